@@ -10,6 +10,12 @@ find_package(tomlplusplus REQUIRED)
 find_package(fmt REQUIRED)
 
 
+#-----------------------------------------------------------------------
+# Threading (e.g. AsyncLogger worker thread)
+
+find_package(Threads REQUIRED)
+
+
 #-----------------------------------------------------------------------
 # URL parsing/construction
 
@@ -17,12 +23,14 @@ find_package(ada REQUIRED)
 
 
 #-----------------------------------------------------------------------
-# Regex
+# Regex (internal tests only)
 
-if (NOT DEFINED PCRE2_USE_STATIC_LIBS)
-    set(PCRE2_USE_STATIC_LIBS ON)
+if (OPENASSETIO_ENABLE_TESTS)
+    if (NOT DEFINED PCRE2_USE_STATIC_LIBS)
+        set(PCRE2_USE_STATIC_LIBS ON)
+    endif ()
+    find_package(PCRE2 REQUIRED COMPONENTS 8BIT)
 endif ()
-find_package(PCRE2 REQUIRED COMPONENTS 8BIT)
 
 
 #-----------------------------------------------------------------------
@@ -80,6 +88,20 @@ if (OPENASSETIO_ENABLE_PYTHON)
     # pybind11 for C++ Python bindings.
     find_package(pybind11 REQUIRED)
 
+    # Free-threaded (no-GIL) Python builds need a pybind11 with
+    # thread-safe internals.
+    execute_process(
+        COMMAND "${Python_EXECUTABLE}" -c
+        "import sysconfig; print(int(bool(sysconfig.get_config_var('Py_GIL_DISABLED'))))"
+        OUTPUT_VARIABLE OPENASSETIO_PYTHON_GIL_DISABLED
+        OUTPUT_STRIP_TRAILING_WHITESPACE
+    )
+    message(TRACE "OPENASSETIO_PYTHON_GIL_DISABLED = ${OPENASSETIO_PYTHON_GIL_DISABLED}")
+    if (OPENASSETIO_PYTHON_GIL_DISABLED AND pybind11_VERSION VERSION_LESS 2.13)
+        message(FATAL_ERROR
+            "Free-threaded Python requires pybind11 2.13 or later, found ${pybind11_VERSION}")
+    endif ()
+
 
     #-------------------------------------------------------------------
     # Locate Python environment
@@ -39,7 +39,7 @@ class OpenAssetIOConan(ConanFile):
         self.requires("tomlplusplus/3.2.0")
         # URL processing
         self.requires("ada/2.7.4")
-        # Regex
+        # Regex (internal tests only)
         self.requires("pcre2/10.42")
         # Test framework
         self.requires("catch2/2.13.8")
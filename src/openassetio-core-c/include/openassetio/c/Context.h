@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/c/export.h>
+
+#include "./namespace.h"
+#include "./trait/TraitsData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_Context oa_Context
+ *
+ * C API for the @fqref{Context} "Context C++ type".
+ *
+ * Contexts are provided to manager plugins by OpenAssetIO, or created
+ * by hosts via @fqcref{hostApi_Manager_createContext}
+ * "hostApi_Manager_createContext", and are read-only from the
+ * perspective of the C API.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_Context_aliases Aliases
+ *
+ * @{
+ */
+#define oa_Context_t OPENASSETIO_NS(Context_t)
+#define oa_Context_h OPENASSETIO_NS(Context_h)
+#define oa_Context_dtor OPENASSETIO_NS(Context_dtor)
+#define oa_Context_locale OPENASSETIO_NS(Context_locale)
+
+/// @}
+// oa_Context_aliases
+
+/**
+ * Opaque handle type representing a shared @fqref{Context} "Context"
+ * instance.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_Context_t* oa_Context_h;
+
+/**
+ * Destructor function.
+ *
+ * Releases a Context handle created by
+ * @fqcref{hostApi_Manager_createContext}
+ * "hostApi_Manager_createContext". Must not be called on handles
+ * provided to manager plugins by OpenAssetIO. The handle should not be
+ * used after calling this function.
+ *
+ * @param handle Opaque handle to Context.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_Context_dtor(oa_Context_h handle);
+
+/**
+ * Retrieve the @fqref{Context.locale} "locale" of the Context.
+ *
+ * The returned handle is owned by the Context, is only valid for as
+ * long as the Context handle is valid, and must not be modified or
+ * destroyed.
+ *
+ * @param handle Opaque handle to Context.
+ * @return Opaque handle to the locale TraitsData.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_trait_TraitsData_h
+oa_Context_locale(oa_Context_h handle);  // noexcept
+
+/// @}
+// oa_Context
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
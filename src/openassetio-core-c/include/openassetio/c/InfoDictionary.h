@@ -52,6 +52,15 @@ extern "C" {
 #define oa_InfoDictionary_setInt OPENASSETIO_NS(InfoDictionary_setInt)
 #define oa_InfoDictionary_setFloat OPENASSETIO_NS(InfoDictionary_setFloat)
 #define oa_InfoDictionary_setStr OPENASSETIO_NS(InfoDictionary_setStr)
+#define oa_InfoDictionary_Entry OPENASSETIO_NS(InfoDictionary_Entry)
+#define oa_InfoDictionary_Iterator_t OPENASSETIO_NS(InfoDictionary_Iterator_t)
+#define oa_InfoDictionary_Iterator_h OPENASSETIO_NS(InfoDictionary_Iterator_h)
+#define oa_InfoDictionary_Iterator_ctor OPENASSETIO_NS(InfoDictionary_Iterator_ctor)
+#define oa_InfoDictionary_Iterator_dtor OPENASSETIO_NS(InfoDictionary_Iterator_dtor)
+#define oa_InfoDictionary_Iterator_next OPENASSETIO_NS(InfoDictionary_Iterator_next)
+#define oa_InfoDictionary_packedSize OPENASSETIO_NS(InfoDictionary_packedSize)
+#define oa_InfoDictionary_exportPacked OPENASSETIO_NS(InfoDictionary_exportPacked)
+#define oa_InfoDictionary_importPacked OPENASSETIO_NS(InfoDictionary_importPacked)
 
 /// @}
 // oa_InfoDictionary_aliases
@@ -273,6 +282,155 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_setStr(oa_StringView* e
 
 /// @}
 // Mutators
+
+/**
+ * @name Iteration
+ *
+ * Functions to visit every entry in a `InfoDictionary`, in an
+ * unspecified order.
+ *
+ * Keys and string values of entries are views on the storage of the
+ * `InfoDictionary`, rather than copies. Both the views and the
+ * iterator itself are invalidated by any modification of the
+ * `InfoDictionary`.
+ *
+ * @{
+ */
+
+/**
+ * An entry of a `InfoDictionary`, as visited by an iterator.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Key of the entry.
+  oa_ConstStringView key;
+  /// Type of the value, determining which member of `value` is set.
+  oa_InfoDictionary_ValueType type;
+  /// Value of the entry.
+  union {
+    /// Value if `type` is `kBool`.
+    bool boolValue;
+    /// Value if `type` is `kInt`.
+    int64_t intValue;
+    /// Value if `type` is `kFloat`.
+    double floatValue;
+    /// Value if `type` is `kStr`.
+    oa_ConstStringView strValue;
+  } value;
+} oa_InfoDictionary_Entry;
+
+/**
+ * Opaque handle type representing an iterator over the entries of a
+ * `InfoDictionary`.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_InfoDictionary_Iterator_t* oa_InfoDictionary_Iterator_h;
+
+/**
+ * Construct an iterator positioned at the first entry of a
+ * `InfoDictionary`.
+ *
+ * The caller is responsible for deallocating via `Iterator_dtor`.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Opaque handle to iterator.
+ * @param handle Opaque handle to InfoDictionary to iterate.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_Iterator_ctor(
+    oa_StringView* error, oa_InfoDictionary_Iterator_h* out, oa_InfoDictionary_h handle);
+
+/**
+ * Destructor function for an iterator.
+ *
+ * @param handle Opaque handle to iterator.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_InfoDictionary_Iterator_dtor(
+    oa_InfoDictionary_Iterator_h handle);
+
+/**
+ * Retrieve the current entry and advance the iterator.
+ *
+ * @param[out] out Storage for the entry, if any.
+ * @param handle Opaque handle to iterator.
+ * @return `true` if an entry was retrieved, `false` if iteration is
+ * complete.
+ */
+OPENASSETIO_CORE_C_EXPORT bool oa_InfoDictionary_Iterator_next(
+    oa_InfoDictionary_Entry* out, oa_InfoDictionary_Iterator_h handle);  // noexcept
+
+/// @}
+// Iteration
+
+/**
+ * @name Bulk copy
+ *
+ * Functions to copy an entire `InfoDictionary` to or from a single
+ * contiguous buffer, such that a dictionary can be exchanged in one
+ * call rather than one call per entry.
+ *
+ * The packed format is intended for exchange within a process only,
+ * and uses native byte order with no alignment padding:
+ *
+ * - `uint64_t` number of entries, followed by, for each entry:
+ *   - `uint8_t` @ref oa_InfoDictionary_ValueType "value type".
+ *   - `uint64_t` key size, followed by the key's bytes.
+ *   - The value: `uint8_t` (0 or 1) for booleans, `int64_t` for
+ *     integers, `double` for floats, or a `uint64_t` size followed by
+ *     the string's bytes for strings.
+ *
+ * @{
+ */
+
+/**
+ * Calculate the number of bytes required to export a `InfoDictionary`
+ * in packed form.
+ *
+ * @param handle Opaque handle to InfoDictionary.
+ * @return Size of packed representation, in bytes.
+ */
+OPENASSETIO_CORE_C_EXPORT size_t
+oa_InfoDictionary_packedSize(oa_InfoDictionary_h handle);  // noexcept
+
+/**
+ * Serialise all entries of a `InfoDictionary` into a caller-provided
+ * buffer.
+ *
+ * If the buffer has insufficient capacity (see
+ * @fqcref{InfoDictionary_packedSize} "packedSize") then nothing is
+ * written and a @fqcref{ErrorCode_kLengthError} "kLengthError" error
+ * code is returned.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Buffer to write to.
+ * @param handle Opaque handle to InfoDictionary.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_exportPacked(oa_StringView* error,
+                                                                      oa_StringView* out,
+                                                                      oa_InfoDictionary_h handle);
+
+/**
+ * Deserialise entries from a packed buffer into a `InfoDictionary`.
+ *
+ * Entries are merged into the `InfoDictionary`, overwriting any
+ * existing entries with the same key.
+ *
+ * If the buffer is malformed then a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code is returned
+ * and the `InfoDictionary` is left unmodified.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to InfoDictionary.
+ * @param packed Buffer to read from.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_InfoDictionary_importPacked(oa_StringView* error,
+                                                                      oa_InfoDictionary_h handle,
+                                                                      oa_ConstStringView packed);
+
+/// @}
+// Bulk copy
 /// @}
 // oa_InfoDictionary
 /// @}
@@ -29,6 +29,7 @@ extern "C" {
  */
 #define oa_ConstStringView OPENASSETIO_NS(ConstStringView)
 #define oa_StringView OPENASSETIO_NS(StringView)
+#define oa_ConstStringViewArray OPENASSETIO_NS(ConstStringViewArray)
 
 /// @}
 // oa_StringView_aliases
@@ -122,6 +123,25 @@ typedef struct {
   size_t size;
 } oa_StringView;
 
+/**
+ * Immutable view on a contiguous array of immutable string views.
+ *
+ * Used to pass collections of strings (e.g. entity references or
+ * trait IDs) across the C API in a single call, without copying the
+ * underlying character data.
+ *
+ * As with @fqcref{ConstStringView} "ConstStringView", both the array
+ * and the character buffers it references are expected to remain
+ * valid for at least as long as the `ConstStringViewArray` is in use.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct {
+  /// Immutable array of string views.
+  const oa_ConstStringView* data;
+  /// Number of elements in the array.
+  size_t size;
+} oa_ConstStringViewArray;
+
 /// @}
 // oa_StringView
 /// @}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include "./namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_access oa_access
+ *
+ * C API for the access mode enumerations found in the
+ * @fqref{access} "access" C++ namespace.
+ *
+ * The enum values correspond exactly to those of the equivalent C++
+ * strong enums.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_access_aliases Aliases
+ *
+ * @{
+ */
+#define oa_access_PolicyAccess OPENASSETIO_NS(access_PolicyAccess)
+#define oa_access_PolicyAccess_kRead OPENASSETIO_NS(access_PolicyAccess_kRead)
+#define oa_access_PolicyAccess_kWrite OPENASSETIO_NS(access_PolicyAccess_kWrite)
+#define oa_access_PolicyAccess_kCreateRelated OPENASSETIO_NS(access_PolicyAccess_kCreateRelated)
+#define oa_access_PolicyAccess_kRequired OPENASSETIO_NS(access_PolicyAccess_kRequired)
+#define oa_access_PolicyAccess_kManagerDriven OPENASSETIO_NS(access_PolicyAccess_kManagerDriven)
+#define oa_access_ResolveAccess OPENASSETIO_NS(access_ResolveAccess)
+#define oa_access_ResolveAccess_kRead OPENASSETIO_NS(access_ResolveAccess_kRead)
+#define oa_access_ResolveAccess_kManagerDriven OPENASSETIO_NS(access_ResolveAccess_kManagerDriven)
+#define oa_access_PublishingAccess OPENASSETIO_NS(access_PublishingAccess)
+#define oa_access_PublishingAccess_kWrite OPENASSETIO_NS(access_PublishingAccess_kWrite)
+#define oa_access_PublishingAccess_kCreateRelated \
+  OPENASSETIO_NS(access_PublishingAccess_kCreateRelated)
+
+/// @}
+// oa_access_aliases
+
+/**
+ * C equivalent of @fqref{access.PolicyAccess} "PolicyAccess".
+ */
+// NOLINTNEXTLINE(modernize-use-using,performance-enum-size)
+typedef enum {
+  /// @fqref{access.PolicyAccess.kRead} "kRead"
+  oa_access_PolicyAccess_kRead = 0,
+  /// @fqref{access.PolicyAccess.kWrite} "kWrite"
+  oa_access_PolicyAccess_kWrite = 1,
+  /// @fqref{access.PolicyAccess.kCreateRelated} "kCreateRelated"
+  oa_access_PolicyAccess_kCreateRelated = 2,
+  /// @fqref{access.PolicyAccess.kRequired} "kRequired"
+  oa_access_PolicyAccess_kRequired = 3,
+  /// @fqref{access.PolicyAccess.kManagerDriven} "kManagerDriven"
+  oa_access_PolicyAccess_kManagerDriven = 4
+} oa_access_PolicyAccess;
+
+/**
+ * C equivalent of @fqref{access.ResolveAccess} "ResolveAccess".
+ */
+// NOLINTNEXTLINE(modernize-use-using,performance-enum-size)
+typedef enum {
+  /// @fqref{access.ResolveAccess.kRead} "kRead"
+  oa_access_ResolveAccess_kRead = 0,
+  /// @fqref{access.ResolveAccess.kManagerDriven} "kManagerDriven"
+  oa_access_ResolveAccess_kManagerDriven = 4
+} oa_access_ResolveAccess;
+
+/**
+ * C equivalent of @fqref{access.PublishingAccess} "PublishingAccess".
+ */
+// NOLINTNEXTLINE(modernize-use-using,performance-enum-size)
+typedef enum {
+  /// @fqref{access.PublishingAccess.kWrite} "kWrite"
+  oa_access_PublishingAccess_kWrite = 1,
+  /// @fqref{access.PublishingAccess.kCreateRelated} "kCreateRelated"
+  oa_access_PublishingAccess_kCreateRelated = 2
+} oa_access_PublishingAccess;
+
+/// @}
+// oa_access
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -31,6 +31,21 @@ extern "C" {
 #define oa_ErrorCode_kBadVariantAccess OPENASSETIO_NS(ErrorCode_kBadVariantAccess)
 #define oa_ErrorCode_kOutOfRange OPENASSETIO_NS(ErrorCode_kOutOfRange)
 #define oa_ErrorCode_kLengthError OPENASSETIO_NS(ErrorCode_kLengthError)
+#define oa_ErrorCode_kBatchElementUnknownError OPENASSETIO_NS(ErrorCode_kBatchElementUnknownError)
+#define oa_ErrorCode_kBatchElementInvalidEntityReference \
+  OPENASSETIO_NS(ErrorCode_kBatchElementInvalidEntityReference)
+#define oa_ErrorCode_kBatchElementMalformedEntityReference \
+  OPENASSETIO_NS(ErrorCode_kBatchElementMalformedEntityReference)
+#define oa_ErrorCode_kBatchElementEntityAccessError \
+  OPENASSETIO_NS(ErrorCode_kBatchElementEntityAccessError)
+#define oa_ErrorCode_kBatchElementEntityResolutionError \
+  OPENASSETIO_NS(ErrorCode_kBatchElementEntityResolutionError)
+#define oa_ErrorCode_kBatchElementInvalidPreflightHint \
+  OPENASSETIO_NS(ErrorCode_kBatchElementInvalidPreflightHint)
+#define oa_ErrorCode_kBatchElementInvalidTraitSet \
+  OPENASSETIO_NS(ErrorCode_kBatchElementInvalidTraitSet)
+#define oa_ErrorCode_kBatchElementAuthError OPENASSETIO_NS(ErrorCode_kBatchElementAuthError)
+#define oa_ErrorCode_kBatchElementTimeout OPENASSETIO_NS(ErrorCode_kBatchElementTimeout)
 #define oa_ErrorCode OPENASSETIO_NS(ErrorCode)
 
 /// @}
@@ -49,7 +64,42 @@ typedef enum {
   /// Error code representing a C++ std::out_of_range exception.
   oa_ErrorCode_kOutOfRange,
   /// Error code representing a C++ std::length_error exception.
-  oa_ErrorCode_kLengthError
+  oa_ErrorCode_kLengthError,
+
+  /**
+   * @name Batch element error codes
+   *
+   * Error codes corresponding to those of
+   * @fqref{errors.BatchElementError.ErrorCode} "BatchElementError",
+   * for use when reporting per-element errors for batch operations.
+   *
+   * @{
+   */
+  /// @fqref{errors.BatchElementError.ErrorCode.kUnknown} "kUnknown"
+  oa_ErrorCode_kBatchElementUnknownError = 128,
+  /// @fqref{errors.BatchElementError.ErrorCode.kInvalidEntityReference}
+  /// "kInvalidEntityReference"
+  oa_ErrorCode_kBatchElementInvalidEntityReference,
+  /// @fqref{errors.BatchElementError.ErrorCode.kMalformedEntityReference}
+  /// "kMalformedEntityReference"
+  oa_ErrorCode_kBatchElementMalformedEntityReference,
+  /// @fqref{errors.BatchElementError.ErrorCode.kEntityAccessError}
+  /// "kEntityAccessError"
+  oa_ErrorCode_kBatchElementEntityAccessError,
+  /// @fqref{errors.BatchElementError.ErrorCode.kEntityResolutionError}
+  /// "kEntityResolutionError"
+  oa_ErrorCode_kBatchElementEntityResolutionError,
+  /// @fqref{errors.BatchElementError.ErrorCode.kInvalidPreflightHint}
+  /// "kInvalidPreflightHint"
+  oa_ErrorCode_kBatchElementInvalidPreflightHint,
+  /// @fqref{errors.BatchElementError.ErrorCode.kInvalidTraitSet}
+  /// "kInvalidTraitSet"
+  oa_ErrorCode_kBatchElementInvalidTraitSet,
+  /// @fqref{errors.BatchElementError.ErrorCode.kAuthError} "kAuthError"
+  oa_ErrorCode_kBatchElementAuthError,
+  /// @fqref{errors.BatchElementError.ErrorCode.kTimeout} "kTimeout"
+  oa_ErrorCode_kBatchElementTimeout
+  /// @}
 } oa_ErrorCode;
 
 /// @}
@@ -1,15 +1,21 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stddef.h>   // NOLINT(modernize-deprecated-headers)
+
 #include <openassetio/c/export.h>
 
+#include "../Context.h"
 #include "../InfoDictionary.h"
 #include "../StringView.h"
+#include "../access.h"
 #include "../errors.h"
 #include "../managerApi/HostSession.h"
 #include "../managerApi/ManagerInterface.h"
 #include "../namespace.h"
+#include "../trait/TraitsData.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +46,10 @@ extern "C" {
 #define oa_hostApi_Manager_identifier OPENASSETIO_NS(hostApi_Manager_identifier)
 #define oa_hostApi_Manager_displayName OPENASSETIO_NS(hostApi_Manager_displayName)
 #define oa_hostApi_Manager_info OPENASSETIO_NS(hostApi_Manager_info)
+#define oa_hostApi_Manager_createContext OPENASSETIO_NS(hostApi_Manager_createContext)
+#define oa_hostApi_Manager_managementPolicy OPENASSETIO_NS(hostApi_Manager_managementPolicy)
+#define oa_hostApi_Manager_entityExists OPENASSETIO_NS(hostApi_Manager_entityExists)
+#define oa_hostApi_Manager_resolve OPENASSETIO_NS(hostApi_Manager_resolve)
 
 /// @}
 // oa_hostApi_Manager_aliases
@@ -131,6 +141,130 @@ OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* er
                                                                oa_InfoDictionary_h out,
                                                                oa_hostApi_Manager_h handle);
 
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.createContext} "createContext"
+ * member function.
+ *
+ * The resulting Context should be deallocated by
+ * @fqcref{Context_dtor} "Context_dtor" when no longer in use.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for the new Context handle, if no error
+ * occurred.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_createContext(
+    oa_StringView* err, oa_Context_h* out, oa_hostApi_Manager_h handle);
+
+/**
+ * @name Batch queries
+ *
+ * Batch functions take a packed array of inputs and write results
+ * into caller-provided arrays with the same number of elements, such
+ * that a batch of any size requires only a single call.
+ *
+ * Functions that support per-element errors additionally take an
+ * array of error codes. On return, each element is
+ * @fqcref{ErrorCode_kOK} "kOK" if the corresponding result was set,
+ * or one of the batch element error codes (see @ref oa_ErrorCode)
+ * otherwise. Elements for which the manager provided neither a result
+ * nor an error are reported as
+ * @fqcref{ErrorCode_kBatchElementUnknownError}
+ * "kBatchElementUnknownError".
+ *
+ * These functions also optionally take an array of error message
+ * out-parameters. If provided, each element is populated with the
+ * message of the corresponding element's error, truncated to its
+ * capacity, or left empty if the element has no error message. Pass
+ * `NULL` if messages are not required.
+ *
+ * The function's own return code is only non-OK if the batch as a
+ * whole failed, in which case the output arrays are in an unspecified
+ * state.
+ *
+ * @{
+ */
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.managementPolicy} "managementPolicy"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Array of `numTraitSets` pre-existing TraitsData
+ * handles, each of which will be updated to refer to the policy for
+ * the corresponding trait set.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param traitSets Array of trait sets, each an array of trait IDs.
+ * @param numTraitSets Number of trait sets.
+ * @param policyAccess Intended access.
+ * @param context Opaque handle to the calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_managementPolicy(
+    oa_StringView* err, oa_trait_TraitsData_h* out, oa_hostApi_Manager_h handle,
+    const oa_ConstStringViewArray* traitSets, size_t numTraitSets,
+    oa_access_PolicyAccess policyAccess, oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.entityExists} "entityExists"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Array of `entityReferences.size` elements, to be
+ * populated with whether each entity exists.
+ * @param[out] elementErrors Array of `entityReferences.size`
+ * elements, to be populated with per-element error codes.
+ * @param[out] elementErrorMessages Array of `entityReferences.size`
+ * pre-existing string views, to be populated with per-element error
+ * messages, or `NULL`.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to query.
+ * @param context Opaque handle to the calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_entityExists(
+    oa_StringView* err, bool* out, oa_ErrorCode* elementErrors,
+    oa_StringView* elementErrorMessages, oa_hostApi_Manager_h handle,
+    oa_ConstStringViewArray entityReferences, oa_Context_h context);
+
+/**
+ * C equivalent of the
+ * @fqref{hostApi.Manager.resolve} "resolve"
+ * member function.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Array of `entityReferences.size` pre-existing
+ * TraitsData handles, each of which will be updated to refer to the
+ * resolved data for the corresponding entity, if successful.
+ * @param[out] elementErrors Array of `entityReferences.size`
+ * elements, to be populated with per-element error codes.
+ * @param[out] elementErrorMessages Array of `entityReferences.size`
+ * pre-existing string views, to be populated with per-element error
+ * messages, or `NULL`.
+ * @param handle Opaque handle representing `Manager` instance.
+ * @param entityReferences Entity reference strings to resolve.
+ * @param traitSet Trait IDs of the traits to resolve.
+ * @param resolveAccess Intended access.
+ * @param context Opaque handle to the calling context.
+ * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+ * error code otherwise.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_hostApi_Manager_resolve(
+    oa_StringView* err, oa_trait_TraitsData_h* out, oa_ErrorCode* elementErrors,
+    oa_StringView* elementErrorMessages, oa_hostApi_Manager_h handle,
+    oa_ConstStringViewArray entityReferences,
+    oa_ConstStringViewArray traitSet, oa_access_ResolveAccess resolveAccess,
+    oa_Context_h context);
+
+/// @}
+
 /// @}
 // oa_hostApi_Manager
 /// @}
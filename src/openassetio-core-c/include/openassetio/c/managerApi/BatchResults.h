@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stddef.h>   // NOLINT(modernize-deprecated-headers)
+
+#include <openassetio/c/export.h>
+
+#include "../StringView.h"
+#include "../errors.h"
+#include "../namespace.h"
+#include "../trait/TraitsData.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_managerApi_BatchResults oa_managerApi_BatchResults
+ *
+ * C API for populating the results of a batch operation.
+ *
+ * Rather than invoking a callback per element, C manager plugins
+ * write the results of batch operations (e.g.
+ * @fqcref{managerApi_CManagerInterface_s} "resolve") into a
+ * `BatchResults` instance that is allocated by OpenAssetIO, sized to
+ * the batch, and passed to the suite function. Once the suite
+ * function returns, OpenAssetIO delivers the results to the host.
+ *
+ * Each element of the batch should be given either a value or an
+ * error. Setting a value or error for an element that already has one
+ * replaces it. Elements that are given neither are reported to the
+ * host as a @fqcref{ErrorCode_kBatchElementUnknownError}
+ * "kBatchElementUnknownError", unless documented otherwise for the
+ * particular suite function.
+ *
+ * The type of value expected depends on the operation, and attempting
+ * to set a value of a different type will result in a
+ * @fqcref{ErrorCode_kBadVariantAccess} "kBadVariantAccess" error code.
+ * An index outside of the batch will result in a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_managerApi_BatchResults_aliases Aliases
+ *
+ * @{
+ */
+#define oa_managerApi_BatchResults_t OPENASSETIO_NS(managerApi_BatchResults_t)
+#define oa_managerApi_BatchResults_h OPENASSETIO_NS(managerApi_BatchResults_h)
+#define oa_managerApi_BatchResults_size OPENASSETIO_NS(managerApi_BatchResults_size)
+#define oa_managerApi_BatchResults_setError OPENASSETIO_NS(managerApi_BatchResults_setError)
+#define oa_managerApi_BatchResults_setBools OPENASSETIO_NS(managerApi_BatchResults_setBools)
+#define oa_managerApi_BatchResults_setStrs OPENASSETIO_NS(managerApi_BatchResults_setStrs)
+#define oa_managerApi_BatchResults_traitsData OPENASSETIO_NS(managerApi_BatchResults_traitsData)
+
+/// @}
+// oa_managerApi_BatchResults_aliases
+
+/**
+ * Opaque handle type representing the results of a batch operation.
+ *
+ * Handles are owned by OpenAssetIO and are only valid for the
+ * duration of the suite function call they are provided to.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_managerApi_BatchResults_t* oa_managerApi_BatchResults_h;
+
+/**
+ * Retrieve the number of elements in the batch.
+ *
+ * @param handle Opaque handle to BatchResults.
+ */
+OPENASSETIO_CORE_C_EXPORT size_t
+oa_managerApi_BatchResults_size(oa_managerApi_BatchResults_h handle);  // noexcept
+
+/**
+ * Set an error for an element of the batch.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to BatchResults.
+ * @param index Index of the element in the batch.
+ * @param code One of the batch element error codes, e.g.
+ * @fqcref{ErrorCode_kBatchElementEntityResolutionError}
+ * "kBatchElementEntityResolutionError". Other codes will result in a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code.
+ * @param message Error message.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_managerApi_BatchResults_setError(
+    oa_StringView* error, oa_managerApi_BatchResults_h handle, size_t index, oa_ErrorCode code,
+    oa_ConstStringView message);
+
+/**
+ * Set boolean values for a contiguous range of elements of the batch.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to BatchResults.
+ * @param first Index of the first element in the batch to set.
+ * @param values Array of values.
+ * @param count Number of elements in `values`.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_managerApi_BatchResults_setBools(
+    oa_StringView* error, oa_managerApi_BatchResults_h handle, size_t first, const bool* values,
+    size_t count);
+
+/**
+ * Set string values for a contiguous range of elements of the batch.
+ *
+ * The strings are copied, so need only remain valid for the duration
+ * of the call.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to BatchResults.
+ * @param first Index of the first element in the batch to set.
+ * @param values Array of values.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_managerApi_BatchResults_setStrs(
+    oa_StringView* error, oa_managerApi_BatchResults_h handle, size_t first,
+    oa_ConstStringViewArray values);
+
+/**
+ * Retrieve the TraitsData value for an element of the batch, such that
+ * it can be populated in-place.
+ *
+ * The element is considered to have a value from this point, clearing
+ * any error previously set for the element.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Opaque handle to the element's TraitsData. The
+ * handle is owned by the BatchResults and must not be destroyed.
+ * @param handle Opaque handle to BatchResults.
+ * @param index Index of the element in the batch.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode
+oa_managerApi_BatchResults_traitsData(oa_StringView* error, oa_trait_TraitsData_h* out,
+                                      oa_managerApi_BatchResults_h handle, size_t index);
+
+/// @}
+// oa_managerApi_BatchResults
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
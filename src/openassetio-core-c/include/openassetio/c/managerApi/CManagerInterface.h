@@ -1,11 +1,20 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stddef.h>   // NOLINT(modernize-deprecated-headers)
+
+#include "../Context.h"
 #include "../InfoDictionary.h"
 #include "../StringView.h"
+#include "../access.h"
 #include "../errors.h"
 #include "../namespace.h"
+#include "../trait/TraitsData.h"
+#include "./BatchResults.h"
+#include "./HostSession.h"
+#include "./ManagerInterface.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -66,6 +75,21 @@ typedef struct oa_managerApi_CManagerInterface_t* oa_managerApi_CManagerInterfac
  * and are expected to provide the same functionality but as a
  * C-friendly API.
  *
+ * Batch operations receive their inputs as contiguous arrays of views
+ * on data owned by OpenAssetIO, valid only for the duration of the
+ * call. Rather than invoking per-element callbacks, results are
+ * written to a @fqcref{managerApi_BatchResults_h} "BatchResults"
+ * handle, which is delivered to the host once the function returns.
+ * A non-OK error code returned from a batch function is converted to
+ * an exception for the whole batch, so should only be used for errors
+ * that are not specific to an element.
+ *
+ * Function pointers other than `dtor`, `identifier`, `displayName` and
+ * `info` may be `NULL`, in which case the default behaviour of the
+ * @fqref{managerApi.ManagerInterface} "ManagerInterface" base class
+ * is used, and `hasCapability` is assumed to return `false` for all
+ * capabilities.
+ *
  * @see @fqcref{managerApi_CManagerInterface_h}
  */
 // NOLINTNEXTLINE(modernize-use-using)
@@ -132,6 +156,192 @@ typedef struct {
    */
   oa_ErrorCode (*info)(oa_StringView* err, oa_InfoDictionary_h out,
                        oa_managerApi_CManagerInterface_h handle);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.hasCapability} "hasCapability"
+   * member function.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] out Storage for whether the capability is supported.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param capability Capability to query.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*hasCapability)(oa_StringView* err, bool* out,
+                                oa_managerApi_CManagerInterface_h handle,
+                                oa_managerApi_ManagerInterface_Capability capability);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.initialize} "initialize"
+   * member function.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param managerSettings Settings to initialize with.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*initialize)(oa_StringView* err, oa_managerApi_CManagerInterface_h handle,
+                             oa_InfoDictionary_h managerSettings,
+                             oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.managementPolicy}
+   * "managementPolicy" member function.
+   *
+   * Results are @fqcref{trait_TraitsData_h} "TraitsData" values, one
+   * per trait set. Elements without a value are treated as unmanaged
+   * (i.e. an empty TraitsData). Per-element errors are not supported,
+   * and will result in an exception.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] results Storage for a policy per trait set.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param traitSets Array of trait sets, each an array of trait IDs.
+   * @param numTraitSets Number of elements in `traitSets`.
+   * @param policyAccess Intended access.
+   * @param context Opaque handle to the calling context.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*managementPolicy)(oa_StringView* err, oa_managerApi_BatchResults_h results,
+                                   oa_managerApi_CManagerInterface_h handle,
+                                   const oa_ConstStringViewArray* traitSets, size_t numTraitSets,
+                                   oa_access_PolicyAccess policyAccess, oa_Context_h context,
+                                   oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.isEntityReferenceString}
+   * "isEntityReferenceString" member function.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] out Storage for whether the string is an entity
+   * reference.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param someString String to check.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*isEntityReferenceString)(oa_StringView* err, bool* out,
+                                          oa_managerApi_CManagerInterface_h handle,
+                                          oa_ConstStringView someString,
+                                          oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.entityExists} "entityExists"
+   * member function.
+   *
+   * Results are boolean values, one per entity reference.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] results Storage for per-element results and errors.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to query.
+   * @param context Opaque handle to the calling context.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*entityExists)(oa_StringView* err, oa_managerApi_BatchResults_h results,
+                               oa_managerApi_CManagerInterface_h handle,
+                               oa_ConstStringViewArray entityReferences, oa_Context_h context,
+                               oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.resolve} "resolve"
+   * member function.
+   *
+   * Results are @fqcref{trait_TraitsData_h} "TraitsData" values, one
+   * per entity reference.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] results Storage for per-element results and errors.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to resolve.
+   * @param traitSet Trait IDs of the traits to resolve.
+   * @param resolveAccess Intended access.
+   * @param context Opaque handle to the calling context.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*resolve)(oa_StringView* err, oa_managerApi_BatchResults_h results,
+                          oa_managerApi_CManagerInterface_h handle,
+                          oa_ConstStringViewArray entityReferences,
+                          oa_ConstStringViewArray traitSet, oa_access_ResolveAccess resolveAccess,
+                          oa_Context_h context, oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.preflight} "preflight"
+   * member function.
+   *
+   * Results are entity reference strings, one per input entity
+   * reference.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] results Storage for per-element results and errors.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to preflight.
+   * @param traitsDatas Array of read-only TraitsData hints, with the
+   * same number of elements as `entityReferences`.
+   * @param publishingAccess Intended access.
+   * @param context Opaque handle to the calling context.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*preflight)(oa_StringView* err, oa_managerApi_BatchResults_h results,
+                            oa_managerApi_CManagerInterface_h handle,
+                            oa_ConstStringViewArray entityReferences,
+                            const oa_trait_TraitsData_h* traitsDatas,
+                            oa_access_PublishingAccess publishingAccess, oa_Context_h context,
+                            oa_managerApi_SharedHostSession_h hostSession);
+
+  /**
+   * C equivalent of the
+   * @fqref{managerApi.ManagerInterface.register_} "register"
+   * member function.
+   *
+   * Results are entity reference strings, one per input entity
+   * reference.
+   *
+   * @param[out] err Storage for error message, if any.
+   * @param[out] results Storage for per-element results and errors.
+   * @param handle Opaque handle representing `ManagerInterface`
+   * instance.
+   * @param entityReferences Entity references to register to.
+   * @param traitsDatas Array of read-only TraitsData to register,
+   * with the same number of elements as `entityReferences`.
+   * @param publishingAccess Intended access.
+   * @param context Opaque handle to the calling context.
+   * @param hostSession Opaque handle to the host session.
+   * @return @fqcref{ErrorCode_kOK} "kOK" if no error occurred, an
+   * error code otherwise.
+   */
+  oa_ErrorCode (*register_)(oa_StringView* err, oa_managerApi_BatchResults_h results,
+                            oa_managerApi_CManagerInterface_h handle,
+                            oa_ConstStringViewArray entityReferences,
+                            const oa_trait_TraitsData_h* traitsDatas,
+                            oa_access_PublishingAccess publishingAccess, oa_Context_h context,
+                            oa_managerApi_SharedHostSession_h hostSession);
 } oa_managerApi_CManagerInterface_s;
 
 /// @}
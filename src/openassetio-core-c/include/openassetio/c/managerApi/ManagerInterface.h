@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
 #include "../namespace.h"
@@ -28,6 +28,28 @@ extern "C" {
  */
 #define oa_managerApi_SharedManagerInterface_t OPENASSETIO_NS(managerApi_SharedManagerInterface_t)
 #define oa_managerApi_SharedManagerInterface_h OPENASSETIO_NS(managerApi_SharedManagerInterface_h)
+#define oa_managerApi_ManagerInterface_Capability \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability)
+#define oa_managerApi_ManagerInterface_Capability_kEntityReferenceIdentification \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kEntityReferenceIdentification)
+#define oa_managerApi_ManagerInterface_Capability_kManagementPolicyQueries \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kManagementPolicyQueries)
+#define oa_managerApi_ManagerInterface_Capability_kStatefulContexts \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kStatefulContexts)
+#define oa_managerApi_ManagerInterface_Capability_kCustomTerminology \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kCustomTerminology)
+#define oa_managerApi_ManagerInterface_Capability_kResolution \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kResolution)
+#define oa_managerApi_ManagerInterface_Capability_kPublishing \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kPublishing)
+#define oa_managerApi_ManagerInterface_Capability_kRelationshipQueries \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kRelationshipQueries)
+#define oa_managerApi_ManagerInterface_Capability_kExistenceQueries \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kExistenceQueries)
+#define oa_managerApi_ManagerInterface_Capability_kDefaultEntityReferences \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kDefaultEntityReferences)
+#define oa_managerApi_ManagerInterface_Capability_kEntityTraitIntrospection \
+  OPENASSETIO_NS(managerApi_ManagerInterface_Capability_kEntityTraitIntrospection)
 
 /// @}
 // oa_managerApi_SharedManagerInterface_aliases
@@ -39,6 +61,36 @@ extern "C" {
 // NOLINTNEXTLINE(modernize-use-using)
 typedef struct oa_managerApi_SharedManagerInterface_t* oa_managerApi_SharedManagerInterface_h;
 
+/**
+ * C equivalent of @fqref{managerApi.ManagerInterface.Capability}
+ * "ManagerInterface::Capability".
+ *
+ * The enum values correspond exactly to those of the C++ strong enum.
+ */
+// NOLINTNEXTLINE(modernize-use-using,performance-enum-size)
+typedef enum {
+  /// @fqref{managerApi.ManagerInterface.Capability.kEntityReferenceIdentification}
+  oa_managerApi_ManagerInterface_Capability_kEntityReferenceIdentification = 0,
+  /// @fqref{managerApi.ManagerInterface.Capability.kManagementPolicyQueries}
+  oa_managerApi_ManagerInterface_Capability_kManagementPolicyQueries = 1,
+  /// @fqref{managerApi.ManagerInterface.Capability.kStatefulContexts}
+  oa_managerApi_ManagerInterface_Capability_kStatefulContexts = 2,
+  /// @fqref{managerApi.ManagerInterface.Capability.kCustomTerminology}
+  oa_managerApi_ManagerInterface_Capability_kCustomTerminology = 3,
+  /// @fqref{managerApi.ManagerInterface.Capability.kResolution}
+  oa_managerApi_ManagerInterface_Capability_kResolution = 4,
+  /// @fqref{managerApi.ManagerInterface.Capability.kPublishing}
+  oa_managerApi_ManagerInterface_Capability_kPublishing = 5,
+  /// @fqref{managerApi.ManagerInterface.Capability.kRelationshipQueries}
+  oa_managerApi_ManagerInterface_Capability_kRelationshipQueries = 6,
+  /// @fqref{managerApi.ManagerInterface.Capability.kExistenceQueries}
+  oa_managerApi_ManagerInterface_Capability_kExistenceQueries = 7,
+  /// @fqref{managerApi.ManagerInterface.Capability.kDefaultEntityReferences}
+  oa_managerApi_ManagerInterface_Capability_kDefaultEntityReferences = 8,
+  /// @fqref{managerApi.ManagerInterface.Capability.kEntityTraitIntrospection}
+  oa_managerApi_ManagerInterface_Capability_kEntityTraitIntrospection = 9
+} oa_managerApi_ManagerInterface_Capability;
+
 /// @}
 // oa_managerApi_SharedManagerInterface
 /// @}
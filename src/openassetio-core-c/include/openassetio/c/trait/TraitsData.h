@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <stdbool.h>  // NOLINT(modernize-deprecated-headers)
+#include <stdint.h>   // NOLINT(modernize-deprecated-headers)
+
+#include <openassetio/c/export.h>
+
+#include "../InfoDictionary.h"
+#include "../StringView.h"
+#include "../errors.h"
+#include "../namespace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/**
+ * @addtogroup CAPI C API
+ * @{
+ */
+
+/**
+ * @defgroup oa_trait_TraitsData oa_trait_TraitsData
+ *
+ * C API for the @fqref{trait.TraitsData} "TraitsData C++ type".
+ *
+ * The set of possible property value types is the same as that of
+ * @fqcref{InfoDictionary} "InfoDictionary", so the
+ * @fqcref{InfoDictionary_ValueType} "InfoDictionary_ValueType"
+ * enumeration is reused here.
+ *
+ * @{
+ */
+
+/**
+ * @defgroup oa_trait_TraitsData_aliases Aliases
+ *
+ * @{
+ */
+#define oa_trait_TraitsData_t OPENASSETIO_NS(trait_TraitsData_t)
+#define oa_trait_TraitsData_h OPENASSETIO_NS(trait_TraitsData_h)
+#define oa_trait_TraitsData_ctor OPENASSETIO_NS(trait_TraitsData_ctor)
+#define oa_trait_TraitsData_dtor OPENASSETIO_NS(trait_TraitsData_dtor)
+#define oa_trait_TraitsData_hasTrait OPENASSETIO_NS(trait_TraitsData_hasTrait)
+#define oa_trait_TraitsData_addTrait OPENASSETIO_NS(trait_TraitsData_addTrait)
+#define oa_trait_TraitsData_typeOfTraitProperty \
+  OPENASSETIO_NS(trait_TraitsData_typeOfTraitProperty)
+#define oa_trait_TraitsData_getTraitPropertyBool \
+  OPENASSETIO_NS(trait_TraitsData_getTraitPropertyBool)
+#define oa_trait_TraitsData_getTraitPropertyInt \
+  OPENASSETIO_NS(trait_TraitsData_getTraitPropertyInt)
+#define oa_trait_TraitsData_getTraitPropertyFloat \
+  OPENASSETIO_NS(trait_TraitsData_getTraitPropertyFloat)
+#define oa_trait_TraitsData_getTraitPropertyStr \
+  OPENASSETIO_NS(trait_TraitsData_getTraitPropertyStr)
+#define oa_trait_TraitsData_setTraitPropertyBool \
+  OPENASSETIO_NS(trait_TraitsData_setTraitPropertyBool)
+#define oa_trait_TraitsData_setTraitPropertyInt \
+  OPENASSETIO_NS(trait_TraitsData_setTraitPropertyInt)
+#define oa_trait_TraitsData_setTraitPropertyFloat \
+  OPENASSETIO_NS(trait_TraitsData_setTraitPropertyFloat)
+#define oa_trait_TraitsData_setTraitPropertyStr \
+  OPENASSETIO_NS(trait_TraitsData_setTraitPropertyStr)
+
+/// @}
+// oa_trait_TraitsData_aliases
+
+/**
+ * Opaque handle type representing a shared
+ * @fqref{trait.TraitsData} "TraitsData" instance.
+ */
+// NOLINTNEXTLINE(modernize-use-using)
+typedef struct oa_trait_TraitsData_t* oa_trait_TraitsData_h;
+
+/**
+ * Constructor function.
+ *
+ * The caller is responsible for deallocating via `dtor`.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Opaque handle to TraitsData.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_ctor(oa_StringView* error,
+                                                                oa_trait_TraitsData_h* out);
+
+/**
+ * Destructor function.
+ *
+ * This should be called by the owner of the handle when the handle is
+ * no longer in use. Handles provided by OpenAssetIO, e.g. as arguments
+ * to @fqcref{managerApi_CManagerInterface_s} "CManagerInterface suite"
+ * functions, are owned by OpenAssetIO and must not be destroyed.
+ *
+ * @param handle Opaque handle to TraitsData.
+ */
+OPENASSETIO_CORE_C_EXPORT void oa_trait_TraitsData_dtor(oa_trait_TraitsData_h handle);
+
+/**
+ * Query whether the TraitsData has a given trait.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for result.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_hasTrait(oa_StringView* error,
+                                                                    bool* out,
+                                                                    oa_trait_TraitsData_h handle,
+                                                                    oa_ConstStringView traitId);
+
+/**
+ * Add a trait to the TraitsData, without any properties.
+ *
+ * If the trait already exists, this is a no-op.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to add.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_addTrait(oa_StringView* error,
+                                                                    oa_trait_TraitsData_h handle,
+                                                                    oa_ConstStringView traitId);
+
+/**
+ * Get the type of value stored in a trait property.
+ *
+ * A missing trait or property will result in a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for retrieved type.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_typeOfTraitProperty(
+    oa_StringView* error, oa_InfoDictionary_ValueType* out, oa_trait_TraitsData_h handle,
+    oa_ConstStringView traitId, oa_ConstStringView propertyKey);
+
+/**
+ * @name Accessors
+ *
+ * Functions to retrieve trait property values of a specific type.
+ *
+ * A missing trait or property will result in a
+ * @fqcref{ErrorCode_kOutOfRange} "kOutOfRange" error code.
+ *
+ * Values with the wrong data type will result in a
+ * @fqcref{ErrorCode_kBadVariantAccess} "kBadVariantAccess" error
+ * code.
+ *
+ * @{
+ */
+
+/**
+ * Retrieve a boolean trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for retrieved value.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getTraitPropertyBool(
+    oa_StringView* error, bool* out, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey);
+
+/**
+ * Retrieve an integer trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for retrieved value.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getTraitPropertyInt(
+    oa_StringView* error, int64_t* out, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey);
+
+/**
+ * Retrieve a floating point trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for retrieved value.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getTraitPropertyFloat(
+    oa_StringView* error, double* out, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey);
+
+/**
+ * Retrieve a string trait property value.
+ *
+ * An `out` parameter with insufficient capacity for the string value
+ * will result in truncation of the string as well as a
+ * @fqcref{ErrorCode_kLengthError} "kLengthError" error code.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param[out] out Storage for retrieved value.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_getTraitPropertyStr(
+    oa_StringView* error, oa_StringView* out, oa_trait_TraitsData_h handle,
+    oa_ConstStringView traitId, oa_ConstStringView propertyKey);
+/// @}
+// Accessors
+
+/**
+ * @name Mutators
+ *
+ * Functions to set trait property values of a specific type.
+ *
+ * The trait is added if it is not already present. An existing value
+ * is overwritten, even if the previous value had a different type.
+ *
+ * @{
+ */
+
+/**
+ * Set a boolean trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to mutate.
+ * @param propertyKey Key of property to mutate.
+ * @param value Value to set.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_setTraitPropertyBool(
+    oa_StringView* error, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey, bool value);
+
+/**
+ * Set an integer trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to mutate.
+ * @param propertyKey Key of property to mutate.
+ * @param value Value to set.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_setTraitPropertyInt(
+    oa_StringView* error, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey, int64_t value);
+
+/**
+ * Set a floating point trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to mutate.
+ * @param propertyKey Key of property to mutate.
+ * @param value Value to set.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_setTraitPropertyFloat(
+    oa_StringView* error, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey, double value);
+
+/**
+ * Set a string trait property value.
+ *
+ * @param[out] error Storage for error message, if any.
+ * @param handle Opaque handle to TraitsData.
+ * @param traitId ID of trait to mutate.
+ * @param propertyKey Key of property to mutate.
+ * @param value Value to set.
+ * @return Error code.
+ */
+OPENASSETIO_CORE_C_EXPORT oa_ErrorCode oa_trait_TraitsData_setTraitPropertyStr(
+    oa_StringView* error, oa_trait_TraitsData_h handle, oa_ConstStringView traitId,
+    oa_ConstStringView propertyKey, oa_ConstStringView value);
+/// @}
+// Mutators
+
+/// @}
+// oa_trait_TraitsData
+/// @}
+// CAPI
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/c/Context.h>
+#include <openassetio/c/trait/TraitsData.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "handles/Context.hpp"
+#include "handles/trait/TraitsData.hpp"
+
+namespace handles = openassetio::handles;
+
+extern "C" {
+
+void oa_Context_dtor(oa_Context_h handle) { delete handles::SharedContext::toInstance(handle); }
+
+oa_trait_TraitsData_h oa_Context_locale(oa_Context_h handle) {
+  const openassetio::ContextConstPtr &context = *handles::SharedContext::toInstance(handle);
+  // The C API has no notion of const handles, so read-only access is
+  // by contract only.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return handles::trait::SharedTraitsData::toHandle(
+      const_cast<openassetio::trait::TraitsDataPtr *>(&context->locale));
+}
+}  // extern "C"
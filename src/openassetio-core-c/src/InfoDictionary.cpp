@@ -1,9 +1,13 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
@@ -112,6 +116,136 @@ oa_ErrorCode set(oa_StringView *err, oa_InfoDictionary_h handle, const oa_ConstS
     return oa_ErrorCode_kOK;
   });
 }
+
+/**
+ * Size of a packed representation of a value, in bytes.
+ *
+ * See the C API documentation for details of the packed format.
+ */
+std::size_t packedSize(const openassetio::Str &str) { return sizeof(std::uint64_t) + str.size(); }
+
+std::size_t packedSize(const openassetio::InfoDictionaryValue &value) {
+  return std::visit(
+      [](const auto &alternative) -> std::size_t {
+        using ValueType = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+          return sizeof(std::uint8_t);
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
+          return packedSize(alternative);
+        } else {
+          return sizeof(ValueType);
+        }
+      },
+      value);
+}
+
+/**
+ * Writer for the packed representation of a InfoDictionary.
+ *
+ * Assumes the destination has sufficient capacity.
+ */
+class PackedWriter {
+ public:
+  explicit PackedWriter(char *cursor) : cursor_{cursor} {}
+
+  template <class Type>
+  void write(const Type value) {
+    std::memcpy(cursor_, &value, sizeof(Type));
+    cursor_ += sizeof(Type);
+  }
+
+  void write(const openassetio::Str &str) {
+    write(static_cast<std::uint64_t>(str.size()));
+    std::memcpy(cursor_, str.data(), str.size());
+    cursor_ += str.size();
+  }
+
+  void write(const openassetio::InfoDictionaryValue &value) {
+    std::visit(
+        [this](const auto &alternative) {
+          using ValueType = std::decay_t<decltype(alternative)>;
+          if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+            write(static_cast<std::uint8_t>(alternative));
+          } else {
+            write(alternative);
+          }
+        },
+        value);
+  }
+
+ private:
+  char *cursor_;
+};
+
+/**
+ * Reader for the packed representation of a InfoDictionary.
+ *
+ * Each read returns `false` if the remaining input is too short.
+ */
+class PackedReader {
+ public:
+  explicit PackedReader(const oa_ConstStringView packed)
+      : cursor_{packed.data}, end_{packed.data + packed.size} {}
+
+  template <class Type>
+  bool read(Type *out) {
+    if (remaining() < sizeof(Type)) {
+      return false;
+    }
+    std::memcpy(out, cursor_, sizeof(Type));
+    cursor_ += sizeof(Type);
+    return true;
+  }
+
+  bool read(openassetio::Str *out) {
+    std::uint64_t size = 0;
+    if (!read(&size) || remaining() < size) {
+      return false;
+    }
+    out->assign(cursor_, static_cast<std::size_t>(size));
+    cursor_ += size;
+    return true;
+  }
+
+  bool read(const std::uint8_t type, openassetio::InfoDictionaryValue *out) {
+    switch (type) {
+      case oa_InfoDictionary_ValueType_kBool: {
+        std::uint8_t value = 0;
+        if (!read(&value) || value > 1) {
+          return false;
+        }
+        *out = value != 0;
+        return true;
+      }
+      case oa_InfoDictionary_ValueType_kInt:
+        return read(&out->emplace<openassetio::Int>());
+      case oa_InfoDictionary_ValueType_kFloat:
+        return read(&out->emplace<openassetio::Float>());
+      case oa_InfoDictionary_ValueType_kStr:
+        return read(&out->emplace<openassetio::Str>());
+      default:
+        return false;
+    }
+  }
+
+  [[nodiscard]] bool atEnd() const { return cursor_ == end_; }
+
+ private:
+  [[nodiscard]] std::size_t remaining() const { return static_cast<std::size_t>(end_ - cursor_); }
+
+  const char *cursor_;
+  const char *end_;
+};
+
+/// Type tag of a value in the packed representation.
+std::uint8_t packedTypeOf(const openassetio::InfoDictionaryValue &value) {
+  // Variant alternatives are in the same order as the C enum.
+  return static_cast<std::uint8_t>(value.index() + oa_InfoDictionary_ValueType_kBool);
+}
+static_assert(std::is_same_v<std::variant_alternative_t<oa_InfoDictionary_ValueType_kStr -
+                                                            oa_InfoDictionary_ValueType_kBool,
+                                                        openassetio::InfoDictionaryValue>,
+                             openassetio::Str>);
 }  // namespace
 
 extern "C" {
@@ -216,4 +350,122 @@ oa_ErrorCode oa_InfoDictionary_setStr(oa_StringView *error, oa_InfoDictionary_h
     return oa_ErrorCode_kOK;
   });
 }
+
+oa_ErrorCode oa_InfoDictionary_Iterator_ctor(oa_StringView *error,
+                                             oa_InfoDictionary_Iterator_h *out,
+                                             oa_InfoDictionary_h handle) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+    *out = handles::InfoDictionaryIterator::toHandle(new handles::InfoDictionaryIteratorRange{
+        infoDictionary->begin(), infoDictionary->end()});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+void oa_InfoDictionary_Iterator_dtor(oa_InfoDictionary_Iterator_h handle) {
+  delete handles::InfoDictionaryIterator::toInstance(handle);
+}
+
+bool oa_InfoDictionary_Iterator_next(oa_InfoDictionary_Entry *out,
+                                     oa_InfoDictionary_Iterator_h handle) {
+  auto &[current, end] = *handles::InfoDictionaryIterator::toInstance(handle);
+  if (current == end) {
+    return false;
+  }
+
+  const auto &[key, value] = *current;
+  out->key = {key.data(), key.size()};
+  out->type = static_cast<oa_InfoDictionary_ValueType>(packedTypeOf(value));
+  std::visit(
+      [out](const auto &alternative) {
+        using ValueType = std::decay_t<decltype(alternative)>;
+        if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+          out->value.boolValue = alternative;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Int>) {
+          out->value.intValue = alternative;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Float>) {
+          out->value.floatValue = alternative;
+        } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
+          out->value.strValue = {alternative.data(), alternative.size()};
+        } else {
+          static_assert(kAlwaysFalse<ValueType>, "Unhandled variant type");
+        }
+      },
+      value);
+
+  ++current;
+  return true;
+}
+
+std::size_t oa_InfoDictionary_packedSize(oa_InfoDictionary_h handle) {
+  const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+
+  std::size_t size = sizeof(std::uint64_t);
+  for (const auto &[key, value] : *infoDictionary) {
+    size += sizeof(std::uint8_t) + packedSize(key) + packedSize(value);
+  }
+  return size;
+}
+
+oa_ErrorCode oa_InfoDictionary_exportPacked(oa_StringView *error, oa_StringView *out,
+                                            oa_InfoDictionary_h handle) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    const InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+
+    const std::size_t size = oa_InfoDictionary_packedSize(handle);
+    if (size > out->capacity) {
+      openassetio::assignStringView(error, "Insufficient storage for return value");
+      return oa_ErrorCode_kLengthError;
+    }
+
+    PackedWriter writer{out->data};
+    writer.write(static_cast<std::uint64_t>(infoDictionary->size()));
+    for (const auto &[key, value] : *infoDictionary) {
+      writer.write(packedTypeOf(value));
+      writer.write(key);
+      writer.write(value);
+    }
+    out->size = size;
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_InfoDictionary_importPacked(oa_StringView *error, oa_InfoDictionary_h handle,
+                                            const oa_ConstStringView packed) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    InfoDictionary *infoDictionary = handles::InfoDictionary::toInstance(handle);
+
+    const auto malformed = [&] {
+      openassetio::assignStringView(error, "Malformed packed InfoDictionary");
+      return oa_ErrorCode_kOutOfRange;
+    };
+
+    PackedReader reader{packed};
+    std::uint64_t numEntries = 0;
+    if (!reader.read(&numEntries)) {
+      return malformed();
+    }
+
+    // Decode fully before modifying the target, so that it is left
+    // untouched if the input is malformed.
+    std::vector<std::pair<openassetio::Str, openassetio::InfoDictionaryValue>> entries;
+    for (std::uint64_t idx = 0; idx < numEntries; ++idx) {
+      std::uint8_t type = 0;
+      auto &[key, value] = entries.emplace_back();
+      if (!reader.read(&type) || !reader.read(&key) || !reader.read(type, &value)) {
+        return malformed();
+      }
+    }
+    if (!reader.atEnd()) {
+      return malformed();
+    }
+
+    for (auto &[key, value] : entries) {
+      infoDictionary->insert_or_assign(std::move(key), std::move(value));
+    }
+
+    return oa_ErrorCode_kOK;
+  });
+}
 }  // extern "C"
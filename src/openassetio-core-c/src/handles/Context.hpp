@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/c/Context.h>
+#include <openassetio/export.h>
+
+#include <openassetio/Context.hpp>
+
+#include "Converter.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles {
+using SharedContext = Converter<ContextConstPtr, oa_Context_h>;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,7 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <utility>
+
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/export.h>
 
@@ -13,6 +15,12 @@ namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace handles {
 using InfoDictionary = Converter<InfoDictionary, oa_InfoDictionary_h>;
-}
+/// Current position and end of an iteration over a InfoDictionary.
+using InfoDictionaryIteratorRange =
+    std::pair<openassetio::InfoDictionary::const_iterator,
+              openassetio::InfoDictionary::const_iterator>;
+using InfoDictionaryIterator =
+    Converter<InfoDictionaryIteratorRange, oa_InfoDictionary_Iterator_h>;
+}  // namespace handles
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
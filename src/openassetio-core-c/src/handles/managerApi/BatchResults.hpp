@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <openassetio/c/managerApi/BatchResults.h>
+#include <openassetio/export.h>
+
+#include "../../managerApi/BatchResults.hpp"
+#include "../Converter.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace handles::managerApi {
+using BatchResults =
+    Converter<openassetio::managerApi::BatchResults, oa_managerApi_BatchResults_h>;
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,27 +1,102 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <openassetio/c/Context.h>
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
+#include <openassetio/c/access.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/HostSession.h>
 #include <openassetio/c/managerApi/ManagerInterface.h>
+#include <openassetio/c/trait/TraitsData.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
 
 #include "../StringView.hpp"
 #include "../errors.hpp"
+#include "../handles/Context.hpp"
 #include "../handles/InfoDictionary.hpp"
 #include "../handles/hostApi/Manager.hpp"
 #include "../handles/managerApi/HostSession.hpp"
 #include "../handles/managerApi/ManagerInterface.hpp"
+#include "../handles/trait/TraitsData.hpp"
 
+namespace access = openassetio::access;
 namespace errors = openassetio::errors;
 namespace handles = openassetio::handles;
 namespace hostApi = openassetio::hostApi;
 namespace managerApi = openassetio::managerApi;
+namespace trait = openassetio::trait;
+
+namespace {
+/// Construct entity references from a batch of strings.
+openassetio::EntityReferences toEntityReferences(const oa_ConstStringViewArray views) {
+  openassetio::EntityReferences entityReferences;
+  entityReferences.reserve(views.size);
+  for (std::size_t idx = 0; idx < views.size; ++idx) {
+    entityReferences.emplace_back(openassetio::Str{views.data[idx].data, views.data[idx].size});
+  }
+  return entityReferences;
+}
+
+/// Construct a trait set from a batch of trait ID strings.
+trait::TraitSet toTraitSet(const oa_ConstStringViewArray views) {
+  trait::TraitSet traitSet;
+  for (std::size_t idx = 0; idx < views.size; ++idx) {
+    traitSet.emplace(views.data[idx].data, views.data[idx].size);
+  }
+  return traitSet;
+}
+
+/**
+ * Convert a batch element error to its C error code.
+ *
+ * C and C++ error code values are kept in sync, see
+ * managerApi/BatchResults.cpp.
+ */
+oa_ErrorCode toErrorCode(const errors::BatchElementError& error) {
+  return static_cast<oa_ErrorCode>(error.code);
+}
+
+/**
+ * Record a batch element error in the caller's per-element arrays.
+ *
+ * Messages are only recorded if the caller provided storage for them.
+ */
+void setElementError(oa_ErrorCode* elementErrors, oa_StringView* elementErrorMessages,
+                     const std::size_t idx, const errors::BatchElementError& error) {
+  elementErrors[idx] = toErrorCode(error);
+  if (elementErrorMessages) {
+    openassetio::assignStringView(&elementErrorMessages[idx], error.message);
+  }
+}
+
+/**
+ * Initialise the caller's per-element arrays, such that elements the
+ * manager doesn't report are flagged as unknown errors.
+ */
+void resetElementErrors(oa_ErrorCode* elementErrors, oa_StringView* elementErrorMessages,
+                        const std::size_t size) {
+  std::fill_n(elementErrors, size, oa_ErrorCode_kBatchElementUnknownError);
+  if (elementErrorMessages) {
+    std::for_each(elementErrorMessages, elementErrorMessages + size,
+                  [](oa_StringView& message) { message.size = 0; });
+  }
+}
+}  // namespace
 
 extern "C" {
 
@@ -78,4 +153,96 @@ oa_ErrorCode oa_hostApi_Manager_info(oa_StringView* err, oa_InfoDictionary_h out
     return oa_ErrorCode_kOK;
   });
 }
+
+oa_ErrorCode oa_hostApi_Manager_createContext(oa_StringView* err, oa_Context_h* out,
+                                              oa_hostApi_Manager_h handle) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr& manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    auto* context = new openassetio::ContextConstPtr{manager->createContext()};
+    *out = handles::SharedContext::toHandle(context);
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_managementPolicy(oa_StringView* err, oa_trait_TraitsData_h* out,
+                                                 oa_hostApi_Manager_h handle,
+                                                 const oa_ConstStringViewArray* traitSets,
+                                                 const std::size_t numTraitSets,
+                                                 const oa_access_PolicyAccess policyAccess,
+                                                 oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr& manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    trait::TraitSets cppTraitSets;
+    cppTraitSets.reserve(numTraitSets);
+    std::transform(traitSets, traitSets + numTraitSets, std::back_inserter(cppTraitSets),
+                   toTraitSet);
+
+    trait::TraitsDatas policies =
+        manager->managementPolicy(cppTraitSets, static_cast<access::PolicyAccess>(policyAccess),
+                                  *handles::SharedContext::toInstance(context));
+
+    for (std::size_t idx = 0; idx < policies.size(); ++idx) {
+      *handles::trait::SharedTraitsData::toInstance(out[idx]) = std::move(policies[idx]);
+    }
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_entityExists(oa_StringView* err, bool* out,
+                                             oa_ErrorCode* elementErrors,
+                                             oa_StringView* elementErrorMessages,
+                                             oa_hostApi_Manager_h handle,
+                                             const oa_ConstStringViewArray entityReferences,
+                                             oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr& manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    resetElementErrors(elementErrors, elementErrorMessages, entityReferences.size);
+
+    manager->entityExists(
+        toEntityReferences(entityReferences), *handles::SharedContext::toInstance(context),
+        [&](const std::size_t idx, const bool exists) {
+          out[idx] = exists;
+          elementErrors[idx] = oa_ErrorCode_kOK;
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          setElementError(elementErrors, elementErrorMessages, idx, error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_hostApi_Manager_resolve(oa_StringView* err, oa_trait_TraitsData_h* out,
+                                        oa_ErrorCode* elementErrors,
+                                        oa_StringView* elementErrorMessages,
+                                        oa_hostApi_Manager_h handle,
+                                        const oa_ConstStringViewArray entityReferences,
+                                        const oa_ConstStringViewArray traitSet,
+                                        const oa_access_ResolveAccess resolveAccess,
+                                        oa_Context_h context) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    const hostApi::ManagerPtr& manager = *handles::hostApi::SharedManager::toInstance(handle);
+
+    resetElementErrors(elementErrors, elementErrorMessages, entityReferences.size);
+
+    manager->resolve(
+        toEntityReferences(entityReferences), toTraitSet(traitSet),
+        static_cast<access::ResolveAccess>(resolveAccess),
+        *handles::SharedContext::toInstance(context),
+        [&](const std::size_t idx, trait::TraitsDataPtr traitsData) {
+          *handles::trait::SharedTraitsData::toInstance(out[idx]) = std::move(traitsData);
+          elementErrors[idx] = oa_ErrorCode_kOK;
+        },
+        [&](const std::size_t idx, const errors::BatchElementError& error) {
+          setElementError(elementErrors, elementErrorMessages, idx, error);
+        });
+
+    return oa_ErrorCode_kOK;
+  });
+}
 }  // extern "C"
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "BatchResults.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/BatchResults.h>
+#include <openassetio/c/trait/TraitsData.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/internal.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+#include "../StringView.hpp"
+#include "../errors.hpp"
+#include "../handles/managerApi/BatchResults.hpp"
+#include "../handles/trait/TraitsData.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+
+BatchResults::BatchResults(const std::size_t size, const ValueType valueType)
+    : valueType_{valueType}, statuses_(size, Status::kUnset) {
+  switch (valueType_) {
+    case ValueType::kBool:
+      bools_.resize(size);
+      break;
+    case ValueType::kStr:
+      strs_.resize(size);
+      break;
+    case ValueType::kTraitsData:
+      traitsDatas_.resize(size);
+      break;
+  }
+}
+
+bool BatchResults::isValidRange(const std::size_t first, const std::size_t count) const {
+  return first <= size() && count <= size() - first;
+}
+
+void BatchResults::setError(const std::size_t index, errors::BatchElementError error) {
+  if (errors_.empty()) {
+    errors_.resize(size());
+  }
+  errors_[index] = std::move(error);
+  statuses_[index] = Status::kError;
+}
+
+void BatchResults::setBools(const std::size_t first, const bool* values,
+                            const std::size_t count) {
+  std::copy(values, values + count, bools_.begin() + static_cast<std::ptrdiff_t>(first));
+  std::fill_n(statuses_.begin() + static_cast<std::ptrdiff_t>(first), count, Status::kValue);
+}
+
+void BatchResults::setStrs(const std::size_t first, const oa_ConstStringViewArray values) {
+  for (std::size_t idx = 0; idx < values.size; ++idx) {
+    strs_[first + idx].assign(values.data[idx].data, values.data[idx].size);
+  }
+  std::fill_n(statuses_.begin() + static_cast<std::ptrdiff_t>(first), values.size,
+              Status::kValue);
+}
+
+trait::TraitsDataPtr& BatchResults::traitsData(const std::size_t index) {
+  trait::TraitsDataPtr& traitsData = traitsDatas_[index];
+  if (!traitsData) {
+    traitsData = trait::TraitsData::make();
+  }
+  statuses_[index] = Status::kValue;
+  return traitsData;
+}
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+namespace errors = openassetio::errors;
+namespace handles = openassetio::handles;
+using openassetio::managerApi::BatchResults;
+
+namespace {
+namespace internalErrors = openassetio::internal::errors;
+// Error codes must match the C++ BatchElementError::ErrorCode values.
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementUnknownError) ==
+              internalErrors::kBatchElementUnknownError);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementInvalidEntityReference) ==
+              internalErrors::kBatchElementInvalidEntityReference);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementMalformedEntityReference) ==
+              internalErrors::kBatchElementMalformedEntityReference);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementEntityAccessError) ==
+              internalErrors::kBatchElementEntityAccessError);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementEntityResolutionError) ==
+              internalErrors::kBatchElementEntityResolutionError);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementInvalidPreflightHint) ==
+              internalErrors::kBatchElementInvalidPreflightHint);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementInvalidTraitSet) ==
+              internalErrors::kBatchElementInvalidTraitSet);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementAuthError) ==
+              internalErrors::kBatchElementAuthError);
+static_assert(static_cast<std::size_t>(oa_ErrorCode_kBatchElementTimeout) ==
+              internalErrors::kBatchElementTimeout);
+
+/**
+ * Validate that a range of elements lies within the batch and that
+ * the batch expects values of the given type.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param results Batch to validate against.
+ * @param first Index of first element.
+ * @param count Number of elements.
+ * @param valueType Type of value to be set.
+ * @return Error code.
+ */
+oa_ErrorCode validate(oa_StringView *err, const BatchResults &results, const std::size_t first,
+                      const std::size_t count, const BatchResults::ValueType valueType) {
+  if (!results.isValidRange(first, count)) {
+    openassetio::assignStringView(err, "Batch index out of range");
+    return oa_ErrorCode_kOutOfRange;
+  }
+  if (results.valueType() != valueType) {
+    openassetio::assignStringView(err, "Invalid value type");
+    return oa_ErrorCode_kBadVariantAccess;
+  }
+  return oa_ErrorCode_kOK;
+}
+}  // namespace
+
+extern "C" {
+
+std::size_t oa_managerApi_BatchResults_size(oa_managerApi_BatchResults_h handle) {
+  return handles::managerApi::BatchResults::toInstance(handle)->size();
+}
+
+oa_ErrorCode oa_managerApi_BatchResults_setError(oa_StringView *error,
+                                                 oa_managerApi_BatchResults_h handle,
+                                                 const std::size_t index, const oa_ErrorCode code,
+                                                 const oa_ConstStringView message) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    BatchResults *results = handles::managerApi::BatchResults::toInstance(handle);
+
+    if (!results->isValidRange(index, 1)) {
+      openassetio::assignStringView(error, "Batch index out of range");
+      return oa_ErrorCode_kOutOfRange;
+    }
+    if (code < oa_ErrorCode_kBatchElementUnknownError ||
+        code > oa_ErrorCode_kBatchElementTimeout) {
+      openassetio::assignStringView(error, "Invalid batch element error code");
+      return oa_ErrorCode_kOutOfRange;
+    }
+
+    results->setError(index, {static_cast<errors::BatchElementError::ErrorCode>(code),
+                              openassetio::Str{message.data, message.size}});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_managerApi_BatchResults_setBools(oa_StringView *error,
+                                                 oa_managerApi_BatchResults_h handle,
+                                                 const std::size_t first, const bool *values,
+                                                 const std::size_t count) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    BatchResults *results = handles::managerApi::BatchResults::toInstance(handle);
+
+    if (const oa_ErrorCode errorCode =
+            validate(error, *results, first, count, BatchResults::ValueType::kBool);
+        errorCode != oa_ErrorCode_kOK) {
+      return errorCode;
+    }
+
+    results->setBools(first, values, count);
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_managerApi_BatchResults_setStrs(oa_StringView *error,
+                                                oa_managerApi_BatchResults_h handle,
+                                                const std::size_t first,
+                                                const oa_ConstStringViewArray values) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    BatchResults *results = handles::managerApi::BatchResults::toInstance(handle);
+
+    if (const oa_ErrorCode errorCode =
+            validate(error, *results, first, values.size, BatchResults::ValueType::kStr);
+        errorCode != oa_ErrorCode_kOK) {
+      return errorCode;
+    }
+
+    results->setStrs(first, values);
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_managerApi_BatchResults_traitsData(oa_StringView *error,
+                                                   oa_trait_TraitsData_h *out,
+                                                   oa_managerApi_BatchResults_h handle,
+                                                   const std::size_t index) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    BatchResults *results = handles::managerApi::BatchResults::toInstance(handle);
+
+    if (const oa_ErrorCode errorCode =
+            validate(error, *results, index, 1, BatchResults::ValueType::kTraitsData);
+        errorCode != oa_ErrorCode_kOK) {
+      return errorCode;
+    }
+
+    *out = handles::trait::SharedTraitsData::toHandle(&results->traitsData(index));
+    return oa_ErrorCode_kOK;
+  });
+}
+}  // extern "C"
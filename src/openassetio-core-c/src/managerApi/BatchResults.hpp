@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <openassetio/c/StringView.h>
+#include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace managerApi {
+
+/**
+ * Storage for the results of a batch operation, populated by a C
+ * manager plugin via the BatchResults C API.
+ *
+ * Each element holds at most one of a value or an error. All storage
+ * is allocated up-front for the size of the batch, so that populating
+ * results is cheap regardless of the order in which elements are set.
+ *
+ * Index validation is the responsibility of the caller, see
+ * `isValidRange`.
+ */
+class BatchResults {
+ public:
+  /// Type of value expected for each element of the batch.
+  enum class ValueType : std::uint8_t { kBool, kStr, kTraitsData };
+
+  /// Current state of an element of the batch.
+  enum class Status : std::uint8_t { kUnset, kValue, kError };
+
+  /**
+   * Construct storage for a batch.
+   *
+   * @param size Number of elements in the batch.
+   * @param valueType Type of value expected for each element.
+   */
+  BatchResults(std::size_t size, ValueType valueType);
+
+  /// Number of elements in the batch.
+  [[nodiscard]] std::size_t size() const { return statuses_.size(); }
+
+  /// Type of value expected for each element of the batch.
+  [[nodiscard]] ValueType valueType() const { return valueType_; }
+
+  /**
+   * Check if a range of elements lies within the batch.
+   *
+   * @param first Index of first element.
+   * @param count Number of elements.
+   * @return Whether the range is valid.
+   */
+  [[nodiscard]] bool isValidRange(std::size_t first, std::size_t count) const;
+
+  /// Current state of an element.
+  [[nodiscard]] Status status(std::size_t index) const { return statuses_[index]; }
+
+  /**
+   * Set an error for an element, replacing any existing value.
+   *
+   * @param index Index of the element.
+   * @param error Error to set.
+   */
+  void setError(std::size_t index, errors::BatchElementError error);
+
+  /**
+   * Set boolean values for a range of elements.
+   *
+   * @param first Index of the first element.
+   * @param values Array of values.
+   * @param count Number of values.
+   */
+  void setBools(std::size_t first, const bool* values, std::size_t count);
+
+  /**
+   * Set string values for a range of elements.
+   *
+   * @param first Index of the first element.
+   * @param values Array of values.
+   */
+  void setStrs(std::size_t first, oa_ConstStringViewArray values);
+
+  /**
+   * Retrieve the TraitsData value of an element, constructing it if
+   * required, and mark the element as having a value.
+   *
+   * @param index Index of the element.
+   * @return TraitsData value.
+   */
+  trait::TraitsDataPtr& traitsData(std::size_t index);
+
+  /// Error of an element with `kError` status.
+  [[nodiscard]] const errors::BatchElementError& error(std::size_t index) const {
+    return errors_[index];
+  }
+
+  /// Boolean value of an element with `kValue` status.
+  [[nodiscard]] bool boolValue(std::size_t index) const { return bools_[index] != 0; }
+
+  /// String value of an element with `kValue` status.
+  [[nodiscard]] Str& strValue(std::size_t index) { return strs_[index]; }
+
+  /// TraitsData value of an element with `kValue` status.
+  [[nodiscard]] const trait::TraitsDataPtr& traitsDataValue(std::size_t index) const {
+    return traitsDatas_[index];
+  }
+
+ private:
+  ValueType valueType_;
+  std::vector<Status> statuses_;
+  // Errors are assumed to be uncommon, so storage is only allocated
+  // on first use.
+  std::vector<errors::BatchElementError> errors_;
+  // Only the storage corresponding to `valueType_` is allocated.
+  // `char` rather than `bool` to avoid the bit-packed specialisation.
+  std::vector<char> bools_;
+  std::vector<Str> strs_;
+  std::vector<trait::TraitsDataPtr> traitsDatas_;
+};
+}  // namespace managerApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -3,22 +3,40 @@
 #include "CManagerInterfaceAdapter.hpp"
 
 #include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include <openassetio/c/Context.h>
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
+#include <openassetio/c/access.h>
 #include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/BatchResults.h>
 #include <openassetio/c/managerApi/CManagerInterface.h>
+#include <openassetio/c/managerApi/HostSession.h>
+#include <openassetio/c/managerApi/ManagerInterface.h>
+#include <openassetio/c/trait/TraitsData.h>
 #include <openassetio/export.h>
+#include <openassetio/Context.hpp>
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
 #include "../errors.hpp"
+#include "../handles/Context.hpp"
 #include "../handles/InfoDictionary.hpp"
+#include "../handles/managerApi/BatchResults.hpp"
+#include "../handles/managerApi/HostSession.hpp"
+#include "../handles/trait/TraitsData.hpp"
+#include "BatchResults.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -26,6 +44,130 @@ namespace managerApi {
 
 constexpr std::size_t kStringBufferSize = 500;
 
+namespace {
+// Enum values must match between the C and C++ APIs.
+static_assert(static_cast<std::size_t>(
+                  oa_managerApi_ManagerInterface_Capability_kEntityTraitIntrospection) ==
+              static_cast<std::size_t>(ManagerInterface::Capability::kEntityTraitIntrospection));
+static_assert(static_cast<std::size_t>(
+                  oa_managerApi_ManagerInterface_Capability_kDefaultEntityReferences) ==
+              static_cast<std::size_t>(ManagerInterface::Capability::kDefaultEntityReferences));
+static_assert(static_cast<std::size_t>(oa_access_PolicyAccess_kManagerDriven) ==
+              static_cast<std::size_t>(access::PolicyAccess::kManagerDriven));
+static_assert(static_cast<std::size_t>(oa_access_ResolveAccess_kManagerDriven) ==
+              static_cast<std::size_t>(access::ResolveAccess::kManagerDriven));
+static_assert(static_cast<std::size_t>(oa_access_PublishingAccess_kCreateRelated) ==
+              static_cast<std::size_t>(access::PublishingAccess::kCreateRelated));
+
+constexpr std::string_view kErrorMissingResult = "No result was provided for this element";
+
+/**
+ * Construct views on the strings of a batch of entity references.
+ *
+ * @param entityReferences Entity references to view, which must
+ * outlive the returned views.
+ * @return String views.
+ */
+std::vector<oa_ConstStringView> toStringViews(const EntityReferences& entityReferences) {
+  std::vector<oa_ConstStringView> views;
+  views.reserve(entityReferences.size());
+  for (const EntityReference& entityReference : entityReferences) {
+    const Str& entityReferenceString = entityReference.toString();
+    views.push_back({entityReferenceString.data(), entityReferenceString.size()});
+  }
+  return views;
+}
+
+/**
+ * Append views on the trait IDs of a trait set.
+ *
+ * @param traitSet Trait set to view, which must outlive the views.
+ * @param views Storage to append views to.
+ */
+void appendStringViews(const trait::TraitSet& traitSet, std::vector<oa_ConstStringView>& views) {
+  for (const trait::TraitId& traitId : traitSet) {
+    views.push_back({traitId.data(), traitId.size()});
+  }
+}
+
+/**
+ * Construct a C array view on a vector of string views.
+ *
+ * @param views String views, which must outlive the array view.
+ * @return Array view.
+ */
+oa_ConstStringViewArray toArray(const std::vector<oa_ConstStringView>& views) {
+  return {views.data(), views.size()};
+}
+
+/**
+ * Construct handles to a batch of TraitsData.
+ *
+ * The C API has no notion of const handles, so read-only access is by
+ * contract only.
+ *
+ * @param traitsDatas TraitsData to wrap, which must outlive the
+ * returned handles.
+ * @return Opaque handles.
+ */
+std::vector<oa_trait_TraitsData_h> toHandles(const trait::TraitsDatas& traitsDatas) {
+  std::vector<oa_trait_TraitsData_h> traitsDataHandles;
+  traitsDataHandles.reserve(traitsDatas.size());
+  for (const trait::TraitsDataPtr& traitsData : traitsDatas) {
+    traitsDataHandles.push_back(handles::trait::SharedTraitsData::toHandle(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<trait::TraitsDataPtr*>(&traitsData)));
+  }
+  return traitsDataHandles;
+}
+
+/// Construct a handle to a (read-only) Context.
+oa_Context_h toHandle(const ContextConstPtr& context) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return handles::SharedContext::toHandle(const_cast<ContextConstPtr*>(&context));
+}
+
+/// Construct a handle to a HostSession.
+oa_managerApi_SharedHostSession_h toHandle(const HostSessionPtr& hostSession) {
+  return handles::managerApi::SharedHostSession::toHandle(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      const_cast<HostSessionPtr*>(&hostSession));
+}
+
+/**
+ * Deliver the results of a batch operation to the host, in index
+ * order.
+ *
+ * Elements that were not given a value or error by the manager are
+ * reported as an error.
+ *
+ * @tparam SuccessFn Callable taking the index of an element with a
+ * value.
+ * @param results Populated batch results.
+ * @param successFn Callable to deliver a value.
+ * @param errorCallback Callback to deliver an error.
+ */
+template <class SuccessFn>
+void deliverResults(const BatchResults& results, const SuccessFn& successFn,
+                    const ManagerInterface::BatchElementErrorCallback& errorCallback) {
+  for (std::size_t idx = 0; idx < results.size(); ++idx) {
+    switch (results.status(idx)) {
+      case BatchResults::Status::kValue:
+        successFn(idx);
+        break;
+      case BatchResults::Status::kError:
+        errorCallback(idx, results.error(idx));
+        break;
+      case BatchResults::Status::kUnset:
+        errorCallback(idx, errors::BatchElementError{
+                               errors::BatchElementError::ErrorCode::kUnknown,
+                               Str{kErrorMissingResult}});
+        break;
+    }
+  }
+}
+}  // namespace
+
 CManagerInterfaceAdapter::CManagerInterfaceAdapter(oa_managerApi_CManagerInterface_h handle,
                                                    oa_managerApi_CManagerInterface_s suite)
     : handle_{handle}, suite_{suite} {}
@@ -91,68 +233,295 @@ InfoDictionary CManagerInterfaceAdapter::info() {
   return infoDict;
 }
 
-bool CManagerInterfaceAdapter::hasCapability([[maybe_unused]] Capability capability) {
-  throw errors::NotImplementedException{"Not implemented"};
+bool CManagerInterfaceAdapter::hasCapability(const Capability capability) {
+  // Suite functions other than the basic introspection functions are
+  // optional. An unimplemented capability is, of course, unsupported.
+  if (suite_.hasCapability == nullptr) {
+    return false;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  // Return value.
+  bool out = false;
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.hasCapability(
+      &errorMessage, &out, handle_,
+      static_cast<oa_managerApi_ManagerInterface_Capability>(capability));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  return out;
 }
 
-void CManagerInterfaceAdapter::initialize([[maybe_unused]] InfoDictionary managerSettings,
-                                          [[maybe_unused]] const HostSessionPtr& hostSession) {
-  throw errors::NotImplementedException{"Not implemented"};
+void CManagerInterfaceAdapter::initialize(InfoDictionary managerSettings,
+                                          const HostSessionPtr& hostSession) {
+  if (suite_.initialize == nullptr) {
+    ManagerInterface::initialize(std::move(managerSettings), hostSession);
+    return;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.initialize(
+      &errorMessage, handle_, handles::InfoDictionary::toHandle(&managerSettings),
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
 }
 
 trait::TraitsDatas CManagerInterfaceAdapter::managementPolicy(
-    [[maybe_unused]] const trait::TraitSets& traitSets,
-    [[maybe_unused]] const access::PolicyAccess policyAccess,
-    [[maybe_unused]] const ContextConstPtr& context,
-    [[maybe_unused]] const HostSessionPtr& hostSession) {
-  throw errors::NotImplementedException{"Not implemented"};
-}
-
-bool CManagerInterfaceAdapter::isEntityReferenceString(
-    [[maybe_unused]] const Str& someString, [[maybe_unused]] const HostSessionPtr& hostSession) {
-  throw errors::NotImplementedException{"Not implemented"};
-}
-
-void CManagerInterfaceAdapter::entityExists(
-    [[maybe_unused]] const EntityReferences& entityReferences,
-    [[maybe_unused]] const ContextConstPtr& context,
-    [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const ExistsSuccessCallback& successCallback,
-    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
-}
-
-void CManagerInterfaceAdapter::resolve(
-    [[maybe_unused]] const EntityReferences& entityReferences,
-    [[maybe_unused]] const trait::TraitSet& traitSet,
-    [[maybe_unused]] const access::ResolveAccess resolveAccess,
-    [[maybe_unused]] const ContextConstPtr& context,
-    [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const ResolveSuccessCallback& successCallback,
-    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
-}
-
-void CManagerInterfaceAdapter::preflight(
-    [[maybe_unused]] const EntityReferences& entityReferences,
-    [[maybe_unused]] const trait::TraitsDatas& traitsDatas,
-    [[maybe_unused]] const access::PublishingAccess publishingAccess,
-    [[maybe_unused]] const ContextConstPtr& context,
-    [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const PreflightSuccessCallback& successCallback,
-    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
-}
-
-void CManagerInterfaceAdapter::register_(
-    [[maybe_unused]] const EntityReferences& entityReferences,
-    [[maybe_unused]] const trait::TraitsDatas& traitsDatas,
-    [[maybe_unused]] const access::PublishingAccess publishingAccess,
-    [[maybe_unused]] const ContextConstPtr& context,
-    [[maybe_unused]] const HostSessionPtr& hostSession,
-    [[maybe_unused]] const RegisterSuccessCallback& successCallback,
-    [[maybe_unused]] const BatchElementErrorCallback& errorCallback) {
-  throw errors::NotImplementedException{"Not implemented"};
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context, const HostSessionPtr& hostSession) {
+  if (suite_.managementPolicy == nullptr) {
+    return ManagerInterface::managementPolicy(traitSets, policyAccess, context, hostSession);
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  // Flatten trait IDs into a single array, so they can be viewed as
+  // one sub-array per trait set.
+  std::size_t numTraitIds = 0;
+  for (const trait::TraitSet& traitSet : traitSets) {
+    numTraitIds += traitSet.size();
+  }
+  std::vector<oa_ConstStringView> traitIdViews;
+  traitIdViews.reserve(numTraitIds);
+  std::vector<oa_ConstStringViewArray> traitSetViews;
+  traitSetViews.reserve(traitSets.size());
+  for (const trait::TraitSet& traitSet : traitSets) {
+    const std::size_t offset = traitIdViews.size();
+    appendStringViews(traitSet, traitIdViews);
+    traitSetViews.push_back({traitIdViews.data() + offset, traitSet.size()});
+  }
+
+  // Return value.
+  BatchResults results{traitSets.size(), BatchResults::ValueType::kTraitsData};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.managementPolicy(
+      &errorMessage, handles::managerApi::BatchResults::toHandle(&results), handle_,
+      traitSetViews.data(), traitSetViews.size(),
+      static_cast<oa_access_PolicyAccess>(policyAccess), toHandle(context),
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  trait::TraitsDatas policies;
+  policies.reserve(results.size());
+  for (std::size_t idx = 0; idx < results.size(); ++idx) {
+    switch (results.status(idx)) {
+      case BatchResults::Status::kValue:
+        policies.push_back(results.traitsDataValue(idx));
+        break;
+      case BatchResults::Status::kError:
+        throw errors::OpenAssetIOException{results.error(idx).message};
+      case BatchResults::Status::kUnset:
+        // Unmanaged.
+        policies.push_back(trait::TraitsData::make());
+        break;
+    }
+  }
+  return policies;
+}
+
+bool CManagerInterfaceAdapter::isEntityReferenceString(const Str& someString,
+                                                       const HostSessionPtr& hostSession) {
+  if (suite_.isEntityReferenceString == nullptr) {
+    return ManagerInterface::isEntityReferenceString(someString, hostSession);
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  // Return value.
+  bool out = false;
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.isEntityReferenceString(
+      &errorMessage, &out, handle_, {someString.data(), someString.size()},
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  return out;
+}
+
+void CManagerInterfaceAdapter::entityExists(const EntityReferences& entityReferences,
+                                            const ContextConstPtr& context,
+                                            const HostSessionPtr& hostSession,
+                                            const ExistsSuccessCallback& successCallback,
+                                            const BatchElementErrorCallback& errorCallback) {
+  if (suite_.entityExists == nullptr) {
+    ManagerInterface::entityExists(entityReferences, context, hostSession, successCallback,
+                                   errorCallback);
+    return;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  const std::vector<oa_ConstStringView> entityReferenceViews = toStringViews(entityReferences);
+
+  // Return values.
+  BatchResults results{entityReferences.size(), BatchResults::ValueType::kBool};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.entityExists(
+      &errorMessage, handles::managerApi::BatchResults::toHandle(&results), handle_,
+      toArray(entityReferenceViews), toHandle(context), toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  deliverResults(
+      results, [&](const std::size_t idx) { successCallback(idx, results.boolValue(idx)); },
+      errorCallback);
+}
+
+void CManagerInterfaceAdapter::resolve(const EntityReferences& entityReferences,
+                                       const trait::TraitSet& traitSet,
+                                       const access::ResolveAccess resolveAccess,
+                                       const ContextConstPtr& context,
+                                       const HostSessionPtr& hostSession,
+                                       const ResolveSuccessCallback& successCallback,
+                                       const BatchElementErrorCallback& errorCallback) {
+  if (suite_.resolve == nullptr) {
+    ManagerInterface::resolve(entityReferences, traitSet, resolveAccess, context, hostSession,
+                              successCallback, errorCallback);
+    return;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  const std::vector<oa_ConstStringView> entityReferenceViews = toStringViews(entityReferences);
+  std::vector<oa_ConstStringView> traitIdViews;
+  traitIdViews.reserve(traitSet.size());
+  appendStringViews(traitSet, traitIdViews);
+
+  // Return values.
+  BatchResults results{entityReferences.size(), BatchResults::ValueType::kTraitsData};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.resolve(
+      &errorMessage, handles::managerApi::BatchResults::toHandle(&results), handle_,
+      toArray(entityReferenceViews), toArray(traitIdViews),
+      static_cast<oa_access_ResolveAccess>(resolveAccess), toHandle(context),
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  deliverResults(
+      results,
+      [&](const std::size_t idx) { successCallback(idx, results.traitsDataValue(idx)); },
+      errorCallback);
+}
+
+void CManagerInterfaceAdapter::preflight(const EntityReferences& entityReferences,
+                                         const trait::TraitsDatas& traitsDatas,
+                                         const access::PublishingAccess publishingAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         const PreflightSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  if (suite_.preflight == nullptr) {
+    ManagerInterface::preflight(entityReferences, traitsDatas, publishingAccess, context,
+                                hostSession, successCallback, errorCallback);
+    return;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  const std::vector<oa_ConstStringView> entityReferenceViews = toStringViews(entityReferences);
+  const std::vector<oa_trait_TraitsData_h> traitsDataHandles = toHandles(traitsDatas);
+
+  // Return values.
+  BatchResults results{entityReferences.size(), BatchResults::ValueType::kStr};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.preflight(
+      &errorMessage, handles::managerApi::BatchResults::toHandle(&results), handle_,
+      toArray(entityReferenceViews), traitsDataHandles.data(),
+      static_cast<oa_access_PublishingAccess>(publishingAccess), toHandle(context),
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  deliverResults(
+      results,
+      [&](const std::size_t idx) {
+        successCallback(idx, EntityReference{std::move(results.strValue(idx))});
+      },
+      errorCallback);
+}
+
+void CManagerInterfaceAdapter::register_(const EntityReferences& entityReferences,
+                                         const trait::TraitsDatas& traitsDatas,
+                                         const access::PublishingAccess publishingAccess,
+                                         const ContextConstPtr& context,
+                                         const HostSessionPtr& hostSession,
+                                         const RegisterSuccessCallback& successCallback,
+                                         const BatchElementErrorCallback& errorCallback) {
+  if (suite_.register_ == nullptr) {
+    ManagerInterface::register_(entityReferences, traitsDatas, publishingAccess, context,
+                                hostSession, successCallback, errorCallback);
+    return;
+  }
+
+  // Buffer for error message.
+  char errorMessageBuffer[kStringBufferSize];
+  // Error message.
+  oa_StringView errorMessage{kStringBufferSize, static_cast<char*>(errorMessageBuffer), 0};
+
+  const std::vector<oa_ConstStringView> entityReferenceViews = toStringViews(entityReferences);
+  const std::vector<oa_trait_TraitsData_h> traitsDataHandles = toHandles(traitsDatas);
+
+  // Return values.
+  BatchResults results{entityReferences.size(), BatchResults::ValueType::kStr};
+
+  // Execute corresponding suite function.
+  const oa_ErrorCode errorCode = suite_.register_(
+      &errorMessage, handles::managerApi::BatchResults::toHandle(&results), handle_,
+      toArray(entityReferenceViews), traitsDataHandles.data(),
+      static_cast<oa_access_PublishingAccess>(publishingAccess), toHandle(context),
+      toHandle(hostSession));
+
+  // Convert error code/message to exception.
+  errors::throwIfError(errorCode, errorMessage);
+
+  deliverResults(
+      results,
+      [&](const std::size_t idx) {
+        successCallback(idx, EntityReference{std::move(results.strValue(idx))});
+      },
+      errorCallback);
 }
 
 }  // namespace managerApi
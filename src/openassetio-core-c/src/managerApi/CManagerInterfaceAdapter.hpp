@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2024 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 #include <string>
 
@@ -19,6 +19,10 @@ namespace managerApi {
 /**
  * ManagerInterface implementation wrapping a manager plugin defined via
  * the C API.
+ *
+ * Batch inputs are passed to the C suite as views on the caller's
+ * data, and results are collected in a BatchResults instance before
+ * being delivered to the callbacks.
  */
 class OPENASSETIO_CORE_C_EXPORT CManagerInterfaceAdapter : ManagerInterface {
  public:
@@ -50,7 +54,7 @@ class OPENASSETIO_CORE_C_EXPORT CManagerInterfaceAdapter : ManagerInterface {
   /// Wrap the C suite's `info` function.
   [[nodiscard]] InfoDictionary info() override;
 
-  // Wrap the C suite's `hasCapability` function.
+  /// Wrap the C suite's `hasCapability` function.
   [[nodiscard]] bool hasCapability(Capability capability) override;
 
   /// Wrap the C suite's `initialize` function.
@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <openassetio/c/InfoDictionary.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "../StringView.hpp"
+#include "../errors.hpp"
+#include "../handles/trait/TraitsData.hpp"
+
+namespace errors = openassetio::errors;
+namespace handles = openassetio::handles;
+namespace trait = openassetio::trait;
+
+namespace {
+// Helper for static_assert.
+template <class... T>
+[[maybe_unused]] constexpr bool kAlwaysFalse = false;
+
+/**
+ * Unpack a TraitsData handle.
+ *
+ * @param handle Opaque handle to a TraitsData.
+ * @return TraitsData instance.
+ */
+const trait::TraitsDataPtr &toTraitsData(oa_trait_TraitsData_h handle) {
+  return *handles::trait::SharedTraitsData::toInstance(handle);
+}
+
+/**
+ * Get a trait property value from a TraitsData, converting a missing
+ * trait or property to an error code.
+ *
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for return value.
+ * @param handle Opaque handle to a TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+oa_ErrorCode getValue(oa_StringView *err, trait::property::Value *out,
+                      oa_trait_TraitsData_h handle, const oa_ConstStringView traitId,
+                      const oa_ConstStringView propertyKey) {
+  if (!toTraitsData(handle)->getTraitProperty(out, {traitId.data, traitId.size},
+                                              {propertyKey.data, propertyKey.size})) {
+    openassetio::assignStringView(err, "Invalid trait property");
+    return oa_ErrorCode_kOutOfRange;
+  }
+  return oa_ErrorCode_kOK;
+}
+
+/**
+ * Get a primitive trait property value from a TraitsData, converting
+ * exceptions to error codes.
+ *
+ * @tparam Type Type of value to extract from variant.
+ * @param[out] err Storage for error message, if any.
+ * @param[out] out Storage for return value.
+ * @param handle Opaque handle to a TraitsData.
+ * @param traitId ID of trait to query.
+ * @param propertyKey Key of property to query.
+ * @return Error code.
+ */
+template <class Type>
+oa_ErrorCode get(oa_StringView *err, Type *out, oa_trait_TraitsData_h handle,
+                 const oa_ConstStringView traitId, const oa_ConstStringView propertyKey) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    trait::property::Value value;
+    if (const oa_ErrorCode errorCode = getValue(err, &value, handle, traitId, propertyKey);
+        errorCode != oa_ErrorCode_kOK) {
+      return errorCode;
+    }
+
+    Type *typedValue = std::get_if<Type>(&value);
+    if (typedValue == nullptr) {
+      openassetio::assignStringView(err, "Invalid value type");
+      return oa_ErrorCode_kBadVariantAccess;
+    }
+
+    *out = std::move(*typedValue);
+    return oa_ErrorCode_kOK;
+  });
+}
+
+/**
+ * Set a trait property value in a TraitsData, converting exceptions to
+ * error codes.
+ *
+ * @tparam Type Type of value to set in variant.
+ * @param[out] err Storage for error message, if any.
+ * @param handle Opaque handle to a TraitsData.
+ * @param traitId ID of trait to mutate.
+ * @param propertyKey Key of property to mutate.
+ * @param value Value to set.
+ * @return Error code.
+ */
+template <class Type>
+oa_ErrorCode set(oa_StringView *err, oa_trait_TraitsData_h handle,
+                 const oa_ConstStringView traitId, const oa_ConstStringView propertyKey,
+                 Type value) {
+  return errors::catchUnknownExceptionAsCode(err, [&] {
+    toTraitsData(handle)->setTraitProperty(openassetio::Str{traitId.data, traitId.size},
+                                           openassetio::Str{propertyKey.data, propertyKey.size},
+                                           std::move(value));
+    return oa_ErrorCode_kOK;
+  });
+}
+}  // namespace
+
+extern "C" {
+
+oa_ErrorCode oa_trait_TraitsData_ctor(oa_StringView *error, oa_trait_TraitsData_h *out) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    *out = handles::trait::SharedTraitsData::toHandle(
+        new trait::TraitsDataPtr{trait::TraitsData::make()});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+void oa_trait_TraitsData_dtor(oa_trait_TraitsData_h handle) {
+  delete handles::trait::SharedTraitsData::toInstance(handle);
+}
+
+oa_ErrorCode oa_trait_TraitsData_hasTrait(oa_StringView *error, bool *out,
+                                          oa_trait_TraitsData_h handle,
+                                          const oa_ConstStringView traitId) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    *out = toTraitsData(handle)->hasTrait({traitId.data, traitId.size});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_addTrait(oa_StringView *error, oa_trait_TraitsData_h handle,
+                                          const oa_ConstStringView traitId) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    toTraitsData(handle)->addTrait({traitId.data, traitId.size});
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_typeOfTraitProperty(oa_StringView *error,
+                                                     oa_InfoDictionary_ValueType *out,
+                                                     oa_trait_TraitsData_h handle,
+                                                     const oa_ConstStringView traitId,
+                                                     const oa_ConstStringView propertyKey) {
+  return errors::catchUnknownExceptionAsCode(error, [&] {
+    trait::property::Value value;
+    if (const oa_ErrorCode errorCode = getValue(error, &value, handle, traitId, propertyKey);
+        errorCode != oa_ErrorCode_kOK) {
+      return errorCode;
+    }
+
+    std::visit(
+        [&out]([[maybe_unused]] auto &&typedValue) {
+          using ValueType = std::decay_t<decltype(typedValue)>;
+          if constexpr (std::is_same_v<ValueType, openassetio::Bool>) {
+            *out = oa_InfoDictionary_ValueType_kBool;
+          } else if constexpr (std::is_same_v<ValueType, openassetio::Int>) {
+            *out = oa_InfoDictionary_ValueType_kInt;
+          } else if constexpr (std::is_same_v<ValueType, openassetio::Float>) {
+            *out = oa_InfoDictionary_ValueType_kFloat;
+          } else if constexpr (std::is_same_v<ValueType, openassetio::Str>) {
+            *out = oa_InfoDictionary_ValueType_kStr;
+          } else {
+            static_assert(kAlwaysFalse<ValueType>, "Unhandled variant type");
+          }
+        },
+        value);
+
+    return oa_ErrorCode_kOK;
+  });
+}
+
+oa_ErrorCode oa_trait_TraitsData_getTraitPropertyBool(oa_StringView *error,
+                                                      openassetio::Bool *out,
+                                                      oa_trait_TraitsData_h handle,
+                                                      const oa_ConstStringView traitId,
+                                                      const oa_ConstStringView propertyKey) {
+  return get(error, out, handle, traitId, propertyKey);
+}
+
+oa_ErrorCode oa_trait_TraitsData_getTraitPropertyInt(oa_StringView *error, openassetio::Int *out,
+                                                     oa_trait_TraitsData_h handle,
+                                                     const oa_ConstStringView traitId,
+                                                     const oa_ConstStringView propertyKey) {
+  return get(error, out, handle, traitId, propertyKey);
+}
+
+oa_ErrorCode oa_trait_TraitsData_getTraitPropertyFloat(oa_StringView *error,
+                                                       openassetio::Float *out,
+                                                       oa_trait_TraitsData_h handle,
+                                                       const oa_ConstStringView traitId,
+                                                       const oa_ConstStringView propertyKey) {
+  return get(error, out, handle, traitId, propertyKey);
+}
+
+oa_ErrorCode oa_trait_TraitsData_getTraitPropertyStr(oa_StringView *error, oa_StringView *out,
+                                                     oa_trait_TraitsData_h handle,
+                                                     const oa_ConstStringView traitId,
+                                                     const oa_ConstStringView propertyKey) {
+  openassetio::Str str;
+
+  if (const oa_ErrorCode errorCode = get(error, &str, handle, traitId, propertyKey);
+      errorCode != oa_ErrorCode_kOK) {
+    return errorCode;
+  }
+
+  openassetio::assignStringView(out, str);
+
+  if (str.size() > out->capacity) {
+    openassetio::assignStringView(error, "Insufficient storage for return value");
+    return oa_ErrorCode_kLengthError;
+  }
+
+  return oa_ErrorCode_kOK;
+}
+
+oa_ErrorCode oa_trait_TraitsData_setTraitPropertyBool(oa_StringView *error,
+                                                      oa_trait_TraitsData_h handle,
+                                                      const oa_ConstStringView traitId,
+                                                      const oa_ConstStringView propertyKey,
+                                                      const openassetio::Bool value) {
+  return set(error, handle, traitId, propertyKey, value);
+}
+
+oa_ErrorCode oa_trait_TraitsData_setTraitPropertyInt(oa_StringView *error,
+                                                     oa_trait_TraitsData_h handle,
+                                                     const oa_ConstStringView traitId,
+                                                     const oa_ConstStringView propertyKey,
+                                                     const openassetio::Int value) {
+  return set(error, handle, traitId, propertyKey, value);
+}
+
+oa_ErrorCode oa_trait_TraitsData_setTraitPropertyFloat(oa_StringView *error,
+                                                       oa_trait_TraitsData_h handle,
+                                                       const oa_ConstStringView traitId,
+                                                       const oa_ConstStringView propertyKey,
+                                                       const openassetio::Float value) {
+  return set(error, handle, traitId, propertyKey, value);
+}
+
+oa_ErrorCode oa_trait_TraitsData_setTraitPropertyStr(oa_StringView *error,
+                                                     oa_trait_TraitsData_h handle,
+                                                     const oa_ConstStringView traitId,
+                                                     const oa_ConstStringView propertyKey,
+                                                     const oa_ConstStringView value) {
+  return set(error, handle, traitId, propertyKey, openassetio::Str{value.data, value.size});
+}
+}  // extern "C"
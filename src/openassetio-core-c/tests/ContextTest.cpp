@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/c/Context.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/Context.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+
+// Private headers.
+#include <handles/Context.hpp>
+#include <handles/trait/TraitsData.hpp>
+
+namespace handles = openassetio::handles;
+
+SCENARIO("Retrieving the locale of a Context via the C API") {
+  GIVEN("a Context with a locale") {
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+    context->locale->addTrait("aLocaleTrait");
+
+    WHEN("the locale is retrieved") {
+      openassetio::ContextConstPtr contextCopy = context;
+      oa_trait_TraitsData_h localeHandle =
+          oa_Context_locale(handles::SharedContext::toHandle(&contextCopy));
+
+      THEN("handle references the Context's locale") {
+        CHECK(*handles::trait::SharedTraitsData::toInstance(localeHandle) == context->locale);
+      }
+    }
+  }
+}
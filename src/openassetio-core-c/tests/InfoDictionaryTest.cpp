@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <cstddef>
+#include <utility>
 
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
@@ -560,3 +561,140 @@ TEMPLATE_TEST_CASE_METHOD(MutatorFixture, "InfoDictionary mutated via C API", ""
     }
   }
 }
+
+SCENARIO("Iterating the entries of a InfoDictionary via C API") {
+  GIVEN("a populated C++ InfoDictionary and its C handle") {
+    InfoDictionary infoDictionary{{"aBool", true},
+                                  {"anInt", openassetio::Int{123}},
+                                  {"aFloat", openassetio::Float{4.56}},
+                                  {"aStr", openassetio::Str{"some string"}}};
+    oa_InfoDictionary_h infoDictionaryHandle = handles::InfoDictionary::toHandle(&infoDictionary);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStrStorageCapacity, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    WHEN("all entries are visited using an iterator") {
+      oa_InfoDictionary_Iterator_h iteratorHandle = nullptr;
+      const oa_ErrorCode actualErrorCode =
+          oa_InfoDictionary_Iterator_ctor(&actualErrorMsg, &iteratorHandle, infoDictionaryHandle);
+      REQUIRE(actualErrorCode == oa_ErrorCode_kOK);
+
+      InfoDictionary actualInfoDictionary;
+      oa_InfoDictionary_Entry entry{};
+      while (oa_InfoDictionary_Iterator_next(&entry, iteratorHandle)) {
+        openassetio::Str key{entry.key.data, entry.key.size};
+        switch (entry.type) {
+          case oa_InfoDictionary_ValueType_kBool:
+            actualInfoDictionary.insert({std::move(key), entry.value.boolValue});
+            break;
+          case oa_InfoDictionary_ValueType_kInt:
+            actualInfoDictionary.insert({std::move(key), openassetio::Int{entry.value.intValue}});
+            break;
+          case oa_InfoDictionary_ValueType_kFloat:
+            actualInfoDictionary.insert({std::move(key), entry.value.floatValue});
+            break;
+          case oa_InfoDictionary_ValueType_kStr:
+            actualInfoDictionary.insert(
+                {std::move(key),
+                 openassetio::Str{entry.value.strValue.data, entry.value.strValue.size}});
+            break;
+        }
+      }
+      oa_InfoDictionary_Iterator_dtor(iteratorHandle);
+
+      THEN("every entry is visited exactly once") {
+        CHECK(actualInfoDictionary == infoDictionary);
+      }
+    }
+
+    WHEN("the entries of an empty InfoDictionary are visited") {
+      InfoDictionary emptyInfoDictionary;
+      oa_InfoDictionary_Iterator_h iteratorHandle = nullptr;
+      REQUIRE(oa_InfoDictionary_Iterator_ctor(
+                  &actualErrorMsg, &iteratorHandle,
+                  handles::InfoDictionary::toHandle(&emptyInfoDictionary)) == oa_ErrorCode_kOK);
+
+      oa_InfoDictionary_Entry entry{};
+      const bool hasEntry = oa_InfoDictionary_Iterator_next(&entry, iteratorHandle);
+      oa_InfoDictionary_Iterator_dtor(iteratorHandle);
+
+      THEN("no entries are visited") { CHECK_FALSE(hasEntry); }
+    }
+  }
+}
+
+SCENARIO("Bulk copying a InfoDictionary via C API") {
+  GIVEN("a populated C++ InfoDictionary and its C handle") {
+    InfoDictionary infoDictionary{{"aBool", true},
+                                  {"anInt", openassetio::Int{123}},
+                                  {"aFloat", openassetio::Float{4.56}},
+                                  {"aStr", openassetio::Str{"some string"}},
+                                  {"", openassetio::Str{}}};
+    oa_InfoDictionary_h infoDictionaryHandle = handles::InfoDictionary::toHandle(&infoDictionary);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStrStorageCapacity, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    const std::size_t packedSize = oa_InfoDictionary_packedSize(infoDictionaryHandle);
+
+    WHEN("the InfoDictionary is exported to a sufficiently large buffer") {
+      openassetio::Str packedStorage(packedSize, '\0');
+      oa_StringView packed{packedStorage.size(), packedStorage.data(), 0};
+
+      const oa_ErrorCode actualErrorCode =
+          oa_InfoDictionary_exportPacked(&actualErrorMsg, &packed, infoDictionaryHandle);
+
+      THEN("the whole buffer is used") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(packed.size == packedSize);
+      }
+
+      AND_WHEN("the buffer is imported into another InfoDictionary") {
+        InfoDictionary actualInfoDictionary{{"anInt", openassetio::Str{"to be overwritten"}},
+                                            {"other", openassetio::Int{1}}};
+
+        const oa_ErrorCode importErrorCode = oa_InfoDictionary_importPacked(
+            &actualErrorMsg, handles::InfoDictionary::toHandle(&actualInfoDictionary),
+            {packed.data, packed.size});
+
+        THEN("entries are merged into the other InfoDictionary") {
+          CHECK(importErrorCode == oa_ErrorCode_kOK);
+          InfoDictionary expectedInfoDictionary = infoDictionary;
+          expectedInfoDictionary.insert({"other", openassetio::Int{1}});
+          CHECK(actualInfoDictionary == expectedInfoDictionary);
+        }
+      }
+
+      AND_WHEN("a truncated buffer is imported into another InfoDictionary") {
+        InfoDictionary actualInfoDictionary{{"other", openassetio::Int{1}}};
+        const InfoDictionary expectedInfoDictionary = actualInfoDictionary;
+
+        const oa_ErrorCode importErrorCode = oa_InfoDictionary_importPacked(
+            &actualErrorMsg, handles::InfoDictionary::toHandle(&actualInfoDictionary),
+            {packed.data, packed.size - 1});
+
+        THEN("an error is returned and the other InfoDictionary is unmodified") {
+          CHECK(importErrorCode == oa_ErrorCode_kOutOfRange);
+          CHECK(actualErrorMsg == "Malformed packed InfoDictionary");
+          CHECK(actualInfoDictionary == expectedInfoDictionary);
+        }
+      }
+    }
+
+    WHEN("the InfoDictionary is exported to a buffer that is too small") {
+      openassetio::Str packedStorage(packedSize - 1, '\0');
+      oa_StringView packed{packedStorage.size(), packedStorage.data(), 0};
+
+      const oa_ErrorCode actualErrorCode =
+          oa_InfoDictionary_exportPacked(&actualErrorMsg, &packed, infoDictionaryHandle);
+
+      THEN("an error is returned and nothing is written") {
+        CHECK(actualErrorCode == oa_ErrorCode_kLengthError);
+        CHECK(actualErrorMsg == "Insufficient storage for return value");
+        CHECK(packed.size == 0);
+      }
+    }
+  }
+}
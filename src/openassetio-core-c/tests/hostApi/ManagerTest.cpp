@@ -1,10 +1,13 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <array>
 #include <cstddef>
 #include <memory>
 
+#include <openassetio/c/Context.h>
 #include <openassetio/c/InfoDictionary.h>
 #include <openassetio/c/StringView.h>
+#include <openassetio/c/access.h>
 #include <openassetio/c/errors.h>
 #include <openassetio/c/hostApi/Manager.h>
 #include <openassetio/c/managerApi/HostSession.h>
@@ -14,20 +17,27 @@
 #include <catch2/trompeloeil.hpp>
 #include <trompeloeil.hpp>
 
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/typedefs.hpp>
 
 // Private headers.
+#include <handles/Context.hpp>
 #include <handles/InfoDictionary.hpp>
 #include <handles/hostApi/Manager.hpp>
 #include <handles/managerApi/HostSession.hpp>
 #include <handles/managerApi/ManagerInterface.hpp>
+#include <handles/trait/TraitsData.hpp>
 
 #include "../StringViewReporting.hpp"
 
@@ -380,3 +390,194 @@ SCENARIO("A host calls Manager::info") {
     }
   }
 }
+
+SCENARIO("A host calls Manager::entityExists") {
+  GIVEN("a Manager and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = dynamic_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Context and its C handle.
+    openassetio::ContextConstPtr context = openassetio::Context::make();
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    // Batch of entity references.
+    const std::array<oa_ConstStringView, 3> entityReferenceViews{
+        {{"first", 5}, {"second", 6}, {"third", 5}}};
+    const oa_ConstStringViewArray entityReferences{entityReferenceViews.data(),
+                                                   entityReferenceViews.size()};
+
+    // Storage for results.
+    std::array<bool, 3> actualExists{false, false, false};
+    std::array<oa_ErrorCode, 3> actualElementErrors{};
+    std::array<openassetio::Str, 3> elementErrorMsgStorage{
+        openassetio::Str(kStringBufferSize, '\0'), openassetio::Str(kStringBufferSize, '\0'),
+        openassetio::Str(kStringBufferSize, '\0')};
+    std::array<oa_StringView, 3> actualElementErrorMsgs{
+        {{kStringBufferSize, elementErrorMsgStorage[0].data(), 0},
+         {kStringBufferSize, elementErrorMsgStorage[1].data(), 0},
+         {kStringBufferSize, elementErrorMsgStorage[2].data(), 0}}};
+
+    AND_GIVEN("ManagerInterface::entityExists() will provide values and errors") {
+      using trompeloeil::_;
+      const openassetio::EntityReferences expectedEntityReferences{
+          openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"},
+          openassetio::EntityReference{"third"}};
+
+      // Set a value for the first element and an error for the second,
+      // leaving the third unset.
+      REQUIRE_CALL(mockManagerInterface,
+                   entityExists(expectedEntityReferences, context, hostSessionPtr, _, _))
+          .LR_SIDE_EFFECT(_4(0, true))
+          .LR_SIDE_EFFECT(_5(1, openassetio::errors::BatchElementError{
+                                    openassetio::errors::BatchElementError::ErrorCode::
+                                        kMalformedEntityReference,
+                                    "malformed"}));
+
+      WHEN("the Manager C API is queried for existence of the entities") {
+        const oa_ErrorCode code = oa_hostApi_Manager_entityExists(
+            &actualErrorMsg, actualExists.data(), actualElementErrors.data(),
+            actualElementErrorMsgs.data(), managerHandle, entityReferences, contextHandle);
+
+        THEN("per-element results, error codes and error messages are set") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(actualExists[0] == true);
+          CHECK(actualElementErrors[0] == oa_ErrorCode_kOK);
+          CHECK(actualElementErrorMsgs[0].size == 0);
+          CHECK(actualElementErrors[1] == oa_ErrorCode_kBatchElementMalformedEntityReference);
+          CHECK(actualElementErrorMsgs[1] == "malformed");
+          CHECK(actualElementErrors[2] == oa_ErrorCode_kBatchElementUnknownError);
+          CHECK(actualElementErrorMsgs[2].size == 0);
+        }
+      }
+
+      WHEN("the Manager C API is queried without storage for error messages") {
+        const oa_ErrorCode code = oa_hostApi_Manager_entityExists(
+            &actualErrorMsg, actualExists.data(), actualElementErrors.data(), nullptr,
+            managerHandle, entityReferences, contextHandle);
+
+        THEN("per-element results and error codes are set") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(actualExists[0] == true);
+          CHECK(actualElementErrors[0] == oa_ErrorCode_kOK);
+          CHECK(actualElementErrors[1] == oa_ErrorCode_kBatchElementMalformedEntityReference);
+          CHECK(actualElementErrors[2] == oa_ErrorCode_kBatchElementUnknownError);
+        }
+      }
+    }
+
+    AND_GIVEN("ManagerInterface::entityExists() will fail with an exception") {
+      using trompeloeil::_;
+      const openassetio::Str expectedErrorMsg = "Some error";
+      REQUIRE_CALL(mockManagerInterface, entityExists(_, _, _, _, _))
+          .THROW(std::logic_error{expectedErrorMsg});
+
+      WHEN("the Manager C API is queried for existence of the entities") {
+        const oa_ErrorCode code = oa_hostApi_Manager_entityExists(
+            &actualErrorMsg, actualExists.data(), actualElementErrors.data(),
+            actualElementErrorMsgs.data(), managerHandle, entityReferences, contextHandle);
+
+        THEN("generic exception error code and message is set") {
+          CHECK(code == oa_ErrorCode_kException);
+          CHECK(actualErrorMsg == expectedErrorMsg);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls Manager::resolve") {
+  GIVEN("a Manager and its C handle") {
+    // Create mock ManagerInterface to inject and assert on.
+    const managerApi::ManagerInterfacePtr mockManagerInterfacePtr =
+        std::make_shared<MockManagerInterface>();
+    auto& mockManagerInterface = dynamic_cast<MockManagerInterface&>(*mockManagerInterfacePtr);
+    // Create a HostSession with our mock HostInterface
+    const managerApi::HostSessionPtr hostSessionPtr = managerApi::HostSession::make(
+        managerApi::Host::make(std::make_shared<MockHostInterface>()),
+        std::make_shared<MockLoggerInterface>());
+
+    // Create the Manager under test.
+    hostApi::ManagerPtr manager = hostApi::Manager::make(mockManagerInterfacePtr, hostSessionPtr);
+    // Create the handle for the Manager under test.
+    oa_hostApi_Manager_h managerHandle = handles::hostApi::SharedManager::toHandle(&manager);
+
+    // Storage for error messages coming from C API functions.
+    openassetio::Str errStorage(kStringBufferSize, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    // Context and its C handle.
+    openassetio::ContextConstPtr context = openassetio::Context::make();
+    oa_Context_h contextHandle = handles::SharedContext::toHandle(&context);
+
+    // Batch of entity references and trait set.
+    const std::array<oa_ConstStringView, 2> entityReferenceViews{{{"first", 5}, {"second", 6}}};
+    const std::array<oa_ConstStringView, 1> traitIdViews{{{"aTrait", 6}}};
+
+    // Storage for results.
+    std::array<openassetio::trait::TraitsDataPtr, 2> actualTraitsDatas{
+        openassetio::trait::TraitsData::make(), openassetio::trait::TraitsData::make()};
+    std::array<oa_trait_TraitsData_h, 2> actualTraitsDataHandles{
+        handles::trait::SharedTraitsData::toHandle(&actualTraitsDatas[0]),
+        handles::trait::SharedTraitsData::toHandle(&actualTraitsDatas[1])};
+    std::array<oa_ErrorCode, 2> actualElementErrors{};
+    std::array<openassetio::Str, 2> elementErrorMsgStorage{
+        openassetio::Str(kStringBufferSize, '\0'), openassetio::Str(kStringBufferSize, '\0')};
+    std::array<oa_StringView, 2> actualElementErrorMsgs{
+        {{kStringBufferSize, elementErrorMsgStorage[0].data(), 0},
+         {kStringBufferSize, elementErrorMsgStorage[1].data(), 0}}};
+
+    AND_GIVEN("ManagerInterface::resolve() will provide a value and an error") {
+      using trompeloeil::_;
+      const openassetio::EntityReferences expectedEntityReferences{
+          openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"}};
+      const openassetio::trait::TraitSet expectedTraitSet{"aTrait"};
+      const openassetio::trait::TraitsDataPtr expectedTraitsData =
+          openassetio::trait::TraitsData::make();
+      expectedTraitsData->addTrait("aTrait");
+
+      REQUIRE_CALL(mockManagerInterface,
+                   resolve(expectedEntityReferences, expectedTraitSet,
+                           openassetio::access::ResolveAccess::kRead, context, hostSessionPtr, _,
+                           _))
+          .LR_SIDE_EFFECT(_6(0, expectedTraitsData))
+          .LR_SIDE_EFFECT(_7(1, openassetio::errors::BatchElementError{
+                                    openassetio::errors::BatchElementError::ErrorCode::
+                                        kEntityResolutionError,
+                                    "unresolvable"}));
+
+      WHEN("the Manager C API is used to resolve the entities") {
+        const oa_ErrorCode code = oa_hostApi_Manager_resolve(
+            &actualErrorMsg, actualTraitsDataHandles.data(), actualElementErrors.data(),
+            actualElementErrorMsgs.data(), managerHandle,
+            {entityReferenceViews.data(), entityReferenceViews.size()},
+            {traitIdViews.data(), traitIdViews.size()}, oa_access_ResolveAccess_kRead,
+            contextHandle);
+
+        THEN("per-element results, error codes and error messages are set") {
+          CHECK(code == oa_ErrorCode_kOK);
+          CHECK(actualTraitsDatas[0] == expectedTraitsData);
+          CHECK(actualElementErrors[0] == oa_ErrorCode_kOK);
+          CHECK(actualElementErrorMsgs[0].size == 0);
+          CHECK(actualTraitsDatas[1]->traitSet().empty());
+          CHECK(actualElementErrors[1] == oa_ErrorCode_kBatchElementEntityResolutionError);
+          CHECK(actualElementErrorMsgs[1] == "unresolvable");
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <array>
+#include <cstddef>
+
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/BatchResults.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <handles/managerApi/BatchResults.hpp>
+#include <handles/trait/TraitsData.hpp>
+#include <managerApi/BatchResults.hpp>
+
+#include "../StringViewReporting.hpp"
+
+using openassetio::errors::BatchElementError;
+using openassetio::managerApi::BatchResults;
+namespace handles = openassetio::handles;
+
+namespace {
+/// Default storage capacity for StringView C strings.
+constexpr std::size_t kStrStorageCapacity = 500;
+constexpr std::size_t kBatchSize = 3;
+
+/**
+ * Fixture providing storage for error messages.
+ */
+struct ErrorMessageFixture {
+  openassetio::Str errStorage = openassetio::Str(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+};
+}  // namespace
+
+SCENARIO("Populating boolean BatchResults via the C API") {
+  GIVEN("an empty boolean batch") {
+    ErrorMessageFixture fixture;
+    BatchResults results{kBatchSize, BatchResults::ValueType::kBool};
+    oa_managerApi_BatchResults_h handle = handles::managerApi::BatchResults::toHandle(&results);
+
+    THEN("the batch size can be queried") {
+      CHECK(oa_managerApi_BatchResults_size(handle) == kBatchSize);
+    }
+
+    THEN("all elements are unset") {
+      for (std::size_t idx = 0; idx < kBatchSize; ++idx) {
+        CHECK(results.status(idx) == BatchResults::Status::kUnset);
+      }
+    }
+
+    WHEN("values are set for a range of elements") {
+      const std::array<bool, 2> values{true, false};
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_setBools(
+          &fixture.actualErrorMsg, handle, 1, values.data(), values.size());
+
+      THEN("values are stored for those elements") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(results.status(0) == BatchResults::Status::kUnset);
+        CHECK(results.status(1) == BatchResults::Status::kValue);
+        CHECK(results.status(2) == BatchResults::Status::kValue);
+        CHECK(results.boolValue(1) == true);
+        CHECK(results.boolValue(2) == false);
+      }
+
+      AND_WHEN("an error is set for one of those elements") {
+        constexpr oa_ConstStringView kErrorMessage{"some error", 10};
+        const oa_ErrorCode errorCode = oa_managerApi_BatchResults_setError(
+            &fixture.actualErrorMsg, handle, 2, oa_ErrorCode_kBatchElementEntityAccessError,
+            kErrorMessage);
+
+        THEN("the error replaces the value") {
+          CHECK(errorCode == oa_ErrorCode_kOK);
+          CHECK(results.status(2) == BatchResults::Status::kError);
+          CHECK(results.error(2).code == BatchElementError::ErrorCode::kEntityAccessError);
+          CHECK(results.error(2).message == "some error");
+        }
+      }
+    }
+
+    WHEN("values are set beyond the end of the batch") {
+      const std::array<bool, 2> values{true, false};
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_setBools(
+          &fixture.actualErrorMsg, handle, 2, values.data(), values.size());
+
+      THEN("an error is returned and no values are stored") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOutOfRange);
+        CHECK(fixture.actualErrorMsg == "Batch index out of range");
+        CHECK(results.status(2) == BatchResults::Status::kUnset);
+      }
+    }
+
+    WHEN("values of the wrong type are set") {
+      const std::array<oa_ConstStringView, 1> values{{{"a", 1}}};
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_setStrs(
+          &fixture.actualErrorMsg, handle, 0, {values.data(), values.size()});
+
+      THEN("an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kBadVariantAccess);
+        CHECK(fixture.actualErrorMsg == "Invalid value type");
+      }
+    }
+
+    WHEN("an error is set with a non-batch error code") {
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_setError(
+          &fixture.actualErrorMsg, handle, 0, oa_ErrorCode_kException, {"", 0});
+
+      THEN("an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOutOfRange);
+        CHECK(fixture.actualErrorMsg == "Invalid batch element error code");
+        CHECK(results.status(0) == BatchResults::Status::kUnset);
+      }
+    }
+  }
+}
+
+SCENARIO("Populating string BatchResults via the C API") {
+  GIVEN("an empty string batch") {
+    ErrorMessageFixture fixture;
+    BatchResults results{kBatchSize, BatchResults::ValueType::kStr};
+    oa_managerApi_BatchResults_h handle = handles::managerApi::BatchResults::toHandle(&results);
+
+    WHEN("values are set for all elements") {
+      const std::array<oa_ConstStringView, kBatchSize> values{
+          {{"first", 5}, {"second", 6}, {"third", 5}}};
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_setStrs(
+          &fixture.actualErrorMsg, handle, 0, {values.data(), values.size()});
+
+      THEN("values are copied into the batch") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(results.strValue(0) == "first");
+        CHECK(results.strValue(1) == "second");
+        CHECK(results.strValue(2) == "third");
+      }
+    }
+  }
+}
+
+SCENARIO("Populating TraitsData BatchResults via the C API") {
+  GIVEN("an empty TraitsData batch") {
+    ErrorMessageFixture fixture;
+    BatchResults results{kBatchSize, BatchResults::ValueType::kTraitsData};
+    oa_managerApi_BatchResults_h handle = handles::managerApi::BatchResults::toHandle(&results);
+
+    WHEN("the TraitsData for an element is retrieved and populated") {
+      oa_trait_TraitsData_h traitsDataHandle = nullptr;
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_traitsData(
+          &fixture.actualErrorMsg, &traitsDataHandle, handle, 1);
+      CHECK(actualErrorCode == oa_ErrorCode_kOK);
+      (*handles::trait::SharedTraitsData::toInstance(traitsDataHandle))->addTrait("aTrait");
+
+      THEN("the element has the populated value") {
+        CHECK(results.status(1) == BatchResults::Status::kValue);
+        CHECK(results.traitsDataValue(1)->hasTrait("aTrait"));
+      }
+
+      AND_WHEN("the TraitsData for the same element is retrieved again") {
+        oa_trait_TraitsData_h otherTraitsDataHandle = nullptr;
+        CHECK(oa_managerApi_BatchResults_traitsData(&fixture.actualErrorMsg,
+                                                    &otherTraitsDataHandle, handle,
+                                                    1) == oa_ErrorCode_kOK);
+
+        THEN("the same TraitsData is returned") {
+          CHECK(otherTraitsDataHandle == traitsDataHandle);
+        }
+      }
+    }
+
+    WHEN("the TraitsData for an element beyond the end of the batch is retrieved") {
+      oa_trait_TraitsData_h traitsDataHandle = nullptr;
+      const oa_ErrorCode actualErrorCode = oa_managerApi_BatchResults_traitsData(
+          &fixture.actualErrorMsg, &traitsDataHandle, handle, kBatchSize);
+
+      THEN("an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOutOfRange);
+        CHECK(fixture.actualErrorMsg == "Batch index out of range");
+      }
+    }
+  }
+}
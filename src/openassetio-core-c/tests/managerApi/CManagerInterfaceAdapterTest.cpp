@@ -1,11 +1,23 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <array>
 #include <cstddef>
 #include <stdexcept>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <openassetio/c/errors.h>
+#include <openassetio/c/managerApi/BatchResults.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
 #include <catch2/catch.hpp>
@@ -14,6 +26,9 @@
 
 // private headers
 #include <handles/InfoDictionary.hpp>
+#include <handles/managerApi/BatchResults.hpp>
+#include <handles/managerApi/HostSession.hpp>
+#include <handles/trait/TraitsData.hpp>
 #include <managerApi/CManagerInterfaceAdapter.hpp>
 
 #include "MockManagerInterfaceSuite.hpp"
@@ -241,3 +256,713 @@ SCENARIO("A host calls CManagerInterfaceAdapter::info") {
     }
   }
 }
+
+SCENARIO("A host calls CManagerInterfaceAdapter::hasCapability") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    const auto suite = mockManagerInterfaceSuite();
+
+    // Expect the destructor to be called, i.e. when cManagerInterface
+    // goes out of scope.
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+    AND_GIVEN("the C suite's hasCapability() call succeeds") {
+      using trompeloeil::_;
+
+      REQUIRE_CALL(mockImpl, hasCapability(_, _, handle,
+                                           oa_managerApi_ManagerInterface_Capability_kResolution))
+          // Update out-parameter.
+          .LR_SIDE_EFFECT(*_2 = true)
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the manager's capability is queried") {
+        const bool actualHasCapability = cManagerInterface.hasCapability(
+            openassetio::managerApi::ManagerInterface::Capability::kResolution);
+
+        THEN("the capability is supported") { CHECK(actualHasCapability); }
+      }
+    }
+  }
+
+  GIVEN("A CManagerInterfaceAdapter wrapping a suite with no hasCapability function") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+    suite.hasCapability = nullptr;
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+    WHEN("the manager's capability is queried") {
+      const bool actualHasCapability = cManagerInterface.hasCapability(
+          openassetio::managerApi::ManagerInterface::Capability::kResolution);
+
+      THEN("the capability is not supported") { CHECK_FALSE(actualHasCapability); }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::initialize") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::InfoDictionary settings{{"aKey", openassetio::Int{123}}};
+    const openassetio::managerApi::HostSessionPtr hostSession;
+
+    AND_GIVEN("the C suite's initialize() call succeeds") {
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, initialize(_, handle, _, _))
+          // Ensure settings are passed through.
+          .LR_WITH(*handles::InfoDictionary::toInstance(_3) == settings)
+          // Ensure host session is passed through.
+          .LR_WITH(handles::managerApi::SharedHostSession::toInstance(_4) == &hostSession)
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the manager is initialized") {
+        THEN("no exception is thrown") {
+          CHECK_NOTHROW(cManagerInterface.initialize(settings, hostSession));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's initialize() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, initialize(_, handle, _, _))
+          // Ensure max size is reasonable.
+          .LR_WITH(_1->capacity == kStringBufferSize)
+          // Update StringView error message out-parameter.
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the manager is initialized") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(cManagerInterface.initialize(settings, hostSession),
+                                 std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no initialize function") {
+      suite.initialize = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("the manager is initialized with settings") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(cManagerInterface.initialize(settings, hostSession),
+                          openassetio::errors::InputValidationException);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::managementPolicy") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::trait::TraitSets traitSets{{"aTrait", "anotherTrait"}, {"aThirdTrait"}};
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+
+    AND_GIVEN("the C suite's managementPolicy() call populates the first element") {
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl,
+                   managementPolicy(_, _, handle, _, _, oa_access_PolicyAccess_kWrite, _, _))
+          // Ensure inputs are one view per trait set.
+          .LR_WITH(_5 == traitSets.size())
+          .LR_WITH(_4[0].size == 2)
+          .LR_WITH(openassetio::Str(_4[0].data[1].data, _4[0].data[1].size) == "anotherTrait")
+          .LR_WITH(_4[1].size == 1)
+          .LR_WITH(openassetio::Str(_4[1].data[0].data, _4[1].data[0].size) == "aThirdTrait")
+          // Populate the first element, leaving the second unset.
+          .LR_SIDE_EFFECT({
+            oa_trait_TraitsData_h traitsDataHandle = nullptr;
+            oa_managerApi_BatchResults_traitsData(nullptr, &traitsDataHandle, _2, 0);
+            (*handles::trait::SharedTraitsData::toInstance(traitsDataHandle))
+                ->addTrait("aTrait");
+          })
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the management policy is queried") {
+        const openassetio::trait::TraitsDatas policies = cManagerInterface.managementPolicy(
+            traitSets, openassetio::access::PolicyAccess::kWrite, context, nullptr);
+
+        THEN("populated elements are returned as-is, and unset elements are unmanaged") {
+          REQUIRE(policies.size() == 2);
+          CHECK(policies[0]->traitSet() == openassetio::trait::TraitSet{"aTrait"});
+          CHECK(policies[1]->traitSet().empty());
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's managementPolicy() call sets an element error") {
+      using trompeloeil::_;
+
+      constexpr oa_ConstStringView kErrorMessage{"some error", 10};
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, managementPolicy(_, _, handle, _, _, _, _, _))
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setError(
+              nullptr, _2, 1, oa_ErrorCode_kBatchElementUnknownError, kErrorMessage))
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the management policy is queried") {
+        THEN("an exception is thrown with the element's error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.managementPolicy(
+                  traitSets, openassetio::access::PolicyAccess::kRead, context, nullptr),
+              openassetio::errors::OpenAssetIOException, Catch::Message("some error"));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's managementPolicy() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, managementPolicy(_, _, handle, _, _, _, _, _))
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the management policy is queried") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.managementPolicy(
+                  traitSets, openassetio::access::PolicyAccess::kRead, context, nullptr),
+              std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no managementPolicy function") {
+      suite.managementPolicy = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("the management policy is queried") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(cManagerInterface.managementPolicy(
+                              traitSets, openassetio::access::PolicyAccess::kRead, context,
+                              nullptr),
+                          openassetio::errors::NotImplementedException);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::isEntityReferenceString") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::Str someString = "some://ref";
+
+    AND_GIVEN("the C suite's isEntityReferenceString() call succeeds") {
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, isEntityReferenceString(_, _, handle, _, _))
+          // Ensure input is a view on the string.
+          .LR_WITH(openassetio::Str(_4.data, _4.size) == someString)
+          // Update out-parameter.
+          .LR_SIDE_EFFECT(*_2 = true)
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the string is queried") {
+        const bool actualIsEntityReferenceString =
+            cManagerInterface.isEntityReferenceString(someString, nullptr);
+
+        THEN("the string is an entity reference") { CHECK(actualIsEntityReferenceString); }
+      }
+    }
+
+    AND_GIVEN("the C suite's isEntityReferenceString() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, isEntityReferenceString(_, _, handle, _, _))
+          // Ensure max size is reasonable.
+          .LR_WITH(_1->capacity == kStringBufferSize)
+          // Update StringView error message out-parameter.
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the string is queried") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(cManagerInterface.isEntityReferenceString(someString, nullptr),
+                                 std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no isEntityReferenceString function") {
+      suite.isEntityReferenceString = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("the string is queried") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(cManagerInterface.isEntityReferenceString(someString, nullptr),
+                          openassetio::errors::NotImplementedException);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::entityExists") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::EntityReferences entityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"},
+        openassetio::EntityReference{"third"}};
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+
+    std::vector<std::pair<std::size_t, bool>> actualSuccesses;
+    std::vector<std::pair<std::size_t, openassetio::errors::BatchElementError>> actualErrors;
+
+    const auto successCallback = [&](const std::size_t idx, const bool exists) {
+      actualSuccesses.emplace_back(idx, exists);
+    };
+    const auto errorCallback = [&](const std::size_t idx,
+                                   openassetio::errors::BatchElementError error) {
+      actualErrors.emplace_back(idx, std::move(error));
+    };
+
+    AND_GIVEN("the C suite's entityExists() call sets values and errors") {
+      using trompeloeil::_;
+
+      const std::array<bool, 1> values{true};
+      constexpr oa_ConstStringView kErrorMessage{"some error", 10};
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, entityExists(_, _, handle, _, _, _))
+          // Ensure inputs are views on the entity references.
+          .LR_WITH(_4.size == entityReferences.size())
+          .LR_WITH(openassetio::Str(_4.data[1].data, _4.data[1].size) == "second")
+          // Populate first element with a value, second with an error,
+          // and leave third unset.
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setBools(nullptr, _2, 0, values.data(),
+                                                              values.size()))
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setError(
+              nullptr, _2, 1, oa_ErrorCode_kBatchElementEntityAccessError, kErrorMessage))
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("existence of the entities is queried") {
+        cManagerInterface.entityExists(entityReferences, context, nullptr, successCallback,
+                                       errorCallback);
+
+        THEN("values are delivered to the success callback") {
+          REQUIRE(actualSuccesses.size() == 1);
+          CHECK(actualSuccesses[0].first == 0);
+          CHECK(actualSuccesses[0].second == true);
+        }
+
+        AND_THEN("errors and unset elements are delivered to the error callback") {
+          using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
+
+          REQUIRE(actualErrors.size() == 2);
+          CHECK(actualErrors[0].first == 1);
+          CHECK(actualErrors[0].second.code == ErrorCode::kEntityAccessError);
+          CHECK(actualErrors[0].second.message == "some error");
+          CHECK(actualErrors[1].first == 2);
+          CHECK(actualErrors[1].second.code == ErrorCode::kUnknown);
+          CHECK(actualErrors[1].second.message == "No result was provided for this element");
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no entityExists function") {
+      suite.entityExists = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("existence of the entities is queried") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(cManagerInterface.entityExists(entityReferences, context, nullptr,
+                                                         successCallback, errorCallback),
+                          openassetio::errors::NotImplementedException);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::resolve") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    const auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+    const openassetio::EntityReferences entityReferences{openassetio::EntityReference{"first"},
+                                                         openassetio::EntityReference{"second"}};
+    const openassetio::trait::TraitSet traitSet{"aTrait"};
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+
+    AND_GIVEN("the C suite's resolve() call populates all elements") {
+      using trompeloeil::_;
+
+      REQUIRE_CALL(mockImpl, resolve(_, _, handle, _, _, oa_access_ResolveAccess_kRead, _, _))
+          .LR_WITH(_5.size == 1)
+          .LR_WITH(openassetio::Str(_5.data[0].data, _5.data[0].size) == "aTrait")
+          // Populate every element with the requested trait.
+          .LR_SIDE_EFFECT(for (std::size_t idx = 0; idx < _4.size; ++idx) {
+            oa_trait_TraitsData_h traitsDataHandle = nullptr;
+            oa_managerApi_BatchResults_traitsData(nullptr, &traitsDataHandle, _2, idx);
+            (*handles::trait::SharedTraitsData::toInstance(traitsDataHandle))
+                ->setTraitProperty("aTrait", "anInt", openassetio::Int(idx));
+          })
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the entities are resolved") {
+        openassetio::trait::TraitsDatas actualTraitsDatas(entityReferences.size());
+
+        cManagerInterface.resolve(
+            entityReferences, traitSet, openassetio::access::ResolveAccess::kRead, context,
+            nullptr,
+            [&](const std::size_t idx, openassetio::trait::TraitsDataPtr traitsData) {
+              actualTraitsDatas[idx] = std::move(traitsData);
+            },
+            [](std::size_t, const openassetio::errors::BatchElementError &) { FAIL(); });
+
+        THEN("populated TraitsData are delivered to the success callback") {
+          for (std::size_t idx = 0; idx < actualTraitsDatas.size(); ++idx) {
+            openassetio::trait::property::Value value;
+            REQUIRE(actualTraitsDatas[idx]);
+            CHECK(actualTraitsDatas[idx]->getTraitProperty(&value, "aTrait", "anInt"));
+            CHECK(std::get<openassetio::Int>(value) == static_cast<openassetio::Int>(idx));
+          }
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's resolve() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      REQUIRE_CALL(mockImpl, resolve(_, _, handle, _, _, _, _, _))
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the entities are resolved") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.resolve(
+                  entityReferences, traitSet, openassetio::access::ResolveAccess::kRead, context,
+                  nullptr, [](std::size_t, const openassetio::trait::TraitsDataPtr &) {},
+                  [](std::size_t, const openassetio::errors::BatchElementError &) {}),
+              std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::preflight") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::EntityReferences entityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"},
+        openassetio::EntityReference{"third"}};
+    const openassetio::trait::TraitsDatas traitsDatas{
+        openassetio::trait::TraitsData::make({"aTrait"}),
+        openassetio::trait::TraitsData::make({"anotherTrait"}),
+        openassetio::trait::TraitsData::make({"aThirdTrait"})};
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+
+    std::vector<std::pair<std::size_t, openassetio::EntityReference>> actualSuccesses;
+    std::vector<std::pair<std::size_t, openassetio::errors::BatchElementError>> actualErrors;
+
+    const auto successCallback = [&](const std::size_t idx,
+                                     openassetio::EntityReference entityReference) {
+      actualSuccesses.emplace_back(idx, std::move(entityReference));
+    };
+    const auto errorCallback = [&](const std::size_t idx,
+                                   openassetio::errors::BatchElementError error) {
+      actualErrors.emplace_back(idx, std::move(error));
+    };
+
+    AND_GIVEN("the C suite's preflight() call sets values and errors") {
+      using trompeloeil::_;
+
+      const std::array<oa_ConstStringView, 1> values{oa_ConstStringView{"first#working", 13}};
+      constexpr oa_ConstStringView kErrorMessage{"some error", 10};
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl,
+                   preflight(_, _, handle, _, _, oa_access_PublishingAccess_kWrite, _, _))
+          // Ensure inputs are views on the entity references.
+          .LR_WITH(_4.size == entityReferences.size())
+          .LR_WITH(openassetio::Str(_4.data[1].data, _4.data[1].size) == "second")
+          // Ensure TraitsData are passed through by handle.
+          .LR_WITH(*handles::trait::SharedTraitsData::toInstance(_5[1]) == traitsDatas[1])
+          // Populate first element with a value, second with an error,
+          // and leave third unset.
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setStrs(nullptr, _2, 0,
+                                                              {values.data(), values.size()}))
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setError(
+              nullptr, _2, 1, oa_ErrorCode_kBatchElementInvalidPreflightHint, kErrorMessage))
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the entities are preflighted") {
+        cManagerInterface.preflight(entityReferences, traitsDatas,
+                                    openassetio::access::PublishingAccess::kWrite, context,
+                                    nullptr, successCallback, errorCallback);
+
+        THEN("values are delivered to the success callback") {
+          REQUIRE(actualSuccesses.size() == 1);
+          CHECK(actualSuccesses[0].first == 0);
+          CHECK(actualSuccesses[0].second == openassetio::EntityReference{"first#working"});
+        }
+
+        AND_THEN("errors and unset elements are delivered to the error callback") {
+          using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
+
+          REQUIRE(actualErrors.size() == 2);
+          CHECK(actualErrors[0].first == 1);
+          CHECK(actualErrors[0].second.code == ErrorCode::kInvalidPreflightHint);
+          CHECK(actualErrors[0].second.message == "some error");
+          CHECK(actualErrors[1].first == 2);
+          CHECK(actualErrors[1].second.code == ErrorCode::kUnknown);
+          CHECK(actualErrors[1].second.message == "No result was provided for this element");
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's preflight() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, preflight(_, _, handle, _, _, _, _, _))
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the entities are preflighted") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.preflight(entityReferences, traitsDatas,
+                                          openassetio::access::PublishingAccess::kWrite, context,
+                                          nullptr, successCallback, errorCallback),
+              std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no preflight function") {
+      suite.preflight = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("the entities are preflighted") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(
+              cManagerInterface.preflight(entityReferences, traitsDatas,
+                                          openassetio::access::PublishingAccess::kWrite, context,
+                                          nullptr, successCallback, errorCallback),
+              openassetio::errors::NotImplementedException);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("A host calls CManagerInterfaceAdapter::register_") {
+  GIVEN("A CManagerInterfaceAdapter wrapping an opaque handle and function suite") {
+    MockCManagerInterfaceImpl mockImpl;
+
+    auto *handle = MockCManagerInterfaceHandleConverter::toHandle(&mockImpl);
+    auto suite = mockManagerInterfaceSuite();
+
+    REQUIRE_CALL(mockImpl, dtor(handle));
+
+    const openassetio::EntityReferences entityReferences{
+        openassetio::EntityReference{"first"}, openassetio::EntityReference{"second"},
+        openassetio::EntityReference{"third"}};
+    const openassetio::trait::TraitsDatas traitsDatas{
+        openassetio::trait::TraitsData::make({"aTrait"}),
+        openassetio::trait::TraitsData::make({"anotherTrait"}),
+        openassetio::trait::TraitsData::make({"aThirdTrait"})};
+    const openassetio::ContextConstPtr context = openassetio::Context::make();
+
+    std::vector<std::pair<std::size_t, openassetio::EntityReference>> actualSuccesses;
+    std::vector<std::pair<std::size_t, openassetio::errors::BatchElementError>> actualErrors;
+
+    const auto successCallback = [&](const std::size_t idx,
+                                     openassetio::EntityReference entityReference) {
+      actualSuccesses.emplace_back(idx, std::move(entityReference));
+    };
+    const auto errorCallback = [&](const std::size_t idx,
+                                   openassetio::errors::BatchElementError error) {
+      actualErrors.emplace_back(idx, std::move(error));
+    };
+
+    AND_GIVEN("the C suite's register_() call sets values and errors") {
+      using trompeloeil::_;
+
+      const std::array<oa_ConstStringView, 1> values{oa_ConstStringView{"first#v1", 8}};
+      constexpr oa_ConstStringView kErrorMessage{"some error", 10};
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl,
+                   register_(_, _, handle, _, _, oa_access_PublishingAccess_kWrite, _, _))
+          // Ensure inputs are views on the entity references.
+          .LR_WITH(_4.size == entityReferences.size())
+          .LR_WITH(openassetio::Str(_4.data[1].data, _4.data[1].size) == "second")
+          // Ensure TraitsData are passed through by handle.
+          .LR_WITH(*handles::trait::SharedTraitsData::toInstance(_5[1]) == traitsDatas[1])
+          // Populate first element with a value, second with an error,
+          // and leave third unset.
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setStrs(nullptr, _2, 0,
+                                                              {values.data(), values.size()}))
+          .LR_SIDE_EFFECT(oa_managerApi_BatchResults_setError(
+              nullptr, _2, 1, oa_ErrorCode_kBatchElementEntityAccessError, kErrorMessage))
+          // Return OK code.
+          .RETURN(oa_ErrorCode_kOK);
+
+      WHEN("the entities are registered") {
+        cManagerInterface.register_(entityReferences, traitsDatas,
+                                    openassetio::access::PublishingAccess::kWrite, context,
+                                    nullptr, successCallback, errorCallback);
+
+        THEN("values are delivered to the success callback") {
+          REQUIRE(actualSuccesses.size() == 1);
+          CHECK(actualSuccesses[0].first == 0);
+          CHECK(actualSuccesses[0].second == openassetio::EntityReference{"first#v1"});
+        }
+
+        AND_THEN("errors and unset elements are delivered to the error callback") {
+          using ErrorCode = openassetio::errors::BatchElementError::ErrorCode;
+
+          REQUIRE(actualErrors.size() == 2);
+          CHECK(actualErrors[0].first == 1);
+          CHECK(actualErrors[0].second.code == ErrorCode::kEntityAccessError);
+          CHECK(actualErrors[0].second.message == "some error");
+          CHECK(actualErrors[1].first == 2);
+          CHECK(actualErrors[1].second.code == ErrorCode::kUnknown);
+          CHECK(actualErrors[1].second.message == "No result was provided for this element");
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite's register_() call fails") {
+      constexpr std::string_view kExpectedErrorMsg = "some error happened";
+      const openassetio::Str expectedErrorCodeAndMsg = "1: some error happened";
+
+      using trompeloeil::_;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      REQUIRE_CALL(mockImpl, register_(_, _, handle, _, _, _, _, _))
+          .LR_SIDE_EFFECT(memcpy(_1->data, kExpectedErrorMsg.data(), kExpectedErrorMsg.size()))
+          .LR_SIDE_EFFECT(_1->size = kExpectedErrorMsg.size())
+          .RETURN(oa_ErrorCode_kUnknown);
+
+      WHEN("the entities are registered") {
+        THEN("an exception is thrown with expected error message") {
+          REQUIRE_THROWS_MATCHES(
+              cManagerInterface.register_(entityReferences, traitsDatas,
+                                          openassetio::access::PublishingAccess::kWrite, context,
+                                          nullptr, successCallback, errorCallback),
+              std::runtime_error, Catch::Message(expectedErrorCodeAndMsg));
+        }
+      }
+    }
+
+    AND_GIVEN("the C suite has no register_ function") {
+      suite.register_ = nullptr;
+
+      openassetio::managerApi::CManagerInterfaceAdapter cManagerInterface{handle, suite};
+
+      WHEN("the entities are registered") {
+        THEN("the default implementation is used") {
+          CHECK_THROWS_AS(
+              cManagerInterface.register_(entityReferences, traitsDatas,
+                                          openassetio::access::PublishingAccess::kWrite, context,
+                                          nullptr, successCallback, errorCallback),
+              openassetio::errors::NotImplementedException);
+        }
+      }
+    }
+  }
+}
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
 #include <openassetio/export.h>  // For OPENASSETIO_CORE_ABI_VERSION
@@ -32,6 +32,47 @@ struct MockCManagerInterfaceImpl {
 
   MAKE_MOCK3(info, oa_ErrorCode(oa_StringView *, oa_InfoDictionary_h,
                                 oa_managerApi_CManagerInterface_h));
+
+  MAKE_MOCK4(hasCapability,
+             oa_ErrorCode(oa_StringView *, bool *, oa_managerApi_CManagerInterface_h,
+                          oa_managerApi_ManagerInterface_Capability));
+
+  MAKE_MOCK4(initialize,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_CManagerInterface_h, oa_InfoDictionary_h,
+                          oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK8(managementPolicy,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_BatchResults_h,
+                          oa_managerApi_CManagerInterface_h, const oa_ConstStringViewArray *,
+                          size_t, oa_access_PolicyAccess, oa_Context_h,
+                          oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK5(isEntityReferenceString,
+             oa_ErrorCode(oa_StringView *, bool *, oa_managerApi_CManagerInterface_h,
+                          oa_ConstStringView, oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK6(entityExists,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_BatchResults_h,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringViewArray,
+                          oa_Context_h, oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK8(resolve,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_BatchResults_h,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringViewArray,
+                          oa_ConstStringViewArray, oa_access_ResolveAccess, oa_Context_h,
+                          oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK8(preflight,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_BatchResults_h,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringViewArray,
+                          const oa_trait_TraitsData_h *, oa_access_PublishingAccess,
+                          oa_Context_h, oa_managerApi_SharedHostSession_h));
+
+  MAKE_MOCK8(register_,
+             oa_ErrorCode(oa_StringView *, oa_managerApi_BatchResults_h,
+                          oa_managerApi_CManagerInterface_h, oa_ConstStringViewArray,
+                          const oa_trait_TraitsData_h *, oa_access_PublishingAccess,
+                          oa_Context_h, oa_managerApi_SharedHostSession_h));
 };
 
 /**
@@ -66,6 +107,67 @@ inline oa_managerApi_CManagerInterface_s mockManagerInterfaceSuite() {
       [](oa_StringView *err, oa_InfoDictionary_h out, oa_managerApi_CManagerInterface_h handle) {
         MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
         return api->info(err, out, handle);
+      },
+      // hasCapability
+      [](oa_StringView *err, bool *out, oa_managerApi_CManagerInterface_h handle,
+         oa_managerApi_ManagerInterface_Capability capability) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->hasCapability(err, out, handle, capability);
+      },
+      // initialize
+      [](oa_StringView *err, oa_managerApi_CManagerInterface_h handle,
+         oa_InfoDictionary_h managerSettings, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->initialize(err, handle, managerSettings, hostSession);
+      },
+      // managementPolicy
+      [](oa_StringView *err, oa_managerApi_BatchResults_h results,
+         oa_managerApi_CManagerInterface_h handle, const oa_ConstStringViewArray *traitSets,
+         size_t numTraitSets, oa_access_PolicyAccess policyAccess, oa_Context_h context,
+         oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->managementPolicy(err, results, handle, traitSets, numTraitSets, policyAccess,
+                                     context, hostSession);
+      },
+      // isEntityReferenceString
+      [](oa_StringView *err, bool *out, oa_managerApi_CManagerInterface_h handle,
+         oa_ConstStringView someString, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->isEntityReferenceString(err, out, handle, someString, hostSession);
+      },
+      // entityExists
+      [](oa_StringView *err, oa_managerApi_BatchResults_h results,
+         oa_managerApi_CManagerInterface_h handle, oa_ConstStringViewArray entityReferences,
+         oa_Context_h context, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->entityExists(err, results, handle, entityReferences, context, hostSession);
+      },
+      // resolve
+      [](oa_StringView *err, oa_managerApi_BatchResults_h results,
+         oa_managerApi_CManagerInterface_h handle, oa_ConstStringViewArray entityReferences,
+         oa_ConstStringViewArray traitSet, oa_access_ResolveAccess resolveAccess,
+         oa_Context_h context, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->resolve(err, results, handle, entityReferences, traitSet, resolveAccess,
+                            context, hostSession);
+      },
+      // preflight
+      [](oa_StringView *err, oa_managerApi_BatchResults_h results,
+         oa_managerApi_CManagerInterface_h handle, oa_ConstStringViewArray entityReferences,
+         const oa_trait_TraitsData_h *traitsDatas, oa_access_PublishingAccess publishingAccess,
+         oa_Context_h context, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->preflight(err, results, handle, entityReferences, traitsDatas,
+                              publishingAccess, context, hostSession);
+      },
+      // register_
+      [](oa_StringView *err, oa_managerApi_BatchResults_h results,
+         oa_managerApi_CManagerInterface_h handle, oa_ConstStringViewArray entityReferences,
+         const oa_trait_TraitsData_h *traitsDatas, oa_access_PublishingAccess publishingAccess,
+         oa_Context_h context, oa_managerApi_SharedHostSession_h hostSession) {
+        MockCManagerInterfaceImpl *api = MockCManagerInterfaceHandleConverter::toInstance(handle);
+        return api->register_(err, results, handle, entityReferences, traitsDatas,
+                              publishingAccess, context, hostSession);
       }};
 }
 }  // namespace test
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+
+#include <openassetio/c/InfoDictionary.h>
+#include <openassetio/c/StringView.h>
+#include <openassetio/c/errors.h>
+#include <openassetio/c/trait/TraitsData.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/typedefs.hpp>
+
+// Private headers.
+#include <handles/trait/TraitsData.hpp>
+
+#include "../StringViewReporting.hpp"
+
+using openassetio::trait::TraitsData;
+using openassetio::trait::TraitsDataPtr;
+namespace handles = openassetio::handles;
+
+namespace {
+/// Default storage capacity for StringView C strings.
+constexpr std::size_t kStrStorageCapacity = 500;
+
+constexpr oa_ConstStringView kTraitId{"aTrait", 6};
+constexpr oa_ConstStringView kBoolKey{"aBool", 5};
+constexpr oa_ConstStringView kIntKey{"anInt", 5};
+constexpr oa_ConstStringView kFloatKey{"aFloat", 6};
+constexpr oa_ConstStringView kStrKey{"aStr", 4};
+constexpr oa_ConstStringView kMissingKey{"missing", 7};
+
+/**
+ * Fixture providing a pre-populated TraitsData and its C handle, as
+ * well as storage for error messages.
+ */
+struct TraitsDataFixture {
+  TraitsDataPtr traitsData = [] {
+    TraitsDataPtr data = TraitsData::make();
+    data->setTraitProperty("aTrait", "aBool", true);
+    data->setTraitProperty("aTrait", "anInt", openassetio::Int{123});
+    data->setTraitProperty("aTrait", "aFloat", 4.56);
+    data->setTraitProperty("aTrait", "aStr", openassetio::Str{"some string"});
+    return data;
+  }();
+
+  oa_trait_TraitsData_h handle = handles::trait::SharedTraitsData::toHandle(&traitsData);
+
+  openassetio::Str errStorage = openassetio::Str(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+};
+}  // namespace
+
+SCENARIO("TraitsData construction and destruction") {
+  openassetio::Str errStorage(kStrStorageCapacity, '\0');
+  oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+  GIVEN("a TraitsData handle constructed using the C API") {
+    oa_trait_TraitsData_h handle = nullptr;
+    const oa_ErrorCode actualErrorCode = oa_trait_TraitsData_ctor(&actualErrorMsg, &handle);
+    CHECK(actualErrorCode == oa_ErrorCode_kOK);
+
+    WHEN("handle is converted to a C++ instance") {
+      const TraitsDataPtr& traitsData = *handles::trait::SharedTraitsData::toInstance(handle);
+
+      THEN("instance is an empty TraitsData") {
+        CHECK(traitsData->traitSet().empty());
+
+        AND_WHEN("dtor function is called") {
+          oa_trait_TraitsData_dtor(handle);
+
+          THEN("TraitsData is deallocated") {
+            // Rely on ASan to detect.
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Querying and adding traits via the C API") {
+  GIVEN("a populated TraitsData") {
+    TraitsDataFixture fixture;
+
+    WHEN("an existing trait is queried") {
+      bool hasTrait = false;
+      const oa_ErrorCode actualErrorCode = oa_trait_TraitsData_hasTrait(
+          &fixture.actualErrorMsg, &hasTrait, fixture.handle, kTraitId);
+
+      THEN("trait is found") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(hasTrait);
+      }
+    }
+
+    WHEN("a new trait is added") {
+      constexpr oa_ConstStringView kNewTraitId{"newTrait", 8};
+      const oa_ErrorCode actualErrorCode =
+          oa_trait_TraitsData_addTrait(&fixture.actualErrorMsg, fixture.handle, kNewTraitId);
+
+      THEN("trait is added to the TraitsData") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOK);
+        CHECK(fixture.traitsData->hasTrait("newTrait"));
+      }
+    }
+  }
+}
+
+SCENARIO("Retrieving trait property values via the C API") {
+  GIVEN("a populated TraitsData") {
+    TraitsDataFixture fixture;
+
+    WHEN("the types of properties are queried") {
+      oa_InfoDictionary_ValueType boolType{};
+      oa_InfoDictionary_ValueType intType{};
+      oa_InfoDictionary_ValueType floatType{};
+      oa_InfoDictionary_ValueType strType{};
+
+      CHECK(oa_trait_TraitsData_typeOfTraitProperty(&fixture.actualErrorMsg, &boolType,
+                                                    fixture.handle, kTraitId,
+                                                    kBoolKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_typeOfTraitProperty(&fixture.actualErrorMsg, &intType,
+                                                    fixture.handle, kTraitId,
+                                                    kIntKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_typeOfTraitProperty(&fixture.actualErrorMsg, &floatType,
+                                                    fixture.handle, kTraitId,
+                                                    kFloatKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_typeOfTraitProperty(&fixture.actualErrorMsg, &strType,
+                                                    fixture.handle, kTraitId,
+                                                    kStrKey) == oa_ErrorCode_kOK);
+
+      THEN("expected types are returned") {
+        CHECK(boolType == oa_InfoDictionary_ValueType_kBool);
+        CHECK(intType == oa_InfoDictionary_ValueType_kInt);
+        CHECK(floatType == oa_InfoDictionary_ValueType_kFloat);
+        CHECK(strType == oa_InfoDictionary_ValueType_kStr);
+      }
+    }
+
+    WHEN("values are retrieved with the correct type") {
+      bool boolValue = false;
+      std::int64_t intValue = 0;
+      double floatValue = 0;
+      openassetio::Str strStorage(kStrStorageCapacity, '\0');
+      oa_StringView strValue{strStorage.size(), strStorage.data(), 0};
+
+      CHECK(oa_trait_TraitsData_getTraitPropertyBool(&fixture.actualErrorMsg, &boolValue,
+                                                     fixture.handle, kTraitId,
+                                                     kBoolKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_getTraitPropertyInt(&fixture.actualErrorMsg, &intValue,
+                                                    fixture.handle, kTraitId,
+                                                    kIntKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_getTraitPropertyFloat(&fixture.actualErrorMsg, &floatValue,
+                                                      fixture.handle, kTraitId,
+                                                      kFloatKey) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_getTraitPropertyStr(&fixture.actualErrorMsg, &strValue,
+                                                    fixture.handle, kTraitId,
+                                                    kStrKey) == oa_ErrorCode_kOK);
+
+      THEN("expected values are returned") {
+        CHECK(boolValue);
+        CHECK(intValue == 123);
+        CHECK(floatValue == 4.56);
+        CHECK(strValue == "some string");
+      }
+    }
+
+    WHEN("a value is retrieved with the wrong type") {
+      bool boolValue = false;
+      const oa_ErrorCode actualErrorCode = oa_trait_TraitsData_getTraitPropertyBool(
+          &fixture.actualErrorMsg, &boolValue, fixture.handle, kTraitId, kIntKey);
+
+      THEN("an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kBadVariantAccess);
+        CHECK(fixture.actualErrorMsg == "Invalid value type");
+      }
+    }
+
+    WHEN("a missing value is retrieved") {
+      bool boolValue = false;
+      const oa_ErrorCode actualErrorCode = oa_trait_TraitsData_getTraitPropertyBool(
+          &fixture.actualErrorMsg, &boolValue, fixture.handle, kTraitId, kMissingKey);
+
+      THEN("an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kOutOfRange);
+        CHECK(fixture.actualErrorMsg == "Invalid trait property");
+      }
+    }
+
+    WHEN("a string value is retrieved into insufficient storage") {
+      openassetio::Str strStorage(4, '\0');
+      oa_StringView strValue{strStorage.size(), strStorage.data(), 0};
+
+      const oa_ErrorCode actualErrorCode = oa_trait_TraitsData_getTraitPropertyStr(
+          &fixture.actualErrorMsg, &strValue, fixture.handle, kTraitId, kStrKey);
+
+      THEN("the value is truncated and an error is returned") {
+        CHECK(actualErrorCode == oa_ErrorCode_kLengthError);
+        CHECK(fixture.actualErrorMsg == "Insufficient storage for return value");
+        CHECK(strValue == "some");
+      }
+    }
+  }
+}
+
+SCENARIO("Setting trait property values via the C API") {
+  GIVEN("an empty TraitsData") {
+    TraitsDataPtr traitsData = TraitsData::make();
+    oa_trait_TraitsData_h handle = handles::trait::SharedTraitsData::toHandle(&traitsData);
+
+    openassetio::Str errStorage(kStrStorageCapacity, '\0');
+    oa_StringView actualErrorMsg{errStorage.size(), errStorage.data(), 0};
+
+    WHEN("values are set") {
+      constexpr oa_ConstStringView kStrValue{"some string", 11};
+
+      CHECK(oa_trait_TraitsData_setTraitPropertyBool(&actualErrorMsg, handle, kTraitId, kBoolKey,
+                                                     true) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_setTraitPropertyInt(&actualErrorMsg, handle, kTraitId, kIntKey,
+                                                    123) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_setTraitPropertyFloat(&actualErrorMsg, handle, kTraitId,
+                                                      kFloatKey, 4.56) == oa_ErrorCode_kOK);
+      CHECK(oa_trait_TraitsData_setTraitPropertyStr(&actualErrorMsg, handle, kTraitId, kStrKey,
+                                                    kStrValue) == oa_ErrorCode_kOK);
+
+      THEN("values are stored in the TraitsData") {
+        openassetio::trait::property::Value value;
+
+        CHECK(traitsData->getTraitProperty(&value, "aTrait", "aBool"));
+        CHECK(std::get<openassetio::Bool>(value) == true);
+        CHECK(traitsData->getTraitProperty(&value, "aTrait", "anInt"));
+        CHECK(std::get<openassetio::Int>(value) == 123);
+        CHECK(traitsData->getTraitProperty(&value, "aTrait", "aFloat"));
+        CHECK(std::get<openassetio::Float>(value) == 4.56);
+        CHECK(traitsData->getTraitProperty(&value, "aTrait", "aStr"));
+        CHECK(std::get<openassetio::Str>(value) == "some string");
+      }
+    }
+  }
+}
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <atomic>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+OPENASSETIO_DECLARE_PTR(CancellationToken)
+
+/**
+ * A flag used by a @ref host to request that in-progress API calls
+ * stop early.
+ *
+ * A token is attached to a @fqref{Context} "Context" by the host, and
+ * may be cancelled from any thread. Cancellation is cooperative:
+ * @ref manager implementations should check
+ * @fqref{Context.isExpired} "Context.isExpired" periodically during
+ * long-running batch operations, and return early if it is set.
+ *
+ * The same token may be shared between many contexts, e.g. a parent
+ * and its children, such that they can be cancelled together.
+ */
+class OPENASSETIO_CORE_EXPORT CancellationToken final {
+ public:
+  OPENASSETIO_ALIAS_PTR(CancellationToken)
+
+  /**
+   * Constructs a new, uncancelled, token.
+   */
+  [[nodiscard]] static CancellationTokenPtr make();
+
+  /**
+   * Request cancellation of calls using this token.
+   *
+   * This cannot be undone.
+   */
+  void cancel();
+
+  /**
+   * @return Whether @ref cancel has been called.
+   */
+  [[nodiscard]] bool isCancelled() const;
+
+ private:
+  CancellationToken() = default;
+
+  std::atomic_bool isCancelled_{false};
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
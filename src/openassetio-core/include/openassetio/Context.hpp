@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include <openassetio/export.h>
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/typedefs.hpp>
 
@@ -28,6 +31,15 @@ OPENASSETIO_DECLARE_PTR(Context)
  * The Context is passed to many calls in this API, and it may, or may
  * not need to be used directly.
  *
+ * A host may bound the time taken by calls using this context by
+ * setting a @ref deadline, and/or may cancel them via a @ref
+ * cancellationToken. Managers should check @ref isExpired periodically
+ * during long-running operations, and stop early if set. Any elements
+ * of a batch that the manager has not completed once the context has
+ * expired are reported to the host with a
+ * @fqref{errors.BatchElementError.ErrorCode.kTimeout} "kTimeout"
+ * error.
+ *
  * @warning Contexts should never be directly constructed. Hosts should
  * use @fqref{hostApi.Manager.createContext} "createContext" or
  * @fqref{hostApi.Manager.createChildContext} "createChildContext". A
@@ -64,6 +76,23 @@ class OPENASSETIO_CORE_EXPORT Context final {
    */
   managerApi::ManagerStateBasePtr managerState;
 
+  /// Clock used to measure the @ref deadline.
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * The time by which calls using this context should complete, if
+   * any.
+   *
+   * @see @ref setTimeout
+   */
+  std::optional<Clock::time_point> deadline;
+
+  /**
+   * Token that the host may use to cancel calls using this context, if
+   * any.
+   */
+  CancellationTokenPtr cancellationToken;
+
   /**
    * Constructs a new context.
    *
@@ -74,6 +103,31 @@ class OPENASSETIO_CORE_EXPORT Context final {
   [[nodiscard]] static ContextPtr make(trait::TraitsDataPtr locale = trait::TraitsData::make(),
                                        managerApi::ManagerStateBasePtr managerState = nullptr);
 
+  /**
+   * Set the @ref deadline relative to the current time.
+   *
+   * The deadline saturates at the latest representable time point,
+   * rather than overflowing, for very long timeouts.
+   *
+   * @param timeout Maximum time that calls using this context should
+   * take.
+   */
+  void setTimeout(Clock::duration timeout);
+
+  /**
+   * @return The time remaining until the @ref deadline, clamped to
+   * zero, or an empty optional if there is no deadline.
+   */
+  [[nodiscard]] std::optional<Clock::duration> remainingTime() const;
+
+  /**
+   * Check whether calls using this context should stop early.
+   *
+   * @return `true` if the @ref deadline has passed or the @ref
+   * cancellationToken has been cancelled, otherwise `false`.
+   */
+  [[nodiscard]] bool isExpired() const;
+
  private:
   Context(trait::TraitsDataPtr locale, managerApi::ManagerStateBasePtr managerState);
 };
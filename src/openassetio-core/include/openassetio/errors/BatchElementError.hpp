@@ -138,6 +138,20 @@ class BatchElementError final {
      * details of the reason.
      */
     kAuthError = internal::errors::kBatchElementAuthError,
+
+    /**
+     * Error code indicating that the element was not completed before
+     * the @fqref{Context.deadline} "deadline" of the @ref Context
+     * passed, or before the Context's
+     * @fqref{Context.cancellationToken} "cancellationToken" was
+     * cancelled.
+     *
+     * This is reported by the API middleware for any elements that
+     * the manager has not completed by the time it returns, if the
+     * Context has expired. Managers may also report it themselves
+     * for elements they skip when stopping early.
+     */
+    kTimeout = internal::errors::kBatchElementTimeout,
   };
 
   /**
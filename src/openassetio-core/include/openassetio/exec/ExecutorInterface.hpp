@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ This namespace contains code relevant to the execution of work across
+ multiple threads.
+
+ A @ref host "Host" may supply an implementation of @ref
+ ExecutorInterface when starting an API session, which is then made
+ available to the @ref manager via the
+ @fqref{managerApi.HostSession} "HostSession". This allows the manager
+ to parallelise work on the same threads as the host, rather than
+ creating its own and oversubscribing the machine.
+*/
+namespace exec {
+OPENASSETIO_DECLARE_PTR(ExecutorInterface)
+/**
+ * An abstract base class that defines an interface for running tasks
+ * concurrently.
+ *
+ * @see @ref ThreadPool
+ * @see @ref TbbArenaExecutor
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+class OPENASSETIO_CORE_EXPORT ExecutorInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(ExecutorInterface)
+
+  /// A unit of work.
+  using Task = std::function<void()>;
+
+  /// Body of a @ref parallelFor loop, taking the iteration index.
+  using LoopBody = std::function<void(std::size_t)>;
+
+  /// Defaulted polymorphic destructor.
+  virtual ~ExecutorInterface();
+
+  /**
+   * The maximum number of tasks that may run at the same time.
+   *
+   * This can be used to choose how finely to divide work.
+   */
+  [[nodiscard]] virtual std::size_t concurrency() const = 0;
+
+  /**
+   * Schedule a task to run asynchronously.
+   *
+   * There are no guarantees as to when, or on which thread, the task
+   * runs. Exceptions thrown by the task cannot be propagated to the
+   * caller, so tasks should handle their own errors. How any escaping
+   * exceptions are reported is up to the implementation.
+   *
+   * @param task Task to run.
+   */
+  virtual void submit(Task task) = 0;
+
+  /**
+   * Call a function for each index in `[0, count)`, blocking until all
+   * calls have completed.
+   *
+   * Calls may run concurrently and in any order. The calling thread
+   * participates in the work, so it is safe to call this method from
+   * within a task, i.e. nested parallelism will not deadlock.
+   *
+   * The default implementation divides the range into chunks, and
+   * claims them from the calling thread and from helper tasks
+   * scheduled via @ref submit.
+   *
+   * @param count Number of iterations.
+   *
+   * @param body Function to call for each iteration.
+   *
+   * @throws Rethrows the first exception thrown by @p body, if any,
+   * once all in-flight calls have completed. Further iterations are
+   * skipped once an exception is thrown.
+   */
+  virtual void parallelFor(std::size_t count, const LoopBody& body);
+};
+}  // namespace exec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines TbbArenaExecutor, an adapter allowing hosts to share an
+ * existing TBB arena with managers.
+ *
+ * This header is not included by OpenAssetIO itself, so OpenAssetIO
+ * has no dependency on TBB. Hosts that use TBB may include it, making
+ * TBB available on their include path.
+ */
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace exec {
+OPENASSETIO_DECLARE_PTR(TbbArenaExecutor)
+/**
+ * An executor that runs tasks in a TBB `task_arena`.
+ *
+ * This allows a @ref host that already uses TBB to supply its own
+ * arena to a @fqref{managerApi.HostSession} "HostSession", such that
+ * work scheduled by the @ref manager is balanced alongside the host's
+ * own work, rather than competing with it for cores.
+ *
+ * @warning The arena must outlive this executor, and any tasks
+ * submitted to it.
+ */
+class TbbArenaExecutor final : public ExecutorInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(TbbArenaExecutor)
+
+  /**
+   * Creates a new instance of the TbbArenaExecutor.
+   *
+   * @param arena Arena in which to run tasks.
+   */
+  [[nodiscard]] static TbbArenaExecutorPtr make(tbb::task_arena& arena) {
+    return std::shared_ptr<TbbArenaExecutor>(new TbbArenaExecutor(arena));
+  }
+
+  /**
+   * The maximum concurrency of the arena.
+   */
+  [[nodiscard]] std::size_t concurrency() const override {
+    return static_cast<std::size_t>(arena_->max_concurrency());
+  }
+
+  /**
+   * Enqueue a task into the arena.
+   *
+   * @param task Task to run.
+   */
+  void submit(Task task) override {
+    arena_->enqueue([task = std::move(task)] {
+      try {
+        task();
+      } catch (...) {  // NOLINT(bugprone-empty-catch)
+        // Consistent with other executors, task exceptions are
+        // discarded rather than terminating the process.
+      }
+    });
+  }
+
+  /**
+   * Run a `tbb::parallel_for` within the arena.
+   *
+   * @param count Number of iterations.
+   *
+   * @param body Function to call for each iteration.
+   */
+  void parallelFor(const std::size_t count, const LoopBody& body) override {
+    arena_->execute([count, &body] {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>{0, count},
+                        [&body](const tbb::blocked_range<std::size_t>& range) {
+                          for (std::size_t idx = range.begin(); idx != range.end(); ++idx) {
+                            body(idx);
+                          }
+                        });
+    });
+  }
+
+ private:
+  explicit TbbArenaExecutor(tbb::task_arena& arena) : arena_{&arena} {}
+
+  tbb::task_arena* arena_;
+};
+}  // namespace exec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace exec {
+OPENASSETIO_DECLARE_PTR(ThreadPool)
+/**
+ * A work-stealing pool of threads.
+ *
+ * Each worker thread has its own queue of tasks. Tasks submitted from
+ * a worker (e.g. nested work) are pushed to, and popped from, the back
+ * of that worker's queue, so they run in last-in first-out order on a
+ * warm cache. Tasks submitted from other threads are distributed
+ * between the queues. A worker whose own queue is empty steals from
+ * the front of the other queues, i.e. the oldest, typically largest,
+ * tasks.
+ *
+ * Worker threads are started on first use. Any tasks remaining in the
+ * queues are run before the pool is destroyed.
+ *
+ * Exceptions escaping a task cannot be propagated to the submitter, so
+ * are logged with `kError` severity, if the pool has a
+ * @fqref{log.LoggerInterface} "logger", then discarded.
+ *
+ * @warning The pool must not be destroyed from one of its own tasks.
+ */
+class OPENASSETIO_CORE_EXPORT ThreadPool final : public ExecutorInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(ThreadPool)
+
+  /**
+   * Creates a new instance of the ThreadPool.
+   *
+   * @param numThreads Number of worker threads. If zero, uses the
+   * number of hardware threads available.
+   *
+   * @param logger Logger used to report exceptions that escape a task.
+   * If null, such exceptions are silently discarded.
+   */
+  [[nodiscard]] static ThreadPoolPtr make(std::size_t numThreads = 0,
+                                          log::LoggerInterfacePtr logger = nullptr);
+
+  /**
+   * A process-wide pool, sized to the number of hardware threads.
+   *
+   * This is used by a @fqref{managerApi.HostSession} "HostSession" if
+   * no other executor is provided by the host, so that all API
+   * sessions in the process share the same threads.
+   *
+   * Exceptions escaping a task are logged to a
+   * @fqref{log.ConsoleLogger} "ConsoleLogger".
+   *
+   * The pool is never destroyed, so its worker threads are not joined
+   * during static destruction, when tasks may still reference objects
+   * that have already been destroyed.
+   */
+  [[nodiscard]] static const ThreadPoolPtr& defaultPool();
+
+  /**
+   * Runs any remaining tasks, then stops the worker threads.
+   */
+  ~ThreadPool() override;
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) noexcept = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool& operator=(ThreadPool&&) noexcept = delete;
+
+  /**
+   * The number of worker threads.
+   */
+  [[nodiscard]] std::size_t concurrency() const override;
+
+  /**
+   * Schedule a task to run on a worker thread.
+   *
+   * @param task Task to run.
+   */
+  void submit(Task task) override;
+
+ private:
+  ThreadPool(std::size_t numThreads, log::LoggerInterfacePtr logger);
+
+  /// Queues and worker thread state.
+  struct Workers;
+
+  std::unique_ptr<Workers> workers_;
+};
+}  // namespace exec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
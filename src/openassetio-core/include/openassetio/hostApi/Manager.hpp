@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -59,6 +60,26 @@ OPENASSETIO_DECLARE_PTR(Manager)
  *
  * The Manager API is threadsafe and can be called from multiple
  * threads concurrently.
+ *
+ * Batch methods respect the @fqref{Context.deadline} "deadline" and
+ * @fqref{Context.cancellationToken} "cancellationToken" of the
+ * supplied @fqref{Context} "Context". If the context has expired
+ * before the call, the manager is not consulted. If it has expired
+ * by the time the manager returns, then any elements the manager did
+ * not report are reported to the error callback with a
+ * @fqref{errors.BatchElementError.ErrorCode.kTimeout} "kTimeout"
+ * error. Convenience signatures surface these errors according to
+ * their error policy, as with any other error.
+ *
+ * The callback signatures of the batch methods stream results to the
+ * host as they become available. A host that only needs part of a
+ * batch, e.g. the first few entities that exist, can stop the batch
+ * early by cancelling the context's cancellation token from within a
+ * callback. No further results are then forwarded to the host, and
+ * well-behaved managers will stop work on the remainder of the batch.
+ * The elements not yet reported are reported as
+ * @fqref{errors.BatchElementError.ErrorCode.kTimeout} "kTimeout", so
+ * each element still receives exactly one callback.
  */
 class OPENASSETIO_CORE_EXPORT Manager final {
  public:
@@ -332,6 +353,45 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    */
   void flushCaches();
 
+  /**
+   * Atomically replaces the underlying manager implementation, for
+   * example with one loaded from an updated plugin library.
+   *
+   * This allows long-lived hosts to upgrade a manager plugin without
+   * needing to recreate their Manager instances, or any state built
+   * around them.
+   *
+   * The replacement is first initialized with the @ref settings of
+   * the current implementation, and its required capabilities
+   * verified. Only if this succeeds is it swapped in. Calls already
+   * in progress on other threads complete using the previous
+   * implementation, which is released once the last of them returns.
+   * Subsequent calls are directed to the replacement.
+   *
+   * A typical workflow, when using the @ref
+   * pluginSystem.CppPluginSystemManagerImplementationFactory
+   * "CppPluginSystemManagerImplementationFactory", is
+   *
+   * @code{.cpp}
+   * factory->reload();
+   * manager->replaceImplementation(factory->instantiate(manager->identifier()));
+   * @endcode
+   *
+   * @note Any manager state held by existing @fqref{Context} "Context"
+   * objects was created by the previous implementation. Hosts should
+   * create new contexts after replacing the implementation.
+   *
+   * @param managerInterface The replacement implementation. Must have
+   * the same @ref identifier as the current implementation.
+   *
+   * @throws errors.InputValidationException if the replacement has a
+   * different identifier.
+   *
+   * @throws errors.ConfigurationException if the replacement does not
+   * support the required capabilities.
+   */
+  void replaceImplementation(managerApi::ManagerInterfacePtr managerInterface);
+
   /**
    * @}
    */
@@ -503,6 +563,11 @@ class OPENASSETIO_CORE_EXPORT Manager final {
    *  @note The locale is deep-copied so that the child's locale can be
    *  freely modified without affecting the parent.
    *
+   *  @note The @fqref{Context.deadline} "deadline" is copied and the
+   *  @fqref{Context.cancellationToken} "cancellationToken" is shared,
+   *  so cancelling the parent's token also cancels calls made using
+   *  the child.
+   *
    *  @warning Contexts should never be directly constructed, always
    *  use this method or @ref createContext to create a new one.
    *
@@ -3057,10 +3122,37 @@ class OPENASSETIO_CORE_EXPORT Manager final {
   explicit Manager(managerApi::ManagerInterfacePtr managerInterface,
                    managerApi::HostSessionPtr hostSession);
 
-  managerApi::ManagerInterfacePtr managerInterface_;
-  managerApi::HostSessionPtr hostSession_;
+  /**
+   * Manager implementation along with any state derived from it.
+   *
+   * Instances are immutable once published, so that they can be
+   * swapped out whilst calls are in progress.
+   */
+  struct Implementation {
+    managerApi::ManagerInterfacePtr managerInterface;
+    std::optional<openassetio::Str> entityReferencePrefix;
+  };
+  using ImplementationConstPtr = std::shared_ptr<const Implementation>;
 
-  std::optional<openassetio::Str> entityReferencePrefix_;
+  /// Atomically retrieve the current implementation.
+  [[nodiscard]] ImplementationConstPtr implementation() const;
+  /// Atomically publish a new implementation.
+  void setImplementation(Implementation implementation);
+  /**
+   * Snapshot of the current manager interface. The returned pointer
+   * keeps the implementation alive for the duration of a call, even if
+   * it is concurrently replaced.
+   */
+  [[nodiscard]] managerApi::ManagerInterfacePtr managerInterface() const;
+
+  ImplementationConstPtr implementation_;
+  /**
+   * Serialises changes to the implementation, such that concurrent
+   * `initialize` and `replaceImplementation` calls cannot overwrite
+   * each other's result.
+   */
+  std::mutex implementationMutex_;
+  managerApi::HostSessionPtr hostSession_;
 };
 }  // namespace hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -2,6 +2,8 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 #include <string_view>
 #include <unordered_map>
@@ -11,6 +13,7 @@
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/typedefs.hpp>
 
+OPENASSETIO_FWD_DECLARE(exec, ExecutorInterface)
 OPENASSETIO_FWD_DECLARE(hostApi, HostInterface)
 OPENASSETIO_FWD_DECLARE(hostApi, Manager)
 OPENASSETIO_FWD_DECLARE(hostApi, ManagerImplementationFactoryInterface)
@@ -117,6 +120,27 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
       log::LoggerInterfacePtr logger);
 
+  /**
+   * Construct an instance of this class, with an executor to be shared
+   * with instantiated managers.
+   *
+   * @param hostInterface See above.
+   *
+   * @param managerImplementationFactory See above.
+   *
+   * @param logger See above.
+   *
+   * @param executor The executor made available to managers via
+   * their @fqref{managerApi.HostSession} "HostSession", such that they
+   * parallelise work on the host's threads. If not provided, the
+   * process-wide @fqref{exec.ThreadPool.defaultPool}
+   * "ThreadPool.defaultPool" is used.
+   */
+  [[nodiscard]] static ManagerFactoryPtr make(
+      HostInterfacePtr hostInterface,
+      ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
+      log::LoggerInterfacePtr logger, exec::ExecutorInterfacePtr executor);
+
   /**
    * All identifiers known to the factory.
    *
@@ -159,6 +183,74 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
    */
   [[nodiscard]] ManagerPtr createManager(const Identifier& identifier) const;
 
+  /**
+   * Default duration that a shared manager may remain unreferenced
+   * before it is evicted from the pool.
+   *
+   * @see @ref sharedManager
+   * @see @ref setSharedManagerIdleTimeout
+   */
+  static constexpr std::chrono::seconds kDefaultSharedManagerIdleTimeout{300};
+
+  /**
+   * Retrieve an initialized @fqref{hostApi.Manager} "Manager" instance
+   * from a pool of managers shared between callers.
+   *
+   * Managers are pooled by identifier and settings. The first call for
+   * a given combination creates and initializes a new manager, exactly
+   * as if @ref createManager followed by
+   * @fqref{hostApi.Manager.initialize} "Manager.initialize" had been
+   * called. Subsequent calls with the same identifier and equal
+   * settings return the same underlying manager, avoiding the cost of
+   * repeated plugin instantiation and initialization.
+   *
+   * Each returned pointer holds a reference on the pooled manager.
+   * Once all such references have been released the manager becomes
+   * idle, and is evicted from the pool (and so destroyed, unless
+   * referenced elsewhere) after the configured idle timeout has
+   * elapsed. Eviction is performed lazily, during subsequent calls to
+   * this method or to @ref evictIdleSharedManagers.
+   *
+   * If initialization fails, the exception is propagated and the next
+   * call for the same identifier and settings will retry.
+   *
+   * @warning Since the manager is shared, callers must not call
+   * @fqref{hostApi.Manager.initialize} "initialize" on the returned
+   * instance, as this would change the settings observed by all other
+   * callers.
+   *
+   * @param identifier Unique manager identifier.
+   *
+   * @param settings Settings to initialize the manager with.
+   *
+   * @return Shared, initialized manager.
+   */
+  [[nodiscard]] ManagerPtr sharedManager(const Identifier& identifier,
+                                         const InfoDictionary& settings) const;
+
+  /**
+   * Set the duration that a shared manager may remain unreferenced
+   * before it is evicted from the pool.
+   *
+   * A zero duration evicts idle managers at the next opportunity.
+   *
+   * @param idleTimeout Idle duration before eviction.
+   *
+   * @see @ref kDefaultSharedManagerIdleTimeout
+   */
+  void setSharedManagerIdleTimeout(std::chrono::milliseconds idleTimeout);
+
+  /**
+   * Evict shared managers that have been unreferenced for longer than
+   * the configured idle timeout.
+   *
+   * Hosts may call this periodically, e.g. from an idle callback, to
+   * release resources held by managers that are no longer in use.
+   *
+   * @return Number of managers evicted from the pool.
+   */
+  std::size_t evictIdleSharedManagers() const;
+
   /**
    * Create a @fqref{hostApi.Manager} "Manager" instance for the @ref
    * manager associated with the given identifier.
@@ -189,6 +281,29 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
       const log::LoggerInterfacePtr& logger);
 
+  /**
+   * Create a @fqref{hostApi.Manager} "Manager" instance for the @ref
+   * manager associated with the given identifier, with an executor to
+   * be shared with the manager.
+   *
+   * @param identifier See above.
+   *
+   * @param hostInterface See above.
+   *
+   * @param managerImplementationFactory See above.
+   *
+   * @param logger See above.
+   *
+   * @param executor The executor made available to the manager via
+   * its @fqref{managerApi.HostSession} "HostSession".
+   *
+   * @return Newly instantiated manager.
+   */
+  [[nodiscard]] static ManagerPtr createManagerForInterface(
+      const Identifier& identifier, const HostInterfacePtr& hostInterface,
+      const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+      const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor);
+
   /**
    * Creates the default @fqref{hostApi.Manager} "Manager" as defined by
    * the TOML configuration file referenced by the
@@ -226,6 +341,30 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
       const log::LoggerInterfacePtr& logger);
 
+  /**
+   * Creates the default @fqref{hostApi.Manager} "Manager" as defined by
+   * the TOML configuration file referenced by the
+   * @ref default_config_var, with an executor to be shared with the
+   * manager.
+   *
+   * @param hostInterface See above.
+   *
+   * @param managerImplementationFactory See above.
+   *
+   * @param logger See above.
+   *
+   * @param executor The executor made available to the manager via
+   * its @fqref{managerApi.HostSession} "HostSession".
+   *
+   * @returns A default-configured manager if
+   * @ref default_config_var is set, otherwise a nullptr if
+   * the var was not set.
+   */
+  [[nodiscard]] static ManagerPtr defaultManagerForInterface(
+      const HostInterfacePtr& hostInterface,
+      const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+      const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor);
+
   /**
    * Creates the default @fqref{hostApi.Manager} "Manager" as defined by
    * the given TOML configuration file.
@@ -278,14 +417,43 @@ class OPENASSETIO_CORE_EXPORT ManagerFactory final {
       const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
       const log::LoggerInterfacePtr& logger);
 
+  /**
+   * Creates the default @fqref{hostApi.Manager} "Manager" as defined by
+   * the given TOML configuration file, with an executor to be shared
+   * with the manager.
+   *
+   * @param configPath See above.
+   *
+   * @param hostInterface See above.
+   *
+   * @param managerImplementationFactory See above.
+   *
+   * @param logger See above.
+   *
+   * @param executor The executor made available to the manager via
+   * its @fqref{managerApi.HostSession} "HostSession".
+   *
+   * @return A default-configured manager.
+   */
+  [[nodiscard]] static ManagerPtr defaultManagerForInterface(
+      std::string_view configPath, const HostInterfacePtr& hostInterface,
+      const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+      const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor);
+
  private:
   ManagerFactory(HostInterfacePtr hostInterface,
                  ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
-                 log::LoggerInterfacePtr logger);
+                 log::LoggerInterfacePtr logger, exec::ExecutorInterfacePtr executor);
+
+  /// Pool of initialized managers backing @ref sharedManager.
+  struct SharedManagerPool;
+  using SharedManagerPoolPtr = std::shared_ptr<SharedManagerPool>;
 
   HostInterfacePtr hostInterface_;
   ManagerImplementationFactoryInterfacePtr managerImplementationFactory_;
   log::LoggerInterfacePtr logger_;
+  exec::ExecutorInterfacePtr executor_;
+  SharedManagerPoolPtr sharedManagerPool_;
 };
 
 }  // namespace hostApi
@@ -36,7 +36,8 @@ enum ErrorCode : std::size_t {
   kBatchElementEntityResolutionError,
   kBatchElementInvalidPreflightHint,
   kBatchElementInvalidTraitSet,
-  kBatchElementAuthError
+  kBatchElementAuthError,
+  kBatchElementTimeout
 };
 }  // namespace errors
 
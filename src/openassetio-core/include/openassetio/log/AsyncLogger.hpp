@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+OPENASSETIO_DECLARE_PTR(AsyncLogger)
+/**
+ * The AsyncLogger is a wrapper for a logger that defers delivery of
+ * messages to a background thread.
+ *
+ * Messages are placed in a bounded, lock-free ring buffer, which is
+ * drained in order by a dedicated worker thread that relays each
+ * message to the @ref upstreamLogger. Logging threads therefore do not
+ * contend on (potentially slow) upstream I/O, such as the `stderr`
+ * lock held by @ref ConsoleLogger.
+ *
+ * When the buffer is full, behaviour is determined by the configured
+ * @ref OverflowPolicy. Messages that are dropped due to overflow are
+ * counted, and a summary warning is relayed to the @ref upstreamLogger
+ * once the buffer has space.
+ *
+ * Any messages remaining in the buffer are delivered before the logger
+ * is destroyed. @ref flush can be used to wait for delivery at other
+ * times.
+ *
+ * @warning The @ref upstreamLogger must not log back into this
+ * logger, since it is called from the worker thread.
+ */
+class OPENASSETIO_CORE_EXPORT AsyncLogger final : public LoggerInterface {
+ public:
+  OPENASSETIO_ALIAS_PTR(AsyncLogger)
+
+  /**
+   * Behaviour when a message is logged whilst the buffer is full.
+   */
+  // NOLINTNEXTLINE(performance-enum-size)
+  enum class OverflowPolicy {
+    /// Discard the message.
+    kDrop,
+    /// Wait until space is available in the buffer.
+    kBlock,
+    /**
+     * Wait for space for every `sampleInterval`th overflowing message,
+     * discarding the rest.
+     */
+    kSample
+  };
+
+  /// Default maximum number of messages held in the buffer.
+  static constexpr std::size_t kDefaultCapacity = 8192;
+
+  /// Default sampling interval for @ref OverflowPolicy.kSample.
+  static constexpr std::size_t kDefaultSampleInterval = 100;
+
+  /**
+   * Creates a new instance of the AsyncLogger, starting its worker
+   * thread.
+   *
+   * @param upstreamLogger A logger that will receive messages on the
+   * worker thread.
+   *
+   * @param capacity Maximum number of messages held in the buffer.
+   * Rounded up to the next power of two.
+   *
+   * @param overflowPolicy Behaviour when the buffer is full.
+   *
+   * @param sampleInterval For @ref OverflowPolicy.kSample, the
+   * interval at which overflowing messages are retained.
+   *
+   * @throws errors.InputValidationException if @p capacity or @p
+   * sampleInterval is zero.
+   */
+  [[nodiscard]] static AsyncLoggerPtr make(
+      LoggerInterfacePtr upstreamLogger, std::size_t capacity = kDefaultCapacity,
+      OverflowPolicy overflowPolicy = OverflowPolicy::kBlock,
+      std::size_t sampleInterval = kDefaultSampleInterval);
+
+  /**
+   * Delivers any pending messages, then stops the worker thread.
+   */
+  ~AsyncLogger() override;
+
+  AsyncLogger(const AsyncLogger&) = delete;
+  AsyncLogger(AsyncLogger&&) noexcept = delete;
+  AsyncLogger& operator=(const AsyncLogger&) = delete;
+  AsyncLogger& operator=(AsyncLogger&&) noexcept = delete;
+
+  /**
+   * Returns the logger wrapped by this logger.
+   */
+  [[nodiscard]] LoggerInterfacePtr upstreamLogger() const;
+
+  /**
+   * Returns the maximum number of messages held in the buffer.
+   */
+  [[nodiscard]] std::size_t capacity() const;
+
+  /**
+   * Returns the behaviour when the buffer is full.
+   */
+  [[nodiscard]] OverflowPolicy overflowPolicy() const;
+
+  /**
+   * Returns the total number of messages discarded due to overflow
+   * since construction.
+   */
+  [[nodiscard]] std::size_t droppedCount() const;
+
+  /**
+   * Block until all messages logged by the calling thread prior to
+   * this call have been delivered to the @ref upstreamLogger.
+   */
+  void flush();
+
+  /**
+   * Check if given severity will be logged.
+   *
+   * Delegates to the @ref upstreamLogger.
+   *
+   * @param severity Severity to check.
+   *
+   * @return Whether a log message at the given severity will be output.
+   */
+  [[nodiscard]] bool isSeverityLogged(Severity severity) const override;
+
+  /**
+   * Queue a message for delivery to the @ref upstreamLogger.
+   *
+   * @param severity Severity level.
+   *
+   * @param message The message to be logged.
+   */
+  void log(Severity severity, const Str& message) override;
+
+ private:
+  AsyncLogger(LoggerInterfacePtr upstreamLogger, std::size_t capacity,
+              OverflowPolicy overflowPolicy, std::size_t sampleInterval);
+
+  /// Ring buffer and worker thread state.
+  struct Worker;
+
+  LoggerInterfacePtr upstreamLogger_;
+  OverflowPolicy overflowPolicy_;
+  std::size_t sampleInterval_;
+  std::unique_ptr<Worker> worker_;
+};
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
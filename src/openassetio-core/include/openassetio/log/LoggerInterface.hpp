@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <array>
+#include <utility>
 
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
@@ -86,6 +87,36 @@ class OPENASSETIO_CORE_EXPORT LoggerInterface {
    */
   [[nodiscard]] virtual bool isSeverityLogged(Severity severity) const;
 
+  /**
+   * Logs a message that is only constructed if it will be output.
+   *
+   * The supplied callable is invoked to construct the message only if
+   * @ref isSeverityLogged returns `true` for the given severity, so
+   * the cost of formatting messages that are filtered out is avoided.
+   * This is preferable to @ref log for messages that are expensive to
+   * construct, especially at lower severities such as
+   * @ref Severity.kDebug "kDebug".
+   *
+   * @code{.cpp}
+   * logger->logDeferred(Severity::kDebug, [&] {
+   *   return fmt::format("Resolved {} entities", refs.size());
+   * });
+   * @endcode
+   *
+   * @tparam MessageFn Callable taking no arguments and returning a
+   * value convertible to `Str`.
+   *
+   * @param severity Severity level.
+   *
+   * @param messageFn Callable that constructs the message.
+   */
+  template <class MessageFn>
+  void logDeferred(const Severity severity, MessageFn&& messageFn) {
+    if (isSeverityLogged(severity)) {
+      log(severity, std::forward<MessageFn>(messageFn)());
+    }
+  }
+
   /**
    * @name Conveniences
    * @{
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2013-2022 The Foundry Visionmongers Ltd
+// Copyright 2013-2025 The Foundry Visionmongers Ltd
 #pragma once
 
 #include <memory>
@@ -7,6 +7,7 @@
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
 
+OPENASSETIO_FWD_DECLARE(exec, ExecutorInterface)
 OPENASSETIO_FWD_DECLARE(log, LoggerInterface)
 OPENASSETIO_FWD_DECLARE(managerApi, Host)
 
@@ -32,9 +33,13 @@ OPENASSETIO_DECLARE_PTR(HostSession)
  *     session.
  *   - A concrete instance of the @fqref{log.LoggerInterface}
  *     "LoggerInterface", to be used for all message reporting.
+ *   - A concrete instance of the @fqref{exec.ExecutorInterface}
+ *     "ExecutorInterface", to be used for any concurrent work, such
+ *     that it shares threads with the host.
  *
  * @see @fqref{managerApi.Host} "Host"
  * @see @fqref{log.LoggerInterface} "LoggerInterface"
+ * @see @fqref{exec.ExecutorInterface} "ExecutorInterface"
  */
 class OPENASSETIO_CORE_EXPORT HostSession final {
  public:
@@ -42,9 +47,19 @@ class OPENASSETIO_CORE_EXPORT HostSession final {
 
   /**
    * Constructs a new HostSession holding the supplied host.
+   *
+   * The session's executor is the process-wide
+   * @fqref{exec.ThreadPool.defaultPool} "ThreadPool.defaultPool".
    */
   [[nodiscard]] static HostSessionPtr make(HostPtr host, log::LoggerInterfacePtr logger);
 
+  /**
+   * Constructs a new HostSession holding the supplied host and
+   * executor.
+   */
+  [[nodiscard]] static HostSessionPtr make(HostPtr host, log::LoggerInterfacePtr logger,
+                                           exec::ExecutorInterfacePtr executor);
+
   /**
    * @return The host that initiated the API session.
    */
@@ -55,10 +70,17 @@ class OPENASSETIO_CORE_EXPORT HostSession final {
    */
   [[nodiscard]] const log::LoggerInterfacePtr& logger() const;
 
+  /**
+   * @return The executor associated with this session, to be used to
+   * parallelise work on the host's threads.
+   */
+  [[nodiscard]] const exec::ExecutorInterfacePtr& executor() const;
+
  private:
-  explicit HostSession(HostPtr host, log::LoggerInterfacePtr logger);
+  HostSession(HostPtr host, log::LoggerInterfacePtr logger, exec::ExecutorInterfacePtr executor);
   HostPtr host_;
   log::LoggerInterfacePtr logger_;
+  exec::ExecutorInterfacePtr executor_;
 };
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -119,6 +119,19 @@ OPENASSETIO_DECLARE_PTR(ManagerInterface)
  * There should be no persistent state in the implementation, concepts
  * such as getError(), etc.. for example should not be used.
  *
+ * Deadlines and cancellation
+ * --------------------------
+ *
+ * A host may bound a call with a @fqref{Context.deadline} "deadline",
+ * or stop it early via a @fqref{Context.cancellationToken}
+ * "cancellationToken", often cancelled by the host from within one of
+ * the callbacks once it has enough results. Implementations processing
+ * large batches should check @fqref{Context.isExpired}
+ * "Context.isExpired" periodically, e.g. between elements or chunks,
+ * and return without reporting the remaining elements once it is set.
+ * These will then be reported to the host as having timed out on your
+ * behalf.
+ *
  * Hosts
  * -----
  *
@@ -152,6 +165,22 @@ OPENASSETIO_DECLARE_PTR(ManagerInterface)
  *
  * @see @ref initialize
  *
+ * Batch results in Python
+ * -----------------------
+ *
+ * Python implementations may optionally define a batch variant of
+ * @ref entityExists, @ref entityTraits, @ref resolve, @ref preflight
+ * and @ref register_, named by appending `Batch` to the Python method
+ * name (e.g. `resolveBatch`). A batch variant takes the same arguments
+ * as the original method, minus the callbacks, and returns a sequence
+ * with one element per input, each either a result or a
+ * @fqref{errors.BatchElementError} "BatchElementError".
+ *
+ * If a batch variant is defined, it is used in preference to the
+ * callback-based method when called from C++ (e.g. via a
+ * @fqref{hostApi.Manager} "Manager"). This avoids a round trip across
+ * the language boundary for every element of large batches.
+ *
  * @note OpenAssetIO makes use of shared pointers to facilitate object
  * lifetime management across multiple languages. Instances passed into
  * API methods via shared pointer may have their lifetimes extended
@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2024 The Foundry Visionmongers Ltd
+// Copyright 2024-2025 The Foundry Visionmongers Ltd
 #pragma once
 #include <filesystem>
 #include <memory>
@@ -87,6 +87,35 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
    */
   void scan(std::string_view paths);
 
+  /**
+   * Re-scan the supplied paths, picking up new versions of plugins
+   * without disrupting any that are currently in use.
+   *
+   * The paths are searched as per @ref scan, and the resulting set of
+   * plugins replaces those previously registered. Where a newly
+   * discovered plugin library differs from the one currently providing
+   * the same identifier, it is loaded alongside the old library,
+   * rather than in place of it.
+   *
+   * Plugin libraries that are superseded by this call, or that are no
+   * longer found in the search paths, are retired. A retired library
+   * is never unloaded, since objects instantiated by its plugins (such
+   * as a @ref managerApi.ManagerInterface "ManagerInterface" or the
+   * manager state held by a @ref Context) may still be in use.
+   *
+   * @note Most platforms will return the already-loaded library when
+   * asked to load a file at the same path, even if the file on disk
+   * has since changed. Updated plugins must therefore be deployed
+   * under a new file name (e.g. with a version suffix) in order to be
+   * loaded alongside their predecessor. A warning is logged if a
+   * plugin library is found to have been modified in place.
+   *
+   * @param paths A list of paths to search, delimited by operating
+   * system specific path separator (i.e. `:` for POSIX, `;` for
+   * Windows).
+   */
+  void reload(std::string_view paths);
+
   /**
    * Returns the identifiers known to the plugin system.
    *
@@ -107,14 +136,25 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
   const PathAndPlugin& plugin(const openassetio::Identifier& identifier) const;
 
  private:
+  /// Loaded shared library, see CppPluginSystem.cpp.
+  struct Library;
+  /// Shared ownership of a loaded library.
+  using LibraryPtr = std::shared_ptr<Library>;
   /// Mapping of plugin identifier to file path and instance.
   using PluginMap = std::unordered_map<openassetio::Identifier, PathAndPlugin>;
-  /// Optional pair of plugin identifier and instance.
-  using MaybeIdentifierAndPlugin =
-      std::optional<std::pair<openassetio::Identifier, CppPluginSystemPluginPtr>>;
+  /// Mapping of plugin identifier to the library providing it.
+  using LibraryMap = std::unordered_map<openassetio::Identifier, LibraryPtr>;
+  /// Plugin identifier, instance and the library providing it.
+  struct LoadedPlugin {
+    openassetio::Identifier identifier;
+    CppPluginSystemPluginPtr plugin;
+    LibraryPtr library;
+  };
+  /// Optional loaded plugin.
+  using MaybeLoadedPlugin = std::optional<LoadedPlugin>;
   /// Attempt to load a plugin at a given path, returning nullopt on
   /// failure.
-  MaybeIdentifierAndPlugin maybeLoadPlugin(const std::filesystem::path& filePath);
+  MaybeLoadedPlugin maybeLoadPlugin(const std::filesystem::path& filePath);
 
   /// Private constructor. See @ref make.
   explicit CppPluginSystem(log::LoggerInterfacePtr logger);
@@ -124,6 +164,8 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystem {
   /// Map of discovered plugin identifiers to their file path and
   /// instance.
   PluginMap plugins_;
+  /// Map of discovered plugin identifiers to their library.
+  LibraryMap libraries_;
 };
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -99,6 +99,21 @@ class OPENASSETIO_CORE_EXPORT CppPluginSystemManagerImplementationFactory
    */
   managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
 
+  /**
+   * Re-scan the search paths for updated plugins.
+   *
+   * Subsequent calls to @ref instantiate will use the updated plugins.
+   * Previously instantiated `ManagerInterface` instances are unaffected
+   * and keep their plugin library loaded until they are destroyed.
+   *
+   * This can be combined with @fqref{hostApi.Manager.replaceImplementation}
+   * "Manager.replaceImplementation" to upgrade a manager plugin in a
+   * running process.
+   *
+   * @see CppPluginSystem.reload
+   */
+  void reload();
+
  private:
   /// Private constructor. See @ref make.
   explicit CppPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
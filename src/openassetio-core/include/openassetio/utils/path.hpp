@@ -1,11 +1,15 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2024 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/typedefs.hpp>
 
 namespace openassetio {
@@ -24,6 +28,69 @@ enum class PathType : std::uint8_t {
   kWindows
 };
 
+/**
+ * Output of a batch conversion using @ref FileUrlPathConverter.
+ *
+ * Converted strings are packed contiguously into a single buffer,
+ * rather than allocating a string per element. An instance can be
+ * reused across batch conversions, in which case the capacity of its
+ * buffers is retained, so that converting a batch of a similar size
+ * requires no further allocations.
+ */
+struct PathBatchResult {
+  /// Converted strings of all elements, concatenated.
+  Str bytes;
+
+  /**
+   * Offset of each element within @ref bytes, followed by the offset
+   * of the end of the final element.
+   *
+   * I.e. element `i` spans `[offsets[i], offsets[i+1])`, and the size
+   * is one more than the number of elements.
+   */
+  std::vector<std::size_t> offsets;
+
+  /**
+   * Errors for elements that could not be converted, paired with the
+   * index of the element, in ascending index order.
+   *
+   * Error codes are always @ref errors::BatchElementError::ErrorCode
+   * "kUnknown", with the message matching that of the exception that
+   * would be thrown by the equivalent single-element conversion.
+   *
+   * The converted string of a failed element is empty.
+   */
+  std::vector<std::pair<std::size_t, errors::BatchElementError>> elementErrors;
+
+  /**
+   * Get the number of elements.
+   *
+   * @return Number of elements in the batch.
+   */
+  [[nodiscard]] std::size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+  /**
+   * Get the converted string of an element.
+   *
+   * No bounds checking is performed.
+   *
+   * @param index Index of element.
+   * @return View of the converted string within @ref bytes.
+   */
+  [[nodiscard]] std::string_view operator[](const std::size_t index) const {
+    return std::string_view{bytes}.substr(offsets[index], offsets[index + 1] - offsets[index]);
+  }
+
+  /**
+   * Remove all elements, retaining allocated capacity.
+   */
+  void clear() {
+    bytes.clear();
+    offsets.clear();
+    elementErrors.clear();
+  }
+};
+
 /**
  * Utility class for converting between file system paths and file URLs.
  *
@@ -112,6 +179,42 @@ class OPENASSETIO_CORE_EXPORT FileUrlPathConverter {
   [[nodiscard]] Str pathFromUrl(std::string_view fileUrl,
                                 PathType pathType = PathType::kSystem) const;
 
+  /**
+   * Construct file URLs from a batch of paths.
+   *
+   * Equivalent to calling the single-element @ref pathToUrl for each
+   * path, but with the results packed into a single caller-owned
+   * buffer, and with invalid paths reported per-element rather than
+   * throwing an exception.
+   *
+   * @param absolutePaths Path strings.
+   *
+   * @param result Output buffer, whose contents are replaced. Any
+   * existing capacity is reused.
+   *
+   * @param pathType Platform associated with all paths.
+   */
+  void pathToUrl(const std::vector<std::string_view> &absolutePaths, PathBatchResult &result,
+                 PathType pathType = PathType::kSystem) const;
+
+  /**
+   * Construct paths from a batch of file URLs.
+   *
+   * Equivalent to calling the single-element @ref pathFromUrl for each
+   * URL, but with the results packed into a single caller-owned
+   * buffer, and with invalid URLs reported per-element rather than
+   * throwing an exception.
+   *
+   * @param fileUrls URLs to convert.
+   *
+   * @param result Output buffer, whose contents are replaced. Any
+   * existing capacity is reused.
+   *
+   * @param pathType Platform associated with all paths.
+   */
+  void pathFromUrl(const std::vector<std::string_view> &fileUrls, PathBatchResult &result,
+                   PathType pathType = PathType::kSystem) const;
+
  private:
   std::unique_ptr<struct FileUrlPathConverterImpl> impl_;
 };
@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2023 The Foundry Visionmongers Ltd
+// Copyright 2023-2025 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 #include <openassetio/export.h>
 
@@ -42,9 +45,195 @@ namespace utils {
  *
  * @throws errors.InputValidationException if a substitution variable is
  * not found in the dictionary.
+ *
+ * @see CompiledTemplate for repeated substitution into the same input
+ * string.
  */
 OPENASSETIO_CORE_EXPORT openassetio::Str substitute(
     std::string_view input, const openassetio::InfoDictionary& substitutions);
+
+/**
+ * Input string for @ref substitute, parsed ahead of time.
+ *
+ * Parsing the input string, including any format specifiers, and
+ * resolving its placeholders, is done once on construction.
+ * Substitution then only has to format the values of the placeholders,
+ * optionally into a reusable buffer. This
+ * makes it appropriate for hot loops, e.g. constructing a path for
+ * each of a large batch of entities.
+ *
+ * The syntax of the input string is as for @ref substitute, with the
+ * exception that all placeholders must be named. I.e. automatic
+ * (`{}`) and numeric (`{0}`) placeholders, as well as nested
+ * placeholders within a format specifier (`{key:{width}}`), are not
+ * supported.
+ *
+ * Each unique placeholder name is assigned a slot, in order of first
+ * appearance in the input string. Values can then be provided either
+ * as a dictionary keyed by placeholder name, or as an array of values
+ * ordered by slot.
+ *
+ * Instances are immutable, so can be shared across threads.
+ */
+class OPENASSETIO_CORE_EXPORT CompiledTemplate {
+ public:
+  /**
+   * Parse an input string.
+   *
+   * @param input The string in which substitutions are to be made.
+   *
+   * @throws errors.InputValidationException if the input string is
+   * malformed or uses unsupported placeholders.
+   */
+  explicit CompiledTemplate(std::string_view input);
+
+  /**
+   * Get the input string that this template was constructed from.
+   *
+   * @return Input string.
+   */
+  [[nodiscard]] const Str& input() const;
+
+  /**
+   * Get the unique placeholder names in the input string.
+   *
+   * The index of a name in the list is its slot, i.e. its position in
+   * an array of positional values.
+   *
+   * @return Placeholder names, in order of first appearance.
+   */
+  [[nodiscard]] const std::vector<Str>& placeholders() const;
+
+  /**
+   * Substitute placeholders using a dictionary mapping of placeholder
+   * names to values.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values. Extra keys are ignored.
+   *
+   * @return The input string with all substitutions made.
+   *
+   * @throws errors.InputValidationException if a placeholder is not
+   * found in the dictionary, or its value cannot be formatted using
+   * the placeholder's format specifier.
+   */
+  [[nodiscard]] Str substitute(const InfoDictionary& substitutions) const;
+
+  /**
+   * Substitute placeholders using a dictionary mapping of placeholder
+   * names to values, into an existing string.
+   *
+   * The output string is overwritten, reusing its existing capacity.
+   *
+   * @param substitutions The dictionary containing the keys to be
+   * replaced and their corresponding values. Extra keys are ignored.
+   *
+   * @param[out] result String to receive the input string with all
+   * substitutions made. Contents are unspecified if an exception is
+   * thrown.
+   *
+   * @throws errors.InputValidationException if a placeholder is not
+   * found in the dictionary, or its value cannot be formatted using
+   * the placeholder's format specifier.
+   */
+  void substitute(const InfoDictionary& substitutions, Str& result) const;
+
+  /**
+   * Substitute placeholders using an array of values ordered by slot.
+   *
+   * @param values Values of each placeholder, in the order given by
+   * @ref placeholders.
+   *
+   * @return The input string with all substitutions made.
+   *
+   * @throws errors.InputValidationException if the number of values
+   * does not match the number of placeholders, or a value cannot be
+   * formatted using its placeholder's format specifier.
+   */
+  [[nodiscard]] Str substitute(const std::vector<InfoDictionaryValue>& values) const;
+
+  /**
+   * Substitute placeholders using an array of values ordered by slot,
+   * into an existing string.
+   *
+   * The output string is overwritten, reusing its existing capacity.
+   *
+   * @param values Values of each placeholder, in the order given by
+   * @ref placeholders.
+   *
+   * @param[out] result String to receive the input string with all
+   * substitutions made. Contents are unspecified if an exception is
+   * thrown.
+   *
+   * @throws errors.InputValidationException if the number of values
+   * does not match the number of placeholders, or a value cannot be
+   * formatted using its placeholder's format specifier.
+   */
+  void substitute(const std::vector<InfoDictionaryValue>& values, Str& result) const;
+
+  /**
+   * Substitute placeholders using each of a batch of dictionaries.
+   *
+   * @param substitutionsBatch Dictionaries containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @return The input string with all substitutions made, for each
+   * dictionary, in the same order.
+   *
+   * @throws errors.InputValidationException if any substitution fails.
+   * The message includes the index of the offending dictionary.
+   */
+  [[nodiscard]] std::vector<Str> substitute(
+      const std::vector<InfoDictionary>& substitutionsBatch) const;
+
+  /**
+   * Substitute placeholders using each of a batch of dictionaries,
+   * into existing strings.
+   *
+   * The output list is resized to match the input, reusing the
+   * existing capacity of each of its strings.
+   *
+   * @param substitutionsBatch Dictionaries containing the keys to be
+   * replaced and their corresponding values.
+   *
+   * @param[out] results Strings to receive the input string with all
+   * substitutions made, for each dictionary, in the same order.
+   * Contents are unspecified if an exception is thrown.
+   *
+   * @throws errors.InputValidationException if any substitution fails.
+   * The message includes the index of the offending dictionary.
+   */
+  void substitute(const std::vector<InfoDictionary>& substitutionsBatch,
+                  std::vector<Str>& results) const;
+
+ private:
+  /// Formatters for a placeholder's format specifier, pre-parsed for
+  /// each type of value.
+  struct SpecFormatters;
+
+  /// Placeholder in the input string.
+  struct Field {
+    /// End of the literal text preceding the placeholder, as an
+    /// offset into literals_.
+    std::size_t literalEnd;
+    /// Index into placeholders_.
+    std::size_t slot;
+    /// Formatters for the value, or null if there is no format
+    /// specifier.
+    std::shared_ptr<const SpecFormatters> specFormatters;
+  };
+
+  template <class ValueForSlot>
+  void render(const ValueForSlot& valueForSlot, Str& result) const;
+
+  [[noreturn]] void throwSubstitutionError(std::string_view message) const;
+
+  Str input_;
+  /// Literal text of the input string, with `{{`/`}}` unescaped.
+  Str literals_;
+  std::vector<Field> fields_;
+  std::vector<Str> placeholders_;
+};
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <atomic>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/CancellationToken.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+CancellationTokenPtr CancellationToken::make() {
+  return std::shared_ptr<CancellationToken>(new CancellationToken);
+}
+
+void CancellationToken::cancel() { isCancelled_.store(true, std::memory_order_release); }
+
+bool CancellationToken::isCancelled() const {
+  return isCancelled_.load(std::memory_order_acquire);
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
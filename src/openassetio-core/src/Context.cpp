@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include <openassetio/export.h>
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 
@@ -16,5 +19,30 @@ ContextPtr Context::make(trait::TraitsDataPtr locale,
 
 Context::Context(trait::TraitsDataPtr locale_, managerApi::ManagerStateBasePtr managerState_)
     : locale{std::move(locale_)}, managerState{std::move(managerState_)} {}
+
+void Context::setTimeout(const Clock::duration timeout) {
+  const Clock::time_point now = Clock::now();
+  // Saturate, rather than overflow, for very long timeouts (e.g. a
+  // Python `timedelta.max`).
+  if (timeout > Clock::time_point::max() - now) {
+    deadline = Clock::time_point::max();
+    return;
+  }
+  // A negative timeout has already expired, so clamp it to avoid
+  // underflow.
+  deadline = now + std::max(timeout, Clock::duration::zero());
+}
+
+std::optional<Context::Clock::duration> Context::remainingTime() const {
+  if (!deadline) {
+    return std::nullopt;
+  }
+  return std::max(*deadline - Clock::now(), Clock::duration::zero());
+}
+
+bool Context::isExpired() const {
+  return (cancellationToken && cancellationToken->isCancelled()) ||
+         (deadline && Clock::now() >= *deadline);
+}
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -41,6 +41,8 @@ Str errorCodeName(BatchElementError::ErrorCode code) {
       return "invalidTraitSet";
     case BatchElementError::ErrorCode::kAuthError:
       return "authError";
+    case BatchElementError::ErrorCode::kTimeout:
+      return "timeout";
   }
 
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/exec/ExecutorInterface.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace exec {
+namespace {
+/**
+ * Number of chunks to aim for per unit of concurrency. More chunks
+ * than threads allows faster threads to pick up the slack.
+ */
+constexpr std::size_t kChunksPerThread = 4;
+
+/**
+ * State shared between the caller of `parallelFor` and its helpers.
+ *
+ * Helper tasks may outlive the `parallelFor` call (e.g. if they are
+ * still queued when the caller finishes the last chunk), so they only
+ * touch the loop body whilst registered as active, and the caller does
+ * not return until no helpers are active.
+ */
+struct LoopState {
+  LoopState(const std::size_t count_, const std::size_t chunkSize_,
+            const ExecutorInterface::LoopBody& body_)
+      : count{count_}, chunkSize{chunkSize_}, body{&body_} {}
+
+  /// Claim and run chunks until none remain.
+  void runChunks() {
+    while (true) {
+      const std::size_t begin = nextIdx.fetch_add(chunkSize, std::memory_order_relaxed);
+      if (begin >= count) {
+        return;
+      }
+      const std::size_t end = std::min(begin + chunkSize, count);
+      try {
+        for (std::size_t idx = begin; idx < end; ++idx) {
+          (*body)(idx);
+        }
+      } catch (...) {
+        const std::lock_guard lock{mutex};
+        if (!error) {
+          error = std::current_exception();
+        }
+        // Prevent any further chunks from being claimed.
+        nextIdx.store(count, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+
+  /// Entry point for helper tasks.
+  void help() {
+    {
+      const std::lock_guard lock{mutex};
+      if (isFinished) {
+        return;
+      }
+      ++numActiveHelpers;
+    }
+    runChunks();
+    const std::lock_guard lock{mutex};
+    --numActiveHelpers;
+    helperDoneCondition.notify_all();
+  }
+
+  /// Wait for active helpers, and stop any further helpers starting.
+  void finish() {
+    std::unique_lock lock{mutex};
+    isFinished = true;
+    helperDoneCondition.wait(lock, [this] { return numActiveHelpers == 0; });
+  }
+
+  const std::size_t count;
+  const std::size_t chunkSize;
+  const ExecutorInterface::LoopBody* body;
+  std::atomic<std::size_t> nextIdx{0};
+
+  std::mutex mutex;
+  std::condition_variable helperDoneCondition;
+  // Guarded by mutex.
+  std::size_t numActiveHelpers{0};
+  bool isFinished{false};
+  std::exception_ptr error;
+};
+}  // namespace
+
+ExecutorInterface::~ExecutorInterface() = default;
+
+void ExecutorInterface::parallelFor(const std::size_t count, const LoopBody& body) {
+  if (count == 0) {
+    return;
+  }
+  const std::size_t numThreads = std::min(std::max(concurrency(), std::size_t{1}), count);
+  if (numThreads == 1) {
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      body(idx);
+    }
+    return;
+  }
+
+  const std::size_t numChunks = std::min(numThreads * kChunksPerThread, count);
+  const std::size_t chunkSize = (count + numChunks - 1) / numChunks;
+  const auto state = std::make_shared<LoopState>(count, chunkSize, body);
+
+  // The calling thread is the first worker, so only request helpers
+  // for the remainder.
+  for (std::size_t helperIdx = 1; helperIdx < numThreads; ++helperIdx) {
+    try {
+      submit([state] { state->help(); });
+    } catch (...) {
+      // Helpers are an optimisation, so if the executor can't accept
+      // any more tasks then the remaining threads pick up the slack.
+      break;
+    }
+  }
+  state->runChunks();
+  state->finish();
+
+  if (state->error) {
+    std::rethrow_exception(state->error);
+  }
+}
+}  // namespace exec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
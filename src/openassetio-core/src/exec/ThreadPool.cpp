@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/exec/ThreadPool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/log/ConsoleLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace exec {
+
+namespace {
+/// Size of a cache line, used to avoid false sharing of queues.
+constexpr std::size_t kCacheLineSize = 64;
+}  // namespace
+
+/**
+ * Per-worker task queues, plus the worker threads that consume them.
+ *
+ * Each queue has its own mutex, so workers only contend when stealing.
+ * The count of pending tasks is used to put idle workers to sleep. It
+ * is incremented before a task is queued, so a worker never sleeps
+ * whilst a task is queued, though it may briefly spin whilst a task is
+ * in the process of being queued.
+ */
+struct ThreadPool::Workers {
+  struct alignas(kCacheLineSize) Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  Workers(const std::size_t numThreads, log::LoggerInterfacePtr logger)
+      : queues(numThreads), logger{std::move(logger)} {}
+
+  /// Start the worker threads, if not already started.
+  void start() {
+    std::call_once(startedFlag, [this] {
+      threads.reserve(queues.size());
+      for (std::size_t idx = 0; idx < queues.size(); ++idx) {
+        threads.emplace_back([this, idx] { run(idx); });
+      }
+    });
+  }
+
+  void push(Task task) {
+    std::size_t queueIdx = 0;
+    if (currentWorkers == this) {
+      queueIdx = currentQueueIdx;
+    } else {
+      queueIdx = nextQueueIdx.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    }
+    {
+      const std::lock_guard lock{sleepMutex};
+      pendingCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+      Queue& queue = queues[queueIdx];
+      const std::lock_guard lock{queue.mutex};
+      queue.tasks.push_back(std::move(task));
+    }
+    wakeCondition.notify_one();
+  }
+
+  /// Pop from the back of our own queue, else steal from the front of another.
+  bool tryPop(const std::size_t ownIdx, Task& task) {
+    {
+      Queue& queue = queues[ownIdx];
+      const std::lock_guard lock{queue.mutex};
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+      }
+    }
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+      Queue& queue = queues[(ownIdx + offset) % queues.size()];
+      const std::lock_guard lock{queue.mutex};
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Worker thread entry point.
+  void run(const std::size_t ownIdx) {
+    currentWorkers = this;
+    currentQueueIdx = ownIdx;
+
+    Task task;
+    while (true) {
+      if (tryPop(ownIdx, task)) {
+        pendingCount.fetch_sub(1, std::memory_order_relaxed);
+        runTask(task);
+        task = nullptr;
+        continue;
+      }
+
+      std::unique_lock lock{sleepMutex};
+      wakeCondition.wait(lock, [this] {
+        return isStopping || pendingCount.load(std::memory_order_relaxed) != 0;
+      });
+      if (isStopping && pendingCount.load(std::memory_order_relaxed) == 0) {
+        return;
+      }
+    }
+  }
+
+  /// Run a task, logging rather than propagating any exception.
+  void runTask(const Task& task) const {
+    try {
+      task();
+    } catch (const std::exception& exc) {
+      logTaskError(exc.what());
+    } catch (...) {
+      logTaskError("Unknown non-exception object thrown");
+    }
+  }
+
+  void logTaskError(const char* const reason) const {
+    if (!logger) {
+      return;
+    }
+    try {
+      logger->log(log::LoggerInterface::Severity::kError,
+                  Str{"Uncaught exception in ThreadPool task: "} + reason);
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // There is nowhere to report a failure of the logger itself, and
+      // an escaping exception would terminate the process.
+    }
+  }
+
+  void stop() {
+    {
+      const std::lock_guard lock{sleepMutex};
+      isStopping = true;
+    }
+    wakeCondition.notify_all();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+  }
+
+  /// The pool that the current thread is a worker of, if any.
+  static thread_local const Workers* currentWorkers;
+  /// The queue owned by the current thread, if a worker.
+  static thread_local std::size_t currentQueueIdx;
+
+  std::vector<Queue> queues;
+  const log::LoggerInterfacePtr logger;
+  std::vector<std::thread> threads;
+  std::once_flag startedFlag;
+
+  alignas(kCacheLineSize) std::atomic<std::size_t> nextQueueIdx{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> pendingCount{0};
+
+  std::mutex sleepMutex;
+  std::condition_variable wakeCondition;
+  // Guarded by sleepMutex.
+  bool isStopping{false};
+};
+
+thread_local const ThreadPool::Workers* ThreadPool::Workers::currentWorkers = nullptr;
+thread_local std::size_t ThreadPool::Workers::currentQueueIdx = 0;
+
+ThreadPoolPtr ThreadPool::make(std::size_t numThreads, log::LoggerInterfacePtr logger) {
+  if (numThreads == 0) {
+    numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  return std::shared_ptr<ThreadPool>(new ThreadPool(numThreads, std::move(logger)));
+}
+
+const ThreadPoolPtr& ThreadPool::defaultPool() {
+  // Intentionally leaked, see docs.
+  static const auto* pool =
+      new ThreadPoolPtr{make(0, log::ConsoleLogger::make())};  // NOLINT(*-owning-memory)
+  return *pool;
+}
+
+ThreadPool::ThreadPool(const std::size_t numThreads, log::LoggerInterfacePtr logger)
+    : workers_{std::make_unique<Workers>(numThreads, std::move(logger))} {}
+
+ThreadPool::~ThreadPool() { workers_->stop(); }
+
+std::size_t ThreadPool::concurrency() const { return workers_->queues.size(); }
+
+void ThreadPool::submit(Task task) {
+  workers_->start();
+  workers_->push(std::move(task));
+}
+}  // namespace exec
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -2,7 +2,9 @@
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -13,11 +15,13 @@
 #include <fmt/format.h>
 
 #include <openassetio/export.h>
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
 #include <openassetio/constants.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/hostApi/Manager.hpp>
@@ -78,11 +82,13 @@ std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &
   if (const auto iter = info.find(Str{constants::kInfoKey_EntityReferencesMatchPrefix});
       iter != info.end()) {
     if (const auto *prefixPtr = std::get_if<Str>(&iter->second)) {
-      logger->debugApi(
-          fmt::format("Entity reference prefix '{}' provided by manager's info() dict. Subsequent"
-                      " calls to isEntityReferenceString will use this prefix rather than call the"
-                      " manager's implementation.",
-                      *prefixPtr));
+      logger->logDeferred(log::LoggerInterface::Severity::kDebugApi, [prefixPtr] {
+        return fmt::format(
+            "Entity reference prefix '{}' provided by manager's info() dict. Subsequent calls to"
+            " isEntityReferenceString will use this prefix rather than call the manager's"
+            " implementation.",
+            *prefixPtr);
+      });
 
       return *prefixPtr;
     }
@@ -93,6 +99,83 @@ std::optional<Str> entityReferencePrefixFromInfo(const log::LoggerInterfacePtr &
   // Prefix string not found, so return unset optional.
   return {};
 }
+
+/**
+ * Invoke a batch ManagerInterface method, enforcing the deadline and
+ * cancellation token of the context.
+ *
+ * If the context has already expired, the manager is not called at
+ * all. Otherwise, elements are recorded as the manager reports them.
+ * Either way, if the context has expired once the manager returns, any
+ * elements it did not report are reported as timed out.
+ *
+ * Once the cancellation token is cancelled, which may be done by the
+ * host from within a callback in order to stop a batch early, any
+ * further results from the manager are discarded rather than being
+ * forwarded to the host. Those elements are then reported as timed
+ * out along with the rest, so each element is still reported exactly
+ * once.
+ *
+ * Contexts with neither a deadline nor a cancellation token are passed
+ * straight through, avoiding any overhead.
+ *
+ * @param call Callable taking the (possibly wrapped) success and error
+ * callbacks, which it should pass on to the manager.
+ */
+template <class SuccessCallback, class ErrorCallback, class Call>
+void callWithExpiry(const ContextConstPtr &context, const std::size_t batchSize,
+                    const SuccessCallback &successCallback, const ErrorCallback &errorCallback,
+                    const Call &call) {
+  if (!context || (!context->deadline && !context->cancellationToken)) {
+    call(successCallback, errorCallback);
+    return;
+  }
+
+  // Bytes rather than `vector<bool>`, since managers may report
+  // elements concurrently.
+  std::vector<std::uint8_t> isReported(batchSize, 0);
+
+  if (!context->isExpired()) {
+    const CancellationToken *const token = context->cancellationToken.get();
+    // Returns false if the element should not be forwarded to the
+    // host, since the host has asked to stop.
+    const auto markReported = [&isReported, token](const std::size_t idx) {
+      if (token && token->isCancelled()) {
+        return false;
+      }
+      if (idx < isReported.size()) {
+        isReported[idx] = 1;
+      }
+      return true;
+    };
+    call(
+        [&](const std::size_t idx, auto value) {
+          if (markReported(idx)) {
+            successCallback(idx, std::move(value));
+          }
+        },
+        [&](const std::size_t idx, errors::BatchElementError error) {
+          if (markReported(idx)) {
+            errorCallback(idx, std::move(error));
+          }
+        });
+
+    if (!context->isExpired()) {
+      return;
+    }
+  }
+
+  const bool isCancelled = context->cancellationToken && context->cancellationToken->isCancelled();
+  const errors::BatchElementError timeoutError{
+      errors::BatchElementError::ErrorCode::kTimeout,
+      isCancelled ? "Cancelled before completion" : "Deadline exceeded before completion"};
+
+  for (std::size_t idx = 0; idx < batchSize; ++idx) {
+    if (isReported[idx] == 0) {
+      errorCallback(idx, timeoutError);
+    }
+  }
+}
 }  // namespace
 
 namespace hostApi {
@@ -105,50 +188,103 @@ ManagerPtr Manager::make(managerApi::ManagerInterfacePtr managerInterface,
 
 Manager::Manager(managerApi::ManagerInterfacePtr managerInterface,
                  managerApi::HostSessionPtr hostSession)
-    : managerInterface_{std::move(managerInterface)}, hostSession_{std::move(hostSession)} {}
+    : implementation_{std::make_shared<const Implementation>(
+          Implementation{std::move(managerInterface), std::nullopt})},
+      hostSession_{std::move(hostSession)} {}
+
+Manager::ImplementationConstPtr Manager::implementation() const {
+  return std::atomic_load(&implementation_);
+}
+
+void Manager::setImplementation(Implementation implementation) {
+  std::atomic_store(&implementation_,
+                    std::make_shared<const Implementation>(std::move(implementation)));
+}
+
+managerApi::ManagerInterfacePtr Manager::managerInterface() const {
+  return implementation()->managerInterface;
+}
 
-Identifier Manager::identifier() const { return managerInterface_->identifier(); }
+Identifier Manager::identifier() const { return managerInterface()->identifier(); }
 
-Str Manager::displayName() const { return managerInterface_->displayName(); }
+Str Manager::displayName() const { return managerInterface()->displayName(); }
 
 bool Manager::hasCapability(Capability capability) {
-  return managerInterface_->hasCapability(
+  return managerInterface()->hasCapability(
       static_cast<managerApi::ManagerInterface::Capability>(capability));
 }
 
-InfoDictionary Manager::info() { return managerInterface_->info(); }
+InfoDictionary Manager::info() { return managerInterface()->info(); }
 
 StrMap Manager::updateTerminology(StrMap terms) {
-  return managerInterface_->updateTerminology(std::move(terms), hostSession_);
+  return managerInterface()->updateTerminology(std::move(terms), hostSession_);
 }
 
-InfoDictionary Manager::settings() { return managerInterface_->settings(hostSession_); }
+InfoDictionary Manager::settings() { return managerInterface()->settings(hostSession_); }
 
 void Manager::initialize(InfoDictionary managerSettings) {
-  managerInterface_->initialize(std::move(managerSettings), hostSession_);
+  // Hold the lock for the whole call, so that a concurrent
+  // replaceImplementation cannot publish a replacement that is then
+  // overwritten by the (re-)initialized snapshot taken here.
+  const std::lock_guard lock{implementationMutex_};
+  const managerApi::ManagerInterfacePtr currentInterface = managerInterface();
+
+  currentInterface->initialize(std::move(managerSettings), hostSession_);
 
   // Verify the manager has required capabilities. This must only be
   // done after initialization, to ensure we can support proxy interface
   // implementations that need initializing to configure the proxied
   // implementation
-  verifyRequiredCapabilities(managerInterface_);
+  verifyRequiredCapabilities(currentInterface);
+
+  setImplementation(
+      {currentInterface,
+       entityReferencePrefixFromInfo(hostSession_->logger(), currentInterface->info())});
+}
+
+void Manager::replaceImplementation(managerApi::ManagerInterfacePtr managerInterface) {
+  const std::lock_guard lock{implementationMutex_};
+  const ImplementationConstPtr current = implementation();
+
+  if (Identifier identifier = managerInterface->identifier();
+      identifier != current->managerInterface->identifier()) {
+    throw errors::InputValidationException{
+        fmt::format("Cannot replace implementation of manager '{}' with '{}'",
+                    current->managerInterface->identifier(), identifier)};
+  }
+
+  // Initialize the replacement with the settings of the current
+  // implementation, so it is ready to serve calls as soon as it is
+  // published.
+  managerInterface->initialize(current->managerInterface->settings(hostSession_), hostSession_);
+  verifyRequiredCapabilities(managerInterface);
+
+  std::optional<Str> entityReferencePrefix =
+      entityReferencePrefixFromInfo(hostSession_->logger(), managerInterface->info());
+
+  // Calls in progress hold their own reference to the previous
+  // implementation, which is therefore released once they complete.
+  setImplementation({std::move(managerInterface), std::move(entityReferencePrefix)});
 
-  entityReferencePrefix_ =
-      entityReferencePrefixFromInfo(hostSession_->logger(), managerInterface_->info());
+  hostSession_->logger()->logDeferred(log::LoggerInterface::Severity::kDebugApi, [&] {
+    return fmt::format("Replaced implementation of manager '{}'", identifier());
+  });
 }
 
-void Manager::flushCaches() { managerInterface_->flushCaches(hostSession_); }
+void Manager::flushCaches() { managerInterface()->flushCaches(hostSession_); }
 
 trait::TraitsDatas Manager::managementPolicy(const trait::TraitSets &traitSets,
                                              const access::PolicyAccess policyAccess,
                                              const ContextConstPtr &context) {
-  return managerInterface_->managementPolicy(traitSets, policyAccess, context, hostSession_);
+  return managerInterface()->managementPolicy(traitSets, policyAccess, context, hostSession_);
 }
 
 ContextPtr Manager::createContext() {
+  const ImplementationConstPtr current = implementation();
   ContextPtr context = Context::make();
-  if (hasCapability(Capability::kStatefulContexts)) {
-    context->managerState = managerInterface_->createState(hostSession_);
+  if (current->managerInterface->hasCapability(
+          managerApi::ManagerInterface::Capability::kStatefulContexts)) {
+    context->managerState = current->managerInterface->createState(hostSession_);
   }
   context->locale = trait::TraitsData::make();
   return context;
@@ -158,16 +294,20 @@ ContextPtr Manager::createChildContext(const ContextPtr &parentContext) {
   // Copy-construct the locale so changes made to the child context
   // don't affect the parent (and vice versa).
   ContextPtr context = Context::make(trait::TraitsData::make(parentContext->locale));
+  // Share the deadline and cancellation token, so that the parent's
+  // bounds apply to calls made with the child.
+  context->deadline = parentContext->deadline;
+  context->cancellationToken = parentContext->cancellationToken;
   if (parentContext->managerState) {
     context->managerState =
-        managerInterface_->createChildState(parentContext->managerState, hostSession_);
+        managerInterface()->createChildState(parentContext->managerState, hostSession_);
   }
   return context;
 }
 
 Str Manager::persistenceTokenForContext(const ContextPtr &context) {
   if (context->managerState) {
-    return managerInterface_->persistenceTokenForState(context->managerState, hostSession_);
+    return managerInterface()->persistenceTokenForState(context->managerState, hostSession_);
   }
   return "";
 }
@@ -175,17 +315,18 @@ Str Manager::persistenceTokenForContext(const ContextPtr &context) {
 ContextPtr Manager::contextFromPersistenceToken(const Str &token) {
   ContextPtr context = Context::make();
   if (!token.empty()) {
-    context->managerState = managerInterface_->stateFromPersistenceToken(token, hostSession_);
+    context->managerState = managerInterface()->stateFromPersistenceToken(token, hostSession_);
   }
   return context;
 }
 
 bool Manager::isEntityReferenceString(const Str &someString) {
-  if (!entityReferencePrefix_) {
-    return managerInterface_->isEntityReferenceString(someString, hostSession_);
+  const ImplementationConstPtr current = implementation();
+  if (!current->entityReferencePrefix) {
+    return current->managerInterface->isEntityReferenceString(someString, hostSession_);
   }
 
-  return someString.rfind(*entityReferencePrefix_, 0) != Str::npos;
+  return someString.rfind(*current->entityReferencePrefix, 0) != Str::npos;
 }
 
 const Str kCreateEntityReferenceErrorMessage = "Invalid entity reference: ";
@@ -209,8 +350,11 @@ void Manager::entityExists(const EntityReferences &entityReferences,
                            const ContextConstPtr &context,
                            const ExistsSuccessCallback &successCallback,
                            const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->entityExists(entityReferences, context, hostSession_, successCallback,
-                                  errorCallback);
+  callWithExpiry(context, entityReferences.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->entityExists(entityReferences, context, hostSession_,
+                                                    success, error);
+                 });
 }
 
 void Manager::entityTraits(const EntityReferences &entityReferences,
@@ -218,16 +362,22 @@ void Manager::entityTraits(const EntityReferences &entityReferences,
                            const ContextConstPtr &context,
                            const EntityTraitsSuccessCallback &successCallback,
                            const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->entityTraits(entityReferences, entityTraitsAccess, context, hostSession_,
-                                  successCallback, errorCallback);
+  callWithExpiry(context, entityReferences.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->entityTraits(entityReferences, entityTraitsAccess,
+                                                    context, hostSession_, success, error);
+                 });
 }
 
 void Manager::resolve(const EntityReferences &entityReferences, const trait::TraitSet &traitSet,
                       const access::ResolveAccess resolveAccess, const ContextConstPtr &context,
                       const ResolveSuccessCallback &successCallback,
                       const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->resolve(entityReferences, traitSet, resolveAccess, context, hostSession_,
-                             successCallback, errorCallback);
+  callWithExpiry(context, entityReferences.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->resolve(entityReferences, traitSet, resolveAccess,
+                                               context, hostSession_, success, error);
+                 });
 }
 
 void Manager::defaultEntityReference(const trait::TraitSets &traitSets,
@@ -235,8 +385,11 @@ void Manager::defaultEntityReference(const trait::TraitSets &traitSets,
                                      const ContextConstPtr &context,
                                      const DefaultEntityReferenceSuccessCallback &successCallback,
                                      const BatchElementErrorCallback &errorCallback) {
-  managerInterface_->defaultEntityReference(traitSets, defaultEntityAccess, context, hostSession_,
-                                            successCallback, errorCallback);
+  callWithExpiry(context, traitSets.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->defaultEntityReference(
+                       traitSets, defaultEntityAccess, context, hostSession_, success, error);
+                 });
 }
 
 void Manager::getWithRelationship(const EntityReferences &entityReferences,
@@ -262,9 +415,12 @@ void Manager::getWithRelationship(const EntityReferences &entityReferences,
         auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface), hostSession);
         successCallback(idx, std::move(pager));
       };
-  managerInterface_->getWithRelationship(entityReferences, relationshipTraitsData, resultTraitSet,
-                                         pageSize, relationsAccess, context, hostSession_,
-                                         convertingPagerSuccessCallback, errorCallback);
+  callWithExpiry(context, entityReferences.size(), convertingPagerSuccessCallback,
+                 errorCallback, [&](const auto &success, const auto &error) {
+                   managerInterface()->getWithRelationship(
+                       entityReferences, relationshipTraitsData, resultTraitSet, pageSize,
+                       relationsAccess, context, hostSession_, success, error);
+                 });
 }
 
 void Manager::getWithRelationships(
@@ -289,9 +445,12 @@ void Manager::getWithRelationships(
         auto pager = hostApi::EntityReferencePager::make(std::move(pagerInterface), hostSession);
         successCallback(idx, std::move(pager));
       };
-  managerInterface_->getWithRelationships(entityReference, relationshipTraitsDatas, resultTraitSet,
-                                          pageSize, relationsAccess, context, hostSession_,
-                                          convertingPagerSuccessCallback, errorCallback);
+  callWithExpiry(context, relationshipTraitsDatas.size(), convertingPagerSuccessCallback,
+                 errorCallback, [&](const auto &success, const auto &error) {
+                   managerInterface()->getWithRelationships(
+                       entityReference, relationshipTraitsDatas, resultTraitSet, pageSize,
+                       relationsAccess, context, hostSession_, success, error);
+                 });
 }
 
 void Manager::preflight(const EntityReferences &entityReferences,
@@ -308,8 +467,11 @@ void Manager::preflight(const EntityReferences &entityReferences,
     message += " traits hints.";
     throw errors::InputValidationException{message};
   }
-  managerInterface_->preflight(entityReferences, traitsHints, publishingAccess, context,
-                               hostSession_, successCallback, errorCallback);
+  callWithExpiry(context, entityReferences.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->preflight(entityReferences, traitsHints, publishingAccess,
+                                                 context, hostSession_, success, error);
+                 });
 }
 
 void Manager::register_(const EntityReferences &entityReferences,
@@ -326,8 +488,12 @@ void Manager::register_(const EntityReferences &entityReferences,
     message += " traits datas.";
     throw errors::InputValidationException{message};
   }
-  managerInterface_->register_(entityReferences, entityTraitsDatas, publishingAccess, context,
-                               hostSession_, successCallback, errorCallback);
+  callWithExpiry(context, entityReferences.size(), successCallback, errorCallback,
+                 [&](const auto &success, const auto &error) {
+                   managerInterface()->register_(entityReferences, entityTraitsDatas,
+                                                 publishingAccess, context, hostSession_, success,
+                                                 error);
+                 });
 }
 
 }  // namespace hostApi
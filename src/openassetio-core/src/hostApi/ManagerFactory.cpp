@@ -2,18 +2,32 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #include <openassetio/hostApi/ManagerFactory.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <variant>
+#include <vector>
 
+#include <fmt/core.h>
+#include <fmt/format.h>
 #include <toml++/toml.h>
 
 #include <openassetio/export.h>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/errors/exceptions.hpp>
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/exec/ThreadPool.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
@@ -25,29 +39,302 @@
 
 namespace {
 constexpr std::string_view kConfigDirVar = "${config_dir}";
+
+/**
+ * Construct a key that uniquely identifies a manager identifier and
+ * settings combination.
+ *
+ * Settings are visited in sorted key order so that equal dictionaries
+ * produce equal keys, and every component is length-prefixed and
+ * type-tagged so that distinct combinations cannot collide.
+ */
+openassetio::Str sharedManagerKey(const openassetio::Identifier& identifier,
+                                  const openassetio::InfoDictionary& settings) {
+  using openassetio::InfoDictionary;
+  using openassetio::Str;
+
+  std::vector<const InfoDictionary::value_type*> entries;
+  entries.reserve(settings.size());
+  for (const auto& entry : settings) {
+    entries.push_back(&entry);
+  }
+  std::sort(entries.begin(), entries.end(),
+            [](const auto* lhs, const auto* rhs) { return lhs->first < rhs->first; });
+
+  Str key;
+  auto out = std::back_inserter(key);
+  fmt::format_to(out, "{}:{}", identifier.size(), identifier);
+  for (const auto* entry : entries) {
+    fmt::format_to(out, "|{}:{}#{}", entry->first.size(), entry->first, entry->second.index());
+    std::visit(
+        [&out](const auto& value) {
+          const Str valueStr = fmt::format("{}", value);
+          fmt::format_to(out, "{}:{}", valueStr.size(), valueStr);
+        },
+        entry->second);
+  }
+  return key;
+}
 }  // namespace
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace hostApi {
 
+namespace {
+/**
+ * Identifier and settings parsed from a default manager TOML config,
+ * with `${config_dir}` substitution already applied.
+ */
+struct ConfigSnapshot {
+  Identifier identifier;
+  InfoDictionary settings;
+};
+using ConfigSnapshotConstPtr = std::shared_ptr<const ConfigSnapshot>;
+
+/**
+ * Parse a default manager TOML config file.
+ *
+ * @param configPath Path to the config file, as provided by the host.
+ * @param canonicalPath Canonical path to the config file, used for
+ * `${config_dir}` substitution.
+ */
+ConfigSnapshotConstPtr parseConfig(const std::string_view configPath,
+                                   const std::filesystem::path& canonicalPath) {
+  toml::parse_result config;
+  try {
+    config = toml::parse_file(configPath);
+  } catch (const std::exception& exc) {
+    std::string msg = "Error parsing config file. ";
+    msg += exc.what();
+    throw errors::ConfigurationException{msg};
+  }
+  auto snapshot = std::make_shared<ConfigSnapshot>();
+  snapshot->identifier = config["manager"]["identifier"].value_or("");
+
+  // Function to substitute ${config_dir} with the absolute,
+  // canonicalised directory of the TOML config file.
+  const auto substituteConfigDir =
+      [configDir = canonicalPath.parent_path().string()](std::string str) {
+        // Adapted from https://en.cppreference.com/w/cpp/string/basic_string/replace
+        for (std::string::size_type pos{};
+             (pos = str.find(kConfigDirVar, pos)) != std::string::npos;
+             pos += configDir.length()) {
+          str.replace(pos, kConfigDirVar.length(), configDir);
+        }
+        return str;
+      };
+
+  InfoDictionary& settings = snapshot->settings;
+  if (toml::table* settingsTable = config["manager"]["settings"].as_table()) {
+    // It'd be nice to use settingsTable::for_each, a lambda and
+    // w/constexpr to filter supported types, filter, but it ends up
+    // being somewhat verbose due to the number of types supported by
+    // the variant.
+    for (const auto& [key, val] : *settingsTable) {
+      if (val.is_integer()) {
+        settings.insert({Str{key}, val.as_integer()->get()});
+      } else if (val.is_floating_point()) {
+        settings.insert({Str{key}, val.as_floating_point()->get()});
+      } else if (val.is_string()) {
+        settings.insert({Str{key}, substituteConfigDir(val.as_string()->get())});
+      } else if (val.is_boolean()) {
+        settings.insert({Str{key}, val.as_boolean()->get()});
+      } else {
+        Str msg = "Unsupported value type for '";
+        msg += key.str();
+        msg += "'.";
+        throw errors::ConfigurationException(msg);
+      }
+    }
+  }
+  return snapshot;
+}
+
+/**
+ * Process-wide cache of parsed default manager configs.
+ *
+ * Hosts commonly create a default manager per worker thread, so
+ * re-parsing the TOML file on each call is wasteful. Entries are keyed
+ * by canonical path, and are invalidated if the file's modification
+ * time or size changes, so a stat is still required per lookup, but
+ * the parse and settings construction are skipped.
+ */
+class ConfigSnapshotCache {
+ public:
+  ConfigSnapshotConstPtr get(const std::string_view configPath) {
+    const std::filesystem::path canonicalPath = std::filesystem::canonical(configPath);
+    const std::filesystem::file_time_type writeTime =
+        std::filesystem::last_write_time(canonicalPath);
+    const std::uintmax_t fileSize = std::filesystem::file_size(canonicalPath);
+    const Str key = canonicalPath.string();
+
+    {
+      const std::lock_guard lock{mutex_};
+      if (const auto iter = entries_.find(key); iter != entries_.end()) {
+        const Entry& entry = iter->second;
+        if (entry.writeTime == writeTime && entry.fileSize == fileSize) {
+          return entry.snapshot;
+        }
+      }
+    }
+
+    // Parse outside the lock. Concurrent misses for the same file may
+    // parse redundantly, but will produce equivalent snapshots.
+    ConfigSnapshotConstPtr snapshot = parseConfig(configPath, canonicalPath);
+
+    const std::lock_guard lock{mutex_};
+    entries_.insert_or_assign(key, Entry{writeTime, fileSize, snapshot});
+    return snapshot;
+  }
+
+ private:
+  struct Entry {
+    std::filesystem::file_time_type writeTime;
+    std::uintmax_t fileSize;
+    ConfigSnapshotConstPtr snapshot;
+  };
+
+  std::mutex mutex_;
+  std::unordered_map<Str, Entry> entries_;
+};
+
+ConfigSnapshotCache& configSnapshotCache() {
+  static ConfigSnapshotCache cache;
+  return cache;
+}
+}  // namespace
+
 const Str ManagerFactory::kDefaultManagerConfigEnvVarName = "OPENASSETIO_DEFAULT_CONFIG";
 
+/**
+ * Reference-counted pool of initialized managers.
+ *
+ * Entries are created on first request and handed out via aliasing
+ * pointers whose deleters release a lease on the entry, rather than
+ * destroying the manager. Entries with no outstanding leases are
+ * evicted once they have been idle for longer than `idleTimeout`.
+ *
+ * The pool is held by shared pointer so that outstanding leases
+ * remain valid should the owning factory be destroyed first.
+ */
+struct ManagerFactory::SharedManagerPool {
+  struct Entry {
+    Identifier identifier;
+    // Guards one-time creation and initialization of `manager`. If
+    // initialization throws, the flag is left unset and a subsequent
+    // request will retry.
+    std::once_flag initialized;
+    ManagerPtr manager;
+    // Remaining members guarded by the pool mutex.
+    std::size_t leaseCount{0};
+    std::chrono::steady_clock::time_point idleSince;
+  };
+  using EntryPtr = std::shared_ptr<Entry>;
+
+  /// Take a lease on the entry for the given key, creating if needed.
+  EntryPtr acquire(const Str& key, const Identifier& identifier) {
+    EntryPtr entry;
+    std::vector<EntryPtr> evicted;
+    {
+      const std::lock_guard lock{mutex};
+      evicted = takeIdle();
+      EntryPtr& slot = entries[key];
+      if (!slot) {
+        slot = std::make_shared<Entry>();
+        slot->identifier = identifier;
+      }
+      ++slot->leaseCount;
+      entry = slot;
+    }
+    destroy(std::move(evicted));
+    return entry;
+  }
+
+  /// Release a lease, marking the entry idle if it was the last.
+  void release(Entry& entry) {
+    const std::lock_guard lock{mutex};
+    if (--entry.leaseCount == 0) {
+      entry.idleSince = std::chrono::steady_clock::now();
+    }
+  }
+
+  /// Evict entries that have been idle for longer than the timeout.
+  std::size_t evictIdle() {
+    std::vector<EntryPtr> evicted;
+    {
+      const std::lock_guard lock{mutex};
+      evicted = takeIdle();
+    }
+    const std::size_t numEvicted = evicted.size();
+    destroy(std::move(evicted));
+    return numEvicted;
+  }
+
+  /**
+   * Remove idle entries from the pool, returning them so they can be
+   * destroyed after the mutex is released - manager destruction may
+   * be arbitrarily expensive. Must be called with the mutex held.
+   */
+  std::vector<EntryPtr> takeIdle() {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<EntryPtr> evicted;
+    for (auto iter = entries.begin(); iter != entries.end();) {
+      if (iter->second->leaseCount == 0 && now - iter->second->idleSince >= idleTimeout) {
+        evicted.push_back(std::move(iter->second));
+        iter = entries.erase(iter);
+      } else {
+        ++iter;
+      }
+    }
+    return evicted;
+  }
+
+  void destroy(std::vector<EntryPtr> evicted) const {
+    for (EntryPtr& entry : evicted) {
+      if (entry->manager) {
+        logger->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+          return fmt::format("Evicting idle shared manager '{}'", entry->identifier);
+        });
+      }
+      entry.reset();
+    }
+  }
+
+  log::LoggerInterfacePtr logger;
+  std::mutex mutex;
+  std::unordered_map<Str, EntryPtr> entries;
+  std::chrono::milliseconds idleTimeout{kDefaultSharedManagerIdleTimeout};
+};
+
 ManagerFactoryPtr ManagerFactory::make(
     HostInterfacePtr hostInterface,
     ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
     log::LoggerInterfacePtr logger) {
-  return ManagerFactoryPtr{new ManagerFactory{
-      std::move(hostInterface), std::move(managerImplementationFactory), std::move(logger)}};
+  return make(std::move(hostInterface), std::move(managerImplementationFactory),
+              std::move(logger), exec::ThreadPool::defaultPool());
+}
+
+ManagerFactoryPtr ManagerFactory::make(
+    HostInterfacePtr hostInterface,
+    ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
+    log::LoggerInterfacePtr logger, exec::ExecutorInterfacePtr executor) {
+  return ManagerFactoryPtr{new ManagerFactory{std::move(hostInterface),
+                                              std::move(managerImplementationFactory),
+                                              std::move(logger), std::move(executor)}};
 }
 
 ManagerFactory::ManagerFactory(
     HostInterfacePtr hostInterface,
     ManagerImplementationFactoryInterfacePtr managerImplementationFactory,
-    log::LoggerInterfacePtr logger)
+    log::LoggerInterfacePtr logger, exec::ExecutorInterfacePtr executor)
     : hostInterface_{std::move(hostInterface)},
       managerImplementationFactory_{std::move(managerImplementationFactory)},
-      logger_{std::move(logger)} {}
+      logger_{std::move(logger)},
+      executor_{std::move(executor)},
+      sharedManagerPool_{std::make_shared<SharedManagerPool>()} {
+  sharedManagerPool_->logger = logger_;
+}
 
 Identifiers ManagerFactory::identifiers() const {
   return managerImplementationFactory_->identifiers();
@@ -73,23 +360,74 @@ ManagerFactory::ManagerDetails ManagerFactory::availableManagers() const {
 }
 
 ManagerPtr ManagerFactory::createManager(const Identifier& identifier) const {
-  return createManagerForInterface(identifier, hostInterface_, managerImplementationFactory_,
-                                   logger_);
+  return Manager::make(managerImplementationFactory_->instantiate(identifier),
+                       managerApi::HostSession::make(managerApi::Host::make(hostInterface_),
+                                                     logger_, executor_));
+}
+
+ManagerPtr ManagerFactory::sharedManager(const Identifier& identifier,
+                                         const InfoDictionary& settings) const {
+  const SharedManagerPool::EntryPtr entry =
+      sharedManagerPool_->acquire(sharedManagerKey(identifier, settings), identifier);
+
+  try {
+    std::call_once(entry->initialized, [&] {
+      ManagerPtr manager = createManager(identifier);
+      manager->initialize(settings);
+      entry->manager = std::move(manager);
+    });
+  } catch (...) {
+    sharedManagerPool_->release(*entry);
+    throw;
+  }
+
+  // Hand out a pointer that shares no ownership with the pool's
+  // reference, so that its destruction releases the lease rather than
+  // the manager.
+  return ManagerPtr{entry->manager.get(),
+                    [pool = sharedManagerPool_, entry]([[maybe_unused]] Manager* manager) {
+                      pool->release(*entry);
+                    }};
+}
+
+void ManagerFactory::setSharedManagerIdleTimeout(const std::chrono::milliseconds idleTimeout) {
+  const std::lock_guard lock{sharedManagerPool_->mutex};
+  sharedManagerPool_->idleTimeout = idleTimeout;
+}
+
+std::size_t ManagerFactory::evictIdleSharedManagers() const {
+  return sharedManagerPool_->evictIdle();
 }
 
 ManagerPtr ManagerFactory::createManagerForInterface(
     const Identifier& identifier, const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
     const log::LoggerInterfacePtr& logger) {
+  return createManagerForInterface(identifier, hostInterface, managerImplementationFactory,
+                                   logger, exec::ThreadPool::defaultPool());
+}
+
+ManagerPtr ManagerFactory::createManagerForInterface(
+    const Identifier& identifier, const HostInterfacePtr& hostInterface,
+    const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+    const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor) {
   return Manager::make(
       managerImplementationFactory->instantiate(identifier),
-      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger));
+      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger, executor));
 }
 
 ManagerPtr ManagerFactory::defaultManagerForInterface(
     const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
     const log::LoggerInterfacePtr& logger) {
+  return defaultManagerForInterface(hostInterface, managerImplementationFactory, logger,
+                                    exec::ThreadPool::defaultPool());
+}
+
+ManagerPtr ManagerFactory::defaultManagerForInterface(
+    const HostInterfacePtr& hostInterface,
+    const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+    const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor) {
   const char* configPath = std::getenv(kDefaultManagerConfigEnvVarName.c_str());
 
   if (!configPath) {
@@ -101,97 +439,61 @@ ManagerPtr ManagerFactory::defaultManagerForInterface(
     logger->log(log::LoggerInterface::Severity::kDebug, msg);
     return nullptr;
   }
-  {
+  logger->logDeferred(log::LoggerInterface::Severity::kDebug, [] {
     Str msg = "Retrieved default manager config file path from '";
     msg += kDefaultManagerConfigEnvVarName;
     msg += "'";
-    logger->log(log::LoggerInterface::Severity::kDebug, msg);
-  }
+    return msg;
+  });
 
   return defaultManagerForInterface(configPath, hostInterface, managerImplementationFactory,
-                                    logger);
+                                    logger, executor);
 }
 
 ManagerPtr ManagerFactory::defaultManagerForInterface(
     const std::string_view configPath, const HostInterfacePtr& hostInterface,
     const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
     const log::LoggerInterfacePtr& logger) {
-  {
+  return defaultManagerForInterface(configPath, hostInterface, managerImplementationFactory,
+                                    logger, exec::ThreadPool::defaultPool());
+}
+
+ManagerPtr ManagerFactory::defaultManagerForInterface(
+    const std::string_view configPath, const HostInterfacePtr& hostInterface,
+    const ManagerImplementationFactoryInterfacePtr& managerImplementationFactory,
+    const log::LoggerInterfacePtr& logger, const exec::ExecutorInterfacePtr& executor) {
+  logger->logDeferred(log::LoggerInterface::Severity::kDebug, [configPath] {
     Str msg = "Loading default manager config at '";
     msg += configPath;
     msg += "'";
-    logger->log(log::LoggerInterface::Severity::kDebug, msg);
-  }
+    return msg;
+  });
+
+  const std::filesystem::file_status status = std::filesystem::status(configPath);
 
-  if (!std::filesystem::exists(configPath)) {
+  if (!std::filesystem::exists(status)) {
     Str msg = "Could not load default manager config from '";
     msg += configPath;
     msg += "', file does not exist.";
     throw errors::InputValidationException(msg);
   }
 
-  if (std::filesystem::is_directory(configPath)) {
+  if (std::filesystem::is_directory(status)) {
     Str msg = "Could not load default manager config from '";
     msg += configPath;
     msg += "', must be a TOML file not a directory.";
     throw errors::InputValidationException(msg);
   }
 
-  toml::parse_result config;
-  try {
-    config = toml::parse_file(configPath);
-  } catch (const std::exception& exc) {
-    std::string msg = "Error parsing config file. ";
-    msg += exc.what();
-    throw errors::ConfigurationException{msg};
-  }
-  const std::string_view identifier = config["manager"]["identifier"].value_or("");
-
-  // Function to substitute ${config_dir} with the absolute,
-  // canonicalised directory of the TOML config file.
-  const auto substituteConfigDir =
-      [configDir =
-           std::filesystem::canonical(configPath).parent_path().string()](std::string str) {
-        // Adapted from https://en.cppreference.com/w/cpp/string/basic_string/replace
-        for (std::string::size_type pos{};
-             (pos = str.find(kConfigDirVar, pos)) != std::string::npos;
-             pos += configDir.length()) {
-          str.replace(pos, kConfigDirVar.length(), configDir);
-        }
-        return str;
-      };
-
-  InfoDictionary settings;
-  if (toml::table* settingsTable = config["manager"]["settings"].as_table()) {
-    // It'd be nice to use settingsTable::for_each, a lambda and
-    // w/constexpr to filter supported types, filter, but it ends up
-    // being somewhat verbose due to the number of types supported by
-    // the variant.
-    for (const auto& [key, val] : *settingsTable) {
-      if (val.is_integer()) {
-        settings.insert({Str{key}, val.as_integer()->get()});
-      } else if (val.is_floating_point()) {
-        settings.insert({Str{key}, val.as_floating_point()->get()});
-      } else if (val.is_string()) {
-        settings.insert({Str{key}, substituteConfigDir(val.as_string()->get())});
-      } else if (val.is_boolean()) {
-        settings.insert({Str{key}, val.as_boolean()->get()});
-      } else {
-        Str msg = "Unsupported value type for '";
-        msg += key.str();
-        msg += "'.";
-        throw errors::ConfigurationException(msg);
-      }
-    }
-  }
+  const ConfigSnapshotConstPtr config = configSnapshotCache().get(configPath);
 
   const managerApi::HostSessionPtr hostSession =
-      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger);
+      managerApi::HostSession::make(managerApi::Host::make(hostInterface), logger, executor);
 
-  const ManagerPtr manager = Manager::make(
-      managerImplementationFactory->instantiate(Identifier(identifier)), hostSession);
+  const ManagerPtr manager =
+      Manager::make(managerImplementationFactory->instantiate(config->identifier), hostSession);
 
-  manager->initialize(settings);
+  manager->initialize(config->settings);
   return manager;
 }
 }  // namespace hostApi
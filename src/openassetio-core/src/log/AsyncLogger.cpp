@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <openassetio/log/AsyncLogger.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include <fmt/core.h>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace log {
+
+namespace {
+/**
+ * Upper bound on how long the worker sleeps between checks of the
+ * buffer. Wake-ups are normally signalled explicitly, so this is only a
+ * safety net.
+ */
+constexpr std::chrono::milliseconds kMaxWorkerSleep{50};
+
+/// Size of a cache line, used to avoid false sharing of counters.
+constexpr std::size_t kCacheLineSize = 64;
+
+std::size_t roundUpToPowerOfTwo(const std::size_t value) {
+  std::size_t result = 2;
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+}  // namespace
+
+/**
+ * Bounded multi-producer, single-consumer ring buffer, plus the
+ * worker thread that consumes it.
+ *
+ * The buffer is based on Dmitry Vyukov's bounded MPMC queue. Each cell
+ * carries a sequence number that producers and the consumer use to
+ * claim and publish the cell without locks. Since there is only one
+ * consumer, the dequeue position need not be atomic.
+ *
+ * The mutex is used only to put the worker to sleep when the buffer is
+ * empty, and to signal flush completion. Producers only touch it if
+ * the worker is known to be sleeping.
+ */
+struct AsyncLogger::Worker {
+  struct Cell {
+    std::atomic<std::size_t> sequence;
+    Severity severity{Severity::kDebugApi};
+    Str message;
+  };
+
+  explicit Worker(const std::size_t requestedCapacity)
+      : capacity{roundUpToPowerOfTwo(requestedCapacity)},
+        mask{capacity - 1},
+        cells{std::make_unique<Cell[]>(capacity)} {  // NOLINT(*-avoid-c-arrays)
+    for (std::size_t idx = 0; idx < capacity; ++idx) {
+      cells[idx].sequence.store(idx, std::memory_order_relaxed);
+    }
+  }
+
+  /// Attempt to enqueue a message, returning false if full.
+  bool tryPush(const Severity severity, const Str& message) {
+    std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+      cell = &cells[pos & mask];
+      const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+      if (diff == 0) {
+        if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->severity = severity;
+    cell->message = message;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    pushedCount.fetch_add(1, std::memory_order_release);
+    return true;
+  }
+
+  /// Attempt to dequeue a message. Must only be called by the worker.
+  bool tryPop(Severity& severity, Str& message) {
+    Cell& cell = cells[dequeuePos & mask];
+    const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (static_cast<std::ptrdiff_t>(seq - (dequeuePos + 1)) < 0) {
+      return false;
+    }
+    severity = cell.severity;
+    message = std::move(cell.message);
+    cell.message.clear();
+    cell.sequence.store(dequeuePos + capacity, std::memory_order_release);
+    ++dequeuePos;
+    return true;
+  }
+
+  /// Check whether the buffer is empty. Must only be called by the worker.
+  [[nodiscard]] bool isEmpty() const {
+    return cells[dequeuePos & mask].sequence.load(std::memory_order_acquire) != dequeuePos + 1;
+  }
+
+  /// Wake the worker, if it is sleeping.
+  void wake() {
+    // Pairs with the fence in `run`, ensuring either we see the worker
+    // is sleeping, or the worker sees our message.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (isSleeping.load(std::memory_order_relaxed)) {
+      const std::lock_guard lock{mutex};
+      wakeCondition.notify_one();
+    }
+  }
+
+  /// Worker thread entry point.
+  void run(LoggerInterface& upstreamLogger) {
+    Severity severity{};
+    Str message;
+    while (true) {
+      std::size_t numDelivered = 0;
+      while (tryPop(severity, message)) {
+        deliver(upstreamLogger, severity, message);
+        ++numDelivered;
+      }
+
+      if (const std::size_t numDropped = droppedCount.load(std::memory_order_relaxed);
+          numDropped != numDroppedReported) {
+        deliver(upstreamLogger, Severity::kWarning,
+                fmt::format("AsyncLogger: {} message(s) dropped due to a full buffer",
+                            numDropped - numDroppedReported));
+        numDroppedReported = numDropped;
+      }
+
+      std::unique_lock lock{mutex};
+      if (numDelivered != 0) {
+        deliveredCount += numDelivered;
+        flushedCondition.notify_all();
+      }
+      isSleeping.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (isEmpty()) {
+        if (isStopping) {
+          break;
+        }
+        wakeCondition.wait_for(lock, kMaxWorkerSleep);
+      }
+      isSleeping.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  static void deliver(LoggerInterface& upstreamLogger, const Severity severity,
+                      const Str& message) {
+    try {
+      upstreamLogger.log(severity, message);
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+      // There is nowhere to report a failure of the logger itself, and
+      // an escaping exception would terminate the process.
+    }
+  }
+
+  const std::size_t capacity;
+  const std::size_t mask;
+  std::unique_ptr<Cell[]> cells;  // NOLINT(*-avoid-c-arrays)
+
+  alignas(kCacheLineSize) std::atomic<std::size_t> enqueuePos{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> pushedCount{0};
+  std::atomic<std::size_t> droppedCount{0};
+  std::atomic<std::size_t> overflowCount{0};
+  alignas(kCacheLineSize) std::size_t dequeuePos{0};
+  std::size_t numDroppedReported{0};
+
+  std::atomic_bool isSleeping{false};
+  std::mutex mutex;
+  std::condition_variable wakeCondition;
+  std::condition_variable flushedCondition;
+  // Guarded by mutex.
+  std::size_t deliveredCount{0};
+  bool isStopping{false};
+
+  std::thread thread;
+};
+
+AsyncLoggerPtr AsyncLogger::make(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                                 const OverflowPolicy overflowPolicy,
+                                 const std::size_t sampleInterval) {
+  if (capacity == 0) {
+    throw errors::InputValidationException{"AsyncLogger: capacity must be greater than zero."};
+  }
+  if (sampleInterval == 0) {
+    throw errors::InputValidationException{
+        "AsyncLogger: sampleInterval must be greater than zero."};
+  }
+  return std::shared_ptr<AsyncLogger>(
+      new AsyncLogger(std::move(upstreamLogger), capacity, overflowPolicy, sampleInterval));
+}
+
+AsyncLogger::AsyncLogger(LoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                         const OverflowPolicy overflowPolicy, const std::size_t sampleInterval)
+    : upstreamLogger_{std::move(upstreamLogger)},
+      overflowPolicy_{overflowPolicy},
+      sampleInterval_{sampleInterval},
+      worker_{std::make_unique<Worker>(capacity)} {
+  worker_->thread = std::thread{[this] { worker_->run(*upstreamLogger_); }};
+}
+
+AsyncLogger::~AsyncLogger() {
+  {
+    const std::lock_guard lock{worker_->mutex};
+    worker_->isStopping = true;
+    worker_->wakeCondition.notify_one();
+  }
+  worker_->thread.join();
+}
+
+LoggerInterfacePtr AsyncLogger::upstreamLogger() const { return upstreamLogger_; }
+
+std::size_t AsyncLogger::capacity() const { return worker_->capacity; }
+
+AsyncLogger::OverflowPolicy AsyncLogger::overflowPolicy() const { return overflowPolicy_; }
+
+std::size_t AsyncLogger::droppedCount() const {
+  return worker_->droppedCount.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::flush() {
+  const std::size_t target = worker_->pushedCount.load(std::memory_order_acquire);
+  worker_->wake();
+  std::unique_lock lock{worker_->mutex};
+  worker_->flushedCondition.wait(lock, [&] { return worker_->deliveredCount >= target; });
+}
+
+bool AsyncLogger::isSeverityLogged(const Severity severity) const {
+  return upstreamLogger_->isSeverityLogged(severity);
+}
+
+void AsyncLogger::log(const Severity severity, const Str& message) {
+  if (!worker_->tryPush(severity, message)) {
+    bool shouldWait = overflowPolicy_ == OverflowPolicy::kBlock;
+    if (overflowPolicy_ == OverflowPolicy::kSample) {
+      const std::size_t overflowIdx =
+          worker_->overflowCount.fetch_add(1, std::memory_order_relaxed) + 1;
+      shouldWait = overflowIdx % sampleInterval_ == 0;
+    }
+
+    if (!shouldWait) {
+      worker_->droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    do {
+      worker_->wake();
+      std::this_thread::yield();
+    } while (!worker_->tryPush(severity, message));
+  }
+  worker_->wake();
+}
+}  // namespace log
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -7,6 +7,8 @@
 
 #include <openassetio/export.h>
 
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/exec/ThreadPool.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 
@@ -15,14 +17,22 @@ inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace managerApi {
 
 HostSessionPtr HostSession::make(HostPtr host, log::LoggerInterfacePtr logger) {
-  return std::shared_ptr<HostSession>(new HostSession(std::move(host), std::move(logger)));
+  return make(std::move(host), std::move(logger), exec::ThreadPool::defaultPool());
 }
 
-HostSession::HostSession(HostPtr host, log::LoggerInterfacePtr logger)
-    : host_{std::move(host)}, logger_{std::move(logger)} {}
+HostSessionPtr HostSession::make(HostPtr host, log::LoggerInterfacePtr logger,
+                                 exec::ExecutorInterfacePtr executor) {
+  return std::shared_ptr<HostSession>(
+      new HostSession(std::move(host), std::move(logger), std::move(executor)));
+}
+
+HostSession::HostSession(HostPtr host, log::LoggerInterfacePtr logger,
+                         exec::ExecutorInterfacePtr executor)
+    : host_{std::move(host)}, logger_{std::move(logger)}, executor_{std::move(executor)} {}
 
 const HostPtr& HostSession::host() const { return host_; }
 const log::LoggerInterfacePtr& HostSession::logger() const { return logger_; }
+const exec::ExecutorInterfacePtr& HostSession::executor() const { return executor_; }
 
 }  // namespace managerApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #ifdef _WIN32
 #include <windows.h>
@@ -100,6 +101,20 @@ constexpr char kPathSep = ':';
 #endif
 }  // namespace
 
+/**
+ * Handle to a loaded plugin library.
+ *
+ * Libraries are never unloaded, even once retired by a `reload`, since
+ * objects instantiated by their plugins (e.g. manager state held by a
+ * Context) may outlive any reference we could reasonably track.
+ */
+struct CppPluginSystem::Library {
+  /// Handle returned by dlopen.
+  void* handle;
+  /// Modification time of the library file when it was loaded.
+  std::filesystem::file_time_type writeTime;
+};
+
 CppPluginSystemPtr CppPluginSystem::make(log::LoggerInterfacePtr logger) {
   return std::make_shared<CppPluginSystem>(CppPluginSystem{std::move(logger)});
 }
@@ -107,6 +122,7 @@ CppPluginSystemPtr CppPluginSystem::make(log::LoggerInterfacePtr logger) {
 void CppPluginSystem::reset() {
   // Note: do not dlclose plugins - they may be in use.
   plugins_.clear();
+  libraries_.clear();
 }
 
 CppPluginSystem::CppPluginSystem(log::LoggerInterfacePtr logger) : logger_{std::move(logger)} {}
@@ -123,8 +139,10 @@ void CppPluginSystem::scan(const std::string_view paths) {
 
     // Check the provided path is actually a searchable directory.
     if (!is_directory(directoryPath)) {
-      logger_->debug(fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
-                                 directoryPath.string()));
+      logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+        return fmt::format("CppPluginSystem: Skipping as not a directory '{}'",
+                           directoryPath.string());
+      });
       continue;
     }
 
@@ -135,17 +153,65 @@ void CppPluginSystem::scan(const std::string_view paths) {
 
       // Assume the item in the search path is a plugin file and attempt
       // to load it.
-      if (MaybeIdentifierAndPlugin idAndPlugin = maybeLoadPlugin(filePath)) {
-        logger_->debug(fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
-                                   idAndPlugin->first, filePath.string()));
+      if (MaybeLoadedPlugin loaded = maybeLoadPlugin(filePath)) {
+        logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+          return fmt::format("CppPluginSystem: Registered plug-in '{}' from '{}'",
+                             loaded->identifier, filePath.string());
+        });
         // Register the successfully loaded plugin.
-        plugins_[std::move(idAndPlugin->first)] = {std::move(filePath),
-                                                   std::move(idAndPlugin->second)};
+        libraries_[loaded->identifier] = std::move(loaded->library);
+        plugins_[std::move(loaded->identifier)] = {std::move(filePath),
+                                                   std::move(loaded->plugin)};
       }
     }
   }
 }
 
+void CppPluginSystem::reload(const std::string_view paths) {
+  PluginMap previousPlugins;
+  LibraryMap previousLibraries;
+  std::swap(previousPlugins, plugins_);
+  std::swap(previousLibraries, libraries_);
+
+  try {
+    scan(paths);
+  } catch (...) {
+    // Leave the previous registrations untouched.
+    plugins_ = std::move(previousPlugins);
+    libraries_ = std::move(previousLibraries);
+    throw;
+  }
+
+  for (auto& [identifier, previousLibrary] : previousLibraries) {
+    const auto iter = libraries_.find(identifier);
+
+    if (iter != libraries_.end() && iter->second->handle == previousLibrary->handle) {
+      // The scan re-opened the library that is already in use. Keep the
+      // existing plugin instance, since it may hold state. The
+      // duplicate instance is released here.
+      const auto& path = previousPlugins.at(identifier).first;
+      std::error_code errorCode;
+      if (const auto writeTime = std::filesystem::last_write_time(path, errorCode);
+          !errorCode && writeTime != previousLibrary->writeTime) {
+        logger_->warning(fmt::format(
+            "CppPluginSystem: Plug-in library '{}' has been modified since it was loaded. Deploy"
+            " updated plug-ins under a new file name in order for them to be reloaded",
+            path.string()));
+      }
+      iter->second = previousLibrary;
+      plugins_[identifier] = std::move(previousPlugins.at(identifier));
+      continue;
+    }
+
+    // The plugin has been superseded or removed. Its library is left
+    // loaded, since objects created by the plugin may still be in use.
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+      return fmt::format("CppPluginSystem: Retiring plug-in '{}' from '{}'", identifier,
+                         previousPlugins.at(identifier).first.string());
+    });
+  }
+}
+
 Identifiers CppPluginSystem::identifiers() const {
   Identifiers result;
   result.reserve(plugins_.size());
@@ -164,19 +230,23 @@ const CppPluginSystem::PathAndPlugin& CppPluginSystem::plugin(const Identifier&
   return iter->second;
 }
 
-CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
+CppPluginSystem::MaybeLoadedPlugin CppPluginSystem::maybeLoadPlugin(
     const std::filesystem::path& filePath) {
   // Check the proposed path is actually a file.
   if (!is_regular_file(filePath)) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+      return fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                         filePath.string());
+    });
     return {};
   }
 
   // Check the proposed file name looks like a shared library.
   if (filePath.extension() != kLibExt) {
-    logger_->debug(fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
-                               filePath.string()));
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+      return fmt::format("CppPluginSystem: Ignoring as it is not a library binary '{}'",
+                         filePath.string());
+    });
     return {};
   }
 
@@ -192,16 +262,22 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
   void* handle = dlopen(filePath.c_str(), RTLD_LAZY | RTLD_LOCAL);
 
   if (!handle) {
-    logger_->debug(fmt::format("CppPluginSystem: Failed to open library '{}': {}",
-                               filePath.string(), dlerror()));
+    // Retrieve the error eagerly, since querying the logger may itself
+    // (e.g. via Python) make calls that overwrite it.
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&, error = Str{dlerror()}] {
+      return fmt::format("CppPluginSystem: Failed to open library '{}': {}", filePath.string(),
+                         error);
+    });
     return {};
   }
 
   // Get the entrypoint function.
   void* entrypoint = dlsym(handle, kEntrypointFnName);
   if (!entrypoint) {
-    logger_->debug(fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
-                               kEntrypointFnName, filePath.string(), dlerror()));
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&, error = Str{dlerror()}] {
+      return fmt::format("CppPluginSystem: No top-level '{}' function in '{}': {}",
+                         kEntrypointFnName, filePath.string(), error);
+    });
     dlclose(handle);
     return {};
   }
@@ -267,15 +343,21 @@ CppPluginSystem::MaybeIdentifierAndPlugin CppPluginSystem::maybeLoadPlugin(
 
   // Ensure it's not already been registered.
   if (const auto iter = plugins_.find(identifier); iter != plugins_.end()) {
-    logger_->debug(
-        fmt::format("CppPluginSystem: Skipping '{}' defined in '{}'. Already registered by '{}'",
-                    identifier, filePath.string(), iter->second.first.string()));
+    logger_->logDeferred(log::LoggerInterface::Severity::kDebug, [&] {
+      return fmt::format(
+          "CppPluginSystem: Skipping '{}' defined in '{}'. Already registered by '{}'",
+          identifier, filePath.string(), iter->second.first.string());
+    });
     plugin.reset();  // Must destroy _before_ closing lib.
     dlclose(handle);
     return {};
   }
 
-  return {{std::move(identifier), std::move(plugin)}};
+  std::error_code errorCode;
+  auto library = std::make_shared<Library>(
+      Library{handle, std::filesystem::last_write_time(filePath, errorCode)});
+
+  return {{std::move(identifier), std::move(plugin), std::move(library)}};
 }
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -109,6 +109,14 @@ managerApi::ManagerInterfacePtr CppPluginSystemManagerImplementationFactory::ins
 
   return managerPlugin->interface();
 }
+
+void CppPluginSystemManagerImplementationFactory::reload() {
+  if (!pluginSystem_) {
+    // Nothing loaded yet, so defer to the usual lazy load.
+    return;
+  }
+  pluginSystem_->reload(paths_);
+}
 }  // namespace pluginSystem
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -2,16 +2,20 @@
 // Copyright 2024-2025 The Foundry Visionmongers Ltd
 #include <openassetio/utils/path.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include <openassetio/export.h>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/typedefs.hpp>
 
 #include "./path/common.hpp"
 #include "./path/posix.hpp"
-#include "./path/posix/detail.hpp"
 #include "./path/windows.hpp"
 #include "./path/windows/detail.hpp"
 #include "./path/windows/pathTypes.hpp"
@@ -23,53 +27,16 @@ namespace utils {
  * Utility class for converting between file URLs and paths for both
  * Windows and POSIX systems.
  *
- * Reusable components (each usually consisting of a couple of
- * pre-compiled regexes and a handful of functions) are constructed and
- * dependency-injected bottom-up, resulting in top-level Windows and
- * POSIX handlers.
- *
- * We then delegate to the top-level Windows and POSIX utilities for the
- * bulk of path/URL processing.
+ * We delegate to the top-level Windows and POSIX utilities for the
+ * bulk of path/URL processing. These are built from hand-written
+ * scanners rather than regexes, so are stateless.
  */
 struct FileUrlPathConverterImpl {
-  // Generic path/URL utilities.
-  path::GenericUrl urlHandler{};
-  path::ForwardSlashSeparatedString forwardSlashSeparatedStringHandler{};
-
-  // Common Windows path/URL utilities.
-  path::windows::detail::WindowsUrl windowsUrlHandler{};
-  path::windows::detail::UncHost uncHostHandler{};
-  path::windows::detail::DriveLetter driveLetterHandler{};
-  path::windows::detail::NormalisedPath windowsNormalisedPathHandler{};
-  path::windows::detail::UncUnnormalisedDevicePath uncUnnormalisedDevicePathHandler{};
-
-  // Windows path utilities for specific types of path.
-  path::windows::pathTypes::DrivePath drivePathHandler{driveLetterHandler,
-                                                       windowsNormalisedPathHandler};
-  path::windows::pathTypes::UncSharePath uncSharePathHandler{
-      uncHostHandler, windowsNormalisedPathHandler, windowsUrlHandler};
-  path::windows::pathTypes::UncUnnormalisedDeviceSharePath uncUnnormalisedDeviceSharePathHandler{
-      uncHostHandler, uncUnnormalisedDevicePathHandler, windowsUrlHandler};
-  path::windows::pathTypes::UncUnnormalisedDeviceDrivePath uncUnnormalisedDeviceDrivePathHandler{
-      driveLetterHandler, uncUnnormalisedDevicePathHandler};
-
   // Entry point for converting Windows path<->URL.
-  path::windows::FileUrlPathConverter windowsFileUrlPathConverter{
-      windowsUrlHandler,
-      driveLetterHandler,
-      uncHostHandler,
-      forwardSlashSeparatedStringHandler,
-      drivePathHandler,
-      uncSharePathHandler,
-      uncUnnormalisedDeviceDrivePathHandler,
-      uncUnnormalisedDeviceSharePathHandler};
-
-  // POSIX path/URL utilities.
-  path::posix::detail::PosixPath posixPathHandler{forwardSlashSeparatedStringHandler};
-  path::posix::detail::PosixUrl posixUrlHandler{};
+  path::windows::FileUrlPathConverter windowsFileUrlPathConverter{};
 
   // Entry point for converting POSIX path<->URL.
-  path::posix::FileUrlPathConverter posixFileUrlPathConverter{posixUrlHandler, posixPathHandler};
+  path::posix::FileUrlPathConverter posixFileUrlPathConverter{};
 
   /**
    * Validate a path and construct a file URL from it.
@@ -105,13 +72,118 @@ struct FileUrlPathConverterImpl {
    * to is invalid or unsupported.
    */
   [[nodiscard]] Str pathFromUrl(const std::string_view fileUrl, PathType pathType) const {
-    if (!urlHandler.isFileUrl(fileUrl)) {
+    if (!path::GenericUrl::isFileUrl(fileUrl)) {
       path::throwError(path::kErrorNotAFileUrl, fileUrl);
     }
     pathType = path::GenericPath::resolveSystemPathType(pathType);
     return pathType == PathType::kWindows ? windowsFileUrlPathConverter.pathFromUrl(fileUrl)
                                           : posixFileUrlPathConverter.pathFromUrl(fileUrl);
   }
+
+  /**
+   * Validate a path and append a file URL constructed from it to an
+   * output string.
+   *
+   * @param path Path string.
+   * @param pathType Platform associated with path, already resolved
+   * from kSystem.
+   * @param out String to append the URL to. On error, the appended
+   * content is unspecified.
+   * @return Error message, if the path is invalid or unsupported.
+   */
+  [[nodiscard]] std::optional<Str> appendUrl(const std::string_view path,
+                                             const PathType pathType, Str& out) const {
+    if (path.empty()) {
+      return Str{path::kErrorEmptyPath};
+    }
+    if (path::GenericPath::containsNullByte(path)) {
+      return Str{path::kErrorNullByte};
+    }
+    if (pathType == PathType::kWindows) {
+      // The Windows implementation reports errors via exceptions.
+      try {
+        out += windowsFileUrlPathConverter.pathToUrl(path);
+      } catch (const errors::InputValidationException& exc) {
+        return Str{exc.what()};
+      }
+      return std::nullopt;
+    }
+    if (const auto error = path::posix::FileUrlPathConverter::appendUrl(path, out)) {
+      return path::formatError(*error, path);
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * Append a path, for a given platform type, converted from a file
+   * URL to an output string.
+   *
+   * @param fileUrl URL to convert.
+   * @param pathType Platform associated with path, already resolved
+   * from kSystem.
+   * @param out String to append the path to. On error, the appended
+   * content is unspecified.
+   * @return Error message, if the URL or path that it decodes to is
+   * invalid or unsupported.
+   */
+  [[nodiscard]] std::optional<Str> appendPath(const std::string_view fileUrl,
+                                              const PathType pathType, Str& out) const {
+    if (!path::GenericUrl::isFileUrl(fileUrl)) {
+      return path::formatError(path::kErrorNotAFileUrl, fileUrl);
+    }
+    if (pathType == PathType::kWindows) {
+      // The Windows implementation reports errors via exceptions.
+      try {
+        out += windowsFileUrlPathConverter.pathFromUrl(fileUrl);
+      } catch (const errors::InputValidationException& exc) {
+        return Str{exc.what()};
+      }
+      return std::nullopt;
+    }
+    if (const auto error = path::posix::FileUrlPathConverter::appendPath(fileUrl, out)) {
+      return path::formatError(*error, fileUrl);
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * Convert a batch of strings, packing the results into a
+   * caller-owned buffer.
+   *
+   * @param inputs Strings to convert.
+   * @param pathType Platform associated with paths.
+   * @param estimatedOverhead Expected increase in size per element
+   * after conversion, used to pre-allocate the output buffer.
+   * @param result Output buffer.
+   * @param appendFn Member function to append a single converted
+   * string, returning an error message on failure.
+   */
+  template <class AppendFn>
+  void convertBatch(const std::vector<std::string_view>& inputs, PathType pathType,
+                    const std::size_t estimatedOverhead, PathBatchResult& result,
+                    const AppendFn appendFn) const {
+    pathType = path::GenericPath::resolveSystemPathType(pathType);
+    result.clear();
+
+    std::size_t estimatedSize = inputs.size() * estimatedOverhead;
+    for (const std::string_view input : inputs) {
+      estimatedSize += input.size();
+    }
+    result.bytes.reserve(estimatedSize);
+    result.offsets.reserve(inputs.size() + 1);
+    result.offsets.push_back(0);
+
+    for (std::size_t idx = 0; idx < inputs.size(); ++idx) {
+      const std::size_t elementPos = result.bytes.size();
+      if (std::optional<Str> error = (this->*appendFn)(inputs[idx], pathType, result.bytes)) {
+        result.bytes.resize(elementPos);
+        result.elementErrors.emplace_back(
+            idx, errors::BatchElementError{errors::BatchElementError::ErrorCode::kUnknown,
+                                           std::move(*error)});
+      }
+      result.offsets.push_back(result.bytes.size());
+    }
+  }
 };
 
 FileUrlPathConverter::FileUrlPathConverter()
@@ -128,6 +200,17 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view fileUrl,
                                       const PathType pathType) const {
   return impl_->pathFromUrl(fileUrl, pathType);
 }
+
+void FileUrlPathConverter::pathToUrl(const std::vector<std::string_view>& absolutePaths,
+                                     PathBatchResult& result, const PathType pathType) const {
+  impl_->convertBatch(absolutePaths, pathType, path::kFileUrlPrefix.size(), result,
+                      &FileUrlPathConverterImpl::appendUrl);
+}
+
+void FileUrlPathConverter::pathFromUrl(const std::vector<std::string_view>& fileUrls,
+                                       PathBatchResult& result, const PathType pathType) const {
+  impl_->convertBatch(fileUrls, pathType, 0, result, &FileUrlPathConverterImpl::appendPath);
+}
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
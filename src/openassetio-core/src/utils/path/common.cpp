@@ -2,6 +2,8 @@
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #include "common.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <string_view>
 
 #include <ada/url.h>
@@ -15,23 +17,55 @@ namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils::path {
 
+Str formatError(const std::string_view message, const std::string_view pathOrUrl) {
+  return fmt::format("{} ('{}')", message, pathOrUrl);
+}
+
 void throwError(const std::string_view message, const std::string_view pathOrUrl) {
-  throw errors::InputValidationException(fmt::format("{} ('{}')", message, pathOrUrl));
+  throw errors::InputValidationException(formatError(message, pathOrUrl));
 }
 
 // ---------------------------------------------------------------------
 // ForwardSlashSeparatedString
 
 Str ForwardSlashSeparatedString::removeTrailingForwardSlashesInPathSegments(
-    const std::string_view& str) const {
-  return trailingForwardSlashesInSegmentRegex.substituteToReduceSize(str, "/");
+    const std::string_view& str) {
+  Str result{str};
+  collapseForwardSlashes(result);
+  return result;
+}
+
+void ForwardSlashSeparatedString::collapseForwardSlashes(Str& str, const std::size_t pos) {
+  std::size_t readPos = str.find("//", pos);
+  if (readPos == Str::npos) {
+    return;
+  }
+  // Retain the first `/` of the run, then compact the remainder of the
+  // string, skipping any `/` that follows a `/`.
+  std::size_t writePos = readPos + 1;
+  for (readPos += 2; readPos < str.size(); ++readPos) {
+    const char chr = str[readPos];
+    if (chr != kForwardSlash || str[writePos - 1] != kForwardSlash) {
+      str[writePos++] = chr;
+    }
+  }
+  str.resize(writePos);
 }
 
 // ---------------------------------------------------------------------
 // GenericUrl
 
-bool GenericUrl::isFileUrl(const std::string_view& url) const {
-  return fileUrlRegex.match(url).has_value();
+bool GenericUrl::isFileUrl(const std::string_view& url) {
+  if (url.size() < kFileUrlPrefix.size()) {
+    return false;
+  }
+  return std::equal(kFileUrlPrefix.begin(), kFileUrlPrefix.end(), url.begin(),
+                    [](const char expected, const char actual) {
+                      // ASCII-only case folding, as per URL schemes.
+                      constexpr char kCaseBit = 0x20;
+                      const bool isLetter = expected >= 'a' && expected <= 'z';
+                      return expected == actual || (isLetter && (actual | kCaseBit) == expected);
+                    });
 }
 
 void GenericUrl::setUrlPath(const Str& urlPath, ada::url& url) {
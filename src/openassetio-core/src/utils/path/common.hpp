@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
 #include <string_view>
 
 #include <ada.h>
@@ -9,8 +10,6 @@
 #include <openassetio/typedefs.hpp>
 #include <openassetio/utils/path.hpp>
 
-#include "../Regex.hpp"
-
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 /**
@@ -56,6 +55,16 @@ constexpr char kForwardSlash = '/';
 constexpr char kBackSlash = '\\';
 constexpr std::string_view kBackSlashStr = "\\";
 constexpr std::string_view kDoubleBackSlash = R"(\\)";
+constexpr std::string_view kFileUrlPrefix = "file://";
+
+/**
+ * Format an error message to contain the problematic string.
+ *
+ * @param message Error message.
+ * @param pathOrUrl Problematic string to append to message.
+ * @return Formatted message.
+ */
+[[nodiscard]] Str formatError(std::string_view message, std::string_view pathOrUrl);
 
 /**
  * Throw an exception formatted to contain the problematic string.
@@ -71,8 +80,6 @@ void throwError(std::string_view message, std::string_view pathOrUrl);
  * I.e. posix paths and URLs.
  */
 struct ForwardSlashSeparatedString {
-  Regex trailingForwardSlashesInSegmentRegex{R"(//+)"};
-
   /**
    * Replace multiple `/`s between segments with a single `/`
    *
@@ -81,7 +88,18 @@ struct ForwardSlashSeparatedString {
    * @param str Path or URL to process.
    * @return New string with `/`s collapsed.
    */
-  [[nodiscard]] Str removeTrailingForwardSlashesInPathSegments(const std::string_view& str) const;
+  [[nodiscard]] static Str removeTrailingForwardSlashesInPathSegments(
+      const std::string_view& str);
+
+  /**
+   * Replace multiple `/`s between segments with a single `/`, in
+   * place.
+   *
+   * @param str Path or URL to modify.
+   * @param pos Position in the string to start from. Any preceding
+   * characters are left untouched.
+   */
+  static void collapseForwardSlashes(Str& str, std::size_t pos = 0);
 };
 
 /**
@@ -120,17 +138,15 @@ struct GenericPath {
  * Utility for dealing with non-platform specific URLs.
  */
 struct GenericUrl {
-  Regex fileUrlRegex{R"(^file://)"};
-
   /**
    * Check if URL has a `file://` scheme.
    *
-   * Regex (ab)used for case-insensitive matching.
+   * The scheme is matched case-insensitively.
    *
    * @param url URL to check.
    * @return true if URL has file scheme, false otherwise.
    */
-  [[nodiscard]] bool isFileUrl(const std::string_view& url) const;
+  [[nodiscard]] static bool isFileUrl(const std::string_view& url);
 
   /**
    * Set the path component on a URL object.
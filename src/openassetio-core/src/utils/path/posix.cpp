@@ -3,8 +3,12 @@
 #include "posix.hpp"
 
 #include <cassert>
+#include <cstddef>
+#include <optional>
 #include <string_view>
 
+#include <ada.h>
+
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
 
@@ -15,61 +19,111 @@ namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils::path::posix {
 
-Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) const {
+namespace {
+/**
+ * Decode the path component of a URL into a POSIX path, appending to
+ * an output string.
+ *
+ * @param urlPath Path component of the URL.
+ * @param out String to append the path to.
+ * @return Error message, if the decoded path is invalid.
+ */
+std::optional<std::string_view> appendDecodedPosixPath(const std::string_view& urlPath,
+                                                       Str& out) {
+  const std::size_t pathPos = out.size();
+  if (!detail::PosixUrl::appendPercentDecoded(urlPath, out)) {
+    return kErrorEncodedSeparator;
+  }
+
+  if (GenericPath::containsNullByte(std::string_view{out}.substr(pathPos))) {
+    return kErrorNullByte;
+  }
+
+  detail::PosixPath::removeTrailingForwardSlashesInPathSegments(out, pathPos);
+  return std::nullopt;
+}
+}  // namespace
+
+Str FileUrlPathConverter::pathToUrl(const std::string_view& posixPath) {
+  Str url;
+  url.reserve(kFileUrlPrefix.size() + posixPath.size());
+  if (const auto error = appendUrl(posixPath, url)) {
+    throwError(*error, posixPath);
+  }
+  return url;
+}
+
+Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) {
+  Str posixPath;
+  posixPath.reserve(url.size());
+  if (const auto error = appendPath(url, posixPath)) {
+    throwError(*error, url);
+  }
+  return posixPath;
+}
+
+std::optional<std::string_view> FileUrlPathConverter::appendUrl(const std::string_view& posixPath,
+                                                                Str& out) {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
   assert(!posixPath.empty());
 
-  if (posixPathHandler.containsUpwardsTraversal(posixPath)) {
-    throwError(kErrorUpwardsTraversal, posixPath);
+  if (detail::PosixPath::containsUpwardsTraversal(posixPath)) {
+    return kErrorUpwardsTraversal;
   }
   if (!detail::PosixPath::startsWithForwardSlash(posixPath)) {
-    throwError(kErrorRelativePath, posixPath);
+    return kErrorRelativePath;
+  }
+
+  // Build the URL directly, assuming the result is already in the
+  // canonical form that Ada would produce.
+  const std::size_t urlPos = out.size();
+  const std::size_t pathPos = urlPos + kFileUrlPrefix.size();
+  out += kFileUrlPrefix;
+  // Ada will automatically %-encode upon setting the URL path, but
+  // with a more limited set than we want.
+  detail::PosixUrl::appendPercentEncoded(posixPath, out);
+  detail::PosixPath::removeTrailingForwardSlashesInPathSegments(out, pathPos);
+
+  const Str::size_type urlPathSize = out.size() - pathPos;
+  if (detail::PosixUrl::isCanonicalPath(std::string_view{out}.substr(pathPos))) {
+    return std::nullopt;
   }
 
+  // Otherwise, defer to Ada to canonicalise the path (e.g. resolving
+  // `.` segments).
   ada::url adaUrl;
   adaUrl.type = ada::scheme::FILE;
   // Must explicitly set empty host to get `file://` rather than
   // `file:`.
   adaUrl.set_host("");
 
-  const Str processedPath = [&] {
-    if (const auto encodedPath = detail::PosixUrl::maybePercentEncode(posixPath)) {
-      return posixPathHandler.removeTrailingForwardSlashesInPathSegments(*encodedPath);
-    }
-    return posixPathHandler.removeTrailingForwardSlashesInPathSegments(posixPath);
-  }();
-
-  if (!adaUrl.set_pathname(processedPath)) {
-    throwError(kErrorInvalidUrlPath, posixPath);
+  if (!adaUrl.set_pathname(std::string_view{out}.substr(pathPos, urlPathSize))) {
+    return kErrorInvalidUrlPath;
   }
 
-  return adaUrl.get_href();
+  out.resize(urlPos);
+  out += adaUrl.get_href();
+  return std::nullopt;
 }
 
-Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+std::optional<std::string_view> FileUrlPathConverter::appendPath(const std::string_view& url,
+                                                                 Str& out) {
+  // Fast path for URLs that need no further parsing or normalisation.
+  if (const auto urlPath = detail::PosixUrl::canonicalLocalPath(url)) {
+    return appendDecodedPosixPath(*urlPath, out);
+  }
+
   ada::result<ada::url_aggregator> adaUrl = ada::parse(url);
   if (!adaUrl) {
-    throwError(kErrorUrlParseFailure, url);
+    return kErrorUrlParseFailure;
   }
 
   if (!adaUrl->get_host().empty()) {
-    throwError(kErrorNonLocal, url);
-  }
-
-  const std::string_view path = adaUrl->get_pathname();
-
-  if (urlHandler.containsPercentEncodedForwardSlash(path)) {
-    throwError(kErrorEncodedSeparator, url);
-  }
-
-  const Str decodedPath = ada::unicode::percent_decode(path, path.find(kPercent));
-
-  if (GenericPath::containsNullByte(decodedPath)) {
-    throwError(kErrorNullByte, url);
+    return kErrorNonLocal;
   }
 
-  return posixPathHandler.removeTrailingForwardSlashesInPathSegments(decodedPath);
+  return appendDecodedPosixPath(adaUrl->get_pathname(), out);
 }
 }  // namespace utils::path::posix
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
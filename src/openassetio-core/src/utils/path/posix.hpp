@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #pragma once
+#include <optional>
 #include <string_view>
 
 #include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
 
 #include "./posix/detail.hpp"
 
@@ -20,11 +22,6 @@ namespace utils::path::posix {
  * to/from a URL.
  */
 struct FileUrlPathConverter {
-  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-  detail::PosixUrl& urlHandler;
-  detail::PosixPath& posixPathHandler;
-  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
-
   /**
    * Convert a POSIX path into a file URL.
    *
@@ -33,7 +30,7 @@ struct FileUrlPathConverter {
    * @throws InputValidationException if the path is invalid (e.g.
    * relative) or unsupported.
    */
-  [[nodiscard]] Str pathToUrl(const std::string_view& posixPath) const;
+  [[nodiscard]] static Str pathToUrl(const std::string_view& posixPath);
 
   /**
    * Convert a file URL to a POSIX path.
@@ -43,7 +40,34 @@ struct FileUrlPathConverter {
    * @throws InputValidationException if the URL or path that it decodes
    * to is invalid or unsupported.
    */
-  [[nodiscard]] Str pathFromUrl(const std::string_view& url) const;
+  [[nodiscard]] static Str pathFromUrl(const std::string_view& url);
+
+  /**
+   * Convert a POSIX path into a file URL, appending to an output
+   * string, and reporting rather than throwing errors.
+   *
+   * @param posixPath path to convert.
+   * @param out String to append the URL to. On error, the appended
+   * content is unspecified.
+   * @return Error message, to be formatted with @p posixPath using
+   * @ref formatError, if the path is invalid or unsupported.
+   */
+  [[nodiscard]] static std::optional<std::string_view> appendUrl(
+      const std::string_view& posixPath, Str& out);
+
+  /**
+   * Convert a file URL to a POSIX path, appending to an output
+   * string, and reporting rather than throwing errors.
+   *
+   * @param url URL to convert.
+   * @param out String to append the path to. On error, the appended
+   * content is unspecified.
+   * @return Error message, to be formatted with @p url using
+   * @ref formatError, if the URL or path that it decodes to is invalid
+   * or unsupported.
+   */
+  [[nodiscard]] static std::optional<std::string_view> appendPath(const std::string_view& url,
+                                                                  Str& out);
 };
 }  // namespace utils::path::posix
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
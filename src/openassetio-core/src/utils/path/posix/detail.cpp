@@ -2,7 +2,10 @@
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #include "detail.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 
@@ -10,16 +13,89 @@
 #include <openassetio/typedefs.hpp>
 
 #include "../common.hpp"
+#include "../scan.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils::path::posix::detail {
 
+namespace {
+/**
+ * Check if a URL path segment is a `.` or `..` segment, including
+ * percent-encoded variants, as per the URL spec.
+ */
+bool isDotSegment(const std::string_view& segment) {
+  constexpr std::string_view kEncodedDot = "%2e";
+  constexpr char kCaseBit = 0x20;
+
+  std::size_t numDots = 0;
+  std::size_t pos = 0;
+  while (pos < segment.size()) {
+    if (segment[pos] == '.') {
+      ++pos;
+    } else if (segment.size() - pos >= kEncodedDot.size() && segment[pos] == kPercent &&
+               segment[pos + 1] == kEncodedDot[1] &&
+               (segment[pos + 2] | kCaseBit) == kEncodedDot[2]) {
+      pos += kEncodedDot.size();
+    } else {
+      return false;
+    }
+    ++numDots;
+  }
+  return numDots == 1 || numDots == 2;
+}
+
+/**
+ * Check if a URL path contains a `.` or `..` segment.
+ */
+bool containsDotSegment(const std::string_view& urlPath) {
+  std::size_t segmentStart = 0;
+  while (true) {
+    const std::size_t segmentEnd = std::min(urlPath.find(kForwardSlash, segmentStart),
+                                            urlPath.size());
+    if (isDotSegment(urlPath.substr(segmentStart, segmentEnd - segmentStart))) {
+      return true;
+    }
+    if (segmentEnd == urlPath.size()) {
+      return false;
+    }
+    segmentStart = segmentEnd + 1;
+  }
+}
+
+/**
+ * Convert a hex digit to its value, or return an empty optional if the
+ * character is not a hex digit.
+ */
+constexpr std::optional<std::uint8_t> hexDigitValue(const char chr) {
+  constexpr std::uint8_t kDecimalBase = 10;
+  if (chr >= '0' && chr <= '9') {
+    return static_cast<std::uint8_t>(chr - '0');
+  }
+  if (chr >= 'a' && chr <= 'f') {
+    return static_cast<std::uint8_t>(chr - 'a' + kDecimalBase);
+  }
+  if (chr >= 'A' && chr <= 'F') {
+    return static_cast<std::uint8_t>(chr - 'A' + kDecimalBase);
+  }
+  return std::nullopt;
+}
+}  // namespace
+
 // ---------------------------------------------------------------------
 // PosixPath
 
-bool PosixPath::containsUpwardsTraversal(const std::string_view& str) const {
-  return upwardsTraversalRegex.match(str).has_value();
+bool PosixPath::containsUpwardsTraversal(const std::string_view& path) {
+  constexpr std::string_view kUpwardsTraversal = "..";
+  for (std::size_t pos = path.find(kUpwardsTraversal); pos != std::string_view::npos;
+       pos = path.find(kUpwardsTraversal, pos + 1)) {
+    const std::size_t endPos = pos + kUpwardsTraversal.size();
+    if ((pos == 0 || path[pos - 1] == kForwardSlash) &&
+        (endPos == path.size() || path[endPos] == kForwardSlash)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 bool PosixPath::startsWithForwardSlash(const std::string_view& path) {
@@ -29,44 +105,93 @@ bool PosixPath::startsWithForwardSlash(const std::string_view& path) {
   return path.front() == kForwardSlash;
 }
 
-Str PosixPath::removeTrailingForwardSlashesInPathSegments(const std::string_view& path) const {
-  if (path.size() <= 2) {
-    return Str{path};
+void PosixPath::removeTrailingForwardSlashesInPathSegments(Str& str, std::size_t pos) {
+  if (str.size() - pos <= 2) {
+    return;
   }
-  Str normalisedPath;
-  normalisedPath.reserve(path.size());
   // Apparently (according to swift-url code comments) two leading
   // `/`s are implementation defined, so should be retained. Any
   // more than two should be collapsed to one.
-  if (path[0] == kForwardSlash && path[1] == kForwardSlash && path[2] != kForwardSlash) {
-    const std::string_view pathView{path};
-    normalisedPath += pathView.substr(0, 2);
-    normalisedPath +=
-        forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(
-            pathView.substr(2));
-  } else {
-    normalisedPath =
-        forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(path);
+  if (str[pos] == kForwardSlash && str[pos + 1] == kForwardSlash &&
+      str[pos + 2] != kForwardSlash) {
+    pos += 2;
   }
-  return normalisedPath;
+  ForwardSlashSeparatedString::collapseForwardSlashes(str, pos);
 }
 
 // ---------------------------------------------------------------------
 // PosixUrl
 
-bool PosixUrl::containsPercentEncodedForwardSlash(const std::string_view& url) const {
-  // Using regex for case-insensitivity.
-  return percentEncodedForwardSlashRegex.match(url).has_value();
+bool PosixUrl::isCanonicalPath(const std::string_view& urlPath) {
+  constexpr std::string_view kDoubleForwardSlash = "//";
+  return urlPath.substr(0, kDoubleForwardSlash.size()) != kDoubleForwardSlash &&
+         kNonCanonicalPathByteSet.findFirstOf(urlPath) == std::string_view::npos &&
+         !containsDotSegment(urlPath);
 }
 
-std::optional<Str> PosixUrl::maybePercentEncode(const std::string_view& path) {
-  // Ada will automatically %-encode upon setting the URL path, but
-  // with a more limited set than we want.
-  Str encodedPath;
-  if (ada::unicode::percent_encode<false>(path, kPercentEncodeCharacterSet.data(), encodedPath)) {
-    return encodedPath;
+std::optional<std::string_view> PosixUrl::canonicalLocalPath(const std::string_view& url) {
+  // `file://` followed by the `/` starting the path, i.e. an empty
+  // host.
+  const std::size_t pathPos = kFileUrlPrefix.size();
+  if (url.size() <= pathPos || url[pathPos] != kForwardSlash || !GenericUrl::isFileUrl(url)) {
+    return std::nullopt;
+  }
+  const std::string_view urlPath = url.substr(pathPos);
+  if (!isCanonicalPath(urlPath)) {
+    return std::nullopt;
+  }
+  return urlPath;
+}
+
+void PosixUrl::appendPercentEncoded(const std::string_view& path, Str& out) {
+  constexpr std::string_view kHexDigits = "0123456789ABCDEF";
+  constexpr std::uint8_t kNibbleSize = 4;
+  constexpr std::uint8_t kNibbleMask = 0xF;
+
+  std::size_t pos = 0;
+  while (true) {
+    const std::size_t encodePos = kPercentEncodeByteSet.findFirstOf(path, pos);
+    out.append(path.substr(pos, encodePos - pos));
+    if (encodePos == std::string_view::npos) {
+      return;
+    }
+    const auto byte = static_cast<std::uint8_t>(path[encodePos]);
+    out += kPercent;
+    out += kHexDigits[byte >> kNibbleSize];
+    out += kHexDigits[byte & kNibbleMask];
+    pos = encodePos + 1;
+  }
+}
+
+bool PosixUrl::appendPercentDecoded(const std::string_view& urlPath, Str& out) {
+  constexpr std::uint8_t kNibbleSize = 4;
+
+  std::size_t pos = 0;
+  while (true) {
+    const std::size_t percentPos = urlPath.find(kPercent, pos);
+    out.append(urlPath.substr(pos, percentPos - pos));
+    if (percentPos == std::string_view::npos) {
+      return true;
+    }
+    const std::optional<std::uint8_t> highNibble =
+        percentPos + 2 < urlPath.size() ? hexDigitValue(urlPath[percentPos + 1]) : std::nullopt;
+    const std::optional<std::uint8_t> lowNibble =
+        highNibble ? hexDigitValue(urlPath[percentPos + 2]) : std::nullopt;
+
+    if (!lowNibble) {
+      // Not a valid percent-encoded sequence, so retain as-is.
+      out += kPercent;
+      pos = percentPos + 1;
+      continue;
+    }
+    // NOLINTNEXTLINE(bugprone-unchecked-optional-access) - implied by lowNibble.
+    const auto decoded = static_cast<char>((*highNibble << kNibbleSize) | *lowNibble);
+    if (decoded == kForwardSlash) {
+      return false;
+    }
+    out += decoded;
+    pos = percentPos + 3;
   }
-  return std::nullopt;
 }
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 
@@ -9,8 +12,8 @@
 #include <openassetio/export.h>
 #include <openassetio/typedefs.hpp>
 
-#include "../../Regex.hpp"
 #include "../common.hpp"
+#include "../scan.hpp"
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -23,17 +26,13 @@ namespace utils::path::posix::detail {
  * Utility for POSIX paths.
  */
 struct PosixPath {
-  ForwardSlashSeparatedString& forwardSlashSeparatedStringHandler;
-
-  Regex upwardsTraversalRegex{R"((^|/)\.\.(/|$))"};
-
   /**
    * Check if a path contains `..` segment.
    *
    * @param path Path to check.
    * @return true if a `..` segment was found, false otherwise.
    */
-  [[nodiscard]] bool containsUpwardsTraversal(const std::string_view& str) const;
+  [[nodiscard]] static bool containsUpwardsTraversal(const std::string_view& path);
 
   /**
    * Check if a path starts with a `/`.
@@ -44,7 +43,7 @@ struct PosixPath {
   [[nodiscard]] static bool startsWithForwardSlash(const std::string_view& path);
 
   /**
-   * Remove extraneous leading `/`s in a path.
+   * Remove extraneous `/`s in a path, in place.
    *
    * If there are exactly two leading `/`s, then they are left
    * unmodified, since the POSIX spec says:
@@ -53,17 +52,17 @@ struct PosixPath {
    *   interpreted in an implementation-defined manner, although more
    *   than two leading slashes shall be treated as a single slash.
    *
-   * @param path Path to modify.
-   * @return Updated path.
+   * @param str String containing the path to modify.
+   * @param pos Position of the start of the path in the string. Any
+   * preceding characters (e.g. a URL scheme) are left untouched.
    */
-  [[nodiscard]] Str removeTrailingForwardSlashesInPathSegments(const std::string_view& path) const;
+  static void removeTrailingForwardSlashesInPathSegments(Str& str, std::size_t pos = 0);
 };
 
 /**
  * Utility for dealing with URLs pointing to POSIX paths.
  */
 struct PosixUrl {
-  Regex percentEncodedForwardSlashRegex{R"(%2F)"};
   /**
    * Augment default percent encoded set for paths.
    *
@@ -100,24 +99,87 @@ struct PosixUrl {
     return charSet;
   }();
 
+  /// Vectorisable form of @ref kPercentEncodeCharacterSet.
+  static constexpr ByteSet kPercentEncodeByteSet{kPercentEncodeCharacterSet};
+
+  /**
+   * Characters that Ada may transform or interpret specially when
+   * parsing a URL path.
+   *
+   * Ada's default %-encode set for URL path components, plus:
+   *
+   * - Backslashes (`\`), which are treated as separators.
+   * - Colons (`:`) and vertical bars (`|`), since they may form a
+   * Windows drive letter, which has special handling.
+   */
+  static constexpr ByteSet kNonCanonicalPathByteSet{[] {
+    constexpr std::uint8_t kByteSize = 8;
+
+    constexpr std::uint8_t kBackSlashHex = 0x5C;
+    constexpr std::uint8_t kColonHex = 0x3A;
+    constexpr std::uint8_t kVerticalBarHex = 0x7C;
+
+    ByteBitmap charSet{};
+    for (std::size_t idx = 0; idx < charSet.size(); ++idx) {
+      charSet[idx] = ada::character_sets::PATH_PERCENT_ENCODE[idx];
+    }
+    for (const std::uint8_t charCode : {kBackSlashHex, kColonHex, kVerticalBarHex}) {
+      charSet[charCode / kByteSize] |= static_cast<std::uint8_t>(1 << (charCode % kByteSize));
+    }
+    return charSet;
+  }()};
+
+  /**
+   * Check if a URL path is in the canonical form that Ada would
+   * produce, such that parsing or setting it would leave it unchanged.
+   *
+   * This is conservative - some canonical paths may be rejected, but
+   * no non-canonical path will be accepted. I.e. there are no
+   * characters that would be percent-encoded or otherwise transformed,
+   * no `.` or `..` segments (including percent-encoded variants), and
+   * no ambiguous leading `//`.
+   *
+   * @param urlPath Path component of a URL.
+   * @return true if the path is known to be canonical, false
+   * otherwise.
+   */
+  [[nodiscard]] static bool isCanonicalPath(const std::string_view& urlPath);
+
+  /**
+   * Extract the path component of a `file:///` URL, if the URL is
+   * already in canonical form.
+   *
+   * This allows the common case to bypass full URL parsing.
+   *
+   * @param url URL to extract path from.
+   * @return Path component of the URL, or an empty optional if the URL
+   * is not a canonical local file URL.
+   */
+  [[nodiscard]] static std::optional<std::string_view> canonicalLocalPath(
+      const std::string_view& url);
+
   /**
-   * Check if a URL contains a percent-encoded `/`.
+   * Percent-encode a path, appending the result to an output string.
    *
-   * @param url URL string to check.
-   * @return true if a percent-encoded slash was found, false otherwise.
+   * Bytes in @ref kPercentEncodeCharacterSet are encoded.
+   *
+   * @param path Path to percent-encode.
+   * @param out String to append the encoded path to.
    */
-  [[nodiscard]] bool containsPercentEncodedForwardSlash(const std::string_view& url) const;
+  static void appendPercentEncoded(const std::string_view& path, Str& out);
 
   /**
-   * Check if percent-encoding is needed for a URL path, and if so
-   * update an output string.
+   * Percent-decode a URL path, appending the result to an output
+   * string.
+   *
+   * Invalid percent-encoded sequences are left unmodified.
    *
-   * @param path Path to potentially percent-encode.
-   * @param encodedPath String to update with result of
-   * percent-encoding. Not modified if no encoding is needed.
-   * @return true if encoding was required, false otherwise.
+   * @param urlPath Path component of the URL to decode.
+   * @param out String to append the decoded path to.
+   * @return false if the path contains a percent-encoded `/`, in which
+   * case decoding is abandoned part way, true otherwise.
    */
-  static std::optional<Str> maybePercentEncode(const std::string_view& path);
+  [[nodiscard]] static bool appendPercentDecoded(const std::string_view& urlPath, Str& out);
 };
 }  // namespace utils::path::posix::detail
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "scan.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENASSETIO_PATH_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils::path {
+
+std::size_t ByteSet::findFirstOf(const std::string_view str, std::size_t pos) const {
+#ifdef OPENASSETIO_PATH_SCAN_SSE2
+  constexpr std::size_t kBlockSize = sizeof(__m128i);
+  // Comparisons are signed, so non-ASCII bytes are negative and hence
+  // fall outside of the printable range.
+  const __m128i belowPrintable = _mm_set1_epi8(static_cast<char>(kFirstPrintable - 1));
+  const __m128i abovePrintable = _mm_set1_epi8(static_cast<char>(kLastPrintable + 1));
+
+  for (; pos + kBlockSize <= str.size(); pos += kBlockSize) {
+    // NOLINTNEXTLINE(*-reinterpret-cast,*-pointer-arithmetic)
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str.data() + pos));
+    const __m128i isPrintableByte = _mm_and_si128(_mm_cmpgt_epi8(block, belowPrintable),
+                                                  _mm_cmplt_epi8(block, abovePrintable));
+    __m128i isMember = _mm_cmpeq_epi8(isPrintableByte, _mm_setzero_si128());
+    for (std::size_t idx = 0; idx < numPrintables_; ++idx) {
+      isMember = _mm_or_si128(isMember,
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8(printables_[idx])));
+    }
+    if (_mm_movemask_epi8(isMember) != 0) {
+      // Defer to the scalar loop to locate the member within the block.
+      break;
+    }
+  }
+#endif
+
+  for (; pos < str.size(); ++pos) {
+    if (contains(static_cast<std::uint8_t>(str[pos]))) {
+      return pos;
+    }
+  }
+  return std::string_view::npos;
+}
+}  // namespace utils::path
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace utils::path {
+
+/**
+ * Bitmap with one bit per byte value, in the same layout as Ada's
+ * percent-encode character sets.
+ */
+using ByteBitmap = std::array<std::uint8_t, 32>;
+
+/**
+ * Set of bytes, optimised for finding members in a string.
+ *
+ * Constructed from a bitmap of member bytes. All bytes outside the
+ * printable ASCII range (i.e. C0 controls, space, DEL and non-ASCII)
+ * must be members, as is the case for all URL percent-encode sets.
+ * Membership of those bytes can then be checked with a simple range
+ * comparison, leaving only the (few) printable members to be checked
+ * individually. This allows a string to be scanned using SIMD
+ * instructions, where available.
+ */
+class ByteSet {
+ public:
+  /**
+   * Construct from a bitmap.
+   *
+   * Intended to be used in a `constexpr` context, such that an invalid
+   * bitmap causes a compilation error.
+   *
+   * @param bitmap Bitmap of member bytes.
+   * @throws InputValidationException if a byte outside of the
+   * printable ASCII range is not a member.
+   */
+  constexpr explicit ByteSet(const ByteBitmap& bitmap) : bitmap_{bitmap} {
+    for (std::size_t byte = 0; byte <= kMaxByte; ++byte) {
+      const auto value = static_cast<std::uint8_t>(byte);
+      if (isPrintable(value)) {
+        if (contains(value)) {
+          printables_.at(numPrintables_++) = static_cast<char>(value);
+        }
+      } else if (!contains(value)) {
+        throw errors::InputValidationException{
+            "ByteSet must contain all non-printable and non-ASCII bytes"};
+      }
+    }
+  }
+
+  /**
+   * Check if a byte is a member of the set.
+   *
+   * @param byte Byte to check.
+   * @return true if a member, false otherwise.
+   */
+  [[nodiscard]] constexpr bool contains(const std::uint8_t byte) const {
+    return (bitmap_.at(byte / kBitsPerByte) & (1U << (byte % kBitsPerByte))) != 0;
+  }
+
+  /**
+   * Find the first member of the set in a string.
+   *
+   * @param str String to search.
+   * @param pos Position to start searching from.
+   * @return Position of the first member byte, or
+   * `std::string_view::npos` if none was found.
+   */
+  [[nodiscard]] std::size_t findFirstOf(std::string_view str, std::size_t pos = 0) const;
+
+ private:
+  static constexpr std::size_t kMaxByte = 0xFF;
+  static constexpr std::size_t kBitsPerByte = 8;
+  static constexpr std::uint8_t kFirstPrintable = 0x21;
+  static constexpr std::uint8_t kLastPrintable = 0x7E;
+
+  [[nodiscard]] static constexpr bool isPrintable(const std::uint8_t byte) {
+    return byte >= kFirstPrintable && byte <= kLastPrintable;
+  }
+
+  ByteBitmap bitmap_;
+  std::array<char, kLastPrintable - kFirstPrintable + 1> printables_{};
+  std::size_t numPrintables_{0};
+};
+}  // namespace utils::path
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -20,7 +20,7 @@ namespace utils::path::windows {
 // ---------------------------------------------------------------------
 // FileUrlPathConverter
 
-Str FileUrlPathConverter::pathToUrl(const std::string_view& windowsPath) const {
+Str FileUrlPathConverter::pathToUrl(const std::string_view& windowsPath) {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
   assert(!windowsPath.empty());
@@ -29,19 +29,27 @@ Str FileUrlPathConverter::pathToUrl(const std::string_view& windowsPath) const {
   // Note: url.set_protocol(...) is a no-op, see https://github.com/ada-url/ada/issues/573
   url.type = ada::scheme::FILE;
 
-  if (!uncUnnormalisedDeviceSharePathHandler.toUrl(windowsPath, url)) {
-    if (!uncUnnormalisedDeviceDrivePathHandler.toUrl(windowsPath, url)) {
-      if (!uncSharePathHandler.toUrl(windowsPath, url)) {
-        // If none of the above, assume a drive path, e.g. `C:\`
-        drivePathHandler.toUrl(windowsPath, url);
-      }
-    }
+  const auto [category, prefixLength] = detail::PathClassifier::classify(windowsPath);
+  switch (category) {
+    case detail::PathClassifier::Category::kUncDeviceShare:
+      pathTypes::UncUnnormalisedDeviceSharePath::toUrl(windowsPath, url);
+      break;
+    case detail::PathClassifier::Category::kUncDeviceDrive:
+      pathTypes::UncUnnormalisedDeviceDrivePath::toUrl(windowsPath, url);
+      break;
+    case detail::PathClassifier::Category::kUncShare:
+      pathTypes::UncSharePath::toUrl(windowsPath, prefixLength, url);
+      break;
+    case detail::PathClassifier::Category::kDrive:
+      // If none of the above, assume a drive path, e.g. `C:\`
+      pathTypes::DrivePath::toUrl(windowsPath, url);
+      break;
   }
 
   return url.get_href();
 }
 
-Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
+Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) {
   ada::result<ada::url_aggregator> adaUrl = ada::parse(url);
   if (!adaUrl) {
     throwError(kErrorUrlParseFailure, url);
@@ -62,23 +70,23 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
   // i.e. it satisfies the error priority of the test suite from the
   // swift-url project, which we use for our unit tests.
 
-  if (host.empty() && !driveLetterHandler.isAbsoluteDrivePath(decodedPath)) {
+  if (host.empty() && !detail::DriveLetter::isAbsoluteDrivePath(decodedPath)) {
     throwError(kErrorRelativePath, url);
   }
   if (GenericPath::containsNullByte(decodedPath)) {
     throwError(kErrorNullByte, url);
   }
-  if (urlHandler.containsPercentEncodedSlash(encodedPath)) {
+  if (detail::WindowsUrl::containsPercentEncodedSlash(encodedPath)) {
     throwError(kErrorEncodedSeparator, url);
   }
-  if (!host.empty() && uncHostHandler.isInvalidHostname(host)) {
+  if (!host.empty() && detail::UncHost::isInvalidHostname(host)) {
     throwError(kErrorUnsupportedHostname, url);
   }
 
   Str windowsPath;
   if (!host.empty()) {
     windowsPath += kDoubleBackSlash;
-    if (const auto ip6Host = urlHandler.ip6ToValidHostname(host)) {
+    if (const auto ip6Host = detail::WindowsUrl::ip6ToValidHostname(host)) {
       windowsPath += *ip6Host;
     } else {
       windowsPath += host;
@@ -86,7 +94,7 @@ Str FileUrlPathConverter::pathFromUrl(const std::string_view& url) const {
   }
 
   decodedPath =
-      forwardSlashSeparatedStringHandler.removeTrailingForwardSlashesInPathSegments(decodedPath);
+      ForwardSlashSeparatedString::removeTrailingForwardSlashesInPathSegments(decodedPath);
   windowsPath += decodedPath;
 
   std::replace(windowsPath.begin(), windowsPath.end(), kForwardSlash, kBackSlash);
@@ -27,30 +27,19 @@ struct FileUrlPathConverter {
   /// https://learn.microsoft.com/en-us/windows/win32/fileio/maximum-file-path-limitation
   static constexpr std::size_t kMaxPath = 259;
 
-  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-  detail::WindowsUrl& urlHandler;
-  detail::DriveLetter& driveLetterHandler;
-  detail::UncHost& uncHostHandler;
-  ForwardSlashSeparatedString& forwardSlashSeparatedStringHandler;
-
-  pathTypes::DrivePath& drivePathHandler;
-  pathTypes::UncSharePath& uncSharePathHandler;
-  pathTypes::UncUnnormalisedDeviceDrivePath& uncUnnormalisedDeviceDrivePathHandler;
-  pathTypes::UncUnnormalisedDeviceSharePath& uncUnnormalisedDeviceSharePathHandler;
-  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
-
   /**
    * Convert a Windows path into a file URL.
    *
-   * Conversion is attempted starting at most specific path prefix
-   * (device share paths, i.e. `\\?\UNC\`) down to least specific (drive
-   * paths, i.e. `C:\`).
+   * The type of path is determined in a single pass over its prefix,
+   * from most specific (device share paths, i.e. `\\?\UNC\`) down to
+   * least specific (drive paths, i.e. `C:\`), then dispatched to the
+   * appropriate handler.
    *
    * @param windowsPath Path to convert.
    * @return URL string.
    * @throws InputValidationException if path is invalid or unsupported.
    */
-  [[nodiscard]] Str pathToUrl(const std::string_view& windowsPath) const;
+  [[nodiscard]] static Str pathToUrl(const std::string_view& windowsPath);
 
   /**
    * Convert a file URL to a Windows path.
@@ -67,7 +56,7 @@ struct FileUrlPathConverter {
    * @throws InputValidationException if URL is invalid or decodes to an
    * invalid path.
    */
-  [[nodiscard]] Str pathFromUrl(const std::string_view& url) const;
+  [[nodiscard]] static Str pathFromUrl(const std::string_view& url);
 };
 }  // namespace utils::path::windows
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -4,6 +4,8 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
 #include <string_view>
 
@@ -15,22 +17,117 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils::path::windows::detail {
+namespace {
+constexpr char kDot = '.';
+constexpr char kSpace = ' ';
+constexpr char kQuestionMark = '?';
+constexpr std::uint8_t kFirstNonAscii = 0x80;
+
+[[nodiscard]] constexpr bool isAnySlash(const char chr) {
+  return chr == kForwardSlash || chr == kBackSlash;
+}
+
+[[nodiscard]] constexpr bool isBackSlash(const char chr) { return chr == kBackSlash; }
+
+[[nodiscard]] constexpr char toLowerAscii(const char chr) {
+  return chr >= 'A' && chr <= 'Z' ? static_cast<char>(chr - 'A' + 'a') : chr;
+}
+
+[[nodiscard]] constexpr bool isAsciiAlpha(const char chr) {
+  const char lower = toLowerAscii(chr);
+  return lower >= 'a' && lower <= 'z';
+}
+
+[[nodiscard]] constexpr bool isAsciiAlphaNumeric(const char chr) {
+  return isAsciiAlpha(chr) || (chr >= '0' && chr <= '9');
+}
+
+[[nodiscard]] bool equalsCaseless(const std::string_view& str, const std::string_view& lower) {
+  return std::equal(str.begin(), str.end(), lower.begin(), lower.end(),
+                    [](const char lhs, const char rhs) { return toLowerAscii(lhs) == rhs; });
+}
+
+/**
+ * Count the number of consecutive characters at the end of a string
+ * that satisfy a predicate.
+ */
+template <class Predicate>
+[[nodiscard]] std::size_t trailingRunLength(const std::string_view& str, Predicate&& predicate) {
+  std::size_t length = 0;
+  while (length < str.size() && predicate(str[str.size() - length - 1])) {
+    ++length;
+  }
+  return length;
+}
+
+/**
+ * Check if a string contains a `..` segment, where segments are
+ * delimited by characters satisfying a predicate.
+ */
+template <class Predicate>
+[[nodiscard]] bool containsDotDotSegment(const std::string_view& path, Predicate&& isSeparator) {
+  constexpr std::string_view kDotDot = "..";
+  for (std::size_t pos = path.find(kDotDot); pos != std::string_view::npos;
+       pos = path.find(kDotDot, pos + 1)) {
+    const bool isSegmentStart = pos == 0 || isSeparator(path[pos - 1]);
+    const std::size_t end = pos + kDotDot.size();
+    const bool isSegmentEnd = end == path.size() || isSeparator(path[end]);
+    if (isSegmentStart && isSegmentEnd) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Remove all but one of a run of trailing separators, where separators
+ * are characters satisfying a predicate.
+ */
+template <class Predicate>
+[[nodiscard]] std::string_view withoutExtraTrailingSeparators(const std::string_view& path,
+                                                              Predicate&& isSeparator) {
+  const std::size_t numSeparators = trailingRunLength(path, isSeparator);
+  if (numSeparators < 2) {
+    return path;
+  }
+  return path.substr(0, path.size() - numSeparators + 1);
+}
+}  // namespace
 
 // ---------------------------------------------------------------------
 // WindowsUrl
 
-bool WindowsUrl::containsPercentEncodedSlash(const std::string_view& url) const {
-  // Using regex for case-insensitivity.
-  return percentEncodedSlashRegex.match(url).has_value();
+bool WindowsUrl::containsPercentEncodedSlash(const std::string_view& url) {
+  constexpr std::size_t kHexLength = 2;
+  for (std::size_t pos = url.find(kPercent); pos != std::string_view::npos;
+       pos = url.find(kPercent, pos + 1)) {
+    const std::string_view hex = url.substr(pos + 1, kHexLength);
+    if (equalsCaseless(hex, "5c") || equalsCaseless(hex, "2f")) {
+      return true;
+    }
+    // For parity with the historic `%(:?5C|2F)` pattern, tolerate a
+    // `:` between the `%` and `5C`.
+    if (hex.size() == kHexLength && hex[0] == kColon &&
+        equalsCaseless(url.substr(pos + 2, kHexLength), "5c")) {
+      return true;
+    }
+  }
+  return false;
 }
 
-std::optional<Str> WindowsUrl::ip6ToValidHostname(const std::string_view& host) const {
-  const auto match = ip6HostRegex.match(host);
-  if (!match) {
+std::optional<Str> WindowsUrl::ip6ToValidHostname(const std::string_view& host) {
+  // E.g. `[::1]`.
+  if (host.size() < 3 || host.front() != '[' || host.back() != ']') {
+    return std::nullopt;
+  }
+  const std::string_view address = host.substr(1, host.size() - 2);
+  if (!std::all_of(address.begin(), address.end(),
+                   [](const char chr) { return isAsciiAlphaNumeric(chr) || chr == kColon; })) {
     return std::nullopt;
   }
   Str ip6HostName;
-  ip6HostName = match->group(host, 1);
+  ip6HostName.reserve(address.size() + kIp6HostSuffix.size());
+  ip6HostName = address;
   ip6HostName += kIp6HostSuffix;
   std::replace(ip6HostName.begin(), ip6HostName.end(), kColon, kHyphen);
   return ip6HostName;
@@ -51,8 +148,8 @@ bool WindowsUrl::maybePercentEncodeAndAppendTo(const std::string_view& path, Str
   return false;
 }
 
-bool WindowsUrl::setUrlHost(const std::string_view& host, ada::url& url) const {
-  if (localHostRegex.match(host).has_value()) {
+bool WindowsUrl::setUrlHost(const std::string_view& host, ada::url& url) {
+  if (equalsCaseless(host, "localhost")) {
     return url.set_host(kLocalHostIP);
   }
   return url.set_host(host);
@@ -61,80 +158,118 @@ bool WindowsUrl::setUrlHost(const std::string_view& host, ada::url& url) const {
 // ---------------------------------------------------------------------
 // NormalisedPath
 
-std::string_view NormalisedPath::withoutTrailingSlashes(const std::string_view& path) const {
-  const auto match = trailingSlashesRegex.match(path);
-  if (!match) {
-    return path;
-  }
-  return path.substr(0, path.size() - match->group(path, 1).size());
+std::string_view NormalisedPath::withoutTrailingSlashes(const std::string_view& path) {
+  return withoutExtraTrailingSeparators(path, isAnySlash);
 }
 
-std::string_view NormalisedPath::withoutTrailingDotsAsFile(const std::string_view& path) const {
-  const auto match = trailingDotsAsFileRegex.match(path);
-  if (!match) {
+std::string_view NormalisedPath::withoutTrailingDotsAsFile(const std::string_view& path) {
+  constexpr std::size_t kMinDots = 3;
+  const std::size_t numDots = trailingRunLength(path, [](const char chr) { return chr == kDot; });
+  if (numDots < kMinDots || numDots == path.size() ||
+      !isAnySlash(path[path.size() - numDots - 1])) {
     return path;
   }
-  return path.substr(0, path.size() - match->group(path, 1).size());
+  return path.substr(0, path.size() - numDots);
 }
 
-std::string_view NormalisedPath::withoutTrailingDotsInFile(const std::string_view& path) const {
-  const auto match = trailingDotsInFileRegex.match(path);
-  if (!match) {
+std::string_view NormalisedPath::withoutTrailingDotsInFile(const std::string_view& path) {
+  const std::size_t numDots = trailingRunLength(path, [](const char chr) { return chr == kDot; });
+  if (numDots == 0 || numDots == path.size() || isAnySlash(path[path.size() - numDots - 1])) {
     return path;
   }
-  return path.substr(0, path.size() - match->group(path, 1).size());
+  return path.substr(0, path.size() - numDots);
 }
 
-std::string_view NormalisedPath::withoutTrailingSpacesAndDots(const std::string_view& path) const {
-  const auto match = trailingDotsAndSpacesRegex.match(path);
-  if (!match) {
+std::string_view NormalisedPath::withoutTrailingSpacesAndDots(const std::string_view& path) {
+  // Only applies to the final segment, which must be preceded by a
+  // separator.
+  const std::size_t lastSlashPos = path.find_last_of(kAnySlash);
+  if (lastSlashPos == std::string_view::npos) {
     return path;
   }
-  return path.substr(0, path.size() - match->group(path, 1).size());
+  const std::size_t spacePos = path.find(kSpace, lastSlashPos + 1);
+  if (spacePos == std::string_view::npos ||
+      path.find_first_not_of(". ", spacePos) != std::string_view::npos) {
+    return path;
+  }
+  return path.substr(0, spacePos);
 }
 
-bool NormalisedPath::containsUpwardsTraversal(const std::string_view& path) const {
-  return upwardsTraversalRegex.match(path).has_value();
+bool NormalisedPath::containsUpwardsTraversal(const std::string_view& path) {
+  return containsDotDotSegment(path, isAnySlash);
 }
 
-Str NormalisedPath::removeTrailingDotsInPathSegments(const std::string_view& path) const {
-  return trailingSingleDotInSegmentRegex.substituteToReduceSize(path, "");
-}
+void NormalisedPath::appendNormalisedPathSegments(const std::string_view& path,
+                                                  const bool shouldRemoveTrailingDots,
+                                                  Str& appendTo) {
+  appendTo.reserve(appendTo.size() + path.size());
 
-Str NormalisedPath::removeTrailingSlashesInPathSegments(const std::string_view& path) const {
-  return trailingSlashesInSegmentRegex.substituteToReduceSize(path, kBackSlashStr);
+  for (std::size_t pos = 0; pos < path.size(); ++pos) {
+    const char chr = path[pos];
+    const bool isFollowedBySlash = pos + 1 < path.size() && isAnySlash(path[pos + 1]);
+
+    if (isAnySlash(chr)) {
+      if (!isFollowedBySlash) {
+        // Lone separators are preserved as-is.
+        appendTo += chr;
+        continue;
+      }
+      // Collapse a run of separators down to a single `\`.
+      while (pos + 1 < path.size() && isAnySlash(path[pos + 1])) {
+        ++pos;
+      }
+      appendTo += kBackSlash;
+      continue;
+    }
+
+    // Note that the preceding character is always from the original
+    // path, regardless of collapsed separators, since it is only
+    // compared against separators.
+    const bool isTrailingDot = chr == kDot && isFollowedBySlash &&
+                               (pos == 0 || (path[pos - 1] != kDot && !isAnySlash(path[pos - 1])));
+    if (!(shouldRemoveTrailingDots && isTrailingDot)) {
+      appendTo += chr;
+    }
+  }
 }
 
 bool NormalisedPath::startsWithSlash(const std::string_view& path) {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
   assert(!path.empty());
-  return path.substr(0, 1).find_first_of(kAnySlash) != std::string_view::npos;
+  return isAnySlash(path.front());
 }
 
 // ---------------------------------------------------------------------
 // DriveLetter
 
-bool DriveLetter::isDrive(const std::string_view& str) const {
-  return driveRegex.match(str).has_value();
+bool DriveLetter::isDrive(const std::string_view& str) {
+  // E.g. `C:`.
+  return str.size() == 2 && isAsciiAlpha(str[0]) && str[1] == kColon;
 }
 
-bool DriveLetter::isAbsoluteDrivePath(const std::string_view& str) const {
-  return absoluteDrivePathRegex.match(str).has_value();
+bool DriveLetter::isAbsoluteDrivePath(const std::string_view& str) {
+  // E.g. `C:\` or `C:/`.
+  return str.size() > 2 && isDrive(str.substr(0, 2)) && isAnySlash(str[2]);
 }
 
 // ---------------------------------------------------------------------
 // UncHost
 
-bool UncHost::isInvalidHostname(const std::string_view& host) const {
-  return invalidHostnameRegex.match(host).has_value();
+bool UncHost::isInvalidHostname(const std::string_view& host) {
+  if (host == "." || host == "?" || DriveLetter::isDrive(host)) {
+    return true;
+  }
+  return std::any_of(host.begin(), host.end(), [](const char chr) {
+    return chr == kPercent || static_cast<std::uint8_t>(chr) >= kFirstNonAscii;
+  });
 }
 
 // ---------------------------------------------------------------------
 // UncUnnormalisedDevicePath
 
 void UncUnnormalisedDevicePath::validatePath(const std::string_view& windowsPath,
-                                             const UncDetails& uncDetails) const {
+                                             const UncDetails& uncDetails) {
   if (uncDetails.fullPath.empty()) {
     // Must have something after the `\\?\` or `\\?\UNC\`
     throwError(kErrorInvalidPath, windowsPath);
@@ -150,25 +285,143 @@ void UncUnnormalisedDevicePath::validatePath(const std::string_view& windowsPath
 }
 
 std::string_view UncUnnormalisedDevicePath::withoutTrailingSlashes(
-    const std::string_view& path) const {
-  auto match = trailingSlashesRegex.match(path);
-  if (!match) {
-    return path;
-  }
-  return path.substr(0, path.size() - match->group(path, 1).size());
+    const std::string_view& path) {
+  return withoutExtraTrailingSeparators(path, isBackSlash);
 }
 
 bool UncUnnormalisedDevicePath::containsForwardSlash(const std::string_view& path) {
   return path.find_first_of(kForwardSlash) != std::string_view::npos;
 }
 
-bool UncUnnormalisedDevicePath::containsUpwardsTraversal(const std::string_view& str) const {
-  return upwardsTraversalRegex.match(str).has_value();
+bool UncUnnormalisedDevicePath::containsUpwardsTraversal(const std::string_view& str) {
+  return containsDotDotSegment(str, isBackSlash);
+}
+
+Str UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(const std::string_view& path) {
+  Str result;
+  result.reserve(path.size());
+  for (std::size_t pos = 0; pos < path.size(); ++pos) {
+    result += path[pos];
+    if (path[pos] == kBackSlash) {
+      while (pos + 1 < path.size() && path[pos + 1] == kBackSlash) {
+        ++pos;
+      }
+    }
+  }
+  return result;
 }
 
-Str UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(
-    const std::string_view& path) const {
-  return trailingSlashesInSegmentRegex.substituteToReduceSize(path, R"(\)");
+// ---------------------------------------------------------------------
+// PathClassifier
+
+PathClassifier::Classification PathClassifier::classify(const std::string_view& path) {
+  // States are named after the prefix consumed so far, where "Slash"
+  // is either separator type.
+  enum class State {
+    kStart,
+    kSlash,            // `/`
+    kBackSlash,        // `\`
+    kDoubleBackSlash,  // `\\`
+    kSlashes,          // Two or more separators, not a device path.
+    kDeviceQuery,      // `\\?`
+    kDevice,           // `\\?\`
+    kDeviceU,          // `\\?\U`
+    kDeviceUN,         // `\\?\UN`
+    kDeviceUNC,        // `\\?\UNC`
+  };
+
+  const auto uncShare = [](const std::size_t prefixLength) {
+    return Classification{Category::kUncShare, prefixLength};
+  };
+  constexpr Classification kDrive{Category::kDrive, 0};
+  constexpr Classification kDeviceDrive{Category::kUncDeviceDrive, kDevicePrefix.size()};
+  constexpr Classification kDeviceShare{Category::kUncDeviceShare, kDeviceSharePrefix.size()};
+
+  State state = State::kStart;
+
+  for (std::size_t pos = 0; pos < path.size(); ++pos) {
+    const char chr = path[pos];
+    switch (state) {
+      case State::kStart:
+        if (!isAnySlash(chr)) {
+          return kDrive;
+        }
+        state = chr == kBackSlash ? State::kBackSlash : State::kSlash;
+        break;
+      case State::kSlash:
+        if (!isAnySlash(chr)) {
+          return kDrive;
+        }
+        state = State::kSlashes;
+        break;
+      case State::kBackSlash:
+        if (!isAnySlash(chr)) {
+          return kDrive;
+        }
+        state = chr == kBackSlash ? State::kDoubleBackSlash : State::kSlashes;
+        break;
+      case State::kDoubleBackSlash:
+        if (chr == kQuestionMark) {
+          state = State::kDeviceQuery;
+        } else if (isAnySlash(chr)) {
+          state = State::kSlashes;
+        } else {
+          return uncShare(pos);
+        }
+        break;
+      case State::kSlashes:
+        if (!isAnySlash(chr)) {
+          return uncShare(pos);
+        }
+        break;
+      case State::kDeviceQuery:
+        if (chr != kBackSlash) {
+          // E.g. `\\?host`, where `?host` is the hostname.
+          return uncShare(2);
+        }
+        state = State::kDevice;
+        break;
+      case State::kDevice:
+        if (toLowerAscii(chr) != 'u') {
+          return kDeviceDrive;
+        }
+        state = State::kDeviceU;
+        break;
+      case State::kDeviceU:
+        if (toLowerAscii(chr) != 'n') {
+          return kDeviceDrive;
+        }
+        state = State::kDeviceUN;
+        break;
+      case State::kDeviceUN:
+        if (toLowerAscii(chr) != 'c') {
+          return kDeviceDrive;
+        }
+        state = State::kDeviceUNC;
+        break;
+      case State::kDeviceUNC:
+        return chr == kBackSlash ? kDeviceShare : kDeviceDrive;
+    }
+  }
+
+  // Reached the end of the path.
+  switch (state) {
+    case State::kStart:
+    case State::kSlash:
+    case State::kBackSlash:
+      return kDrive;
+    case State::kDoubleBackSlash:
+    case State::kSlashes:
+      return uncShare(path.size());
+    case State::kDeviceQuery:
+      return uncShare(2);
+    case State::kDevice:
+    case State::kDeviceU:
+    case State::kDeviceUN:
+    case State::kDeviceUNC:
+      return kDeviceDrive;
+  }
+  return kDrive;
 }
 
 }  // namespace utils::path::windows::detail
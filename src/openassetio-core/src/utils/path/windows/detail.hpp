@@ -5,12 +5,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <string_view>
 
 #include <ada.h>
 
 #include <openassetio/export.h>
-
-#include "../../Regex.hpp"
+#include <openassetio/typedefs.hpp>
 
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
@@ -24,9 +24,6 @@ namespace utils::path::windows::detail {
 struct WindowsUrl {
   static constexpr std::string_view kLocalHostIP = "127.0.0.1";
   static constexpr std::string_view kIp6HostSuffix = ".ipv6-literal.net";
-  Regex ip6HostRegex{R"(^\[([A-Z0-9:]+)\]$)"};
-  Regex localHostRegex{"^localhost$"};
-  Regex percentEncodedSlashRegex{R"(%(:?5C|2F))"};
   /**
    * Augment default percent encoded set for paths.
    *
@@ -66,7 +63,7 @@ struct WindowsUrl {
    * @param url URL string to check.
    * @return true if a percent-encoded slash was found, false otherwise.
    */
-  [[nodiscard]] bool containsPercentEncodedSlash(const std::string_view& url) const;
+  [[nodiscard]] static bool containsPercentEncodedSlash(const std::string_view& url);
 
   /**
    * Detect an IP6 address, and if found convert it to a valid UNC
@@ -76,7 +73,7 @@ struct WindowsUrl {
    * @return Unset optional if hostname is not an IP6 address, otherwise
    * a valid UNC hostname pointing to the IP6 address.
    */
-  [[nodiscard]] std::optional<Str> ip6ToValidHostname(const std::string_view& host) const;
+  [[nodiscard]] static std::optional<Str> ip6ToValidHostname(const std::string_view& host);
 
   /**
    * Check if percent-encoding is needed for a URL path, and if so
@@ -102,7 +99,7 @@ struct WindowsUrl {
    * @return true if setting host succeeded, false if the host is
    * invalid, according to the Ada library.
    */
-  bool setUrlHost(const std::string_view& host, ada::url& url) const;
+  static bool setUrlHost(const std::string_view& host, ada::url& url);
 };
 
 /**
@@ -135,13 +132,6 @@ struct UncDetails {
  * See https://learn.microsoft.com/en-us/dotnet/standard/io/file-path-formats
  */
 struct NormalisedPath {
-  Regex upwardsTraversalRegex{R"((^|[\\/])\.\.([\\/]|$))"};
-  Regex trailingDotsAsFileRegex{R"([\\/](\.{3,})$)"};
-  Regex trailingDotsInFileRegex{R"([^.\\/](\.+)$)"};
-  Regex trailingDotsAndSpacesRegex{R"([\\/][^\\/ ]*( [. ]*)$)"};
-  Regex trailingSlashesRegex{R"([\\/]([\\/]+)$)"};
-  Regex trailingSingleDotInSegmentRegex{R"((?<![.\\/])\.(?=[/\\]))"};
-  Regex trailingSlashesInSegmentRegex{R"([\\/][\\/]+)"};
 
   /**
    * Get a view of the input path with all but the last trailing slash
@@ -153,7 +143,7 @@ struct NormalisedPath {
    * @return Input path if no trimming was needed, otherwise a
    * substring view with extraneous trailing slashes trimmed.
    */
-  [[nodiscard]] std::string_view withoutTrailingSlashes(const std::string_view& path) const;
+  [[nodiscard]] static std::string_view withoutTrailingSlashes(const std::string_view& path);
 
   /**
    * If the final segment of input path ends in three or more `.`s, get
@@ -169,7 +159,7 @@ struct NormalisedPath {
    * @return Input path if no trimming was needed, otherwise a
    * substring view with extraneous trailing dots trimmed.
    */
-  [[nodiscard]] std::string_view withoutTrailingDotsAsFile(const std::string_view& path) const;
+  [[nodiscard]] static std::string_view withoutTrailingDotsAsFile(const std::string_view& path);
 
   /**
    * If the final segment of the input path is a file name, and the file
@@ -183,7 +173,7 @@ struct NormalisedPath {
    * @return Input path if no trimming was needed, otherwise a
    * substring view with extraneous trailing dots trimmed.
    */
-  [[nodiscard]] std::string_view withoutTrailingDotsInFile(const std::string_view& path) const;
+  [[nodiscard]] static std::string_view withoutTrailingDotsInFile(const std::string_view& path);
 
   /**
    * If the final segment of the input path ends in a space followed by
@@ -195,7 +185,8 @@ struct NormalisedPath {
    * @return Input path if no trimming was needed, otherwise a
    * substring view with extraneous trailing dots trimmed.
    */
-  [[nodiscard]] std::string_view withoutTrailingSpacesAndDots(const std::string_view& path) const;
+  [[nodiscard]] static std::string_view withoutTrailingSpacesAndDots(
+      const std::string_view& path);
 
   /**
    * Check if a path contains `..` segment.
@@ -203,28 +194,30 @@ struct NormalisedPath {
    * @param path Path to check.
    * @return True if a `..` segment was found, false otherwise.
    */
-  [[nodiscard]] bool containsUpwardsTraversal(const std::string_view& path) const;
+  [[nodiscard]] static bool containsUpwardsTraversal(const std::string_view& path);
 
   /**
-   * Remove all trailing `.`s in each path segment.
+   * Append a path to a string, collapsing runs of separators and
+   * (optionally) removing a trailing `.` from each path segment.
    *
-   * E.g. `C:\path...\to.\file` -> `C:\path\to\file`
+   * Runs of two or more separators (of either type) are collapsed to a
+   * single `\`, whereas lone separators are preserved as-is.
    *
-   * @param path Path to process.
-   * @return New string with any trailing dots within segments removed.
-   */
-  [[nodiscard]] Str removeTrailingDotsInPathSegments(const std::string_view& path) const;
-
-  /**
-   * Remove all trailing slashes in each path segment.
+   * A single trailing `.` is removed from a segment if it is followed
+   * by a separator and not preceded by another `.` or separator.
    *
-   * E.g. `C:\path\/\/to\\file` -> `C:\path\to\file`
+   * E.g. `C:\path.\/\to.\file` -> `C:\path\to\file`
+   *
+   * This is done in a single pass, with the same result as collapsing
+   * separators then removing dots in separate passes.
    *
    * @param path Path to process.
-   * @return New string with any trailing slashes within segments
-   * removed.
+   * @param shouldRemoveTrailingDots Whether to remove trailing `.`s
+   * from path segments.
+   * @param appendTo String to append the normalised path to.
    */
-  [[nodiscard]] Str removeTrailingSlashesInPathSegments(const std::string_view& path) const;
+  static void appendNormalisedPathSegments(const std::string_view& path,
+                                           bool shouldRemoveTrailingDots, Str& appendTo);
 
   /**
    * Check if given path starts with a path separator.
@@ -241,8 +234,6 @@ struct NormalisedPath {
  * Utility for handling Windows drive letters e.g. `C:\`.
  */
 struct DriveLetter {
-  Regex driveRegex{R"(^[A-Z]:$)"};
-  Regex absoluteDrivePathRegex{R"(^[A-Z]:[/\\])"};
   /**
    * Check if a given string is a Windows drive letter.
    *
@@ -251,7 +242,7 @@ struct DriveLetter {
    * @param str String to check.
    * @return true if string is a drive letter, false otherwise.
    */
-  [[nodiscard]] bool isDrive(const std::string_view& str) const;
+  [[nodiscard]] static bool isDrive(const std::string_view& str);
 
   /**
    * Check if a given string is a Windows absolute path on a drive.
@@ -261,7 +252,7 @@ struct DriveLetter {
    * @param str String to check.
    * @return true if string is an absolute drive path, false otherwise.
    */
-  [[nodiscard]] bool isAbsoluteDrivePath(const std::string_view& str) const;
+  [[nodiscard]] static bool isAbsoluteDrivePath(const std::string_view& str);
 };
 
 /**
@@ -271,7 +262,7 @@ struct DriveLetter {
  */
 struct UncHost {
   /**
-   * Invalid UNC hostname regex.
+   * Check if a given hostname is invalid.
    *
    * - Unicode domains are unsupported, so ensure ASCII.
    * - Ensure no %-encoding.
@@ -279,16 +270,11 @@ struct UncHost {
    *   > Otherwise we might create something which looks like a Win32 file
    *     namespace/local device path
    * - Reject drive letters as hostnames.
-   */
-  Regex invalidHostnameRegex{R"(^[.?]$|[^[:ascii:]]|%|^[A-Z]:$)"};
-
-  /**
-   * Check if a given hostname is invalid.
    *
    * @param host Hostname to check.
    * @return true if the hostname is invalid, false otherwise.
    */
-  [[nodiscard]] bool isInvalidHostname(const std::string_view& host) const;
+  [[nodiscard]] static bool isInvalidHostname(const std::string_view& host);
 };
 
 /**
@@ -301,17 +287,13 @@ struct UncHost {
  * one.
  */
 struct UncUnnormalisedDevicePath {
-  Regex upwardsTraversalRegex{R"((^|\\)\.\.(\\|$))"};
-  Regex trailingSlashesRegex{R"(\\(\\+)$)"};
-  Regex trailingSlashesInSegmentRegex{R"((\\\\+))"};
-
   /**
    * Validate a Windows UNC device path.
    *
    * @param windowsPath Path to validate.
    * @param uncDetails UNC features of path.
    */
-  void validatePath(const std::string_view& windowsPath, const UncDetails& uncDetails) const;
+  static void validatePath(const std::string_view& windowsPath, const UncDetails& uncDetails);
 
   /**
    * Trim trailing `\`s from a path.
@@ -322,7 +304,7 @@ struct UncUnnormalisedDevicePath {
    * @return Input path if there was nothing to trim, otherwise a
    * substring view of the path with extraneous `\`s removed.
    */
-  [[nodiscard]] std::string_view withoutTrailingSlashes(const std::string_view& path) const;
+  [[nodiscard]] static std::string_view withoutTrailingSlashes(const std::string_view& path);
 
   /**
    * Check if a path contains a `/` anywhere.
@@ -338,7 +320,7 @@ struct UncUnnormalisedDevicePath {
    * @param path Path to check.
    * @return true if a `..` segment was found, false otherwise.
    */
-  [[nodiscard]] bool containsUpwardsTraversal(const std::string_view& str) const;
+  [[nodiscard]] static bool containsUpwardsTraversal(const std::string_view& str);
 
   /**
    * Remove all trailing slashes in each path segment.
@@ -349,7 +331,54 @@ struct UncUnnormalisedDevicePath {
    * @return New string with any trailing slashes within segments
    * removed.
    */
-  [[nodiscard]] Str removeTrailingSlashesInPathSegments(const std::string_view& path) const;
+  [[nodiscard]] static Str removeTrailingSlashesInPathSegments(const std::string_view& path);
+};
+
+/**
+ * Classifier for the type of a Windows path, based on its prefix.
+ *
+ * Implemented as a deterministic finite-state machine that consumes
+ * each byte of the prefix at most once, stopping as soon as the type
+ * of path is unambiguous.
+ */
+struct PathClassifier {
+  /// Prefix of UNC device paths.
+  static constexpr std::string_view kDevicePrefix = R"(\\?\)";
+  /// Prefix of UNC device share paths.
+  static constexpr std::string_view kDeviceSharePrefix = R"(\\?\UNC\)";
+
+  /**
+   * Type of Windows path.
+   */
+  enum class Category {
+    /// Drive path, e.g. `C:\path`. Assumed if no other type matches.
+    kDrive,
+    /// UNC share path, e.g. `\\host\share\path` or `//host/share`.
+    kUncShare,
+    /// UNC device drive path, e.g. `\\?\C:\path`.
+    kUncDeviceDrive,
+    /// UNC device share path, e.g. `\\?\UNC\host\share\path`.
+    kUncDeviceShare
+  };
+
+  /**
+   * Result of classifying a path.
+   */
+  struct Classification {
+    /// Type of path.
+    Category category;
+    /// Length of the type-specific prefix, e.g. the leading run of
+    /// separators of a UNC share path. Zero for drive paths.
+    std::size_t prefixLength;
+  };
+
+  /**
+   * Classify a Windows path.
+   *
+   * @param path Path to classify.
+   * @return Type of path and length of its prefix.
+   */
+  [[nodiscard]] static Classification classify(const std::string_view& path);
 };
 
 }  // namespace utils::path::windows::detail
@@ -3,7 +3,7 @@
 #include "pathTypes.hpp"
 
 #include <cassert>
-#include <optional>
+#include <cstddef>
 #include <string_view>
 #include <tuple>
 
@@ -20,7 +20,7 @@ namespace utils::path::windows::pathTypes {
 // ---------------------------------------------------------------------
 // DrivePath
 
-void DrivePath::toUrl(const std::string_view& windowsPath, ada::url& url) const {
+void DrivePath::toUrl(const std::string_view& windowsPath, ada::url& url) {
   validatePath(windowsPath);
   // Must explicitly set empty host to get `file://` rather than
   // `file:`.
@@ -28,36 +28,36 @@ void DrivePath::toUrl(const std::string_view& windowsPath, ada::url& url) const
   setUrlPath(windowsPath, url);
 }
 
-void DrivePath::validatePath(const std::string_view& windowsPath) const {
+void DrivePath::validatePath(const std::string_view& windowsPath) {
   // Note: kludge to match error priority of swift-url. Otherwise
   // this would be handled by `isAbsoluteDrivePath`.
   if (detail::NormalisedPath::startsWithSlash(windowsPath)) {
     // Path starts with slash so is a relative path.
     throwError(kErrorRelativePath, windowsPath);
   }
-  if (normalisedPathHandler.containsUpwardsTraversal(windowsPath)) {
+  if (detail::NormalisedPath::containsUpwardsTraversal(windowsPath)) {
     // Path contains a `..` segment.
     throwError(kErrorUpwardsTraversal, windowsPath);
   }
-  if (!driveLetterHandler.isAbsoluteDrivePath(windowsPath)) {
+  if (!detail::DriveLetter::isAbsoluteDrivePath(windowsPath)) {
     // Path either isn't a drive path, or is a relative drive path
     // e.g. `C:` (without trailing slash).
     throwError(kErrorRelativePath, windowsPath);
   }
 }
 
-void DrivePath::setUrlPath(const std::string_view& windowsPath, ada::url& url) const {
+void DrivePath::setUrlPath(const std::string_view& windowsPath, ada::url& url) {
   // Precondition.
   // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
-  assert(driveLetterHandler.isAbsoluteDrivePath(windowsPath));
+  assert(detail::DriveLetter::isAbsoluteDrivePath(windowsPath));
 
-  const std::string_view trimmedPath = normalisedPathHandler.withoutTrailingDotsInFile(
-      normalisedPathHandler.withoutTrailingDotsAsFile(
-          normalisedPathHandler.withoutTrailingSpacesAndDots(
-              normalisedPathHandler.withoutTrailingSlashes(windowsPath))));
+  const std::string_view trimmedPath = detail::NormalisedPath::withoutTrailingDotsInFile(
+      detail::NormalisedPath::withoutTrailingDotsAsFile(
+          detail::NormalisedPath::withoutTrailingSpacesAndDots(
+              detail::NormalisedPath::withoutTrailingSlashes(windowsPath))));
 
-  const Str normalisedPath = normalisedPathHandler.removeTrailingDotsInPathSegments(
-      normalisedPathHandler.removeTrailingSlashesInPathSegments(trimmedPath));
+  Str normalisedPath;
+  detail::NormalisedPath::appendNormalisedPathSegments(trimmedPath, true, normalisedPath);
 
   const std::string_view normalisedPathView{normalisedPath};
   const std::string_view driveLetter = normalisedPathView.substr(0, kDriveLetterLength);
@@ -74,47 +74,48 @@ void DrivePath::setUrlPath(const std::string_view& windowsPath, ada::url& url) c
 // ---------------------------------------------------------------------
 // UncSharePath
 
-bool UncSharePath::toUrl(const std::string_view& windowsPath, ada::url& url) const {
-  const std::optional<detail::UncDetails> uncDetails = extractUncDetails(windowsPath);
-  if (!uncDetails) {
-    return false;
-  }
-  validatePath(windowsPath, *uncDetails);
-  if (!urlHandler.setUrlHost(uncDetails->hostOrDrive, url)) {
+void UncSharePath::toUrl(const std::string_view& windowsPath, const std::size_t prefixLength,
+                         ada::url& url) {
+  const detail::UncDetails uncDetails = extractUncDetails(windowsPath, prefixLength);
+  validatePath(windowsPath, uncDetails);
+  if (!detail::WindowsUrl::setUrlHost(uncDetails.hostOrDrive, url)) {
     throwError(kErrorInvalidHostname, windowsPath);
   }
-  setUrlPath(*uncDetails, url);
-  return true;
+  setUrlPath(uncDetails, url);
 }
 
-std::optional<detail::UncDetails> UncSharePath::extractUncDetails(
-    const std::string_view& path) const {
-  const auto pathParts = pathRegex.match(path);
-  if (!pathParts) {
-    return std::nullopt;
-  }
-  const std::string_view prefix = pathParts->group(path, 1);
-  const std::string_view hostOrDrive = pathParts->group(path, 2);
+detail::UncDetails UncSharePath::extractUncDetails(const std::string_view& path,
+                                                   const std::size_t prefixLength) {
+  // E.g. `\\host\share\path` - host is everything up to the next
+  // separator.
+  const std::string_view hostAndShare = path.substr(prefixLength);
+  const std::string_view hostOrDrive =
+      hostAndShare.substr(0, hostAndShare.find_first_of(kAnySlash));
   const auto [shareName, sharePath, shareNameAndPath] =
-      extractShareNameAndPath(pathParts->group(path, 3));
+      extractShareNameAndPath(hostAndShare.substr(hostOrDrive.size()));
   const std::string_view fullPath =
-      path.substr(prefix.size(), hostOrDrive.size() + shareNameAndPath.size());
+      hostAndShare.substr(0, hostOrDrive.size() + shareNameAndPath.size());
   return detail::UncDetails{hostOrDrive, shareName, sharePath, shareNameAndPath, fullPath};
 }
 
 std::tuple<std::string_view, std::string_view, std::string_view>
-UncSharePath::extractShareNameAndPath(std::string_view shareNameAndPath) const {
-  shareNameAndPath = normalisedPathHandler.withoutTrailingSlashes(shareNameAndPath);
-  const auto headAndTail = pathHeadAndTailRegex.match(shareNameAndPath);
-  if (!headAndTail) {
+UncSharePath::extractShareNameAndPath(std::string_view shareNameAndPath) {
+  shareNameAndPath = detail::NormalisedPath::withoutTrailingSlashes(shareNameAndPath);
+  // Share name is a run of separators followed by a (non-empty) name,
+  // and must be followed by a separator for there to be a share path.
+  const std::size_t nameStart = shareNameAndPath.find_first_not_of(kAnySlash);
+  const std::size_t nameEnd = nameStart == 0 || nameStart == std::string_view::npos
+                                  ? std::string_view::npos
+                                  : shareNameAndPath.find_first_of(kAnySlash, nameStart);
+  if (nameEnd == std::string_view::npos) {
     // Share name without path.
     return {shareNameAndPath, {}, shareNameAndPath};
   }
-  const std::string_view shareName = headAndTail->group(shareNameAndPath, 1);
-  const std::string_view sharePath = normalisedPathHandler.withoutTrailingDotsInFile(
-      normalisedPathHandler.withoutTrailingDotsAsFile(
-          normalisedPathHandler.withoutTrailingSpacesAndDots(
-              headAndTail->group(shareNameAndPath, 2))));
+  const std::string_view shareName = shareNameAndPath.substr(0, nameEnd);
+  const std::string_view sharePath = detail::NormalisedPath::withoutTrailingDotsInFile(
+      detail::NormalisedPath::withoutTrailingDotsAsFile(
+          detail::NormalisedPath::withoutTrailingSpacesAndDots(
+              shareNameAndPath.substr(nameEnd))));
   // In case shareNameAndPath is now shorter due to trimming trailing
   // dots/spaces.
   shareNameAndPath = shareNameAndPath.substr(0, shareName.size() + sharePath.size());
@@ -122,27 +123,30 @@ UncSharePath::extractShareNameAndPath(std::string_view shareNameAndPath) const {
 }
 
 void UncSharePath::validatePath(const std::string_view& windowsPath,
-                                const detail::UncDetails& uncDetails) const {
+                                const detail::UncDetails& uncDetails) {
   if (uncDetails.fullPath.empty()) {
     // Completely empty path after UNC prefix.
     throwError(kErrorInvalidPath, windowsPath);
   }
-  if (normalisedPathHandler.containsUpwardsTraversal(uncDetails.shareNameAndPath)) {
+  if (detail::NormalisedPath::containsUpwardsTraversal(uncDetails.shareNameAndPath)) {
     // Disallow `..`, except for hostnames.
     throwError(kErrorUpwardsTraversal, windowsPath);
   }
-  if (uncHostHandler.isInvalidHostname(uncDetails.hostOrDrive)) {
+  if (detail::UncHost::isInvalidHostname(uncDetails.hostOrDrive)) {
     // E.g. non-ASCII or other disallowed character in hostname.
     throwError(kErrorInvalidHostname, windowsPath);
   }
 }
 
-void UncSharePath::setUrlPath(const detail::UncDetails& uncDetails, ada::url& url) const {
+void UncSharePath::setUrlPath(const detail::UncDetails& uncDetails, ada::url& url) {
+  // Note: share name always ends in a non-separator, so separators
+  // are never collapsed across the share name/path boundary.
   Str normalisedPath;
   normalisedPath.reserve(uncDetails.shareNameAndPath.size());
-  normalisedPath += uncDetails.shareName;
-  normalisedPath += normalisedPathHandler.removeTrailingDotsInPathSegments(uncDetails.sharePath);
-  normalisedPath = normalisedPathHandler.removeTrailingSlashesInPathSegments(normalisedPath);
+  detail::NormalisedPath::appendNormalisedPathSegments(uncDetails.shareName, false,
+                                                       normalisedPath);
+  detail::NormalisedPath::appendNormalisedPathSegments(uncDetails.sharePath, true,
+                                                       normalisedPath);
 
   if (Str encodedPath;
       detail::WindowsUrl::maybePercentEncodeAndAppendTo(normalisedPath, encodedPath)) {
@@ -155,35 +159,33 @@ void UncSharePath::setUrlPath(const detail::UncDetails& uncDetails, ada::url& ur
 // ---------------------------------------------------------------------
 // UncUnnormalisedDeviceDrivePath
 
-bool UncUnnormalisedDeviceDrivePath::toUrl(const std::string_view& windowsPath,
-                                           ada::url& url) const {
-  const std::optional<detail::UncDetails> uncDetails = extractUncDetails(windowsPath);
-  if (!uncDetails) {
-    return false;
-  }
-  validatePath(windowsPath, *uncDetails);
+void UncUnnormalisedDeviceDrivePath::toUrl(const std::string_view& windowsPath,
+                                           ada::url& url) {
+  const detail::UncDetails uncDetails = extractUncDetails(windowsPath);
+  validatePath(windowsPath, uncDetails);
   url.set_host("");
-  setUrlPath(*uncDetails, url);
-  return true;
+  setUrlPath(uncDetails, url);
 }
 
-std::optional<detail::UncDetails> UncUnnormalisedDeviceDrivePath::extractUncDetails(
-    const std::string_view& path) const {
-  const auto pathParts = pathRegex.match(path);
-  if (!pathParts) {
-    return std::nullopt;
-  }
-  const std::string_view hostOrDrive = pathParts->group(path, 1);
+detail::UncDetails UncUnnormalisedDeviceDrivePath::extractUncDetails(
+    const std::string_view& path) {
+  // Precondition.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+  assert(path.substr(0, kPrefix.size()) == kPrefix);
+
+  const std::string_view driveAndPath = path.substr(kPrefix.size());
+  const std::string_view hostOrDrive = driveAndPath.substr(0, driveAndPath.find(kBackSlash));
   const std::string_view shareNameAndPath =
-      uncUnnormalisedDevicePathHandler.withoutTrailingSlashes(pathParts->group(path, 2));
+      detail::UncUnnormalisedDevicePath::withoutTrailingSlashes(
+          driveAndPath.substr(hostOrDrive.size()));
   const std::string_view fullPath =
       path.substr(kPrefix.size(), hostOrDrive.size() + shareNameAndPath.size());
   return detail::UncDetails{hostOrDrive, {}, {}, shareNameAndPath, fullPath};
 }
 
 void UncUnnormalisedDeviceDrivePath::validatePath(const std::string_view& windowsPath,
-                                                  const detail::UncDetails& uncDetails) const {
-  uncUnnormalisedDevicePathHandler.validatePath(windowsPath, uncDetails);
+                                                  const detail::UncDetails& uncDetails) {
+  detail::UncUnnormalisedDevicePath::validatePath(windowsPath, uncDetails);
 
   // UNC device drive path specific
 
@@ -195,25 +197,25 @@ void UncUnnormalisedDeviceDrivePath::validatePath(const std::string_view& window
     // Must be followed by an absolute path e.g. `\\?\C:\`.
     throwError(kErrorInvalidPath, windowsPath);
   }
-  if (!driveLetterHandler.isDrive(uncDetails.hostOrDrive)) {
+  if (!detail::DriveLetter::isDrive(uncDetails.hostOrDrive)) {
     // Must be followed by a drive e.g. `\\?\C:`.
     throwError(kErrorUnsupportedDevicePath, windowsPath);
   }
 }
 
 void UncUnnormalisedDeviceDrivePath::setUrlPath(const detail::UncDetails& uncDetails,
-                                                ada::url& url) const {
+                                                ada::url& url) {
+  using detail::UncUnnormalisedDevicePath;
   // `\\?\C:\path` - `C:` part should not be %-encoded.
   if (Str encodedPath{uncDetails.hostOrDrive}; detail::WindowsUrl::maybePercentEncodeAndAppendTo(
-          uncUnnormalisedDevicePathHandler.removeTrailingSlashesInPathSegments(
+          UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(
               uncDetails.shareNameAndPath),
           encodedPath)) {
     GenericUrl::setUrlPath(
-        uncUnnormalisedDevicePathHandler.removeTrailingSlashesInPathSegments(encodedPath), url);
+        UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(encodedPath), url);
   } else {
     GenericUrl::setUrlPath(
-        uncUnnormalisedDevicePathHandler.removeTrailingSlashesInPathSegments(uncDetails.fullPath),
-        url);
+        UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(uncDetails.fullPath), url);
   }
 }
 
@@ -228,61 +230,60 @@ Str UncUnnormalisedDeviceDrivePath::prefixDrivePath(const std::string_view drive
 // ---------------------------------------------------------------------
 // UncUnnormalisedDeviceSharePath
 
-bool UncUnnormalisedDeviceSharePath::toUrl(const std::string_view& windowsPath,
-                                           ada::url& url) const {
-  const std::optional<detail::UncDetails> uncDetails = extractUncDetails(windowsPath);
-  if (!uncDetails) {
-    return false;
-  }
-  validatePath(windowsPath, *uncDetails);
-  if (!urlHandler.setUrlHost(uncDetails->hostOrDrive, url)) {
+void UncUnnormalisedDeviceSharePath::toUrl(const std::string_view& windowsPath,
+                                           ada::url& url) {
+  const detail::UncDetails uncDetails = extractUncDetails(windowsPath);
+  validatePath(windowsPath, uncDetails);
+  if (!detail::WindowsUrl::setUrlHost(uncDetails.hostOrDrive, url)) {
     throwError(kErrorInvalidHostname, windowsPath);
   }
-  setUrlPath(*uncDetails, url);
-  return true;
+  setUrlPath(uncDetails, url);
 }
 
-std::optional<detail::UncDetails> UncUnnormalisedDeviceSharePath::extractUncDetails(
-    const std::string_view& path) const {
-  const auto pathParts = pathRegex.match(path);
-  if (!pathParts) {
-    return std::nullopt;
-  }
-  const std::string_view hostOrDrive = pathParts->group(path, 1);
+detail::UncDetails UncUnnormalisedDeviceSharePath::extractUncDetails(
+    const std::string_view& path) {
+  // Precondition.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+  assert(path.size() >= kPrefix.size());
+
+  const std::string_view hostAndShare = path.substr(kPrefix.size());
+  const std::string_view hostOrDrive = hostAndShare.substr(0, hostAndShare.find(kBackSlash));
   const auto [shareName, sharePath, shareNameAndPath] =
-      extractShareNameAndPath(pathParts->group(path, 2));
+      extractShareNameAndPath(hostAndShare.substr(hostOrDrive.size()));
   const std::string_view fullPath =
       path.substr(kPrefix.size(), hostOrDrive.size() + shareNameAndPath.size());
   return detail::UncDetails{hostOrDrive, shareName, sharePath, shareNameAndPath, fullPath};
 }
 
 std::tuple<std::string_view, std::string_view, std::string_view>
-UncUnnormalisedDeviceSharePath::extractShareNameAndPath(std::string_view shareNameAndPath) const {
-  shareNameAndPath = uncUnnormalisedDevicePathHandler.withoutTrailingSlashes(shareNameAndPath);
-  const auto headAndTail = pathHeadAndTailRegex.match(shareNameAndPath);
-  if (!headAndTail) {
+UncUnnormalisedDeviceSharePath::extractShareNameAndPath(std::string_view shareNameAndPath) {
+  shareNameAndPath = detail::UncUnnormalisedDevicePath::withoutTrailingSlashes(shareNameAndPath);
+  // Share name is a `\` followed by a (non-empty) name.
+  if (shareNameAndPath.size() < 2 || shareNameAndPath[0] != kBackSlash ||
+      shareNameAndPath[1] == kBackSlash) {
     return {shareNameAndPath, {}, shareNameAndPath};
   }
-  return {headAndTail->group(shareNameAndPath, 1), headAndTail->group(shareNameAndPath, 2),
-          shareNameAndPath};
+  const std::string_view shareName =
+      shareNameAndPath.substr(0, shareNameAndPath.find(kBackSlash, 1));
+  return {shareName, shareNameAndPath.substr(shareName.size()), shareNameAndPath};
 }
 
 void UncUnnormalisedDeviceSharePath::validatePath(const std::string_view& windowsPath,
-                                                  const detail::UncDetails& uncDetails) const {
-  uncUnnormalisedDevicePathHandler.validatePath(windowsPath, uncDetails);
+                                                  const detail::UncDetails& uncDetails) {
+  detail::UncUnnormalisedDevicePath::validatePath(windowsPath, uncDetails);
 
   if (uncDetails.hostOrDrive.empty()) {
     // E.g. `\\?\UNC\\path` - host segment is blank.
     throwError(kErrorInvalidHostname, windowsPath);
   }
-  if (uncHostHandler.isInvalidHostname(uncDetails.hostOrDrive)) {
+  if (detail::UncHost::isInvalidHostname(uncDetails.hostOrDrive)) {
     throwError(kErrorInvalidHostname, windowsPath);
   }
 }
 
 void UncUnnormalisedDeviceSharePath::setUrlPath(const detail::UncDetails& uncDetails,
-                                                ada::url& url) const {
-  const Str urlPath = uncUnnormalisedDevicePathHandler.removeTrailingSlashesInPathSegments(
+                                                ada::url& url) {
+  const Str urlPath = detail::UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(
       uncDetails.shareNameAndPath);
   if (Str encodedUrlPath;
       detail::WindowsUrl::maybePercentEncodeAndAppendTo(urlPath, encodedUrlPath)) {
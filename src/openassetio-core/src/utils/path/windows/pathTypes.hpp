@@ -1,7 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
 #pragma once
-#include <optional>
+#include <cstddef>
 #include <string_view>
 #include <tuple>
 
@@ -9,7 +9,6 @@
 
 #include <openassetio/export.h>
 
-#include "../../Regex.hpp"
 #include "./detail.hpp"
 
 namespace openassetio {
@@ -23,11 +22,6 @@ namespace utils::path::windows::pathTypes {
  * Utility for handling Windows drive paths e.g. `C:\path`.
  */
 struct DrivePath {
-  // NOLINTBEGIN(cppcoreguidelines-avoid-const-or-ref-data-members)
-  detail::DriveLetter& driveLetterHandler;
-  detail::NormalisedPath& normalisedPathHandler;
-  // NOLINTEND(cppcoreguidelines-avoid-const-or-ref-data-members)
-
   static constexpr std::size_t kDriveLetterLength = 2;
 
   /**
@@ -36,14 +30,14 @@ struct DrivePath {
    * @param windowsPath Windows path to convert to a URL.
    * @param url URL object to update.
    */
-  void toUrl(const std::string_view& windowsPath, ada::url& url) const;
+  static void toUrl(const std::string_view& windowsPath, ada::url& url);
 
   /**
    * Validate a Windows drive path.
    *
    * @param windowsPath Path to validate.
    */
-  void validatePath(const std::string_view& windowsPath) const;
+  static void validatePath(const std::string_view& windowsPath);
 
   /**
    * Set Windows path as path component of a file URL.
@@ -55,7 +49,7 @@ struct DrivePath {
    * @param windowsPath Path to set as URL path component.
    * @param url URL object to update.
    */
-  void setUrlPath(const std::string_view& windowsPath, ada::url& url) const;
+  static void setUrlPath(const std::string_view& windowsPath, ada::url& url);
 };
 
 /**
@@ -67,41 +61,28 @@ struct DrivePath {
  * as `\` is a path separator.
  */
 struct UncSharePath {
-  detail::UncHost& uncHostHandler;
-  detail::NormalisedPath& normalisedPathHandler;
-  detail::WindowsUrl& urlHandler;
-
-  Regex pathRegex{R"(^([\\/]{2,})([^\\/]*)(.*)$)"};
-  Regex pathHeadAndTailRegex{R"(^([\\/]+[^\\/]+)([\\/].*)$)"};
-
   /**
    * Validate and convert a Windows UNC share path to a file URL.
    *
-   * No-op if the path is not a Windows UNC share path.
-   *
-   * Note that this will parse any UNC path, including device paths
-   * `\\?\`, so these must be filtered out before calling this method.
+   * The path must have been classified as a UNC share path by
+   * detail::PathClassifier.
    *
    * @param windowsPath Windows path to convert to a URL.
+   * @param prefixLength Length of the leading run of separators.
    * @param url URL object to update.
-   * @return true if the path is a UNC share path, false otherwise.
    */
-  bool toUrl(const std::string_view& windowsPath, ada::url& url) const;
+  static void toUrl(const std::string_view& windowsPath, std::size_t prefixLength,
+                    ada::url& url);
 
   /**
-   * Check if the path is a UNC path, and if so return a structure
-   * containing useful features extracted from the path.
-   *
-   * Note that this will attempt to parse any UNC path, including `\\?\`
-   * device paths, so these must be filtered out before this method is
-   * called.
+   * Extract a structure containing useful features from a UNC path.
    *
    * @param path Path to parse.
-   * @return Empty optional if the path is not a UNC path, otherwise
-   * the results of parsing the path components.
+   * @param prefixLength Length of the leading run of separators.
+   * @return Results of parsing the path components.
    */
-  [[nodiscard]] std::optional<detail::UncDetails> extractUncDetails(
-      const std::string_view& path) const;
+  [[nodiscard]] static detail::UncDetails extractUncDetails(const std::string_view& path,
+                                                            std::size_t prefixLength);
 
   /**
    * Normalise and split the share name and path components from a UNC
@@ -113,8 +94,8 @@ struct UncSharePath {
    * @return Share name, path and joined name and path, after
    * normalisation.
    */
-  [[nodiscard]] std::tuple<std::string_view, std::string_view, std::string_view>
-  extractShareNameAndPath(std::string_view shareNameAndPath) const;
+  [[nodiscard]] static std::tuple<std::string_view, std::string_view, std::string_view>
+  extractShareNameAndPath(std::string_view shareNameAndPath);
 
   /**
    * Validate a Windows UNC share path.
@@ -122,8 +103,8 @@ struct UncSharePath {
    * @param windowsPath Path to validate.
    * @param uncDetails UNC features of path.
    */
-  void validatePath(const std::string_view& windowsPath,
-                    const detail::UncDetails& uncDetails) const;
+  static void validatePath(const std::string_view& windowsPath,
+                           const detail::UncDetails& uncDetails);
 
   /**
    * Set Windows UNC path as path component of a file URL.
@@ -135,7 +116,7 @@ struct UncSharePath {
    * @param windowsPath Path to set as URL path component.
    * @param url URL object to update.
    */
-  void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url) const;
+  static void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url);
 };
 
 /**
@@ -145,42 +126,31 @@ struct UncSharePath {
  * "UNC" device that is handled by UncUnnormalisedDeviceSharePath).
  */
 struct UncUnnormalisedDeviceDrivePath {
-  detail::DriveLetter& driveLetterHandler;
-  detail::UncUnnormalisedDevicePath& uncUnnormalisedDevicePathHandler;
-
-  static constexpr std::string_view kPrefix = R"(\\?\)";
-  Regex pathRegex{R"(^\\\\\?\\([^\\]*)(.*)$)"};
+  static constexpr std::string_view kPrefix = detail::PathClassifier::kDevicePrefix;
 
   /**
    * Validate and convert a Windows UNC device drive path to a file
    * URL.
    *
-   * Note that this will parse all device paths, i.e. paths prefixed
-   * with `\\?\`, including non-drive paths such as `\\?\UNC\`, so such
-   * paths should be filtered before calling this method.
-   *
-   * No-op if the path is not a Windows device path.
+   * The path must have been classified as a UNC device drive path by
+   * detail::PathClassifier.
    *
    * @param windowsPath Windows path to convert to a URL.
    * @param url URL object to update.
-   * @return true if the path is a Windows UNC device path, false
-   * otherwise.
    */
-  bool toUrl(const std::string_view& windowsPath, ada::url& url) const;
+  static void toUrl(const std::string_view& windowsPath, ada::url& url);
 
   /**
-   * Check if the path is a UNC device path, and if so return a
-   * structure containing useful features extracted from the path.
+   * Extract a structure containing useful features from a UNC device
+   * path.
    *
    * Assumes a device drive path, i.e. does not split out a share
    * name/path.
    *
-   * @param path Path to parse.
-   * @return Empty optional if the path is not a UNC device path,
-   * otherwise the results of parsing the path components.
+   * @param path Path to parse, prefixed with `\\?\`.
+   * @return Results of parsing the path components.
    */
-  [[nodiscard]] std::optional<detail::UncDetails> extractUncDetails(
-      const std::string_view& path) const;
+  [[nodiscard]] static detail::UncDetails extractUncDetails(const std::string_view& path);
 
   /**
    * Validate a Windows UNC device drive path.
@@ -188,8 +158,8 @@ struct UncUnnormalisedDeviceDrivePath {
    * @param windowsPath Path to validate.
    * @param uncDetails UNC features of path.
    */
-  void validatePath(const std::string_view& windowsPath,
-                    const detail::UncDetails& uncDetails) const;
+  static void validatePath(const std::string_view& windowsPath,
+                           const detail::UncDetails& uncDetails);
 
   /**
    * Set Windows UNC drive path as path component of a file URL.
@@ -201,7 +171,7 @@ struct UncUnnormalisedDeviceDrivePath {
    * @param windowsPath Path to set as URL path component.
    * @param url URL object to update.
    */
-  void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url) const;
+  static void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url);
 
   /**
    * Prefix a (normalised) drive path to make it an unnormalised device
@@ -222,37 +192,28 @@ struct UncUnnormalisedDeviceDrivePath {
  * Utility for handling Windows UNC device share paths, i.e. `\\?\UNC\`.
  */
 struct UncUnnormalisedDeviceSharePath {
-  detail::UncHost& uncHostHandler;
-  detail::UncUnnormalisedDevicePath& uncUnnormalisedDevicePathHandler;
-  detail::WindowsUrl& urlHandler;
-
-  static constexpr std::string_view kPrefix = R"(\\?\UNC\)";
-  Regex pathRegex{R"(^\\\\\?\\UNC\\([^\\]*)(.*)$)"};
-  Regex pathHeadAndTailRegex{R"(^(\\[^\\]+)(.*)$)"};
+  static constexpr std::string_view kPrefix = detail::PathClassifier::kDeviceSharePrefix;
 
   /**
    * Validate and convert a Windows UNC device share path to a file
    * URL.
    *
-   * No-op if the path is not a Windows device share path.
+   * The path must have been classified as a UNC device share path by
+   * detail::PathClassifier.
    *
    * @param windowsPath Windows path to convert to a URL.
    * @param url URL object to update.
-   * @return true if the path is a Windows UNC device share path, false
-   * otherwise.
    */
-  bool toUrl(const std::string_view& windowsPath, ada::url& url) const;
+  static void toUrl(const std::string_view& windowsPath, ada::url& url);
 
   /**
-   * Check if the path is a UNC device share path, and if so return a
-   * structure containing useful features extracted from the path.
+   * Extract a structure containing useful features from a UNC device
+   * share path.
    *
-   * @param path Path to parse.
-   * @return Empty optional if the path is not a UNC device share path,
-   * otherwise the results of parsing the path components.
+   * @param path Path to parse, prefixed with `\\?\UNC\`.
+   * @return Results of parsing the path components.
    */
-  [[nodiscard]] std::optional<detail::UncDetails> extractUncDetails(
-      const std::string_view& path) const;
+  [[nodiscard]] static detail::UncDetails extractUncDetails(const std::string_view& path);
 
   /**
    * Split the share name and path components from a UNC device share
@@ -266,8 +227,8 @@ struct UncUnnormalisedDeviceSharePath {
    * @return Share name, path and joined name and path, after
    * normalisation.
    */
-  [[nodiscard]] std::tuple<std::string_view, std::string_view, std::string_view>
-  extractShareNameAndPath(std::string_view shareNameAndPath) const;
+  [[nodiscard]] static std::tuple<std::string_view, std::string_view, std::string_view>
+  extractShareNameAndPath(std::string_view shareNameAndPath);
 
   /**
    * Validate a Windows UNC device share path.
@@ -275,8 +236,8 @@ struct UncUnnormalisedDeviceSharePath {
    * @param windowsPath Path to validate.
    * @param uncDetails UNC features of path.
    */
-  void validatePath(const std::string_view& windowsPath,
-                    const detail::UncDetails& uncDetails) const;
+  static void validatePath(const std::string_view& windowsPath,
+                           const detail::UncDetails& uncDetails);
 
   /**
    * Set Windows UNC device share path as path component of a file URL.
@@ -287,7 +248,7 @@ struct UncUnnormalisedDeviceSharePath {
    * @param uncDetails UNC features of path.
    * @param url URL object to update.
    */
-  void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url) const;
+  static void setUrlPath(const detail::UncDetails& uncDetails, ada::url& url);
 
   /**
    * Prefix a (normalised) share path to make it an unnormalised device
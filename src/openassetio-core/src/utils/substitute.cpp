@@ -1,8 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2023-2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <optional>
 #include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <fmt/args.h>
 #include <fmt/core.h>
@@ -17,6 +25,122 @@
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace utils {
+namespace {
+constexpr std::string_view kErrorInvalidFormatString = "invalid format string";
+constexpr std::string_view kErrorUnmatchedBrace = "unmatched '}' in format string";
+constexpr std::string_view kErrorMissingBrace = "missing '}' in format string";
+constexpr std::string_view kErrorUnsupportedPlaceholder =
+    "automatic, numeric and nested placeholders are not supported";
+constexpr std::string_view kErrorArgumentNotFound = "argument not found";
+
+// Placeholder names follow libfmt's rules for named arguments.
+constexpr bool isNameStart(const char chr) {
+  return (chr >= 'a' && chr <= 'z') || (chr >= 'A' && chr <= 'Z') || chr == '_';
+}
+
+constexpr bool isNameChar(const char chr) {
+  return isNameStart(chr) || (chr >= '0' && chr <= '9');
+}
+
+/**
+ * Append a value to a string, without a format specifier.
+ */
+void appendValue(const InfoDictionaryValue& value, Str& result) {
+  std::visit(
+      [&result](const auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<T, Str>) {
+          result += typedValue;
+        } else {
+          fmt::format_to(std::back_inserter(result), "{}", typedValue);
+        }
+      },
+      value);
+}
+
+/// Type that libfmt formats an InfoDictionaryValue alternative as.
+template <class T>
+struct FormatAs {
+  using type = T;
+};
+template <>
+struct FormatAs<Int> {
+  using type = long long;  // NOLINT(google-runtime-int)
+};
+template <>
+struct FormatAs<Str> {
+  using type = fmt::string_view;
+};
+
+/**
+ * libfmt formatter for a type, with a format specifier already parsed
+ * into it.
+ *
+ * The same specifier may be valid for some types of value but not
+ * others, e.g. `.2f`. So the error from parsing it is only reported if
+ * a value of this type is formatted.
+ */
+template <class T>
+struct SpecFormatter {
+  std::optional<fmt::formatter<T>> formatter;
+  Str parseError;
+};
+
+/**
+ * Parse a format specifier, i.e. the text following the `:` of a
+ * placeholder, up to and including the closing `}`.
+ */
+template <class T>
+SpecFormatter<T> parseSpec(const std::string_view spec) {
+  SpecFormatter<T> specFormatter;
+  try {
+    fmt::format_parse_context parseContext{spec};
+    fmt::formatter<T> formatter;
+    const auto* const specEnd = formatter.parse(parseContext);
+    // As per fmt::vformat.
+    if (specEnd == spec.data() + spec.size() || *specEnd != '}') {
+      throw fmt::format_error{"unknown format specifier"};
+    }
+    specFormatter.formatter = formatter;
+  } catch (const fmt::format_error& exc) {
+    specFormatter.parseError = exc.what();
+  }
+  return specFormatter;
+}
+}  // namespace
+
+struct CompiledTemplate::SpecFormatters {
+  explicit SpecFormatters(const std::string_view spec)
+      : formatters{parseSpec<FormatAs<Bool>::type>(spec), parseSpec<FormatAs<Int>::type>(spec),
+                   parseSpec<FormatAs<Float>::type>(spec), parseSpec<FormatAs<Str>::type>(spec)} {}
+
+  /**
+   * Append a value to a string, using the pre-parsed formatter for its
+   * type.
+   *
+   * @param buffer Scratch buffer to format into, since libfmt
+   * formatters cannot write to a `std::string` directly.
+   */
+  void append(const InfoDictionaryValue& value, fmt::memory_buffer& buffer, Str& result) const {
+    std::visit(
+        [this, &buffer, &result](const auto& typedValue) {
+          using T = typename FormatAs<std::decay_t<decltype(typedValue)>>::type;
+          const auto& specFormatter = std::get<SpecFormatter<T>>(formatters);
+          if (!specFormatter.formatter) {
+            throw fmt::format_error{specFormatter.parseError};
+          }
+          buffer.clear();
+          fmt::format_context formatContext{fmt::appender{buffer}, {}};
+          specFormatter.formatter->format(static_cast<T>(typedValue), formatContext);
+          result.append(buffer.data(), buffer.size());
+        },
+        value);
+  }
+
+  std::tuple<SpecFormatter<FormatAs<Bool>::type>, SpecFormatter<FormatAs<Int>::type>,
+             SpecFormatter<FormatAs<Float>::type>, SpecFormatter<FormatAs<Str>::type>>
+      formatters;
+};
 
 Str substitute(const std::string_view input, const InfoDictionary& substitutions) {
   fmt::dynamic_format_arg_store<fmt::format_context> args;
@@ -47,6 +171,163 @@ Str substitute(const std::string_view input, const InfoDictionary& substitutions
   }
 }
 
+// ---------------------------------------------------------------------
+// CompiledTemplate
+
+CompiledTemplate::CompiledTemplate(const std::string_view input) : input_{input} {
+  std::size_t pos = 0;
+  while (pos < input.size()) {
+    const std::size_t bracePos = input.find_first_of("{}", pos);
+    literals_ += input.substr(pos, bracePos - pos);
+    if (bracePos == std::string_view::npos) {
+      break;
+    }
+    pos = bracePos + 1;
+
+    // Escaped brace, i.e. `{{` or `}}`.
+    if (pos < input.size() && input[pos] == input[bracePos]) {
+      literals_ += input[bracePos];
+      ++pos;
+      continue;
+    }
+    if (input[bracePos] == '}') {
+      throwSubstitutionError(kErrorUnmatchedBrace);
+    }
+
+    // Placeholder, i.e. `{name}` or `{name:spec}`.
+    if (pos == input.size()) {
+      throwSubstitutionError(kErrorInvalidFormatString);
+    }
+    if (!isNameStart(input[pos])) {
+      const bool isAutomaticOrNumeric =
+          input[pos] == '}' || input[pos] == ':' || (input[pos] >= '0' && input[pos] <= '9');
+      throwSubstitutionError(isAutomaticOrNumeric ? kErrorUnsupportedPlaceholder
+                                                  : kErrorInvalidFormatString);
+    }
+    const std::size_t nameStart = pos;
+    while (pos < input.size() && isNameChar(input[pos])) {
+      ++pos;
+    }
+    const std::string_view name = input.substr(nameStart, pos - nameStart);
+
+    std::shared_ptr<const SpecFormatters> specFormatters;
+    if (pos < input.size() && input[pos] == ':') {
+      const std::size_t specEnd = input.find_first_of("{}", pos + 1);
+      if (specEnd == std::string_view::npos) {
+        throwSubstitutionError(kErrorMissingBrace);
+      }
+      if (input[specEnd] == '{') {
+        throwSubstitutionError(kErrorUnsupportedPlaceholder);
+      }
+      // Empty specifier is equivalent to no specifier.
+      if (specEnd > pos + 1) {
+        specFormatters =
+            std::make_shared<const SpecFormatters>(input.substr(pos + 1, specEnd - pos));
+      }
+      pos = specEnd;
+    }
+    if (pos == input.size() || input[pos] != '}') {
+      throwSubstitutionError(kErrorMissingBrace);
+    }
+    ++pos;
+
+    const auto existingSlot = std::find(placeholders_.begin(), placeholders_.end(), name);
+    const auto slot = static_cast<std::size_t>(existingSlot - placeholders_.begin());
+    if (existingSlot == placeholders_.end()) {
+      placeholders_.emplace_back(name);
+    }
+    fields_.push_back({literals_.size(), slot, std::move(specFormatters)});
+  }
+}
+
+const Str& CompiledTemplate::input() const { return input_; }
+
+const std::vector<Str>& CompiledTemplate::placeholders() const { return placeholders_; }
+
+Str CompiledTemplate::substitute(const InfoDictionary& substitutions) const {
+  Str result;
+  substitute(substitutions, result);
+  return result;
+}
+
+void CompiledTemplate::substitute(const InfoDictionary& substitutions, Str& result) const {
+  render(
+      [this, &substitutions](const std::size_t slot) -> const InfoDictionaryValue& {
+        const auto iter = substitutions.find(placeholders_[slot]);
+        if (iter == substitutions.end()) {
+          throwSubstitutionError(kErrorArgumentNotFound);
+        }
+        return iter->second;
+      },
+      result);
+}
+
+Str CompiledTemplate::substitute(const std::vector<InfoDictionaryValue>& values) const {
+  Str result;
+  substitute(values, result);
+  return result;
+}
+
+void CompiledTemplate::substitute(const std::vector<InfoDictionaryValue>& values,
+                                  Str& result) const {
+  if (values.size() != placeholders_.size()) {
+    throwSubstitutionError(fmt::format("expected {} positional values, got {}",
+                                       placeholders_.size(), values.size()));
+  }
+  render([&values](const std::size_t slot) -> const InfoDictionaryValue& { return values[slot]; },
+         result);
+}
+
+std::vector<Str> CompiledTemplate::substitute(
+    const std::vector<InfoDictionary>& substitutionsBatch) const {
+  std::vector<Str> results;
+  substitute(substitutionsBatch, results);
+  return results;
+}
+
+void CompiledTemplate::substitute(const std::vector<InfoDictionary>& substitutionsBatch,
+                                  std::vector<Str>& results) const {
+  results.resize(substitutionsBatch.size());
+  for (std::size_t idx = 0; idx < substitutionsBatch.size(); ++idx) {
+    try {
+      substitute(substitutionsBatch[idx], results[idx]);
+    } catch (const errors::InputValidationException& exc) {
+      throw errors::InputValidationException{
+          fmt::format("{} (substitutions at index {})", exc.what(), idx)};
+    }
+  }
+}
+
+template <class ValueForSlot>
+void CompiledTemplate::render(const ValueForSlot& valueForSlot, Str& result) const {
+  result.clear();
+  // Estimate assuming short values, to avoid most reallocations.
+  constexpr std::size_t kEstimatedValueSize = 8;
+  result.reserve(literals_.size() + fields_.size() * kEstimatedValueSize);
+
+  std::size_t literalStart = 0;
+  fmt::memory_buffer buffer;
+  try {
+    for (const Field& field : fields_) {
+      result.append(literals_, literalStart, field.literalEnd - literalStart);
+      literalStart = field.literalEnd;
+      if (field.specFormatters) {
+        field.specFormatters->append(valueForSlot(field.slot), buffer, result);
+      } else {
+        appendValue(valueForSlot(field.slot), result);
+      }
+    }
+  } catch (const fmt::format_error& exc) {
+    throwSubstitutionError(exc.what());
+  }
+  result.append(literals_, literalStart);
+}
+
+void CompiledTemplate::throwSubstitutionError(const std::string_view message) const {
+  throw errors::InputValidationException{fmt::format(
+      "substitute(): failed to process the input string '{}': {}", input_, message)};
+}
+
 }  // namespace utils
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
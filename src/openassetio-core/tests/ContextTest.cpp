@@ -1,9 +1,11 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
+#include <chrono>
 #include <type_traits>
 
 #include <catch2/catch.hpp>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/typedefs.hpp>
 
@@ -22,5 +24,86 @@ SCENARIO("Default construction") {
     const Context::Ptr context = Context::make();
 
     THEN("the locale is not null") { CHECK(context->locale); }
+
+    THEN("there is no deadline or cancellation token, so it never expires") {
+      CHECK_FALSE(context->deadline);
+      CHECK_FALSE(context->cancellationToken);
+      CHECK_FALSE(context->remainingTime());
+      CHECK_FALSE(context->isExpired());
+    }
+  }
+}
+
+SCENARIO("Context deadline") {
+  GIVEN("a Context") {
+    const Context::Ptr context = Context::make();
+
+    WHEN("a timeout in the future is set") {
+      const auto timeout = std::chrono::minutes{1};
+      const auto before = Context::Clock::now();
+      context->setTimeout(timeout);
+
+      THEN("deadline is relative to now") {
+        REQUIRE(context->deadline);
+        CHECK(*context->deadline >= before + timeout);
+        CHECK(*context->deadline <= Context::Clock::now() + timeout);
+      }
+
+      THEN("remaining time is positive and at most the timeout") {
+        const auto remaining = context->remainingTime();
+        REQUIRE(remaining);
+        CHECK(*remaining > Context::Clock::duration::zero());
+        CHECK(*remaining <= timeout);
+      }
+
+      THEN("context has not expired") { CHECK_FALSE(context->isExpired()); }
+    }
+
+    WHEN("the maximum timeout is set") {
+      context->setTimeout(Context::Clock::duration::max());
+
+      THEN("deadline saturates rather than overflowing") {
+        CHECK(context->deadline == Context::Clock::time_point::max());
+        CHECK(*context->remainingTime() > Context::Clock::duration::zero());
+        CHECK_FALSE(context->isExpired());
+      }
+    }
+
+    WHEN("a negative timeout is set") {
+      context->setTimeout(Context::Clock::duration::min());
+
+      THEN("context has expired") {
+        CHECK(context->remainingTime() == Context::Clock::duration::zero());
+        CHECK(context->isExpired());
+      }
+    }
+
+    WHEN("deadline is in the past") {
+      context->deadline = Context::Clock::now() - std::chrono::seconds{1};
+
+      THEN("remaining time is zero") {
+        CHECK(context->remainingTime() == Context::Clock::duration::zero());
+      }
+
+      THEN("context has expired") { CHECK(context->isExpired()); }
+    }
+  }
+}
+
+SCENARIO("Context cancellation") {
+  GIVEN("a Context with a cancellation token") {
+    const Context::Ptr context = Context::make();
+    context->cancellationToken = openassetio::CancellationToken::make();
+
+    THEN("context has not expired") { CHECK_FALSE(context->isExpired()); }
+
+    WHEN("token is cancelled") {
+      context->cancellationToken->cancel();
+
+      THEN("context has expired") {
+        CHECK(context->cancellationToken->isCancelled());
+        CHECK(context->isExpired());
+      }
+    }
   }
 }
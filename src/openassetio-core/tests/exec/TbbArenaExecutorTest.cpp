@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <tbb/task_arena.h>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/exec/TbbArenaExecutor.hpp>
+
+using openassetio::exec::TbbArenaExecutor;
+
+SCENARIO("TbbArenaExecutor concurrency") {
+  GIVEN("a TBB arena with a given concurrency") {
+    tbb::task_arena arena{3};
+
+    WHEN("an executor is constructed for the arena") {
+      const auto executor = TbbArenaExecutor::make(arena);
+
+      THEN("concurrency is that of the arena") { CHECK(executor->concurrency() == 3); }
+    }
+  }
+}
+
+SCENARIO("TbbArenaExecutor runs submitted tasks") {
+  GIVEN("a TbbArenaExecutor") {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::size_t numRun = 0;
+    std::atomic_int arenaConcurrency{0};
+
+    tbb::task_arena arena{2};
+    const auto executor = TbbArenaExecutor::make(arena);
+
+    WHEN("tasks are submitted, some of which throw") {
+      constexpr std::size_t kNumTasks = 100;
+      for (std::size_t idx = 0; idx < kNumTasks; ++idx) {
+        executor->submit([&, idx] {
+          arenaConcurrency = tbb::this_task_arena::max_concurrency();
+          {
+            const std::lock_guard lock{mutex};
+            ++numRun;
+            condition.notify_all();
+          }
+          if (idx % 2 == 0) {
+            throw std::runtime_error{"Task failed"};
+          }
+        });
+      }
+
+      THEN("all tasks run within the arena") {
+        std::unique_lock lock{mutex};
+        condition.wait_for(lock, std::chrono::seconds{10}, [&] { return numRun == kNumTasks; });
+        CHECK(numRun == kNumTasks);
+        CHECK(arenaConcurrency == 2);
+      }
+    }
+  }
+}
+
+SCENARIO("TbbArenaExecutor parallelFor") {
+  GIVEN("a TbbArenaExecutor") {
+    tbb::task_arena arena{4};
+    const auto executor = TbbArenaExecutor::make(arena);
+
+    WHEN("parallelFor is called") {
+      constexpr std::size_t kCount = 10000;
+      std::vector<std::atomic<std::size_t>> visits(kCount);
+      std::atomic_int arenaConcurrency{0};
+      executor->parallelFor(kCount, [&](const std::size_t idx) {
+        ++visits[idx];
+        arenaConcurrency = tbb::this_task_arena::max_concurrency();
+      });
+
+      THEN("each index is visited exactly once") {
+        CHECK(std::all_of(visits.begin(), visits.end(),
+                          [](const std::atomic<std::size_t>& count) { return count == 1; }));
+      }
+
+      AND_THEN("iterations run within the arena") { CHECK(arenaConcurrency == 4); }
+    }
+
+    WHEN("parallelFor is called with a count of zero") {
+      std::atomic<std::size_t> numCalls{0};
+      executor->parallelFor(0, [&]([[maybe_unused]] const std::size_t idx) { ++numCalls; });
+
+      THEN("the body is not called") { CHECK(numCalls == 0); }
+    }
+
+    WHEN("the body throws") {
+      THEN("the exception is rethrown to the caller") {
+        CHECK_THROWS_AS(executor->parallelFor(100,
+                                              [](const std::size_t idx) {
+                                                if (idx == 50) {
+                                                  throw std::runtime_error{"Body failed"};
+                                                }
+                                              }),
+                        std::runtime_error);
+      }
+    }
+  }
+}
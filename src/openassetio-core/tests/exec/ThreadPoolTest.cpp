@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/exec/ThreadPool.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+using openassetio::exec::ThreadPool;
+
+namespace {
+using Severity = openassetio::log::LoggerInterface::Severity;
+
+/// Logger that records messages, which may be logged from any thread.
+struct RecordingLogger final : openassetio::log::LoggerInterface {
+  void log(const Severity severity, const openassetio::Str& message) override {
+    const std::lock_guard lock{mutex};
+    messages.emplace_back(severity, message);
+  }
+
+  std::mutex mutex;
+  std::vector<std::pair<Severity, openassetio::Str>> messages;
+};
+}  // namespace
+
+SCENARIO("ThreadPool construction") {
+  WHEN("a number of threads is given") {
+    const auto pool = ThreadPool::make(3);
+
+    THEN("concurrency is the number of threads") { CHECK(pool->concurrency() == 3); }
+  }
+
+  WHEN("the number of threads is zero") {
+    const auto pool = ThreadPool::make(0);
+
+    THEN("concurrency is the number of hardware threads") {
+      CHECK(pool->concurrency() == std::max(std::thread::hardware_concurrency(), 1U));
+    }
+  }
+
+  WHEN("the default pool is retrieved multiple times") {
+    THEN("the same pool is returned") {
+      CHECK(ThreadPool::defaultPool() != nullptr);
+      CHECK(ThreadPool::defaultPool() == ThreadPool::defaultPool());
+    }
+  }
+}
+
+SCENARIO("ThreadPool runs submitted tasks") {
+  GIVEN("a ThreadPool with a logger") {
+    const auto logger = std::make_shared<RecordingLogger>();
+    auto pool = ThreadPool::make(4, logger);
+
+    WHEN("tasks are submitted, some of which throw, and the pool is destroyed") {
+      constexpr std::size_t kNumTasks = 1000;
+      std::atomic<std::size_t> numRun{0};
+      for (std::size_t idx = 0; idx < kNumTasks; ++idx) {
+        pool->submit([&numRun, idx] {
+          ++numRun;
+          if (idx % 2 == 0) {
+            throw std::runtime_error{"Task failed"};
+          }
+        });
+      }
+      pool.reset();
+
+      THEN("all tasks have run") { CHECK(numRun == kNumTasks); }
+
+      AND_THEN("each exception has been logged as an error") {
+        REQUIRE(logger->messages.size() == kNumTasks / 2);
+        for (const auto& [severity, message] : logger->messages) {
+          CHECK(severity == Severity::kError);
+          CHECK(message == "Uncaught exception in ThreadPool task: Task failed");
+        }
+      }
+    }
+
+    WHEN("a task throws a non-exception object and the pool is destroyed") {
+      pool->submit([] { throw 1; });  // NOLINT(hicpp-exception-baseclass)
+      pool.reset();
+
+      THEN("the failure has been logged as an error") {
+        REQUIRE(logger->messages.size() == 1);
+        CHECK(logger->messages[0].first == Severity::kError);
+        CHECK(logger->messages[0].second ==
+              "Uncaught exception in ThreadPool task: Unknown non-exception object thrown");
+      }
+    }
+  }
+
+  GIVEN("a ThreadPool without a logger") {
+    auto pool = ThreadPool::make(2);
+
+    WHEN("a task throws and the pool is destroyed") {
+      std::atomic_bool isRun{false};
+      pool->submit([&isRun] {
+        isRun = true;
+        throw std::runtime_error{"Task failed"};
+      });
+      pool.reset();
+
+      THEN("the exception is discarded") { CHECK(isRun); }
+    }
+  }
+
+  GIVEN("a ThreadPool with two threads") {
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool isNestedRun = false;
+    std::atomic_bool wasNestedRunByOtherThread{false};
+    // Declared last, so tasks are complete before the above are
+    // destroyed.
+    const auto pool = ThreadPool::make(2);
+
+    WHEN("a task submits a nested task then waits for it to run") {
+      pool->submit([&] {
+        const std::thread::id parentThreadId = std::this_thread::get_id();
+        pool->submit([&, parentThreadId] {
+          const std::lock_guard lock{mutex};
+          isNestedRun = true;
+          wasNestedRunByOtherThread = std::this_thread::get_id() != parentThreadId;
+          condition.notify_all();
+        });
+        std::unique_lock lock{mutex};
+        condition.wait_for(lock, std::chrono::seconds{10}, [&] { return isNestedRun; });
+      });
+
+      THEN("the nested task is stolen by the other thread") {
+        std::unique_lock lock{mutex};
+        condition.wait_for(lock, std::chrono::seconds{10}, [&] { return isNestedRun; });
+        CHECK(isNestedRun);
+        CHECK(wasNestedRunByOtherThread);
+      }
+    }
+  }
+}
+
+SCENARIO("ThreadPool parallelFor") {
+  GIVEN("a ThreadPool") {
+    const auto pool = ThreadPool::make(4);
+
+    WHEN("parallelFor is called") {
+      constexpr std::size_t kCount = 10000;
+      std::vector<std::atomic<std::size_t>> visits(kCount);
+      pool->parallelFor(kCount, [&](const std::size_t idx) { ++visits[idx]; });
+
+      THEN("each index is visited exactly once") {
+        CHECK(std::all_of(visits.begin(), visits.end(),
+                          [](const std::atomic<std::size_t>& count) { return count == 1; }));
+      }
+    }
+
+    WHEN("parallelFor is called with a count of zero") {
+      std::atomic<std::size_t> numCalls{0};
+      pool->parallelFor(0, [&]([[maybe_unused]] const std::size_t idx) { ++numCalls; });
+
+      THEN("the body is not called") { CHECK(numCalls == 0); }
+    }
+
+    WHEN("parallelFor is nested within parallelFor") {
+      constexpr std::size_t kOuterCount = 100;
+      constexpr std::size_t kInnerCount = 100;
+      std::atomic<std::size_t> numCalls{0};
+      pool->parallelFor(kOuterCount, [&]([[maybe_unused]] const std::size_t outerIdx) {
+        pool->parallelFor(kInnerCount,
+                          [&]([[maybe_unused]] const std::size_t innerIdx) { ++numCalls; });
+      });
+
+      THEN("all iterations complete without deadlock") {
+        CHECK(numCalls == kOuterCount * kInnerCount);
+      }
+    }
+
+    WHEN("the body throws") {
+      THEN("the exception is rethrown to the caller") {
+        CHECK_THROWS_AS(pool->parallelFor(100,
+                                          [](const std::size_t idx) {
+                                            if (idx == 50) {
+                                              throw std::runtime_error{"Body failed"};
+                                            }
+                                          }),
+                        std::runtime_error);
+      }
+    }
+  }
+}
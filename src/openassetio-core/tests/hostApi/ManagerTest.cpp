@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
+#include <chrono>
 #include <cstddef>
 #include <memory>
 #include <type_traits>
@@ -12,6 +13,7 @@
 #include <catch2/trompeloeil.hpp>
 #include <trompeloeil.hpp>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/access.hpp>
@@ -835,3 +837,133 @@ SCENARIO("Registering entities") {
     }
   }
 }
+
+SCENARIO("Batch calls respect the context deadline and cancellation token") {
+  using trompeloeil::_;
+  using openassetio::errors::BatchElementError;
+  using openassetio::trait::TraitsDataPtr;
+
+  GIVEN("a configured Manager instance and a batch of entity references") {
+    const openassetio::ManagerFixture fixture;
+    const auto& manager = fixture.manager;
+    auto& mockManagerInterface = fixture.mockManagerInterface;
+    const auto& context = fixture.context;
+    constexpr auto kResolveAccess = openassetio::access::ResolveAccess::kRead;
+
+    const openassetio::EntityReferences refs = {openassetio::EntityReference{"testReference1"},
+                                                openassetio::EntityReference{"testReference2"},
+                                                openassetio::EntityReference{"testReference3"}};
+    const openassetio::trait::TraitSet traits{"fakeTrait"};
+    const TraitsDataPtr expected = openassetio::trait::TraitsData::make();
+
+    std::vector<std::size_t> successIndices;
+    std::vector<std::size_t> errorIndices;
+    std::vector<BatchElementError> errors;
+    const auto recordError = [&](const std::size_t idx, BatchElementError error) {
+      errorIndices.push_back(idx);
+      errors.push_back(std::move(error));
+    };
+
+    AND_GIVEN("the context deadline has already passed") {
+      context->deadline = openassetio::Context::Clock::now() - std::chrono::seconds{1};
+
+      FORBID_CALL(mockManagerInterface, resolve(_, _, _, _, _, _, _));
+
+      WHEN("resolve is called") {
+        manager->resolve(
+            refs, traits, kResolveAccess, context,
+            [&](const std::size_t idx, [[maybe_unused]] const TraitsDataPtr& traitsData) {
+              successIndices.push_back(idx);
+            },
+            recordError);
+
+        THEN("the manager is not called and every element is reported as timed out") {
+          CHECK(successIndices.empty());
+          CHECK(errorIndices == std::vector<std::size_t>{0, 1, 2});
+          for (const BatchElementError& error : errors) {
+            CHECK(error == BatchElementError{BatchElementError::ErrorCode::kTimeout,
+                                             "Deadline exceeded before completion"});
+          }
+        }
+      }
+    }
+
+    AND_GIVEN("the context deadline passes whilst the manager is processing the batch") {
+      context->setTimeout(std::chrono::minutes{1});
+
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, kResolveAccess, _, _, _, _))
+          .LR_SIDE_EFFECT(_6(1, expected))
+          .LR_SIDE_EFFECT(context->deadline =
+                              openassetio::Context::Clock::now() - std::chrono::seconds{1});
+
+      WHEN("resolve is called") {
+        manager->resolve(
+            refs, traits, kResolveAccess, context,
+            [&](const std::size_t idx, [[maybe_unused]] const TraitsDataPtr& traitsData) {
+              successIndices.push_back(idx);
+            },
+            recordError);
+
+        THEN("completed elements are reported and the remainder are timed out") {
+          CHECK(successIndices == std::vector<std::size_t>{1});
+          CHECK(errorIndices == std::vector<std::size_t>{0, 2});
+          for (const BatchElementError& error : errors) {
+            CHECK(error == BatchElementError{BatchElementError::ErrorCode::kTimeout,
+                                             "Deadline exceeded before completion"});
+          }
+        }
+      }
+    }
+
+    AND_GIVEN("the context has a deadline that does not pass") {
+      context->setTimeout(std::chrono::minutes{1});
+
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, kResolveAccess, _, _, _, _))
+          .LR_SIDE_EFFECT(_6(0, expected))
+          .LR_SIDE_EFFECT(_6(1, expected));
+
+      WHEN("resolve is called") {
+        manager->resolve(
+            refs, traits, kResolveAccess, context,
+            [&](const std::size_t idx, [[maybe_unused]] const TraitsDataPtr& traitsData) {
+              successIndices.push_back(idx);
+            },
+            recordError);
+
+        THEN("unreported elements are left for the manager to report") {
+          CHECK(successIndices == std::vector<std::size_t>{0, 1});
+          CHECK(errorIndices.empty());
+        }
+      }
+    }
+
+    AND_GIVEN("the context has a cancellation token") {
+      context->cancellationToken = openassetio::CancellationToken::make();
+
+      REQUIRE_CALL(mockManagerInterface, resolve(refs, _, kResolveAccess, _, _, _, _))
+          .LR_SIDE_EFFECT(_6(0, expected))
+          .LR_SIDE_EFFECT(_6(1, expected))
+          .LR_SIDE_EFFECT(_7(2, BatchElementError{
+                                    BatchElementError::ErrorCode::kEntityResolutionError, ""}));
+
+      WHEN("resolve is called and the host cancels from within the first callback") {
+        manager->resolve(
+            refs, traits, kResolveAccess, context,
+            [&](const std::size_t idx, [[maybe_unused]] const TraitsDataPtr& traitsData) {
+              successIndices.push_back(idx);
+              context->cancellationToken->cancel();
+            },
+            recordError);
+
+        THEN("further results are discarded and reported as cancelled instead") {
+          CHECK(successIndices == std::vector<std::size_t>{0});
+          CHECK(errorIndices == std::vector<std::size_t>{1, 2});
+          for (const BatchElementError& error : errors) {
+            CHECK(error == BatchElementError{BatchElementError::ErrorCode::kTimeout,
+                                             "Cancelled before completion"});
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,244 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/AsyncLogger.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+using log::AsyncLogger;
+using Severity = log::LoggerInterface::Severity;
+using Message = std::pair<Severity, Str>;
+
+/**
+ * Logger that records messages, optionally holding the caller (i.e.
+ * the AsyncLogger worker thread) until released.
+ */
+struct RecordingLogger final : log::LoggerInterface {
+  void log(const Severity severity, const Str& message) override {
+    std::unique_lock lock{mutex};
+    messages.emplace_back(severity, message);
+    ++numEntered;
+    condition.notify_all();
+    condition.wait(lock, [&] { return !isGated; });
+  }
+
+  /// Prevent log calls from returning until `release` is called.
+  void gate() {
+    const std::lock_guard lock{mutex};
+    isGated = true;
+  }
+
+  void release() {
+    const std::lock_guard lock{mutex};
+    isGated = false;
+    condition.notify_all();
+  }
+
+  void waitForEntered(const std::size_t count) {
+    std::unique_lock lock{mutex};
+    condition.wait(lock, [&] { return numEntered >= count; });
+  }
+
+  std::vector<Message> recorded() {
+    const std::lock_guard lock{mutex};
+    return messages;
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool isGated{false};
+  std::size_t numEntered{0};
+  std::vector<Message> messages;
+};
+
+/**
+ * Gate the upstream logger, then fill a two-slot buffer such that the
+ * worker is held delivering "first" with "a" and "b" queued.
+ */
+void fillBuffer(AsyncLogger& logger, RecordingLogger& upstream) {
+  upstream.gate();
+  logger.log(Severity::kInfo, "first");
+  upstream.waitForEntered(1);
+  logger.log(Severity::kInfo, "a");
+  logger.log(Severity::kInfo, "b");
+}
+}  // namespace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+using openassetio::Message;
+using openassetio::RecordingLogger;
+using openassetio::Severity;
+using openassetio::log::AsyncLogger;
+
+SCENARIO("AsyncLogger construction") {
+  const auto upstream = std::make_shared<RecordingLogger>();
+
+  WHEN("capacity is not a power of two") {
+    const auto logger = AsyncLogger::make(upstream, 5);
+
+    THEN("capacity is rounded up to the next power of two") { CHECK(logger->capacity() == 8); }
+  }
+
+  WHEN("capacity is zero") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(AsyncLogger::make(upstream, 0),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+
+  WHEN("sample interval is zero") {
+    THEN("an exception is thrown") {
+      CHECK_THROWS_AS(AsyncLogger::make(upstream, 2, AsyncLogger::OverflowPolicy::kSample, 0),
+                      openassetio::errors::InputValidationException);
+    }
+  }
+}
+
+SCENARIO("AsyncLogger delivers messages to upstream logger") {
+  GIVEN("an AsyncLogger wrapping a recording logger") {
+    const auto upstream = std::make_shared<RecordingLogger>();
+    auto logger = AsyncLogger::make(upstream);
+
+    WHEN("messages are logged from multiple threads and the logger is flushed") {
+      constexpr std::size_t kNumThreads = 4;
+      constexpr std::size_t kNumMessages = 1000;
+      std::vector<std::thread> threads;
+      for (std::size_t threadIdx = 0; threadIdx < kNumThreads; ++threadIdx) {
+        threads.emplace_back([&logger, threadIdx] {
+          for (std::size_t msgIdx = 0; msgIdx < kNumMessages; ++msgIdx) {
+            logger->log(Severity::kDebug, std::to_string(threadIdx));
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+      logger->flush();
+
+      THEN("all messages are delivered") {
+        const std::vector<Message> recorded = upstream->recorded();
+        CHECK(recorded.size() == kNumThreads * kNumMessages);
+        CHECK(logger->droppedCount() == 0);
+      }
+    }
+
+    WHEN("messages are logged from a single thread and the logger is destroyed") {
+      logger->log(Severity::kInfo, "one");
+      logger->log(Severity::kError, "two");
+      logger.reset();
+
+      THEN("messages are delivered in order") {
+        const std::vector<Message> expected{{Severity::kInfo, "one"}, {Severity::kError, "two"}};
+        CHECK(upstream->recorded() == expected);
+      }
+    }
+  }
+}
+
+SCENARIO("AsyncLogger overflow policies") {
+  const auto upstream = std::make_shared<RecordingLogger>();
+
+  GIVEN("an AsyncLogger with a drop policy and a full buffer") {
+    const auto logger = AsyncLogger::make(upstream, 2, AsyncLogger::OverflowPolicy::kDrop);
+    fillBuffer(*logger, *upstream);
+
+    WHEN("further messages are logged") {
+      logger->log(Severity::kInfo, "c");
+      logger->log(Severity::kInfo, "d");
+
+      THEN("messages are dropped and a summary is logged once there is space") {
+        CHECK(logger->droppedCount() == 2);
+
+        upstream->release();
+        logger->flush();
+
+        const std::vector<Message> expected{
+            {Severity::kInfo, "first"},
+            {Severity::kInfo, "a"},
+            {Severity::kInfo, "b"},
+            {Severity::kWarning, "AsyncLogger: 2 message(s) dropped due to a full buffer"}};
+        CHECK(upstream->recorded() == expected);
+      }
+    }
+  }
+
+  GIVEN("an AsyncLogger with a block policy and a full buffer") {
+    const auto logger = AsyncLogger::make(upstream, 2, AsyncLogger::OverflowPolicy::kBlock);
+    fillBuffer(*logger, *upstream);
+
+    WHEN("a further message is logged") {
+      std::atomic_bool isLogged{false};
+      std::thread thread{[&] {
+        logger->log(Severity::kInfo, "c");
+        isLogged = true;
+      }};
+
+      THEN("the caller blocks until there is space") {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        CHECK_FALSE(isLogged);
+
+        upstream->release();
+        thread.join();
+        logger->flush();
+
+        const std::vector<Message> expected{{Severity::kInfo, "first"},
+                                            {Severity::kInfo, "a"},
+                                            {Severity::kInfo, "b"},
+                                            {Severity::kInfo, "c"}};
+        CHECK(upstream->recorded() == expected);
+        CHECK(logger->droppedCount() == 0);
+      }
+    }
+  }
+
+  GIVEN("an AsyncLogger with a sample policy and a full buffer") {
+    const auto logger = AsyncLogger::make(upstream, 2, AsyncLogger::OverflowPolicy::kSample, 3);
+    fillBuffer(*logger, *upstream);
+
+    WHEN("further messages are logged") {
+      std::thread thread{[&] {
+        logger->log(Severity::kInfo, "c");
+        logger->log(Severity::kInfo, "d");
+        logger->log(Severity::kInfo, "e");
+      }};
+
+      THEN("only every sampleInterval'th message is retained") {
+        while (logger->droppedCount() < 2) {
+          std::this_thread::yield();
+        }
+        upstream->release();
+        thread.join();
+        logger->flush();
+
+        // The drop summary may be delivered either side of "e",
+        // depending on when "e" found space in the buffer.
+        const std::vector<Message> recorded = upstream->recorded();
+        const Message expectedSummary{Severity::kWarning,
+                                      "AsyncLogger: 2 message(s) dropped due to a full buffer"};
+        REQUIRE(recorded.size() == 5);
+        CHECK(std::count(recorded.begin(), recorded.end(), Message{Severity::kInfo, "e"}) == 1);
+        CHECK(std::count(recorded.begin(), recorded.end(), expectedSummary) == 1);
+        CHECK(logger->droppedCount() == 2);
+      }
+    }
+  }
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+using Severity = log::LoggerInterface::Severity;
+
+/**
+ * Logger that only logs at or above a given severity, recording
+ * messages.
+ */
+struct ThresholdLogger final : log::LoggerInterface {
+  explicit ThresholdLogger(const Severity threshold) : threshold{threshold} {}
+
+  void log([[maybe_unused]] const Severity severity, const Str& message) override {
+    messages.push_back(message);
+  }
+
+  [[nodiscard]] bool isSeverityLogged(const Severity severity) const override {
+    return severity >= threshold;
+  }
+
+  Severity threshold;
+  std::vector<Str> messages;
+};
+}  // namespace
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
+
+using openassetio::Severity;
+using openassetio::Str;
+using openassetio::ThresholdLogger;
+
+SCENARIO("LoggerInterface::logDeferred only constructs messages that will be logged") {
+  GIVEN("a logger that filters out messages below warning severity") {
+    ThresholdLogger logger{Severity::kWarning};
+    int numMessagesConstructed = 0;
+    const auto messageFn = [&numMessagesConstructed] {
+      ++numMessagesConstructed;
+      return Str{"a message"};
+    };
+
+    WHEN("a deferred message is logged below the threshold") {
+      logger.logDeferred(Severity::kDebug, messageFn);
+
+      THEN("the message is not constructed or logged") {
+        CHECK(numMessagesConstructed == 0);
+        CHECK(logger.messages.empty());
+      }
+    }
+
+    WHEN("a deferred message is logged at the threshold") {
+      logger.logDeferred(Severity::kWarning, messageFn);
+
+      THEN("the message is constructed and logged") {
+        CHECK(numMessagesConstructed == 1);
+        CHECK(logger.messages == std::vector<Str>{"a message"});
+      }
+    }
+  }
+}
@@ -8,6 +8,8 @@
 #include <trompeloeil.hpp>
 
 #include <openassetio/export.h>  // NOLINT - cpplint
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/exec/ThreadPool.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
@@ -73,3 +75,43 @@ SCENARIO("HostSession::host method returns held pointer by reference") {
     }
   }
 }
+
+SCENARIO("HostSession::executor method returns held pointer by reference") {
+  GIVEN("a configured HostSession") {
+    const openassetio::managerApi::HostSessionPtr session =
+        openassetio::managerApi::HostSession::make(
+            openassetio::managerApi::Host::make(
+                std::make_shared<openassetio::MockHostInterface>()),
+            std::make_shared<openassetio::MockLoggerInterface>());
+
+    WHEN("executor is called multiple times") {
+      THEN("returned values are references to the same object") {
+        CHECK(&session->executor() == &session->executor());
+      }
+    }
+  }
+}
+
+SCENARIO("HostSession executor") {
+  const auto host =
+      openassetio::managerApi::Host::make(std::make_shared<openassetio::MockHostInterface>());
+  const auto logger = std::make_shared<openassetio::MockLoggerInterface>();
+
+  GIVEN("a HostSession constructed without an executor") {
+    const openassetio::managerApi::HostSessionPtr session =
+        openassetio::managerApi::HostSession::make(host, logger);
+
+    THEN("the executor is the default thread pool") {
+      CHECK(session->executor() == openassetio::exec::ThreadPool::defaultPool());
+    }
+  }
+
+  GIVEN("a HostSession constructed with an executor") {
+    const openassetio::exec::ExecutorInterfacePtr executor =
+        openassetio::exec::ThreadPool::make(1);
+    const openassetio::managerApi::HostSessionPtr session =
+        openassetio::managerApi::HostSession::make(host, logger, executor);
+
+    THEN("the executor is the provided executor") { CHECK(session->executor() == executor); }
+  }
+}
@@ -1,9 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2024 The Foundry Visionmongers Ltd
+// Copyright 2024-2025 The Foundry Visionmongers Ltd
 #pragma once
 
+#include <memory>
+
 #include <openassetio/errors/exceptions.hpp>
 #include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/managerApi/ManagerStateBase.hpp>
+
+// State defined within the plugin library, for use in checking that
+// the library outlives any state it creates.
+struct StubManagerState : openassetio::managerApi::ManagerStateBase {};
 
 struct StubManagerInterface : openassetio::managerApi::ManagerInterface {
   [[nodiscard]] openassetio::Identifier identifier() const override {
@@ -15,7 +22,14 @@ struct StubManagerInterface : openassetio::managerApi::ManagerInterface {
     return OPENASSETIO_CORE_PLUGINSYSTEM_TEST_PLUGIN_ID_SUFFIX;
   }
 
-  bool hasCapability([[maybe_unused]] Capability capability) override { return false; }
+  bool hasCapability(Capability capability) override {
+    return capability == Capability::kStatefulContexts;
+  }
+
+  openassetio::managerApi::ManagerStateBasePtr createState(
+      [[maybe_unused]] const openassetio::managerApi::HostSessionPtr& hostSession) override {
+    return std::make_shared<StubManagerState>();
+  }
 
   // Deliberately throw an exception, for use in checking RTTI.
   openassetio::InfoDictionary info() override {
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <string_view>
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/typedefs.hpp>
+#include <openassetio/utils/substitute.hpp>
+
+using openassetio::Bool;
+using openassetio::Float;
+using openassetio::InfoDictionary;
+using openassetio::Int;
+using openassetio::Str;
+using openassetio::errors::InputValidationException;
+using openassetio::utils::CompiledTemplate;
+using openassetio::utils::substitute;
+
+namespace {
+/// Path template exercising format specifiers of each value type.
+constexpr std::string_view kPathTemplate =
+    "/jobs/{job}/shots/{shot:_>8}/v{version:03d}/{name:.4s}.{scale:+07.3f}.{frame:04d}.exr"
+    "?final={isFinal:>5}";
+
+const InfoDictionary kPathSubstitutions{{"job", Str{"abc"}},     {"shot", Str{"sh010"}},
+                                        {"version", Int{7}},     {"name", Str{"plate"}},
+                                        {"scale", Float{1.5}},   {"frame", Int{1001}},
+                                        {"isFinal", Bool{true}}};
+}  // namespace
+
+SCENARIO("CompiledTemplate format specifiers match substitute") {
+  GIVEN("a template with format specifiers for values of each type") {
+    const CompiledTemplate compiledTemplate{kPathTemplate};
+
+    WHEN("substituted") {
+      const Str actual = compiledTemplate.substitute(kPathSubstitutions);
+
+      THEN("result is as for substitute") {
+        CHECK(actual == "/jobs/abc/shots/___sh010/v007/plat.+01.500.1001.exr?final= true");
+        CHECK(actual == substitute(kPathTemplate, kPathSubstitutions));
+      }
+    }
+  }
+
+  GIVEN("a template with a format specifier that is only valid for some types") {
+    constexpr std::string_view kInput = "{value:.2f}";
+    const CompiledTemplate compiledTemplate{kInput};
+
+    WHEN("substituted with a value of a valid type") {
+      const InfoDictionary substitutions{{"value", Float{0.125}}};
+
+      THEN("result is as for substitute") {
+        CHECK(compiledTemplate.substitute(substitutions) == "0.12");
+        CHECK(compiledTemplate.substitute(substitutions) == substitute(kInput, substitutions));
+      }
+    }
+
+    WHEN("substituted with a value of an invalid type") {
+      const InfoDictionary substitutions{{"value", Int{1}}};
+
+      THEN("the same error as substitute is raised") {
+        const auto expectedMessage = Catch::Message(
+            "substitute(): failed to process the input string '{value:.2f}': precision not "
+            "allowed for this argument type");
+        CHECK_THROWS_MATCHES(compiledTemplate.substitute(substitutions),
+                             InputValidationException, expectedMessage);
+        CHECK_THROWS_MATCHES(substitute(kInput, substitutions), InputValidationException,
+                             expectedMessage);
+      }
+    }
+  }
+}
+
+TEST_CASE("CompiledTemplate vs substitute with format specifiers", "[!benchmark]") {
+  const CompiledTemplate compiledTemplate{kPathTemplate};
+  Str result;
+
+  BENCHMARK("substitute") { return substitute(kPathTemplate, kPathSubstitutions); };
+
+  BENCHMARK("CompiledTemplate") { return compiledTemplate.substitute(kPathSubstitutions); };
+
+  BENCHMARK("CompiledTemplate into reused string") {
+    compiledTemplate.substitute(kPathSubstitutions, result);
+    return result.size();
+  };
+}
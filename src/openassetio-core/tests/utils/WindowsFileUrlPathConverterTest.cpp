@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <openassetio/typedefs.hpp>
+
+#include <utils/Regex.hpp>
+#include <utils/path/windows/detail.hpp>
+#include <utils/path/windows/pathTypes.hpp>
+
+// Differential tests of the regex-free Windows path classification and
+// normalisation against the original regex-based implementation.
+// Python tests cover the expected behaviour in detail, here we're
+// checking that the state machine and scanners are exactly equivalent
+// to the regexes they replace.
+
+namespace {
+using openassetio::Str;
+using openassetio::utils::Regex;
+namespace windows = openassetio::utils::path::windows;
+using windows::detail::DriveLetter;
+using windows::detail::NormalisedPath;
+using windows::detail::PathClassifier;
+using windows::detail::UncDetails;
+using windows::detail::UncHost;
+using windows::detail::UncUnnormalisedDevicePath;
+using windows::detail::WindowsUrl;
+
+/**
+ * Comparable copy of UncDetails.
+ */
+using UncDetailsTuple = std::tuple<Str, Str, Str, Str, Str>;
+
+UncDetailsTuple toTuple(const UncDetails& details) {
+  return {Str{details.hostOrDrive}, Str{details.shareName}, Str{details.sharePath},
+          Str{details.shareNameAndPath}, Str{details.fullPath}};
+}
+
+/**
+ * Original regex-based implementation, retained as a reference.
+ */
+struct LegacyWindowsPathHandlers {
+  // WindowsUrl
+  Regex ip6HostRegex{R"(^\[([A-Z0-9:]+)\]$)"};
+  Regex percentEncodedSlashRegex{R"(%(:?5C|2F))"};
+  // NormalisedPath
+  Regex upwardsTraversalRegex{R"((^|[\\/])\.\.([\\/]|$))"};
+  Regex trailingDotsAsFileRegex{R"([\\/](\.{3,})$)"};
+  Regex trailingDotsInFileRegex{R"([^.\\/](\.+)$)"};
+  Regex trailingDotsAndSpacesRegex{R"([\\/][^\\/ ]*( [. ]*)$)"};
+  Regex trailingSlashesRegex{R"([\\/]([\\/]+)$)"};
+  Regex trailingSingleDotInSegmentRegex{R"((?<![.\\/])\.(?=[/\\]))"};
+  Regex trailingSlashesInSegmentRegex{R"([\\/][\\/]+)"};
+  // DriveLetter
+  Regex driveRegex{R"(^[A-Z]:$)"};
+  Regex absoluteDrivePathRegex{R"(^[A-Z]:[/\\])"};
+  // UncHost
+  Regex invalidHostnameRegex{R"(^[.?]$|[^[:ascii:]]|%|^[A-Z]:$)"};
+  // UncUnnormalisedDevicePath
+  Regex deviceUpwardsTraversalRegex{R"((^|\\)\.\.(\\|$))"};
+  Regex deviceTrailingSlashesRegex{R"(\\(\\+)$)"};
+  Regex deviceTrailingSlashesInSegmentRegex{R"((\\\\+))"};
+  // pathTypes
+  Regex uncSharePathRegex{R"(^([\\/]{2,})([^\\/]*)(.*)$)"};
+  Regex uncSharePathHeadAndTailRegex{R"(^([\\/]+[^\\/]+)([\\/].*)$)"};
+  Regex deviceDrivePathRegex{R"(^\\\\\?\\([^\\]*)(.*)$)"};
+  Regex deviceSharePathRegex{R"(^\\\\\?\\UNC\\([^\\]*)(.*)$)"};
+  Regex deviceSharePathHeadAndTailRegex{R"(^(\\[^\\]+)(.*)$)"};
+
+  /**
+   * Trim the first capture group of a regex from the end of a string.
+   */
+  static std::string_view withoutGroup(const Regex& regex, const std::string_view& str) {
+    const auto match = regex.match(str);
+    if (!match) {
+      return str;
+    }
+    return str.substr(0, str.size() - match->group(str, 1).size());
+  }
+
+  [[nodiscard]] std::optional<Str> ip6ToValidHostname(const std::string_view& host) const {
+    const auto match = ip6HostRegex.match(host);
+    if (!match) {
+      return std::nullopt;
+    }
+    Str ip6HostName{match->group(host, 1)};
+    ip6HostName += WindowsUrl::kIp6HostSuffix;
+    std::replace(ip6HostName.begin(), ip6HostName.end(), ':', '-');
+    return ip6HostName;
+  }
+
+  [[nodiscard]] std::string_view withoutTrailingSlashes(const std::string_view& path) const {
+    return withoutGroup(trailingSlashesRegex, path);
+  }
+
+  [[nodiscard]] std::string_view withoutTrailingDotsAsFile(const std::string_view& path) const {
+    return withoutGroup(trailingDotsAsFileRegex, path);
+  }
+
+  [[nodiscard]] std::string_view withoutTrailingDotsInFile(const std::string_view& path) const {
+    return withoutGroup(trailingDotsInFileRegex, path);
+  }
+
+  [[nodiscard]] std::string_view withoutTrailingSpacesAndDots(
+      const std::string_view& path) const {
+    return withoutGroup(trailingDotsAndSpacesRegex, path);
+  }
+
+  [[nodiscard]] Str removeTrailingDotsInPathSegments(const std::string_view& path) const {
+    return trailingSingleDotInSegmentRegex.substituteToReduceSize(path, "");
+  }
+
+  [[nodiscard]] Str removeTrailingSlashesInPathSegments(const std::string_view& path) const {
+    return trailingSlashesInSegmentRegex.substituteToReduceSize(path, "\\");
+  }
+
+  [[nodiscard]] std::string_view deviceWithoutTrailingSlashes(
+      const std::string_view& path) const {
+    return withoutGroup(deviceTrailingSlashesRegex, path);
+  }
+
+  /**
+   * Classify a path by attempting each path type in turn, extracting
+   * UNC details where relevant.
+   */
+  [[nodiscard]] std::pair<PathClassifier::Category, std::optional<UncDetailsTuple>> classify(
+      const std::string_view& path) const {
+    if (const auto parts = deviceSharePathRegex.match(path)) {
+      const std::string_view hostOrDrive = parts->group(path, 1);
+      const std::string_view shareNameAndPath =
+          deviceWithoutTrailingSlashes(parts->group(path, 2));
+      std::string_view shareName = shareNameAndPath;
+      std::string_view sharePath;
+      if (const auto headAndTail = deviceSharePathHeadAndTailRegex.match(shareNameAndPath)) {
+        shareName = headAndTail->group(shareNameAndPath, 1);
+        sharePath = headAndTail->group(shareNameAndPath, 2);
+      }
+      const std::string_view fullPath = path.substr(
+          PathClassifier::kDeviceSharePrefix.size(), hostOrDrive.size() + shareNameAndPath.size());
+      return {PathClassifier::Category::kUncDeviceShare,
+              UncDetailsTuple{hostOrDrive, shareName, sharePath, shareNameAndPath, fullPath}};
+    }
+
+    if (const auto parts = deviceDrivePathRegex.match(path)) {
+      const std::string_view hostOrDrive = parts->group(path, 1);
+      const std::string_view shareNameAndPath =
+          deviceWithoutTrailingSlashes(parts->group(path, 2));
+      const std::string_view fullPath = path.substr(PathClassifier::kDevicePrefix.size(),
+                                                    hostOrDrive.size() + shareNameAndPath.size());
+      return {PathClassifier::Category::kUncDeviceDrive,
+              UncDetailsTuple{hostOrDrive, "", "", shareNameAndPath, fullPath}};
+    }
+
+    if (const auto parts = uncSharePathRegex.match(path)) {
+      const std::string_view prefix = parts->group(path, 1);
+      const std::string_view hostOrDrive = parts->group(path, 2);
+      std::string_view shareNameAndPath = withoutTrailingSlashes(parts->group(path, 3));
+      std::string_view shareName = shareNameAndPath;
+      std::string_view sharePath;
+      if (const auto headAndTail = uncSharePathHeadAndTailRegex.match(shareNameAndPath)) {
+        shareName = headAndTail->group(shareNameAndPath, 1);
+        sharePath = withoutTrailingDotsInFile(withoutTrailingDotsAsFile(
+            withoutTrailingSpacesAndDots(headAndTail->group(shareNameAndPath, 2))));
+        shareNameAndPath = shareNameAndPath.substr(0, shareName.size() + sharePath.size());
+      }
+      const std::string_view fullPath =
+          path.substr(prefix.size(), hostOrDrive.size() + shareNameAndPath.size());
+      return {PathClassifier::Category::kUncShare,
+              UncDetailsTuple{hostOrDrive, shareName, sharePath, shareNameAndPath, fullPath}};
+    }
+
+    return {PathClassifier::Category::kDrive, std::nullopt};
+  }
+};
+
+/**
+ * Classify a path using the state machine, extracting UNC details
+ * where relevant.
+ */
+std::pair<PathClassifier::Category, std::optional<UncDetailsTuple>> classify(
+    const std::string_view& path) {
+  namespace pathTypes = windows::pathTypes;
+  const auto [category, prefixLength] = PathClassifier::classify(path);
+  switch (category) {
+    case PathClassifier::Category::kUncDeviceShare:
+      return {category,
+              toTuple(pathTypes::UncUnnormalisedDeviceSharePath::extractUncDetails(path))};
+    case PathClassifier::Category::kUncDeviceDrive:
+      return {category,
+              toTuple(pathTypes::UncUnnormalisedDeviceDrivePath::extractUncDetails(path))};
+    case PathClassifier::Category::kUncShare:
+      return {category, toTuple(pathTypes::UncSharePath::extractUncDetails(path, prefixLength))};
+    case PathClassifier::Category::kDrive:
+      break;
+  }
+  return {category, std::nullopt};
+}
+
+/**
+ * Generate random strings biased towards characters and prefixes that
+ * are significant to Windows path processing.
+ */
+struct RandomStringGenerator {
+  static constexpr std::array kPrefixes{
+      "", "", R"(\\?\UNC\)", R"(\\?\unc\)", R"(\\?\)", R"(\\?)", R"(\\)", "//", R"(\/)",
+      R"(\\\)", "C:\\", "c:/", "C:", "\\"};
+  static constexpr std::array kFragments{
+      "\\", "\\", "/", R"(\\)", "//", ".", "..", "...", " ", " .", "a", "B", "z", "C:", "c:",
+      "?", "%", "%5C", "%5c", "%2F", "%2f", "%:5C", "%:2f", "%2", ":", "[", "]", "[::1]",
+      "localhost", "UNC", "u", "N", "host", "\x7F", "\x80", "\xC3\xA9", "\t"};
+
+  Str operator()(const std::size_t maxFragments) {
+    Str result = kPrefixes.at(
+        std::uniform_int_distribution<std::size_t>{0, kPrefixes.size() - 1}(engine));
+    const std::size_t numFragments = std::uniform_int_distribution<std::size_t>{
+        0, maxFragments}(engine);
+    std::uniform_int_distribution<std::size_t> fragmentIdx{0, kFragments.size() - 1};
+    for (std::size_t idx = 0; idx < numFragments; ++idx) {
+      result += kFragments.at(fragmentIdx(engine));
+    }
+    return result;
+  }
+
+  std::mt19937 engine;
+};
+
+constexpr std::size_t kNumIterations = 100000;
+constexpr std::size_t kMaxFragments = 10;
+}  // namespace
+
+TEST_CASE("Windows path classification matches reference implementation") {
+  const LegacyWindowsPathHandlers legacy;
+  const std::uint32_t seed = Catch::rngSeed();
+  INFO("Seed: " << seed);
+  RandomStringGenerator generator{std::mt19937{seed}};
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    const Str path = generator(kMaxFragments);
+    INFO("Path: " << path);
+    const auto expected = legacy.classify(path);
+    const auto actual = classify(path);
+    REQUIRE(actual == expected);
+
+    if (actual.first == PathClassifier::Category::kUncShare) {
+      // Share name and path are normalised separately.
+      const Str& shareName = std::get<1>(*actual.second);
+      const Str& sharePath = std::get<2>(*actual.second);
+      Str normalised;
+      NormalisedPath::appendNormalisedPathSegments(shareName, false, normalised);
+      NormalisedPath::appendNormalisedPathSegments(sharePath, true, normalised);
+      CHECK(normalised == legacy.removeTrailingSlashesInPathSegments(
+                              shareName + legacy.removeTrailingDotsInPathSegments(sharePath)));
+    }
+  }
+}
+
+TEST_CASE("Windows path normalisation matches reference implementation") {
+  const LegacyWindowsPathHandlers legacy;
+  const std::uint32_t seed = Catch::rngSeed();
+  INFO("Seed: " << seed);
+  RandomStringGenerator generator{std::mt19937{seed}};
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    const Str path = generator(kMaxFragments);
+    INFO("Path: " << path);
+
+    CHECK(NormalisedPath::withoutTrailingSlashes(path) == legacy.withoutTrailingSlashes(path));
+    CHECK(NormalisedPath::withoutTrailingDotsAsFile(path) ==
+          legacy.withoutTrailingDotsAsFile(path));
+    CHECK(NormalisedPath::withoutTrailingDotsInFile(path) ==
+          legacy.withoutTrailingDotsInFile(path));
+    CHECK(NormalisedPath::withoutTrailingSpacesAndDots(path) ==
+          legacy.withoutTrailingSpacesAndDots(path));
+    CHECK(NormalisedPath::containsUpwardsTraversal(path) ==
+          legacy.upwardsTraversalRegex.matches(path));
+
+    Str normalised;
+    NormalisedPath::appendNormalisedPathSegments(path, true, normalised);
+    CHECK(normalised == legacy.removeTrailingDotsInPathSegments(
+                            legacy.removeTrailingSlashesInPathSegments(path)));
+    normalised.clear();
+    NormalisedPath::appendNormalisedPathSegments(path, false, normalised);
+    CHECK(normalised == legacy.removeTrailingSlashesInPathSegments(path));
+
+    CHECK(UncUnnormalisedDevicePath::withoutTrailingSlashes(path) ==
+          legacy.deviceWithoutTrailingSlashes(path));
+    CHECK(UncUnnormalisedDevicePath::containsUpwardsTraversal(path) ==
+          legacy.deviceUpwardsTraversalRegex.matches(path));
+    CHECK(UncUnnormalisedDevicePath::removeTrailingSlashesInPathSegments(path) ==
+          legacy.deviceTrailingSlashesInSegmentRegex.substituteToReduceSize(path, "\\"));
+  }
+}
+
+TEST_CASE("Windows path component predicates match reference implementation") {
+  const LegacyWindowsPathHandlers legacy;
+  const std::uint32_t seed = Catch::rngSeed();
+  INFO("Seed: " << seed);
+  RandomStringGenerator generator{std::mt19937{seed}};
+
+  for (std::size_t iteration = 0; iteration < kNumIterations; ++iteration) {
+    // Short strings, since these are mostly concerned with exact
+    // matches.
+    const Str str = generator(2);
+    INFO("String: " << str);
+
+    CHECK(DriveLetter::isDrive(str) == legacy.driveRegex.matches(str));
+    CHECK(DriveLetter::isAbsoluteDrivePath(str) == legacy.absoluteDrivePathRegex.matches(str));
+    CHECK(UncHost::isInvalidHostname(str) == legacy.invalidHostnameRegex.matches(str));
+    CHECK(WindowsUrl::containsPercentEncodedSlash(str) ==
+          legacy.percentEncodedSlashRegex.matches(str));
+    CHECK(WindowsUrl::ip6ToValidHostname(str) == legacy.ip6ToValidHostname(str));
+  }
+}
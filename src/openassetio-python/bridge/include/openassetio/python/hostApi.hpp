@@ -1,6 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2025 The Foundry Visionmongers Ltd
 #pragma once
+#include <cstddef>
+#include <thread>
+
 #include <openassetio/export.h>
 #include <openassetio/python/export.h>
 #include <openassetio/typedefs.hpp>
@@ -23,6 +26,76 @@ namespace hostApi {
  */
 OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
 createPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger);
+
+/**
+ * Retrieve an instance of the Python plugin system implementation,
+ * where each instantiated manager is a pool of copies.
+ *
+ * Each manager instantiated by the returned factory holds
+ * @p numInstances independent instances of the Python manager, and
+ * dispatches concurrent calls from different threads to different
+ * instances. This allows parallelism for Python managers that
+ * serialise work per-instance, and that release the GIL whilst
+ * waiting (e.g. on network or disk I/O).
+ *
+ * Calls to `initialize` and `flushCaches` are broadcast to all
+ * instances, so all instances must behave identically. Manager state
+ * created by one instance may be used by another.
+ *
+ * @note All instances share the main interpreter, and so its GIL.
+ * For CPU-bound managers, see
+ * @ref createOutOfProcessPythonManagerImplementationFactory.
+ *
+ * @param logger Logger.
+ *
+ * @param numInstances Number of manager instances per pool.
+ *
+ * @return Python plugin system.
+ *
+ * @throws errors.InputValidationException If @p numInstances is zero.
+ */
+OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
+createPythonPluginSystemManagerImplementationFactory(log::LoggerInterfacePtr logger,
+                                                     std::size_t numInstances);
+
+/**
+ * Retrieve a factory for Python managers hosted in separate worker
+ * processes.
+ *
+ * Each instantiated manager spawns a pool of Python interpreter
+ * processes, each of which loads the manager plugin using the Python
+ * plugin system, configured via the inherited environment (e.g.
+ * `OPENASSETIO_PLUGIN_PATH`). Calls are forwarded to workers over a
+ * local socket, and batch methods are split across idle workers, so
+ * are serviced in parallel without contending for a single GIL.
+ *
+ * The host process does not need to embed a Python interpreter.
+ *
+ * Only a subset of the @ref managerApi::ManagerInterface
+ * "ManagerInterface" is forwarded. Methods related to manager state,
+ * relationships and default entity references are not available, and
+ * the associated capabilities are not advertised.
+ *
+ * Currently only supported on POSIX platforms.
+ *
+ * @param logger Logger, which also receives log messages from the
+ * workers.
+ *
+ * @param pythonExecutable Python interpreter used to run workers,
+ * which must be able to import the `openassetio` package. Resolved
+ * using `PATH` if not an absolute path.
+ *
+ * @param numWorkers Number of worker processes per manager instance.
+ *
+ * @return Out-of-process plugin system.
+ *
+ * @throws errors.NotImplementedException If out-of-process managers
+ * are not supported on this platform.
+ */
+OPENASSETIO_PYTHON_BRIDGE_EXPORT openassetio::hostApi::ManagerImplementationFactoryInterfacePtr
+createOutOfProcessPythonManagerImplementationFactory(
+    log::LoggerInterfacePtr logger, Str pythonExecutable = "python3",
+    std::size_t numWorkers = std::thread::hardware_concurrency());
 }  // namespace hostApi
 }  // namespace python
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "PooledManagerImplementationFactory.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+
+namespace {
+
+/**
+ * A ManagerInterface implementation that holds several interchangeable
+ * copies of the same manager, and dispatches each API call to a copy
+ * that is not currently in use by another thread.
+ *
+ * A thread that re-enters the manager (e.g. from within a callback)
+ * continues to use the copy it already holds, so nested calls cannot
+ * deadlock waiting for a free copy.
+ *
+ * Methods that configure the manager are broadcast to all copies.
+ * Methods that describe the manager are answered by the first copy, on
+ * the understanding that all copies are identical.
+ */
+class PooledManagerInterface final : public managerApi::ManagerInterface {
+  using ManagerInterfaces = std::vector<managerApi::ManagerInterfacePtr>;
+
+ public:
+  explicit PooledManagerInterface(ManagerInterfaces managerInterfaces)
+      : managerInterfaces_{std::move(managerInterfaces)} {
+    // Precondition.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+    assert(!managerInterfaces_.empty());
+    idle_.reserve(managerInterfaces_.size());
+    for (const auto& managerInterface : managerInterfaces_) {
+      idle_.push_back(managerInterface.get());
+    }
+  }
+
+  [[nodiscard]] Identifier identifier() const override {
+    return managerInterfaces_.front()->identifier();
+  }
+
+  [[nodiscard]] Str displayName() const override {
+    return managerInterfaces_.front()->displayName();
+  }
+
+  [[nodiscard]] InfoDictionary info() override { return managerInterfaces_.front()->info(); }
+
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override {
+    return managerInterfaces_.front()->settings(hostSession);
+  }
+
+  [[nodiscard]] bool hasCapability(const Capability capability) override {
+    return managerInterfaces_.front()->hasCapability(capability);
+  }
+
+  /**
+   * All copies are initialized with the same settings.
+   */
+  void initialize(const InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override {
+    for (const auto& managerInterface : managerInterfaces_) {
+      managerInterface->initialize(managerSettings, hostSession);
+    }
+  }
+
+  /**
+   * All copies are flushed.
+   */
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override {
+    for (const auto& managerInterface : managerInterfaces_) {
+      managerInterface->flushCaches(hostSession);
+    }
+  }
+
+  /*
+   * The remaining API methods all dispatch to a leased copy.
+   */
+
+  /**
+   * Convenience macro to call a method on a copy leased for the
+   * duration of the call.
+   */
+#define INVOKE_LEASED_MANAGER_FOR_FUNCTION(method, ...) Lease{this}->method(__VA_ARGS__)
+
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(updateTerminology, std::move(terms), hostSession);
+  }
+
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(managementPolicy, traitSets, policyAccess, context,
+                                              hostSession);
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createState(
+      const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(createState, hostSession);
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr createChildState(
+      const managerApi::ManagerStateBasePtr& parentState,
+      const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(createChildState, parentState, hostSession);
+  }
+
+  [[nodiscard]] Str persistenceTokenForState(
+      const managerApi::ManagerStateBasePtr& state,
+      const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(persistenceTokenForState, state, hostSession);
+  }
+
+  [[nodiscard]] managerApi::ManagerStateBasePtr stateFromPersistenceToken(
+      const Str& token, const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(stateFromPersistenceToken, token, hostSession);
+  }
+
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override {
+    return INVOKE_LEASED_MANAGER_FOR_FUNCTION(isEntityReferenceString, someString, hostSession);
+  }
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(entityExists, entityReferences, context, hostSession,
+                                       successCallback, errorCallback);
+  }
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    const access::EntityTraitsAccess entityTraitsAccess,
+                    const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(entityTraits, entityReferences, entityTraitsAccess,
+                                       context, hostSession, successCallback, errorCallback);
+  }
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(resolve, entityReferences, traitSet, resolveAccess,
+                                       context, hostSession, successCallback, errorCallback);
+  }
+
+  void defaultEntityReference(const trait::TraitSets& traitSets,
+                              const access::DefaultEntityAccess defaultEntityAccess,
+                              const ContextConstPtr& context,
+                              const managerApi::HostSessionPtr& hostSession,
+                              const DefaultEntityReferenceSuccessCallback& successCallback,
+                              const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(defaultEntityReference, traitSets, defaultEntityAccess,
+                                       context, hostSession, successCallback, errorCallback);
+  }
+
+  void getWithRelationship(const EntityReferences& entityReferences,
+                           const trait::TraitsDataPtr& relationshipTraitsData,
+                           const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+                           const access::RelationsAccess relationsAccess,
+                           const ContextConstPtr& context,
+                           const managerApi::HostSessionPtr& hostSession,
+                           const RelationshipQuerySuccessCallback& successCallback,
+                           const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(getWithRelationship, entityReferences,
+                                       relationshipTraitsData, resultTraitSet, pageSize,
+                                       relationsAccess, context, hostSession, successCallback,
+                                       errorCallback);
+  }
+
+  void getWithRelationships(const EntityReference& entityReference,
+                            const trait::TraitsDatas& relationshipTraitsDatas,
+                            const trait::TraitSet& resultTraitSet, const std::size_t pageSize,
+                            const access::RelationsAccess relationsAccess,
+                            const ContextConstPtr& context,
+                            const managerApi::HostSessionPtr& hostSession,
+                            const RelationshipQuerySuccessCallback& successCallback,
+                            const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(getWithRelationships, entityReference,
+                                       relationshipTraitsDatas, resultTraitSet, pageSize,
+                                       relationsAccess, context, hostSession, successCallback,
+                                       errorCallback);
+  }
+
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(preflight, entityReferences, traitsHints,
+                                       publishingAccess, context, hostSession, successCallback,
+                                       errorCallback);
+  }
+
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override {
+    INVOKE_LEASED_MANAGER_FOR_FUNCTION(register_, entityReferences, entityTraitsDatas,
+                                       publishingAccess, context, hostSession, successCallback,
+                                       errorCallback);
+  }
+
+#undef INVOKE_LEASED_MANAGER_FOR_FUNCTION
+
+ private:
+  /**
+   * RAII exclusive use of a copy by the current thread.
+   *
+   * If the current thread already holds a copy from this pool, then
+   * that copy is reused rather than waiting on another.
+   */
+  class Lease {
+   public:
+    explicit Lease(PooledManagerInterface* pool) : pool_{pool} {
+      auto& held = heldByThisThread();
+      if (const auto iter =
+              std::find_if(held.rbegin(), held.rend(),
+                           [pool](const auto& poolAndCopy) { return poolAndCopy.first == pool; });
+          iter != held.rend()) {
+        managerInterface_ = iter->second;
+        return;
+      }
+
+      {
+        std::unique_lock lock{pool_->mutex_};
+        pool_->idleChanged_.wait(lock, [this] { return !pool_->idle_.empty(); });
+        managerInterface_ = pool_->idle_.back();
+        pool_->idle_.pop_back();
+      }
+      held.emplace_back(pool_, managerInterface_);
+      isOwner_ = true;
+    }
+
+    ~Lease() {
+      if (!isOwner_) {
+        return;
+      }
+      // Leases are scoped to a call, so are released in reverse order.
+      heldByThisThread().pop_back();
+      {
+        const std::lock_guard lock{pool_->mutex_};
+        pool_->idle_.push_back(managerInterface_);
+      }
+      pool_->idleChanged_.notify_one();
+    }
+
+    Lease(const Lease&) = delete;
+    Lease(Lease&&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+
+    managerApi::ManagerInterface* operator->() const { return managerInterface_; }
+
+   private:
+    using HeldCopies =
+        std::vector<std::pair<const PooledManagerInterface*, managerApi::ManagerInterface*>>;
+
+    static HeldCopies& heldByThisThread() {
+      thread_local HeldCopies held;
+      return held;
+    }
+
+    PooledManagerInterface* pool_;
+    managerApi::ManagerInterface* managerInterface_ = nullptr;
+    bool isOwner_ = false;
+  };
+
+  ManagerInterfaces managerInterfaces_;
+  std::vector<managerApi::ManagerInterface*> idle_;
+  std::mutex mutex_;
+  std::condition_variable idleChanged_;
+};
+}  // namespace
+
+PooledManagerImplementationFactory::PooledManagerImplementationFactory(
+    log::LoggerInterfacePtr logger,
+    openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory,
+    const std::size_t numInstances)
+    : ManagerImplementationFactoryInterface{std::move(logger)},
+      factory_{std::move(factory)},
+      numInstances_{numInstances} {
+  if (numInstances_ == 0) {
+    throw errors::InputValidationException{"At least one manager instance must be pooled"};
+  }
+}
+
+Identifiers PooledManagerImplementationFactory::identifiers() { return factory_->identifiers(); }
+
+managerApi::ManagerInterfacePtr PooledManagerImplementationFactory::instantiate(
+    const Identifier& identifier) {
+  if (numInstances_ == 1) {
+    return factory_->instantiate(identifier);
+  }
+
+  std::vector<managerApi::ManagerInterfacePtr> managerInterfaces;
+  managerInterfaces.reserve(numInstances_);
+  for (std::size_t idx = 0; idx < numInstances_; ++idx) {
+    managerInterfaces.push_back(factory_->instantiate(identifier));
+  }
+  return std::make_shared<PooledManagerInterface>(std::move(managerInterfaces));
+}
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+
+#include <openassetio/export.h>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi {
+/**
+ * Factory decorator that instantiates several copies of each manager
+ * and pools them behind a single ManagerInterface.
+ *
+ * Concurrent calls from different threads are dispatched to different
+ * copies, so that a manager whose implementation serialises work
+ * within an instance (e.g. a single client connection guarded by a
+ * lock) can service calls in parallel.
+ */
+class PooledManagerImplementationFactory final
+    : public openassetio::hostApi::ManagerImplementationFactoryInterface {
+ public:
+  /**
+   * @param logger Logger.
+   * @param factory Factory used to instantiate each copy.
+   * @param numInstances Number of copies per manager.
+   */
+  PooledManagerImplementationFactory(
+      log::LoggerInterfacePtr logger,
+      openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory,
+      std::size_t numInstances);
+
+  Identifiers identifiers() override;
+  managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
+
+ private:
+  openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory_;
+  std::size_t numInstances_;
+};
+}  // namespace python::hostApi
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
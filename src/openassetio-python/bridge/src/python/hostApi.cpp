@@ -2,6 +2,8 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #include <openassetio/python/hostApi.hpp>
 
+#include <cstddef>
+#include <memory>
 #include <utility>
 
 #include <pybind11/embed.h>
@@ -9,9 +11,16 @@
 #include <openassetio/export.h>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+#ifdef _WIN32
+#include <openassetio/errors/exceptions.hpp>
+#endif
 // Private headers
 #include <openassetio/private/python/pointers.hpp>
 
+#include "PooledManagerImplementationFactory.hpp"
+#include "outOfProcess/OutOfProcessManagerInterface.hpp"
+
 namespace py = pybind11;
 
 namespace openassetio {
@@ -43,6 +52,28 @@ ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplemen
   return pointers::createPyRetainingPtr<ManagerImplementationFactoryInterfacePtr>(pyInstance,
                                                                                   cppInstancePtr);
 }
+
+ManagerImplementationFactoryInterfacePtr createPythonPluginSystemManagerImplementationFactory(
+    log::LoggerInterfacePtr logger, const std::size_t numInstances) {
+  ManagerImplementationFactoryInterfacePtr factory =
+      createPythonPluginSystemManagerImplementationFactory(logger);
+  return std::make_shared<PooledManagerImplementationFactory>(std::move(logger),
+                                                              std::move(factory), numInstances);
+}
+
+ManagerImplementationFactoryInterfacePtr createOutOfProcessPythonManagerImplementationFactory(
+    [[maybe_unused]] log::LoggerInterfacePtr logger, [[maybe_unused]] Str pythonExecutable,
+    [[maybe_unused]] const std::size_t numWorkers) {
+#ifdef _WIN32
+  // Fail up front, rather than on first use, since workers are spawned
+  // lazily.
+  throw errors::NotImplementedException{
+      "Out-of-process Python managers are not supported on this platform"};
+#else
+  return std::make_shared<outOfProcess::OutOfProcessManagerImplementationFactory>(
+      std::move(logger), std::move(pythonExecutable), numWorkers);
+#endif
+}
 }  // namespace python::hostApi
 }  // namespace OPENASSETIO_CORE_ABI_VERSION
 }  // namespace openassetio
@@ -0,0 +1,360 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "OutOfProcessManagerInterface.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/managerApi/Host.hpp>
+#include <openassetio/managerApi/HostSession.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "WorkerPool.hpp"
+#include "protocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+
+OutOfProcessManagerInterface::OutOfProcessManagerInterface(std::unique_ptr<WorkerPool> pool,
+                                                           const Identifier& identifier)
+    : pool_{std::move(pool)} {
+  Writer request{Op::kInstantiate};
+  request.str(identifier);
+  pool_->broadcastSetup(request.payload());
+}
+
+Identifier OutOfProcessManagerInterface::identifier() const {
+  const Str payload = call(Writer{Op::kIdentifier}.payload());
+  Reader reply{payload};
+  Identifier result = reply.str();
+  reply.expectEnd();
+  return result;
+}
+
+Str OutOfProcessManagerInterface::displayName() const {
+  const Str payload = call(Writer{Op::kDisplayName}.payload());
+  Reader reply{payload};
+  Str result = reply.str();
+  reply.expectEnd();
+  return result;
+}
+
+InfoDictionary OutOfProcessManagerInterface::info() {
+  const Str payload = call(Writer{Op::kInfo}.payload());
+  Reader reply{payload};
+  InfoDictionary result = reply.dictionary();
+  reply.expectEnd();
+  return result;
+}
+
+InfoDictionary OutOfProcessManagerInterface::settings(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  const Str payload = call(Writer{Op::kSettings}.payload());
+  Reader reply{payload};
+  InfoDictionary result = reply.dictionary();
+  reply.expectEnd();
+  return result;
+}
+
+void OutOfProcessManagerInterface::initialize(InfoDictionary managerSettings,
+                                              const managerApi::HostSessionPtr& hostSession) {
+  const managerApi::HostPtr& host = hostSession->host();
+  Writer request{Op::kInitialize};
+  request.str(host->identifier());
+  request.str(host->displayName());
+  request.dictionary(host->info());
+  request.dictionary(managerSettings);
+  pool_->broadcastSetup(request.payload());
+}
+
+void OutOfProcessManagerInterface::flushCaches(
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  broadcast(Writer{Op::kFlushCaches}.payload());
+}
+
+bool OutOfProcessManagerInterface::hasCapability(const Capability capability) {
+  switch (capability) {
+    // Manager state can't cross the process boundary.
+    case Capability::kStatefulContexts:
+    // Not forwarded to workers.
+    case Capability::kRelationshipQueries:
+    case Capability::kDefaultEntityReferences:
+      return false;
+    default:
+      break;
+  }
+  Writer request{Op::kHasCapability};
+  request.u8(static_cast<std::uint8_t>(capability));
+  const Str payload = call(request.payload());
+  Reader reply{payload};
+  const bool result = reply.u8() != 0;
+  reply.expectEnd();
+  return result;
+}
+
+StrMap OutOfProcessManagerInterface::updateTerminology(
+    StrMap terms, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Writer request{Op::kUpdateTerminology};
+  request.strMap(terms);
+  const Str payload = call(request.payload());
+  Reader reply{payload};
+  StrMap result = reply.strMap();
+  reply.expectEnd();
+  return result;
+}
+
+bool OutOfProcessManagerInterface::isEntityReferenceString(
+    const Str& someString, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Writer request{Op::kIsEntityReferenceString};
+  request.str(someString);
+  const Str payload = call(request.payload());
+  Reader reply{payload};
+  const bool result = reply.u8() != 0;
+  reply.expectEnd();
+  return result;
+}
+
+trait::TraitsDatas OutOfProcessManagerInterface::managementPolicy(
+    const trait::TraitSets& traitSets, const access::PolicyAccess policyAccess,
+    const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession) {
+  Writer request{Op::kManagementPolicy};
+  request.traitSets(traitSets);
+  request.u8(static_cast<std::uint8_t>(policyAccess));
+  request.context(context);
+  const Str payload = call(request.payload());
+  Reader reply{payload};
+  trait::TraitsDatas result = reply.traitsDatas();
+  reply.expectEnd();
+  return result;
+}
+
+void OutOfProcessManagerInterface::entityExists(
+    const EntityReferences& entityReferences, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ExistsSuccessCallback& successCallback, const BatchElementErrorCallback& errorCallback) {
+  batch(
+      entityReferences.size(),
+      [&](const std::size_t first, const std::size_t count) {
+        Writer request{Op::kEntityExists};
+        request.entityReferences(entityReferences, first, count);
+        request.context(context);
+        return request.payload();
+      },
+      [&](const std::size_t idx, Reader& reader) { successCallback(idx, reader.u8() != 0); },
+      errorCallback);
+}
+
+void OutOfProcessManagerInterface::entityTraits(
+    const EntityReferences& entityReferences, const access::EntityTraitsAccess entityTraitsAccess,
+    const ContextConstPtr& context, [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const EntityTraitsSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  batch(
+      entityReferences.size(),
+      [&](const std::size_t first, const std::size_t count) {
+        Writer request{Op::kEntityTraits};
+        request.entityReferences(entityReferences, first, count);
+        request.u8(static_cast<std::uint8_t>(entityTraitsAccess));
+        request.context(context);
+        return request.payload();
+      },
+      [&](const std::size_t idx, Reader& reader) { successCallback(idx, reader.traitSet()); },
+      errorCallback);
+}
+
+void OutOfProcessManagerInterface::resolve(
+    const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+    const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const ResolveSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  batch(
+      entityReferences.size(),
+      [&](const std::size_t first, const std::size_t count) {
+        Writer request{Op::kResolve};
+        request.entityReferences(entityReferences, first, count);
+        request.strs(traitSet);
+        request.u8(static_cast<std::uint8_t>(resolveAccess));
+        request.context(context);
+        return request.payload();
+      },
+      [&](const std::size_t idx, Reader& reader) { successCallback(idx, reader.traitsData()); },
+      errorCallback);
+}
+
+void OutOfProcessManagerInterface::preflight(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const PreflightSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (traitsHints.size() != entityReferences.size()) {
+    throw errors::InputValidationException{
+        "Parameter lists must be of the same length: " +
+        std::to_string(entityReferences.size()) + " entity references vs. " +
+        std::to_string(traitsHints.size()) + " traits hints."};
+  }
+  batch(
+      entityReferences.size(),
+      [&](const std::size_t first, const std::size_t count) {
+        Writer request{Op::kPreflight};
+        request.entityReferences(entityReferences, first, count);
+        request.traitsDatas(traitsHints, first, count);
+        request.u8(static_cast<std::uint8_t>(publishingAccess));
+        request.context(context);
+        return request.payload();
+      },
+      [&](const std::size_t idx, Reader& reader) {
+        successCallback(idx, createEntityReference(reader.str()));
+      },
+      errorCallback);
+}
+
+void OutOfProcessManagerInterface::register_(
+    const EntityReferences& entityReferences, const trait::TraitsDatas& entityTraitsDatas,
+    const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+    [[maybe_unused]] const managerApi::HostSessionPtr& hostSession,
+    const RegisterSuccessCallback& successCallback,
+    const BatchElementErrorCallback& errorCallback) {
+  if (entityTraitsDatas.size() != entityReferences.size()) {
+    throw errors::InputValidationException{
+        "Parameter lists must be of the same length: " +
+        std::to_string(entityReferences.size()) + " entity references vs. " +
+        std::to_string(entityTraitsDatas.size()) + " traits datas."};
+  }
+  batch(
+      entityReferences.size(),
+      [&](const std::size_t first, const std::size_t count) {
+        Writer request{Op::kRegister};
+        request.entityReferences(entityReferences, first, count);
+        request.traitsDatas(entityTraitsDatas, first, count);
+        request.u8(static_cast<std::uint8_t>(publishingAccess));
+        request.context(context);
+        return request.payload();
+      },
+      [&](const std::size_t idx, Reader& reader) {
+        successCallback(idx, createEntityReference(reader.str()));
+      },
+      errorCallback);
+}
+
+Str OutOfProcessManagerInterface::call(const Str& request) const {
+  const auto lease = pool_->acquire(1);
+  return lease->workers().front()->call(request);
+}
+
+void OutOfProcessManagerInterface::broadcast(const Str& request) const {
+  const auto lease = pool_->acquireAll();
+  for (WorkerProcess* worker : lease->workers()) {
+    worker->call(request);
+  }
+}
+
+void OutOfProcessManagerInterface::batch(const std::size_t size,
+                                         const ChunkEncoder& encodeChunk,
+                                         const ElementDecoder& decodeElement,
+                                         const BatchElementErrorCallback& errorCallback) const {
+  if (size == 0) {
+    return;
+  }
+
+  // Split the batch into contiguous chunks, one per leased worker.
+  const auto lease = pool_->acquire(size);
+  const std::vector<WorkerProcess*>& workers = lease->workers();
+  const std::size_t numChunks = workers.size();
+  std::vector<std::size_t> firsts(numChunks + 1, 0);
+  for (std::size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx) {
+    const std::size_t count = size / numChunks + (chunkIdx < size % numChunks ? 1 : 0);
+    firsts[chunkIdx + 1] = firsts[chunkIdx] + count;
+  }
+
+  // Send all chunks before waiting on any, so workers run in parallel.
+  std::exception_ptr firstError;
+  std::size_t numSent = 0;
+  for (; numSent < numChunks; ++numSent) {
+    try {
+      const std::size_t first = firsts[numSent];
+      workers[numSent]->send(encodeChunk(first, firsts[numSent + 1] - first));
+    } catch (...) {
+      firstError = std::current_exception();
+      break;
+    }
+  }
+
+  // Always drain replies, to keep request/reply streams in sync.
+  std::vector<Str> replies(numSent);
+  for (std::size_t chunkIdx = 0; chunkIdx < numSent; ++chunkIdx) {
+    try {
+      replies[chunkIdx] = workers[chunkIdx]->receive();
+    } catch (...) {
+      if (!firstError) {
+        firstError = std::current_exception();
+      }
+    }
+  }
+
+  // Don't hold workers whilst callbacks run, which may be re-entrant.
+  lease->release();
+  if (firstError) {
+    std::rethrow_exception(firstError);
+  }
+
+  for (std::size_t chunkIdx = 0; chunkIdx < numChunks; ++chunkIdx) {
+    const std::size_t first = firsts[chunkIdx];
+    Reader reply{replies[chunkIdx]};
+    if (reply.u32() != firsts[chunkIdx + 1] - first) {
+      throw errors::OpenAssetIOException{
+          "Unexpected number of results from out-of-process manager worker"};
+    }
+    for (std::size_t idx = first; idx < firsts[chunkIdx + 1]; ++idx) {
+      if (static_cast<Element>(reply.u8()) == Element::kValue) {
+        decodeElement(idx, reply);
+      } else {
+        const auto code = static_cast<errors::BatchElementError::ErrorCode>(reply.u8());
+        errorCallback(idx, errors::BatchElementError{code, reply.str()});
+      }
+    }
+    reply.expectEnd();
+  }
+}
+
+OutOfProcessManagerImplementationFactory::OutOfProcessManagerImplementationFactory(
+    log::LoggerInterfacePtr logger, Str pythonExecutable, const std::size_t numWorkers)
+    : ManagerImplementationFactoryInterface{std::move(logger)},
+      pythonExecutable_{std::move(pythonExecutable)},
+      numWorkers_{numWorkers} {}
+
+Identifiers OutOfProcessManagerImplementationFactory::identifiers() {
+  // Plugin discovery happens in the worker, so spin one up just to ask.
+  WorkerProcess worker{pythonExecutable_, logger()};
+  const Str payload = worker.call(Writer{Op::kIdentifiers}.payload());
+  Reader reply{payload};
+  Identifiers result = reply.identifiers();
+  reply.expectEnd();
+  return result;
+}
+
+managerApi::ManagerInterfacePtr OutOfProcessManagerImplementationFactory::instantiate(
+    const Identifier& identifier) {
+  return std::make_shared<OutOfProcessManagerInterface>(
+      std::make_unique<WorkerPool>(pythonExecutable_, numWorkers_, logger()), identifier);
+}
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
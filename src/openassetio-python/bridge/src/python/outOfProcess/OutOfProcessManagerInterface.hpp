@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <openassetio/export.h>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "WorkerPool.hpp"
+#include "protocol.hpp"
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+/**
+ * Proxy ManagerInterface forwarding calls to a Python manager plugin
+ * hosted in a pool of worker processes.
+ *
+ * Each worker process instantiates its own copy of the manager. Batch
+ * methods are split into contiguous chunks, one per idle worker, which
+ * are processed in parallel. Other methods are serviced by a single
+ * worker, except `initialize` and `flushCaches`, which are broadcast
+ * to all workers. A worker that dies is respawned, and the manager
+ * re-instantiated and re-initialized within it.
+ *
+ * Manager state is local to each worker process, and so cannot be
+ * shared with the host. As such, the `kStatefulContexts` capability is
+ * never advertised, along with capabilities whose methods are not
+ * forwarded.
+ */
+class OutOfProcessManagerInterface final : public managerApi::ManagerInterface {
+ public:
+  OutOfProcessManagerInterface(std::unique_ptr<WorkerPool> pool, const Identifier& identifier);
+
+  [[nodiscard]] Identifier identifier() const override;
+  [[nodiscard]] Str displayName() const override;
+  [[nodiscard]] InfoDictionary info() override;
+  [[nodiscard]] InfoDictionary settings(const managerApi::HostSessionPtr& hostSession) override;
+  void initialize(InfoDictionary managerSettings,
+                  const managerApi::HostSessionPtr& hostSession) override;
+  void flushCaches(const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool hasCapability(Capability capability) override;
+  [[nodiscard]] StrMap updateTerminology(StrMap terms,
+                                         const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] bool isEntityReferenceString(
+      const Str& someString, const managerApi::HostSessionPtr& hostSession) override;
+  [[nodiscard]] trait::TraitsDatas managementPolicy(
+      const trait::TraitSets& traitSets, access::PolicyAccess policyAccess,
+      const ContextConstPtr& context, const managerApi::HostSessionPtr& hostSession) override;
+
+  void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const ExistsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void entityTraits(const EntityReferences& entityReferences,
+                    access::EntityTraitsAccess entityTraitsAccess, const ContextConstPtr& context,
+                    const managerApi::HostSessionPtr& hostSession,
+                    const EntityTraitsSuccessCallback& successCallback,
+                    const BatchElementErrorCallback& errorCallback) override;
+
+  void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
+               access::ResolveAccess resolveAccess, const ContextConstPtr& context,
+               const managerApi::HostSessionPtr& hostSession,
+               const ResolveSuccessCallback& successCallback,
+               const BatchElementErrorCallback& errorCallback) override;
+
+  void preflight(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsHints,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const PreflightSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  void register_(const EntityReferences& entityReferences,
+                 const trait::TraitsDatas& entityTraitsDatas,
+                 access::PublishingAccess publishingAccess, const ContextConstPtr& context,
+                 const managerApi::HostSessionPtr& hostSession,
+                 const RegisterSuccessCallback& successCallback,
+                 const BatchElementErrorCallback& errorCallback) override;
+
+ private:
+  /// Encode the request for a chunk of a batch.
+  using ChunkEncoder = std::function<Str(std::size_t first, std::size_t count)>;
+  /// Decode a successful element of a batch and pass it to a callback.
+  using ElementDecoder = std::function<void(std::size_t idx, Reader& reader)>;
+
+  /// Send a request to a single worker.
+  Str call(const Str& request) const;
+  /// Send a request to all workers.
+  void broadcast(const Str& request) const;
+  /// Split a batch request across idle workers.
+  void batch(std::size_t size, const ChunkEncoder& encodeChunk,
+             const ElementDecoder& decodeElement,
+             const BatchElementErrorCallback& errorCallback) const;
+
+  std::unique_ptr<WorkerPool> pool_;
+};
+
+/**
+ * Factory for managers hosted in out-of-process Python workers.
+ */
+class OutOfProcessManagerImplementationFactory final
+    : public openassetio::hostApi::ManagerImplementationFactoryInterface {
+ public:
+  OutOfProcessManagerImplementationFactory(log::LoggerInterfacePtr logger, Str pythonExecutable,
+                                           std::size_t numWorkers);
+
+  Identifiers identifiers() override;
+  managerApi::ManagerInterfacePtr instantiate(const Identifier& identifier) override;
+
+ private:
+  Str pythonExecutable_;
+  std::size_t numWorkers_;
+};
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
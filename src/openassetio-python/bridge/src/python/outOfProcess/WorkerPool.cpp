@@ -0,0 +1,415 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <openassetio/export.h>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+#include "protocol.hpp"
+
+#ifndef _WIN32
+// NOLINTNEXTLINE(readability-redundant-declaration)
+extern char** environ;
+#endif
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+namespace {
+/// Module run by the worker process.
+constexpr const char* kWorkerModule = "openassetio.pluginSystem._outOfProcessWorker";
+/// File descriptor of the socket in the worker process.
+constexpr int kWorkerSocketFd = 3;
+/// Time allowed for a worker to exit once its socket is closed.
+constexpr std::chrono::milliseconds kExitTimeout{5000};
+/// Time allowed for a worker to exit once sent SIGTERM.
+constexpr std::chrono::milliseconds kTerminateTimeout{1000};
+/// Interval at which to poll for worker exit.
+constexpr std::chrono::milliseconds kExitPollInterval{10};
+
+/**
+ * Throw an exception raised in the worker, mapped to the closest C++
+ * exception type.
+ */
+[[noreturn]] void throwWorkerException(const Str& name, const Str& message) {
+  if (name == "InputValidationException") {
+    throw errors::InputValidationException{message};
+  }
+  if (name == "ConfigurationException") {
+    throw errors::ConfigurationException{message};
+  }
+  if (name == "NotImplementedException") {
+    throw errors::NotImplementedException{message};
+  }
+  throw errors::UnhandledException{name + ": " + message};
+}
+
+#ifndef _WIN32
+/**
+ * Reap a child process, waiting at most @p timeout.
+ *
+ * @return Whether the process has been reaped.
+ */
+bool reapWithin(const pid_t pid, const std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (true) {
+    int status = 0;
+    const pid_t result = waitpid(pid, &status, WNOHANG);
+    if (result == pid || (result == -1 && errno != EINTR)) {
+      return true;
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(kExitPollInterval);
+  }
+}
+
+/// Set the close-on-exec flag, so siblings don't inherit the socket.
+void setCloseOnExec(const int fd) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const int flags = fcntl(fd, F_GETFD);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-signed-bitwise)
+  if (flags == -1 || fcntl(fd, F_SETFD, flags | FD_CLOEXEC) == -1) {
+    throw errors::OpenAssetIOException{"Failed to configure out-of-process manager socket"};
+  }
+}
+#endif
+}  // namespace
+
+#ifdef _WIN32
+
+WorkerProcess::WorkerProcess([[maybe_unused]] const Str& pythonExecutable,
+                             log::LoggerInterfacePtr logger)
+    : logger_{std::move(logger)} {
+  throw errors::NotImplementedException{
+      "Out-of-process Python managers are not supported on this platform"};
+}
+
+WorkerProcess::~WorkerProcess() = default;
+
+void WorkerProcess::writeAll([[maybe_unused]] const char* data,
+                             [[maybe_unused]] const std::size_t size) {
+  fail();
+}
+
+void WorkerProcess::readAll([[maybe_unused]] char* data, [[maybe_unused]] const std::size_t size) {
+  fail();
+}
+
+#else
+
+WorkerProcess::WorkerProcess(const Str& pythonExecutable, log::LoggerInterfacePtr logger)
+    : logger_{std::move(logger)} {
+  std::array<int, 2> sockets{};
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets.data()) == -1) {
+    throw errors::OpenAssetIOException{"Failed to create out-of-process manager socket"};
+  }
+  socket_ = sockets[0];
+  int workerSocket = sockets[1];
+
+  try {
+    setCloseOnExec(socket_);
+    setCloseOnExec(workerSocket);
+    // dup2 onto the same descriptor would not clear close-on-exec.
+    if (workerSocket == kWorkerSocketFd) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+      workerSocket = fcntl(sockets[1], F_DUPFD_CLOEXEC, kWorkerSocketFd + 1);
+      close(sockets[1]);
+      if (workerSocket == -1) {
+        throw errors::OpenAssetIOException{"Failed to configure out-of-process manager socket"};
+      }
+    }
+#ifdef SO_NOSIGPIPE
+    // No MSG_NOSIGNAL on macOS.
+    const int enable = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+#endif
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, workerSocket, kWorkerSocketFd);
+
+    Str module{kWorkerModule};
+    Str executable = pythonExecutable;
+    Str moduleFlag{"-m"};
+    Str fdArg = std::to_string(kWorkerSocketFd);
+    std::array<char*, 5> argv{executable.data(), moduleFlag.data(), module.data(), fdArg.data(),
+                              nullptr};
+
+    pid_t pid = -1;
+    const int spawnResult = posix_spawnp(&pid, executable.c_str(), &actions, nullptr,
+                                         argv.data(), environ);
+    posix_spawn_file_actions_destroy(&actions);
+    close(workerSocket);
+
+    if (spawnResult != 0) {
+      throw errors::ConfigurationException{"Failed to launch out-of-process manager worker '" +
+                                           pythonExecutable + "'"};
+    }
+    pid_ = static_cast<int>(pid);
+  } catch (...) {
+    close(socket_);
+    throw;
+  }
+}
+
+WorkerProcess::~WorkerProcess() {
+  if (socket_ != -1) {
+    // Worker exits when it sees the end of the stream.
+    close(socket_);
+  }
+  if (pid_ == -1) {
+    return;
+  }
+  const auto pid = static_cast<pid_t>(pid_);
+  if (reapWithin(pid, kExitTimeout)) {
+    return;
+  }
+  // Worker is hung, e.g. in a manager call that never returns.
+  kill(pid, SIGTERM);
+  if (reapWithin(pid, kTerminateTimeout)) {
+    return;
+  }
+  kill(pid, SIGKILL);
+  int status = 0;
+  while (waitpid(pid, &status, 0) == -1 && errno == EINTR) {
+  }
+}
+
+void WorkerProcess::writeAll(const char* data, std::size_t size) {
+  if (socket_ == -1) {
+    fail();
+  }
+#ifdef MSG_NOSIGNAL
+  constexpr int kFlags = MSG_NOSIGNAL;
+#else
+  constexpr int kFlags = 0;
+#endif
+  while (size > 0) {
+    const ssize_t written = ::send(socket_, data, size, kFlags);
+    if (written == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      fail();
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data += written;
+    size -= static_cast<std::size_t>(written);
+  }
+}
+
+void WorkerProcess::readAll(char* data, std::size_t size) {
+  if (socket_ == -1) {
+    fail();
+  }
+  while (size > 0) {
+    const ssize_t numRead = ::recv(socket_, data, size, 0);
+    if (numRead == -1 && errno == EINTR) {
+      continue;
+    }
+    if (numRead <= 0) {
+      fail();
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data += numRead;
+    size -= static_cast<std::size_t>(numRead);
+  }
+}
+
+#endif
+
+void WorkerProcess::fail() {
+  // The stream is in an unknown state, so the worker can't be reused.
+#ifndef _WIN32
+  if (socket_ != -1) {
+    close(socket_);
+    socket_ = -1;
+  }
+#endif
+  throw errors::OpenAssetIOException{"Out-of-process manager worker has terminated"};
+}
+
+void WorkerProcess::send(const Str& request) {
+  if (request.size() > UINT32_MAX) {
+    throw errors::InputValidationException{"Request too large for out-of-process transport"};
+  }
+  const auto size = static_cast<std::uint32_t>(request.size());
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  writeAll(reinterpret_cast<const char*>(&size), sizeof(size));
+  writeAll(request.data(), request.size());
+}
+
+Str WorkerProcess::receive() {
+  while (true) {
+    std::uint32_t size = 0;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    readAll(reinterpret_cast<char*>(&size), sizeof(size));
+    Str frame(size, '\0');
+    readAll(frame.data(), frame.size());
+
+    Reader reader{frame};
+    switch (static_cast<Reply>(reader.u8())) {
+      case Reply::kResult:
+        return frame.substr(1);
+      case Reply::kLog: {
+        const auto severity = static_cast<log::LoggerInterface::Severity>(reader.u8());
+        logger_->log(severity, reader.str());
+        break;
+      }
+      case Reply::kException: {
+        const Str name = reader.str();
+        throwWorkerException(name, reader.str());
+      }
+      default:
+        fail();
+    }
+  }
+}
+
+void WorkerPool::Lease::release() {
+  if (workers_.empty()) {
+    return;
+  }
+  std::vector<WorkerProcess*> idle;
+  idle.reserve(workers_.size());
+  for (WorkerProcess* worker : workers_) {
+    if (!worker->isAlive()) {
+      worker = pool_->respawn(worker);
+    }
+    if (worker) {
+      idle.push_back(worker);
+    }
+  }
+  {
+    const std::lock_guard lock{pool_->mutex_};
+    pool_->idle_.insert(pool_->idle_.end(), idle.begin(), idle.end());
+  }
+  workers_.clear();
+  pool_->idleChanged_.notify_all();
+}
+
+WorkerPool::WorkerPool(const Str& pythonExecutable, const std::size_t numWorkers,
+                       const log::LoggerInterfacePtr& logger)
+    : pythonExecutable_{pythonExecutable}, logger_{logger} {
+  workers_.reserve(numWorkers);
+  for (std::size_t idx = 0; idx < std::max<std::size_t>(numWorkers, 1); ++idx) {
+    workers_.push_back(std::make_unique<WorkerProcess>(pythonExecutable, logger));
+    idle_.push_back(workers_.back().get());
+  }
+}
+
+std::size_t WorkerPool::size() const {
+  const std::lock_guard lock{mutex_};
+  return workers_.size();
+}
+
+std::unique_ptr<WorkerPool::Lease> WorkerPool::acquire(const std::size_t maxCount) {
+  std::unique_lock lock{mutex_};
+  idleChanged_.wait(lock, [this] { return !idle_.empty() || workers_.empty(); });
+  if (workers_.empty()) {
+    throw errors::OpenAssetIOException{"All out-of-process manager workers have terminated"};
+  }
+  const std::size_t count = std::clamp<std::size_t>(maxCount, 1, idle_.size());
+  std::vector<WorkerProcess*> workers(idle_.end() - static_cast<std::ptrdiff_t>(count),
+                                      idle_.end());
+  idle_.resize(idle_.size() - count);
+  return std::make_unique<Lease>(this, std::move(workers));
+}
+
+std::unique_ptr<WorkerPool::Lease> WorkerPool::acquireAll() {
+  std::unique_lock lock{mutex_};
+  idleChanged_.wait(lock, [this] { return idle_.size() == workers_.size(); });
+  if (workers_.empty()) {
+    throw errors::OpenAssetIOException{"All out-of-process manager workers have terminated"};
+  }
+  std::vector<WorkerProcess*> workers;
+  workers.swap(idle_);
+  return std::make_unique<Lease>(this, std::move(workers));
+}
+
+void WorkerPool::broadcastSetup(const Str& request) {
+  {
+    const auto lease = acquireAll();
+    for (WorkerProcess* worker : lease->workers()) {
+      worker->call(request);
+    }
+  }
+  const std::lock_guard lock{mutex_};
+  // Replace any previous request with the same opcode.
+  const auto existing =
+      std::find_if(setupRequests_.begin(), setupRequests_.end(),
+                   [&request](const Str& setupRequest) { return setupRequest[0] == request[0]; });
+  if (existing != setupRequests_.end()) {
+    *existing = request;
+  } else {
+    setupRequests_.push_back(request);
+  }
+}
+
+WorkerProcess* WorkerPool::respawn(WorkerProcess* deadWorker) {
+  std::vector<Str> setupRequests;
+  {
+    const std::lock_guard lock{mutex_};
+    setupRequests = setupRequests_;
+  }
+
+  std::unique_ptr<WorkerProcess> replacement;
+  try {
+    replacement = std::make_unique<WorkerProcess>(pythonExecutable_, logger_);
+    for (const Str& request : setupRequests) {
+      replacement->call(request);
+    }
+  } catch (const std::exception& exc) {
+    logger_->error(Str{"Failed to restart out-of-process manager worker: "} + exc.what());
+    replacement.reset();
+  }
+
+  WorkerProcess* result = replacement.get();
+  std::unique_ptr<WorkerProcess> dead;
+  {
+    const std::lock_guard lock{mutex_};
+    const auto slot =
+        std::find_if(workers_.begin(), workers_.end(),
+                     [deadWorker](const auto& worker) { return worker.get() == deadWorker; });
+    dead = std::move(*slot);
+    if (replacement) {
+      *slot = std::move(replacement);
+    } else {
+      workers_.erase(slot);
+    }
+  }
+  // Reap the dead process outside the lock, since it may take a while.
+  dead.reset();
+  return result;
+}
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <openassetio/export.h>
+#include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+/**
+ * A Python worker process, connected via a Unix domain socket.
+ *
+ * The process is spawned on construction, and exits once the socket is
+ * closed on destruction. If it does not exit promptly, it is
+ * terminated, so that a hung worker cannot hang the host.
+ *
+ * A worker services a single request at a time. It is not thread safe,
+ * see WorkerPool.
+ */
+class WorkerProcess {
+ public:
+  /**
+   * Spawn a worker process.
+   *
+   * @param pythonExecutable Python interpreter to run the worker
+   * module. Resolved using `PATH` if not an absolute path.
+   * @param logger Logger to forward worker log messages to.
+   */
+  WorkerProcess(const Str& pythonExecutable, log::LoggerInterfacePtr logger);
+  ~WorkerProcess();
+
+  WorkerProcess(const WorkerProcess&) = delete;
+  WorkerProcess(WorkerProcess&&) = delete;
+  WorkerProcess& operator=(const WorkerProcess&) = delete;
+  WorkerProcess& operator=(WorkerProcess&&) = delete;
+
+  /// Send a request payload.
+  void send(const Str& request);
+
+  /**
+   * Receive the reply to the last request.
+   *
+   * Log messages from the worker are forwarded to the logger.
+   *
+   * @return Result payload.
+   * @throws errors::OpenAssetIOException (or subclass) if the worker
+   * raised an exception, or has terminated.
+   */
+  Str receive();
+
+  /// Send a request and receive the reply.
+  Str call(const Str& request) {
+    send(request);
+    return receive();
+  }
+
+  /**
+   * Whether the worker can service further requests.
+   *
+   * False once communication with the worker has failed, e.g. because
+   * the process has crashed.
+   */
+  [[nodiscard]] bool isAlive() const { return socket_ != -1; }
+
+ private:
+  void writeAll(const char* data, std::size_t size);
+  void readAll(char* data, std::size_t size);
+  [[noreturn]] void fail();
+
+  log::LoggerInterfacePtr logger_;
+  int socket_ = -1;
+  int pid_ = -1;
+};
+
+/**
+ * Fixed-size pool of worker processes, shared between threads.
+ *
+ * Workers that have died are replaced with a new process when they are
+ * returned to the pool, and brought up to date by replaying the
+ * requests previously sent via @ref broadcastSetup. If a replacement
+ * cannot be started, the pool shrinks instead.
+ */
+class WorkerPool {
+ public:
+  /**
+   * Workers leased from the pool, returned to the pool on destruction.
+   */
+  class Lease {
+   public:
+    Lease(WorkerPool* pool, std::vector<WorkerProcess*> workers)
+        : pool_{pool}, workers_{std::move(workers)} {}
+    ~Lease() { release(); }
+
+    Lease(const Lease&) = delete;
+    Lease(Lease&&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+
+    [[nodiscard]] const std::vector<WorkerProcess*>& workers() const { return workers_; }
+
+    /// Return the workers to the pool early, replacing dead workers.
+    void release();
+
+   private:
+    WorkerPool* pool_;
+    std::vector<WorkerProcess*> workers_;
+  };
+
+  WorkerPool(const Str& pythonExecutable, std::size_t numWorkers,
+             const log::LoggerInterfacePtr& logger);
+
+  [[nodiscard]] std::size_t size() const;
+
+  /**
+   * Lease up to @p maxCount idle workers, waiting until at least one
+   * is available.
+   *
+   * @throws errors::OpenAssetIOException if no workers remain.
+   */
+  std::unique_ptr<Lease> acquire(std::size_t maxCount);
+
+  /**
+   * Lease all workers, waiting until they are all idle.
+   *
+   * @throws errors::OpenAssetIOException if no workers remain.
+   */
+  std::unique_ptr<Lease> acquireAll();
+
+  /**
+   * Send a request to all workers, and replay it to any workers that
+   * are subsequently respawned.
+   *
+   * Only the most recent request for each opcode is replayed.
+   */
+  void broadcastSetup(const Str& request);
+
+ private:
+  /// Replace a dead worker, returning the replacement, or null.
+  WorkerProcess* respawn(WorkerProcess* deadWorker);
+
+  Str pythonExecutable_;
+  log::LoggerInterfacePtr logger_;
+  std::vector<Str> setupRequests_;
+  std::vector<std::unique_ptr<WorkerProcess>> workers_;
+  std::vector<WorkerProcess*> idle_;
+  mutable std::mutex mutex_;
+  std::condition_variable idleChanged_;
+};
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
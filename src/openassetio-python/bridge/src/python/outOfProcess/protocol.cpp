@@ -0,0 +1,277 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "protocol.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+namespace {
+/// Tags for dictionary and trait property values.
+enum class ValueType : std::uint8_t { kBool, kInt, kFloat, kStr };
+
+static_assert(std::is_same_v<InfoDictionaryValue, trait::property::Value>,
+              "Dictionary and trait property values must share an encoding");
+
+/**
+ * Append the native byte representation of a trivial value.
+ */
+template <class T>
+void appendRaw(Str& payload, const T value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  const auto oldSize = payload.size();
+  payload.resize(oldSize + sizeof(T));
+  std::memcpy(payload.data() + oldSize, &value, sizeof(T));
+}
+
+std::uint32_t checkedSize(const std::size_t size) {
+  if (size > std::numeric_limits<std::uint32_t>::max()) {
+    throw errors::InputValidationException{"Value too large for out-of-process transport"};
+  }
+  return static_cast<std::uint32_t>(size);
+}
+
+[[noreturn]] void throwMalformed() {
+  throw errors::OpenAssetIOException{"Malformed message from out-of-process manager worker"};
+}
+}  // namespace
+
+Writer::Writer(const Op opcode) { u8(static_cast<std::uint8_t>(opcode)); }
+
+void Writer::u8(const std::uint8_t value) { appendRaw(payload_, value); }
+
+void Writer::u32(const std::uint32_t value) { appendRaw(payload_, value); }
+
+void Writer::str(const std::string_view value) {
+  u32(checkedSize(value.size()));
+  payload_.append(value);
+}
+
+void Writer::strs(const trait::TraitSet& values) {
+  u32(checkedSize(values.size()));
+  for (const auto& value : values) {
+    str(value);
+  }
+}
+
+void Writer::value(const InfoDictionaryValue& value) {
+  std::visit(
+      [this](const auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<T, Bool>) {
+          u8(static_cast<std::uint8_t>(ValueType::kBool));
+          u8(static_cast<std::uint8_t>(typedValue));
+        } else if constexpr (std::is_same_v<T, Int>) {
+          u8(static_cast<std::uint8_t>(ValueType::kInt));
+          appendRaw(payload_, typedValue);
+        } else if constexpr (std::is_same_v<T, Float>) {
+          u8(static_cast<std::uint8_t>(ValueType::kFloat));
+          appendRaw(payload_, typedValue);
+        } else {
+          u8(static_cast<std::uint8_t>(ValueType::kStr));
+          str(typedValue);
+        }
+      },
+      value);
+}
+
+void Writer::dictionary(const InfoDictionary& values) {
+  u32(checkedSize(values.size()));
+  for (const auto& [key, value] : values) {
+    str(key);
+    this->value(value);
+  }
+}
+
+void Writer::strMap(const StrMap& values) {
+  u32(checkedSize(values.size()));
+  for (const auto& [key, value] : values) {
+    str(key);
+    str(value);
+  }
+}
+
+void Writer::traitsData(const trait::TraitsDataConstPtr& traitsData) {
+  if (!traitsData) {
+    u32(0);
+    return;
+  }
+  const trait::TraitSet traitSet = traitsData->traitSet();
+  u32(checkedSize(traitSet.size()));
+  for (const trait::TraitId& traitId : traitSet) {
+    str(traitId);
+    const trait::property::KeySet keys = traitsData->traitPropertyKeys(traitId);
+    u32(checkedSize(keys.size()));
+    for (const trait::property::Key& key : keys) {
+      str(key);
+      trait::property::Value propertyValue;
+      traitsData->getTraitProperty(&propertyValue, traitId, key);
+      value(propertyValue);
+    }
+  }
+}
+
+void Writer::traitsDatas(const trait::TraitsDatas& traitsDatas, const std::size_t first,
+                         const std::size_t count) {
+  u32(checkedSize(count));
+  for (std::size_t idx = first; idx < first + count; ++idx) {
+    traitsData(traitsDatas[idx]);
+  }
+}
+
+void Writer::traitSets(const trait::TraitSets& traitSets) {
+  u32(checkedSize(traitSets.size()));
+  for (const trait::TraitSet& traitSet : traitSets) {
+    strs(traitSet);
+  }
+}
+
+void Writer::entityReferences(const EntityReferences& entityReferences, const std::size_t first,
+                              const std::size_t count) {
+  u32(checkedSize(count));
+  for (std::size_t idx = first; idx < first + count; ++idx) {
+    str(entityReferences[idx].toString());
+  }
+}
+
+void Writer::context(const ContextConstPtr& context) {
+  // Manager state is opaque and local to the worker, so is not sent.
+  traitsData(context ? context->locale : nullptr);
+}
+
+std::string_view Reader::take(const std::size_t size) {
+  if (size > payload_.size()) {
+    throwMalformed();
+  }
+  const std::string_view bytes = payload_.substr(0, size);
+  payload_.remove_prefix(size);
+  return bytes;
+}
+
+std::uint8_t Reader::u8() {
+  std::uint8_t value = 0;
+  std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+  return value;
+}
+
+std::uint32_t Reader::u32() {
+  std::uint32_t value = 0;
+  std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+  return value;
+}
+
+Str Reader::str() { return Str{take(u32())}; }
+
+Identifiers Reader::identifiers() {
+  const std::uint32_t count = u32();
+  Identifiers values;
+  // Guard against a corrupt count causing a huge allocation.
+  values.reserve(std::min<std::size_t>(count, payload_.size()));
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    values.push_back(str());
+  }
+  return values;
+}
+
+trait::TraitSet Reader::traitSet() {
+  const std::uint32_t count = u32();
+  trait::TraitSet values;
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    values.insert(str());
+  }
+  return values;
+}
+
+InfoDictionaryValue Reader::value() {
+  switch (static_cast<ValueType>(u8())) {
+    case ValueType::kBool:
+      return Bool{u8() != 0};
+    case ValueType::kInt: {
+      Int value = 0;
+      std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+      return value;
+    }
+    case ValueType::kFloat: {
+      Float value = 0;
+      std::memcpy(&value, take(sizeof(value)).data(), sizeof(value));
+      return value;
+    }
+    case ValueType::kStr:
+      return str();
+  }
+  throwMalformed();
+}
+
+InfoDictionary Reader::dictionary() {
+  const std::uint32_t count = u32();
+  InfoDictionary values;
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    Str key = str();
+    values.insert_or_assign(std::move(key), value());
+  }
+  return values;
+}
+
+StrMap Reader::strMap() {
+  const std::uint32_t count = u32();
+  StrMap values;
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    Str key = str();
+    values.insert_or_assign(std::move(key), str());
+  }
+  return values;
+}
+
+trait::TraitsDataPtr Reader::traitsData() {
+  auto traitsData = trait::TraitsData::make();
+  const std::uint32_t numTraits = u32();
+  for (std::uint32_t traitIdx = 0; traitIdx < numTraits; ++traitIdx) {
+    const trait::TraitId traitId = str();
+    traitsData->addTrait(traitId);
+    const std::uint32_t numProperties = u32();
+    for (std::uint32_t propertyIdx = 0; propertyIdx < numProperties; ++propertyIdx) {
+      const trait::property::Key key = str();
+      traitsData->setTraitProperty(traitId, key, value());
+    }
+  }
+  return traitsData;
+}
+
+trait::TraitsDatas Reader::traitsDatas() {
+  const std::uint32_t count = u32();
+  trait::TraitsDatas values;
+  // Guard against a corrupt count causing a huge allocation.
+  values.reserve(std::min<std::size_t>(count, payload_.size()));
+  for (std::uint32_t idx = 0; idx < count; ++idx) {
+    values.push_back(traitsData());
+  }
+  return values;
+}
+
+void Reader::expectEnd() const {
+  if (!payload_.empty()) {
+    throwMalformed();
+  }
+}
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
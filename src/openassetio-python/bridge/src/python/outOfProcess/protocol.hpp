@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+/**
+ * Wire protocol for communicating with out-of-process Python manager
+ * workers.
+ *
+ * Must be kept in sync with the Python implementation in
+ * `openassetio.pluginSystem._outOfProcessWorker`, where the protocol is
+ * documented.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/Context.hpp>
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace python::hostApi::outOfProcess {
+
+/// Request opcodes.
+enum class Op : std::uint8_t {
+  kIdentifiers,
+  kInstantiate,
+  kIdentifier,
+  kDisplayName,
+  kInfo,
+  kSettings,
+  kInitialize,
+  kFlushCaches,
+  kHasCapability,
+  kUpdateTerminology,
+  kIsEntityReferenceString,
+  kManagementPolicy,
+  kEntityExists,
+  kEntityTraits,
+  kResolve,
+  kPreflight,
+  kRegister
+};
+
+/// Kinds of reply frame.
+enum class Reply : std::uint8_t { kResult, kLog, kException };
+
+/// Tags for elements of batch results.
+enum class Element : std::uint8_t { kValue, kError };
+
+/**
+ * Encoder for request payloads.
+ */
+class Writer {
+ public:
+  explicit Writer(Op opcode);
+
+  void u8(std::uint8_t value);
+  void u32(std::uint32_t value);
+  void str(std::string_view value);
+  void strs(const trait::TraitSet& values);
+  void dictionary(const InfoDictionary& values);
+  void strMap(const StrMap& values);
+  void traitsData(const trait::TraitsDataConstPtr& traitsData);
+  void traitsDatas(const trait::TraitsDatas& traitsDatas, std::size_t first, std::size_t count);
+  void traitSets(const trait::TraitSets& traitSets);
+  void entityReferences(const EntityReferences& entityReferences, std::size_t first,
+                        std::size_t count);
+  void context(const ContextConstPtr& context);
+
+  [[nodiscard]] const Str& payload() const { return payload_; }
+
+ private:
+  void value(const InfoDictionaryValue& value);
+
+  Str payload_;
+};
+
+/**
+ * Decoder for reply payloads.
+ *
+ * Throws if the payload is malformed.
+ */
+class Reader {
+ public:
+  explicit Reader(std::string_view payload) : payload_{payload} {}
+
+  std::uint8_t u8();
+  std::uint32_t u32();
+  Str str();
+  Identifiers identifiers();
+  trait::TraitSet traitSet();
+  InfoDictionary dictionary();
+  StrMap strMap();
+  trait::TraitsDataPtr traitsData();
+  trait::TraitsDatas traitsDatas();
+
+  /// Throw if there is unconsumed data.
+  void expectEnd() const;
+
+ private:
+  std::string_view take(std::size_t size);
+  InfoDictionaryValue value();
+
+  std::string_view payload_;
+};
+}  // namespace python::hostApi::outOfProcess
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
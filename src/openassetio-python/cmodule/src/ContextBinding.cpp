@@ -1,11 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <chrono>
+#include <optional>
 #include <sstream>
+#include <tuple>
 #include <utility>
 
+#include <pybind11/chrono.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/CancellationToken.hpp>
 #include <openassetio/Context.hpp>
 #include <openassetio/managerApi/ManagerStateBase.hpp>
 #include <openassetio/trait/TraitsData.hpp>
@@ -19,6 +24,7 @@ void registerContext(const py::module& mod) {
   using openassetio::ContextPtr;
   using openassetio::managerApi::ManagerStateBasePtr;
   using openassetio::trait::TraitsData;
+  using openassetio::trait::TraitsDataPtr;
   using PyRetainingTraitsDataPtr = openassetio::PyRetainingSharedPtr<TraitsData>;
   using PyRetainingManagerStateBasePtr =
       openassetio::PyRetainingSharedPtr<openassetio::managerApi::ManagerStateBase>;
@@ -48,5 +54,55 @@ void registerContext(const py::module& mod) {
           "managerState", [](const Context& self) { return self.managerState; },
           [](Context& self, PyRetainingManagerStateBasePtr managerState) {
             self.managerState = std::move(managerState);
-          });
+          })
+      .def_readwrite("cancellationToken", &Context::cancellationToken)
+      // The deadline is a point on a monotonic clock, which is not
+      // meaningful to Python, so expose it relative to now.
+      .def(
+          "setTimeout",
+          [](Context& self, const std::optional<py::object>& timeout) {
+            if (!timeout) {
+              self.deadline.reset();
+              return;
+            }
+            // Convert via the total seconds, since pybind11's
+            // `timedelta` conversion overflows for very large values
+            // (e.g. `timedelta.max`).
+            const std::chrono::duration<double> seconds{
+                timeout->attr("total_seconds")().cast<double>()};
+            if (seconds >= Context::Clock::duration::max()) {
+              self.setTimeout(Context::Clock::duration::max());
+            } else if (seconds <= Context::Clock::duration::zero()) {
+              self.setTimeout(Context::Clock::duration::zero());
+            } else {
+              self.setTimeout(std::chrono::duration_cast<Context::Clock::duration>(seconds));
+            }
+          },
+          py::arg("timeout"))
+      .def("remainingTime", &Context::remainingTime)
+      .def("isExpired", &Context::isExpired)
+      // Manager state is opaque to us, so only the locale is pickled.
+      // Managers provide persistence tokens for transferring state.
+      // Deadlines and cancellation tokens are bound to this process.
+      .def(py::pickle(
+          [](const Context& self) {
+            if (self.managerState) {
+              throw py::type_error{
+                  "Cannot pickle a Context with a managerState, use "
+                  "Manager.persistenceTokenForState instead"};
+            }
+            if (self.deadline || self.cancellationToken) {
+              throw py::type_error{
+                  "Cannot pickle a Context with a deadline or cancellationToken, since they "
+                  "are local to this process"};
+            }
+            return py::make_tuple(self.locale);
+          },
+          [](const std::tuple<TraitsDataPtr>& state) {
+            TraitsDataPtr locale = std::get<0>(state);
+            if (!locale) {
+              locale = TraitsData::make();
+            }
+            return Context::make(std::move(locale), ManagerStateBasePtr{});
+          }));
 }
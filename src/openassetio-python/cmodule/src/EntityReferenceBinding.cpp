@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <sstream>
+#include <tuple>
 
 #include <fmt/core.h>
 
@@ -35,5 +36,9 @@ void registerEntityReference(const py::module& mod) {
       .def(py::self < py::self)   // NOLINT(misc-redundant-expression)
       .def(py::self <= py::self)  // NOLINT(misc-redundant-expression)
       .def("__hash__",
-           [](const EntityReference& self) { return std::hash<EntityReference>{}(self); });
+           [](const EntityReference& self) { return std::hash<EntityReference>{}(self); })
+      .def(py::pickle([](const EntityReference& self) { return py::make_tuple(self.toString()); },
+                      [](const std::tuple<openassetio::Str>& state) {
+                        return EntityReference{std::get<0>(state)};
+                      }));
 }
@@ -0,0 +1,233 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines PyOverrideCache, a per-instance cache of Python override
+ * resolution for use in pybind11 trampoline classes.
+ */
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <typeinfo>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Cache of Python override resolution for the virtual methods of a
+ * single trampoline instance.
+ *
+ * `pybind11::get_override` acquires the GIL and looks up the method
+ * by name on every call, even for methods that the Python subclass
+ * does not override. For frequently called methods this overhead can
+ * dominate.
+ *
+ * Each overridable method is assigned a slot. The first call through a
+ * slot resolves the override and caches the result:
+ *
+ * - If the method is not overridden, subsequent calls can skip the GIL
+ *   entirely and go straight to the C++ base class implementation.
+ * - If the method is overridden by a plain Python method, the
+ *   underlying function is cached, and is bound to the instance on
+ *   each call, skipping the attribute lookup.
+ * - Otherwise (e.g. a callable instance attribute), we fall back to
+ *   `pybind11::get_override` on each call.
+ *
+ * As a consequence, methods added to or replaced on the Python class
+ * (or instance) after they are first called from C++ are not observed.
+ *
+ * The GIL does not serialise first use in free-threaded Python builds,
+ * so concurrent first calls through a slot may each resolve the
+ * override. Only one thread publishes its result to the cache, the
+ * others use their own result for that call.
+ *
+ * `pybind11::get_override` inspects the calling Python frame to detect
+ * an override delegating to its base class (i.e. `super()`), which
+ * would otherwise recurse back into the override. We instead record
+ * which cached overrides are currently executing on this thread (see
+ * @ref markActive), and treat a re-entrant call through the same slot
+ * of the same instance as a call to the base class.
+ *
+ * @tparam Base C++ base class of the trampoline.
+ * @tparam kNumSlots Number of overridable methods.
+ */
+template <class Base, std::size_t kNumSlots>
+class PyOverrideCache {
+  /// Resolution state of a slot.
+  enum class State : std::uint8_t {
+    kUnresolved,
+    kResolving,
+    kNotOverridden,
+    kOverridden,
+    kUncacheable
+  };
+
+ public:
+  /**
+   * RAII marker that the override in a slot is executing on the
+   * current thread.
+   */
+  class [[nodiscard]] ActiveOverride {
+   public:
+    ActiveOverride(const Base* self, const std::size_t slot)
+        : self_{self}, slot_{slot}, outer_{innermost()} {
+      innermost() = this;
+    }
+    ~ActiveOverride() { innermost() = outer_; }
+
+    ActiveOverride(const ActiveOverride&) = delete;
+    ActiveOverride(ActiveOverride&&) = delete;
+    ActiveOverride& operator=(const ActiveOverride&) = delete;
+    ActiveOverride& operator=(ActiveOverride&&) = delete;
+
+    /// Whether the given slot is executing on the current thread.
+    [[nodiscard]] static bool isActive(const Base* self, const std::size_t slot) {
+      for (const ActiveOverride* active = innermost(); active != nullptr;
+           active = active->outer_) {
+        if (active->self_ == self && active->slot_ == slot) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+   private:
+    static const ActiveOverride*& innermost() {
+      thread_local const ActiveOverride* active = nullptr;
+      return active;
+    }
+
+    const Base* self_;
+    std::size_t slot_;
+    const ActiveOverride* outer_;
+  };
+
+  PyOverrideCache() = default;
+  PyOverrideCache(const PyOverrideCache&) = delete;
+  PyOverrideCache(PyOverrideCache&&) = delete;
+  PyOverrideCache& operator=(const PyOverrideCache&) = delete;
+  PyOverrideCache& operator=(PyOverrideCache&&) = delete;
+
+  ~PyOverrideCache() {
+    if (std::none_of(functions_.begin(), functions_.end(), [](const pybind11::object& function) {
+          return static_cast<bool>(function);
+        })) {
+      return;
+    }
+    if (!Py_IsInitialized()) {
+      // Interpreter has gone, nothing we can safely do.
+      for (pybind11::object& function : functions_) {
+        function.release();
+      }
+      return;
+    }
+    // The last reference to the C++ instance may be dropped in C++,
+    // without the GIL held.
+    const pybind11::gil_scoped_acquire gil{};
+    for (pybind11::object& function : functions_) {
+      function = pybind11::object{};
+    }
+  }
+
+  /**
+   * Check whether the method in a slot is known not to be overridden.
+   *
+   * The GIL need not be held.
+   */
+  [[nodiscard]] bool isNotOverridden(const std::size_t slot) const noexcept {
+    return states_[slot].load(std::memory_order_acquire) == State::kNotOverridden;
+  }
+
+  /**
+   * Get the Python override of the method in a slot, resolving and
+   * caching it on first use.
+   *
+   * The GIL must be held.
+   *
+   * @param self Trampoline instance.
+   * @param slot Slot of the method.
+   * @param name Name of the method in Python.
+   * @return Override bound to the Python instance, or a null function
+   * if the base class implementation should be used.
+   */
+  pybind11::function get(const Base* self, const std::size_t slot, const char* name) {
+    const pybind11::handle pySelf = pybind11::detail::get_object_handle(
+        self, pybind11::detail::get_type_info(typeid(Base)));
+    if (!pySelf) {
+      return {};
+    }
+
+    State state = states_[slot].load(std::memory_order_acquire);
+    pybind11::object function;
+    if (state == State::kUnresolved || state == State::kResolving) {
+      state = resolve(pySelf, slot, name, function);
+    } else if (state == State::kOverridden) {
+      function = functions_[slot];
+    }
+
+    switch (state) {
+      case State::kOverridden:
+        break;
+      case State::kUncacheable:
+        return pybind11::get_override(self, name);
+      default:
+        return {};
+    }
+
+    if (ActiveOverride::isActive(self, slot)) {
+      return {};
+    }
+    PyObject* bound = PyMethod_New(function.ptr(), pySelf.ptr());
+    if (bound == nullptr) {
+      throw pybind11::error_already_set{};
+    }
+    return pybind11::reinterpret_steal<pybind11::function>(bound);
+  }
+
+  /**
+   * Mark the override in a slot as executing on the current thread,
+   * for the lifetime of the returned object.
+   */
+  static ActiveOverride markActive(const Base* self, const std::size_t slot) {
+    return {self, slot};
+  }
+
+ private:
+  /**
+   * Resolve the override in a slot, and publish it to the cache if no
+   * other thread is doing so.
+   *
+   * @param[out] function Unbound override function, if overridden.
+   */
+  State resolve(const pybind11::handle pySelf, const std::size_t slot, const char* name,
+                pybind11::object& function) {
+    const pybind11::function attr = pybind11::getattr(pySelf, name, pybind11::function());
+
+    State state = State::kUncacheable;
+    if (!attr || attr.is_cpp_function()) {
+      state = State::kNotOverridden;
+    } else if (PyMethod_Check(attr.ptr()) && PyMethod_GET_SELF(attr.ptr()) == pySelf.ptr()) {
+      function = pybind11::reinterpret_borrow<pybind11::object>(PyMethod_GET_FUNCTION(attr.ptr()));
+      state = State::kOverridden;
+    }
+
+    State expected = State::kUnresolved;
+    if (states_[slot].compare_exchange_strong(expected, State::kResolving,
+                                              std::memory_order_acq_rel)) {
+      functions_[slot] = function;
+      states_[slot].store(state, std::memory_order_release);
+    }
+    return state;
+  }
+
+  std::array<std::atomic<State>, kNumSlots> states_{};
+  /// Unbound override functions, to avoid a reference cycle via self.
+  std::array<pybind11::object, kNumSlots> functions_;
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
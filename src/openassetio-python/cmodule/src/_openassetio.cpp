@@ -15,6 +15,16 @@ extern void registerTestUtils(py::module& mod);
 PYBIND11_MODULE(_openassetio, mod) {
   namespace py = pybind11;
 
+#ifdef Py_GIL_DISABLED
+  // Declare that this module is safe to use without the GIL, otherwise
+  // free-threaded Python will re-enable the GIL on import. Bindings
+  // that touch Python objects attach a thread state (via
+  // `gil_scoped_acquire`) before doing so.
+  if (PyUnstable_Module_SetGIL(mod.ptr(), Py_MOD_GIL_NOT_USED) != 0) {
+    throw py::error_already_set{};
+  }
+#endif
+
   // Note: the `register` functions here should be called in dependency
   // order. E.g. `Manager` depends on `ManagerInterface`, so
   // `registerManagerInterface` should be called first. This is so
@@ -25,20 +35,34 @@ PYBIND11_MODULE(_openassetio, mod) {
   const py::module managerApi = mod.def_submodule("managerApi");
   const py::module hostApi = mod.def_submodule("hostApi");
   const py::module log = mod.def_submodule("log");
+  const py::module exec = mod.def_submodule("exec");
   const py::module constants = mod.def_submodule("constants");
   const py::module errors = mod.def_submodule("errors");
   const py::module trait = mod.def_submodule("trait");
   py::module utils = mod.def_submodule("utils");
   const py::module pluginSystem = mod.def_submodule("pluginSystem");
 
+  // Make submodules importable by their qualified name, which is the
+  // `__module__` of the types they contain. This allows pickle to look
+  // up types by reference.
+  const py::object sysModules = py::module_::import("sys").attr("modules");
+  for (const py::module& submodule :
+       {access, managerApi, hostApi, log, exec, constants, errors, trait, utils, pluginSystem}) {
+    sysModules[submodule.attr("__name__")] = submodule;
+  }
+
   registerVersion(mod);
   registerAccess(access);
   registerConstants(constants);
   registerLoggerInterface(log);
   registerConsoleLogger(log);
   registerSeverityFilter(log);
+  registerAsyncLogger(log);
+  registerExecutorInterface(exec);
+  registerThreadPool(exec);
   registerTraitsData(trait);
   registerManagerStateBase(managerApi);
+  registerCancellationToken(mod);
   registerContext(mod);
   registerBatchElementError(errors);
   registerExceptions(errors);
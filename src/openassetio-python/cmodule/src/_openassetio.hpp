@@ -55,15 +55,27 @@ void registerConstants(const py::module& mod);
 /// Register the LoggerInterface class with Python.
 void registerLoggerInterface(const py::module& mod);
 
+/// Register the ExecutorInterface class with Python.
+void registerExecutorInterface(const py::module& mod);
+
+/// Register the ThreadPool class with Python.
+void registerThreadPool(const py::module& mod);
+
 /// Register the ConsoleLogger class with Python.
 void registerConsoleLogger(const py::module& mod);
 
 /// Register the SeverityFilter class with Python.
 void registerSeverityFilter(const py::module& mod);
 
+/// Register the AsyncLogger class with Python.
+void registerAsyncLogger(const py::module& mod);
+
 /// Register the Context class with Python.
 void registerContext(const py::module& mod);
 
+/// Register the CancellationToken class with Python.
+void registerCancellationToken(const py::module& mod);
+
 /// Register the HostInterface class with Python.
 void registerHostInterface(const py::module& mod);
 
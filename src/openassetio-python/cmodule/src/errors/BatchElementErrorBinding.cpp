@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <sstream>
+#include <tuple>
 
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
@@ -24,7 +25,8 @@ void registerBatchElementError(const py::module& mod) {
       .value("kEntityResolutionError", BatchElementError::ErrorCode::kEntityResolutionError)
       .value("kInvalidPreflightHint", BatchElementError::ErrorCode::kInvalidPreflightHint)
       .value("kInvalidTraitSet", BatchElementError::ErrorCode::kInvalidTraitSet)
-      .value("kAuthError", BatchElementError::ErrorCode::kAuthError);
+      .value("kAuthError", BatchElementError::ErrorCode::kAuthError)
+      .value("kTimeout", BatchElementError::ErrorCode::kTimeout);
 
   batchElementError
       .def(py::init<BatchElementError::ErrorCode, openassetio::Str>(), py::arg("code"),
@@ -32,6 +34,14 @@ void registerBatchElementError(const py::module& mod) {
       .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
       .def_readonly("code", &BatchElementError::code)
       .def_readonly("message", &BatchElementError::message)
+      .def(py::pickle(
+          [](const BatchElementError& self) {
+            return py::make_tuple(static_cast<int>(self.code), self.message);
+          },
+          [](const std::tuple<int, openassetio::Str>& state) {
+            return BatchElementError{static_cast<BatchElementError::ErrorCode>(std::get<0>(state)),
+                                     std::get<1>(state)};
+          }))
       .def("__str__", [](const BatchElementError& self) {
         std::ostringstream stringStream;
         stringStream << self;
@@ -170,7 +170,9 @@ void convertPyExceptionAndThrow(const pybind11::error_already_set &thrownPyExc,
   // GIL. pybind11::error_already_set::what() does this itself, but we need
   // additional attributes too. Note that acquiring the GIL can cause
   // crashes if the Python interpreter is finalizing (i.e. has been
-  // destroyed).
+  // destroyed). In free-threaded builds the "GIL" here is just an
+  // attached thread state, but that is all we need, since the error
+  // indicator and the exception object are private to this thread.
   const pybind11::gil_scoped_acquire gil{};
   // Check module name of Python exception.
   if (thrownPyExc.type().attr("__module__").cast<std::string_view>() != kErrorsModuleName) {
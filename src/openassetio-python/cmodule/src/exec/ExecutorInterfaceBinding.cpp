@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <pybind11/functional.h>
+#include <pybind11/pybind11.h>
+
+#include <openassetio/exec/ExecutorInterface.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerExecutorInterface(const py::module& mod) {
+  using openassetio::exec::ExecutorInterface;
+  using openassetio::exec::ExecutorInterfacePtr;
+
+  // Python callables wrapped as tasks acquire the GIL when called, so
+  // the GIL must be released whilst waiting on them.
+  py::class_<ExecutorInterface, ExecutorInterfacePtr>(mod, "ExecutorInterface")
+      .def("concurrency", &ExecutorInterface::concurrency)
+      .def("submit", &ExecutorInterface::submit, py::arg("task").none(false))
+      .def("parallelFor", &ExecutorInterface::parallelFor, py::arg("count"),
+           py::arg("body").none(false), py::call_guard<py::gil_scoped_release>{});
+}
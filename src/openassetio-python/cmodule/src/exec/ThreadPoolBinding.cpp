@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/exec/ExecutorInterface.hpp>
+#include <openassetio/exec/ThreadPool.hpp>
+#include <openassetio/log/LoggerInterface.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerThreadPool(const py::module& mod) {
+  using openassetio::exec::ExecutorInterface;
+  using openassetio::exec::ThreadPool;
+  using openassetio::exec::ThreadPoolPtr;
+  using openassetio::log::LoggerInterface;
+
+  // Ensure a Python logger is not destroyed whilst the pool may still
+  // report task failures to it.
+  using openassetio::PyRetainingSharedPtr;
+  using PyRetainingLoggerInterfacePtr = PyRetainingSharedPtr<LoggerInterface>;
+
+  py::class_<ThreadPool, ExecutorInterface, ThreadPoolPtr>(mod, "ThreadPool", py::is_final())
+      .def(py::init([](const std::size_t numThreads, PyRetainingLoggerInterfacePtr logger) {
+             ThreadPoolPtr pool = ThreadPool::make(numThreads, std::move(logger));
+             // Destruction runs remaining tasks and joins the worker
+             // threads, which may themselves be waiting on the GIL in
+             // order to call Python tasks. So ensure the GIL is
+             // released whilst destroying.
+             return ThreadPoolPtr{pool.get(),
+                                  [pool]([[maybe_unused]] ThreadPool* unused) mutable {
+                                    if (PyGILState_Check() != 0) {
+                                      const py::gil_scoped_release release{};
+                                      pool.reset();
+                                    } else {
+                                      pool.reset();
+                                    }
+                                  }};
+           }),
+           py::arg("numThreads") = 0, py::arg("logger") = nullptr)
+      .def_static("defaultPool", &ThreadPool::defaultPool);
+}
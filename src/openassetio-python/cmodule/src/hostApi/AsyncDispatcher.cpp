@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "AsyncDispatcher.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace {
+/**
+ * Convert a C++ exception to the equivalent Python exception object.
+ *
+ * Rethrowing through a pybind11 function applies the same exception
+ * translators as any other bound call, including restoring the
+ * original Python exception if the C++ exception came from Python.
+ */
+pybind11::object toPyException(const std::exception_ptr& error) {
+  try {
+    pybind11::cpp_function{[&error] { std::rethrow_exception(error); }}();
+  } catch (const pybind11::error_already_set& exc) {
+    return exc.value();
+  }
+  return pybind11::none{};
+}
+
+/// Schedule a call on an event loop, ignoring it if the loop is closed.
+void callSoonThreadsafe(const pybind11::object& loop, const pybind11::cpp_function& callback,
+                        const pybind11::object& future, const pybind11::object& arg) {
+  try {
+    loop.attr("call_soon_threadsafe")(callback, future, arg);
+  } catch (const pybind11::error_already_set&) {
+    // The loop has been closed, so there is nothing left to await the
+    // result.
+  }
+}
+}  // namespace
+
+AsyncDispatcher& AsyncDispatcher::instance() {
+  static auto* dispatcher = new AsyncDispatcher;  // NOLINT(*-owning-memory)
+  return *dispatcher;
+}
+
+void AsyncDispatcher::shutdown() {
+  std::vector<std::thread> workers;
+  std::deque<Task> tasks;
+  {
+    const std::lock_guard lock{mutex_};
+    isStopping_ = true;
+    workers.swap(workers_);
+    tasks.swap(tasks_);
+  }
+  wakeCondition_.notify_all();
+
+  {
+    // In-flight calls need the GIL to complete.
+    const pybind11::gil_scoped_release release{};
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  // Discarded tasks are destroyed here, with the GIL held, since they
+  // reference Python objects.
+}
+
+void AsyncDispatcher::enqueue(Task task) {
+  {
+    const std::lock_guard lock{mutex_};
+    if (isStopping_) {
+      throw std::runtime_error{"AsyncDispatcher has been shut down"};
+    }
+    if (workers_.empty()) {
+      const std::size_t numWorkers = std::max(std::thread::hardware_concurrency(), 1U);
+      workers_.reserve(numWorkers);
+      for (std::size_t idx = 0; idx < numWorkers; ++idx) {
+        workers_.emplace_back([this] { run(); });
+      }
+    }
+    tasks_.push_back(std::move(task));
+  }
+  wakeCondition_.notify_one();
+}
+
+void AsyncDispatcher::run() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock lock{mutex_};
+      wakeCondition_.wait(lock, [this] { return isStopping_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+void AsyncDispatcher::Completion::succeed(pybind11::object result) {
+  const auto setResult = [](const pybind11::object& future, const pybind11::object& value) {
+    if (!future.attr("cancelled")().cast<bool>()) {
+      future.attr("set_result")(value);
+    }
+  };
+  callSoonThreadsafe(loop, pybind11::cpp_function{setResult}, future, result);
+  loop = pybind11::object{};
+  future = pybind11::object{};
+}
+
+void AsyncDispatcher::Completion::fail(const std::exception_ptr& error) {
+  const auto setException = [](const pybind11::object& future,
+                                const pybind11::object& exception) {
+    if (!future.attr("cancelled")().cast<bool>()) {
+      future.attr("set_exception")(exception);
+    }
+  };
+  callSoonThreadsafe(loop, pybind11::cpp_function{setException}, future,
+                     toPyException(error));
+  loop = pybind11::object{};
+  future = pybind11::object{};
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
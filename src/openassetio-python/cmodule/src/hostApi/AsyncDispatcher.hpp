@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Defines AsyncDispatcher, used to expose blocking API calls to Python
+ * as asyncio awaitables.
+ */
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Runs blocking calls on a fixed pool of worker threads, delivering
+ * their results to asyncio event loops.
+ *
+ * Calls run without the GIL. On completion, the worker briefly
+ * acquires the GIL to convert the result (or exception) to Python,
+ * then schedules it onto the caller's event loop using
+ * `loop.call_soon_threadsafe`. This allows many concurrent in-flight
+ * calls to be awaited without a thread per call.
+ *
+ * Worker threads are started on first use, and must be stopped via
+ * @ref shutdown before the interpreter finalizes.
+ */
+class AsyncDispatcher {
+ public:
+  /**
+   * Process-wide instance.
+   *
+   * This is intentionally never destroyed, since destruction could
+   * otherwise occur after interpreter finalization.
+   */
+  static AsyncDispatcher& instance();
+
+  /**
+   * Schedule a call onto a worker thread.
+   *
+   * Must be called with the GIL held, from a thread with a running
+   * asyncio event loop.
+   *
+   * @param callable Callable to run on a worker thread without the GIL.
+   * Its return value is cast to Python.
+   *
+   * @return `asyncio.Future` that resolves to the result of the call,
+   * or to the exception it threw.
+   */
+  template <class Callable>
+  pybind11::object submit(Callable callable) {
+    auto completion = std::make_shared<Completion>();
+    completion->loop = pybind11::module_::import("asyncio").attr("get_running_loop")();
+    completion->future = completion->loop.attr("create_future")();
+    pybind11::object future = completion->future;
+
+    enqueue([callable = std::move(callable), completion]() mutable {
+      std::optional<decltype(callable())> result;
+      std::exception_ptr error;
+      try {
+        result.emplace(callable());
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      const pybind11::gil_scoped_acquire gil{};
+      if (error) {
+        completion->fail(error);
+      } else {
+        completion->succeed(pybind11::cast(std::move(*result)));
+      }
+      // Release Python objects whilst we hold the GIL.
+      result.reset();
+      completion.reset();
+    });
+
+    return future;
+  }
+
+  /**
+   * Stop worker threads, waiting for in-flight calls to complete and
+   * discarding calls that have yet to start.
+   *
+   * Must be called with the GIL held.
+   */
+  void shutdown();
+
+ private:
+  /// Event loop and future awaiting a result. Requires the GIL.
+  struct Completion {
+    pybind11::object loop;
+    pybind11::object future;
+
+    void succeed(pybind11::object result);
+    void fail(const std::exception_ptr& error);
+  };
+
+  using Task = std::function<void()>;
+
+  AsyncDispatcher() = default;
+
+  void enqueue(Task task);
+  void run();
+
+  std::mutex mutex_;
+  std::condition_variable wakeCondition_;
+  std::deque<Task> tasks_;
+  std::vector<std::thread> workers_;
+  bool isStopping_{false};
+};
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
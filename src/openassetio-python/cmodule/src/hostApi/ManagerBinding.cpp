@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <pybind11/functional.h>
@@ -20,6 +22,9 @@
 #include <openassetio/trait/collection.hpp>
 
 #include "../_openassetio.hpp"
+#include "../pickling.hpp"
+#include "../trait/TraitsDataEncoding.hpp"
+#include "AsyncDispatcher.hpp"
 
 namespace {
 using openassetio::EntityReferences;
@@ -36,6 +41,26 @@ void validateTraitsDatas(const trait::TraitsDatas& traitsDatas) {
   }
 }
 
+/**
+ * Awaitable equivalent of a `Manager::resolve` convenience overload.
+ *
+ * The call runs on an AsyncDispatcher worker thread, and the returned
+ * `asyncio.Future` completes on the calling thread's event loop.
+ */
+template <class Refs, class... Tag>
+py::object resolveAsync(openassetio::hostApi::ManagerPtr manager, Refs entityReferences,
+                        trait::TraitSet traitSet,
+                        const openassetio::access::ResolveAccess resolveAccess,
+                        openassetio::ContextConstPtr context, const Tag&... errorPolicyTag) {
+  return openassetio::AsyncDispatcher::instance().submit(
+      [manager = std::move(manager), entityReferences = std::move(entityReferences),
+       traitSet = std::move(traitSet), resolveAccess, context = std::move(context),
+       errorPolicyTag...] {
+        return manager->resolve(entityReferences, traitSet, resolveAccess, context,
+                                errorPolicyTag...);
+      });
+}
+
 py::list pyBoolListFromUintVector(const std::vector<Manager::BoolAsUint>& boolAsUints) {
   const py::gil_scoped_acquire gil{};
   py::list pyResult;
@@ -44,6 +69,97 @@ py::list pyBoolListFromUintVector(const std::vector<Manager::BoolAsUint>& boolAs
   }
   return pyResult;
 }
+
+/**
+ * Batch of boolean results, exposed to Python as a read-only sequence
+ * supporting the buffer protocol.
+ *
+ * Returned by the opt-in `entityExistsAsArray` method. This avoids
+ * creating a Python `bool` per element for large batches, and allows
+ * e.g. `numpy.asarray` to view the results without a copy.
+ */
+struct BoolArray {
+  std::vector<Manager::BoolAsUint> values;
+};
+
+// Required in order to use the buffer protocol "?" format.
+static_assert(sizeof(Manager::BoolAsUint) == sizeof(bool));
+
+/**
+ * Batch of TraitsData results, exposed to Python as a read-only
+ * sequence.
+ *
+ * Returned by the opt-in `resolveAsSequence` method. Elements are only
+ * wrapped as Python objects when indexed.
+ */
+struct TraitsDataSequence {
+  trait::TraitsDatas values;
+};
+
+py::object elementAt(const BoolArray& array, const std::size_t index) {
+  return py::bool_{array.values[index] != 0};
+}
+
+py::object elementAt(const TraitsDataSequence& sequence, const std::size_t index) {
+  return py::cast(sequence.values[index]);
+}
+
+/**
+ * Register the read-only sequence protocol for a batch result type.
+ *
+ * Indexing follows `list` semantics, i.e. negative indices count from
+ * the end, and slicing returns a new `list`.
+ *
+ * Equality is defined against any sequence, such that results can be
+ * compared to lists.
+ */
+template <class Sequence, class... Options>
+void defSequence(py::class_<Sequence, Options...>& pyClass) {
+  pyClass.def("__len__", [](const Sequence& self) { return self.values.size(); })
+      .def("__getitem__",
+           [](const Sequence& self, py::ssize_t index) {
+             const auto size = static_cast<py::ssize_t>(self.values.size());
+             if (index < 0) {
+               index += size;
+             }
+             if (index < 0 || index >= size) {
+               throw py::index_error{};
+             }
+             return elementAt(self, static_cast<std::size_t>(index));
+           })
+      .def("__getitem__",
+           [](const Sequence& self, const py::slice& slice) {
+             py::ssize_t start = 0;
+             py::ssize_t stop = 0;
+             py::ssize_t step = 0;
+             py::ssize_t sliceLength = 0;
+             if (!slice.compute(static_cast<py::ssize_t>(self.values.size()), &start, &stop,
+                                &step, &sliceLength)) {
+               throw py::error_already_set{};
+             }
+             py::list elements{static_cast<std::size_t>(sliceLength)};
+             for (py::ssize_t idx = 0; idx < sliceLength; ++idx, start += step) {
+               elements[static_cast<std::size_t>(idx)] =
+                   elementAt(self, static_cast<std::size_t>(start));
+             }
+             return elements;
+           })
+      .def("__eq__", [](const Sequence& self, const py::object& other) -> py::object {
+        if (!PySequence_Check(other.ptr()) || py::isinstance<py::str>(other)) {
+          return py::reinterpret_borrow<py::object>(Py_NotImplemented);
+        }
+        const auto otherSequence = py::reinterpret_borrow<py::sequence>(other);
+        if (otherSequence.size() != self.values.size()) {
+          return py::bool_{false};
+        }
+        for (std::size_t idx = 0; idx < self.values.size(); ++idx) {
+          if (!elementAt(self, idx).equal(otherSequence[idx])) {
+            return py::bool_{false};
+          }
+        }
+        return py::bool_{true};
+      });
+}
 }  // namespace
 
 void registerManager(const py::module& mod) {
@@ -60,6 +176,11 @@ void registerManager(const py::module& mod) {
 
   py::class_<Manager, ManagerPtr> pyManager{mod, "Manager", py::is_final()};
 
+  // Worker threads servicing awaitable methods must be stopped whilst
+  // the interpreter is still able to service their final GIL requests.
+  py::module_::import("atexit").attr("register")(
+      py::cpp_function{[] { openassetio::AsyncDispatcher::instance().shutdown(); }});
+
   // BatchElementErrorPolicy tags for tag dispatch overload resolution
   // idiom.
   py::class_<Manager::BatchElementErrorPolicyTag> pyBatchElementErrorPolicyTag{
@@ -75,6 +196,41 @@ void registerManager(const py::module& mod) {
       .def_readonly_static("kException", &Manager::BatchElementErrorPolicyTag::kException)
       .def_readonly_static("kVariant", &Manager::BatchElementErrorPolicyTag::kVariant);
 
+  py::class_<BoolArray> pyBoolArray{pyManager, "BoolArray", py::buffer_protocol()};
+  defSequence(pyBoolArray);
+  pyBoolArray.def_buffer([](BoolArray& self) {
+    return py::buffer_info{self.values.data(),
+                           sizeof(Manager::BoolAsUint),
+                           "?",
+                           1,
+                           {self.values.size()},
+                           {sizeof(Manager::BoolAsUint)},
+                           /* readonly= */ true};
+  });
+
+  openassetio::defBinaryPickle(
+      pyBoolArray,
+      [](const BoolArray& self) {
+        return openassetio::Str(self.values.begin(), self.values.end());
+      },
+      [](const std::string_view encoded) {
+        BoolArray array;
+        array.values.reserve(encoded.size());
+        for (const char value : encoded) {
+          array.values.push_back(value != 0 ? 1 : 0);
+        }
+        return array;
+      });
+
+  py::class_<TraitsDataSequence> pyTraitsDataSequence{pyManager, "TraitsDataSequence"};
+  defSequence(pyTraitsDataSequence);
+  openassetio::defBinaryPickle(
+      pyTraitsDataSequence,
+      [](const TraitsDataSequence& self) { return trait::encodeTraitsDatas(self.values); },
+      [](const std::string_view encoded) {
+        return TraitsDataSequence{trait::decodeTraitsDatas(encoded)};
+      });
+
   py::enum_<Manager::Capability>{pyManager, "Capability"}
       .value("kStatefulContexts", Manager::Capability::kStatefulContexts)
       .value("kCustomTerminology", Manager::Capability::kCustomTerminology)
@@ -94,6 +250,9 @@ void registerManager(const py::module& mod) {
       .def("initialize", &Manager::initialize, py::arg("managerSettings"),
            py::call_guard<py::gil_scoped_release>{})
       .def("flushCaches", &Manager::flushCaches, py::call_guard<py::gil_scoped_release>{})
+      .def("replaceImplementation",
+           RetainCommonPyArgs::forFn<&Manager::replaceImplementation>(),
+           py::arg("managerInterface").none(false), py::call_guard<py::gil_scoped_release>{})
       .def("managementPolicy",
            py::overload_cast<const trait::TraitSet&, access::PolicyAccess, const ContextConstPtr&>(
                &Manager::managementPolicy),
@@ -227,6 +386,23 @@ void registerManager(const py::module& mod) {
                              const Manager::BatchElementErrorCallback&>(&Manager::entityExists),
            py::arg("entityReferences"), py::arg("context").none(false), py::arg("successCallback"),
            py::arg("errorCallback"), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityExistsAsArray",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const ContextConstPtr& context) {
+            return BoolArray{self.entityExists(entityReferences, context)};
+          },
+          py::arg("entityReferences"), py::arg("context").none(false),
+          py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "entityExistsAsArray",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const ContextConstPtr& context,
+             const Manager::BatchElementErrorPolicyTag::Exception& errorPolicyTag) {
+            return BoolArray{self.entityExists(entityReferences, context, errorPolicyTag)};
+          },
+          py::arg("entityReferences"), py::arg("context").none(false), py::arg("errorPolicyTag"),
+          py::call_guard<py::gil_scoped_release>{})
       .def("entityTraits",
            py::overload_cast<const EntityReferences&, access::EntityTraitsAccess,
                              const ContextConstPtr&, const Manager::EntityTraitsSuccessCallback&,
@@ -355,6 +531,48 @@ void registerManager(const py::module& mod) {
           },
           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
           py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "resolveAsSequence",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitSet& traitSet, const access::ResolveAccess resolveAccess,
+             const ContextConstPtr& context) {
+            return TraitsDataSequence{
+                self.resolve(entityReferences, traitSet, resolveAccess, context)};
+          },
+          py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+          py::arg("context").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def(
+          "resolveAsSequence",
+          [](Manager& self, const EntityReferences& entityReferences,
+             const trait::TraitSet& traitSet, const access::ResolveAccess resolveAccess,
+             const ContextConstPtr& context,
+             const Manager::BatchElementErrorPolicyTag::Exception& errorPolicyTag) {
+            return TraitsDataSequence{self.resolve(entityReferences, traitSet, resolveAccess,
+                                                   context, errorPolicyTag)};
+          },
+          py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+          py::arg("context").none(false), py::arg("errorPolicyTag"),
+          py::call_guard<py::gil_scoped_release>{})
+      .def("resolveAsync", &resolveAsync<EntityReference>, py::arg("entityReference"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("context").none(false))
+      .def("resolveAsync",
+           &resolveAsync<EntityReference, Manager::BatchElementErrorPolicyTag::Exception>,
+           py::arg("entityReference"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"))
+      .def("resolveAsync",
+           &resolveAsync<EntityReference, Manager::BatchElementErrorPolicyTag::Variant>,
+           py::arg("entityReference"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"))
+      .def("resolveAsync", &resolveAsync<EntityReferences>, py::arg("entityReferences"),
+           py::arg("traitSet"), py::arg("resolveAccess"), py::arg("context").none(false))
+      .def("resolveAsync",
+           &resolveAsync<EntityReferences, Manager::BatchElementErrorPolicyTag::Exception>,
+           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"))
+      .def("resolveAsync",
+           &resolveAsync<EntityReferences, Manager::BatchElementErrorPolicyTag::Variant>,
+           py::arg("entityReferences"), py::arg("traitSet"), py::arg("resolveAccess"),
+           py::arg("context").none(false), py::arg("errorPolicyTag"))
       .def("getWithRelationship",
            py::overload_cast<const EntityReferences&, const trait::TraitsDataPtr&, std::size_t,
                              access::RelationsAccess, const ContextConstPtr&,
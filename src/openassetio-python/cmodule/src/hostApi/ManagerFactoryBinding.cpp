@@ -2,10 +2,12 @@
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
 #include <string_view>
 
+#include <pybind11/chrono.h>
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
 #include <openassetio/InfoDictionary.hpp>
+#include <openassetio/exec/ExecutorInterface.hpp>
 #include <openassetio/hostApi/HostInterface.hpp>
 #include <openassetio/hostApi/Manager.hpp>
 #include <openassetio/hostApi/ManagerFactory.hpp>
@@ -16,6 +18,7 @@
 #include "../_openassetio.hpp"
 
 void registerManagerFactory(const py::module& mod) {
+  using openassetio::exec::ExecutorInterfacePtr;
   using openassetio::hostApi::HostInterfacePtr;
   using openassetio::hostApi::ManagerFactory;
   using openassetio::hostApi::ManagerFactoryPtr;
@@ -26,9 +29,17 @@ void registerManagerFactory(const py::module& mod) {
   py::class_<ManagerFactory, ManagerFactoryPtr> managerFactory(mod, "ManagerFactory",
                                                                py::is_final());
   managerFactory
-      .def(py::init(RetainCommonPyArgs::forFn<&ManagerFactory::make>()),
+      .def(py::init(RetainCommonPyArgs::forFn<static_cast<ManagerFactoryPtr (*)(
+                        HostInterfacePtr, ManagerImplementationFactoryInterfacePtr,
+                        LoggerInterfacePtr)>(&ManagerFactory::make)>()),
            py::arg("hostInterface").none(false),
            py::arg("managerImplementationFactory").none(false), py::arg("logger").none(false))
+      .def(py::init(RetainCommonPyArgs::forFn<static_cast<ManagerFactoryPtr (*)(
+                        HostInterfacePtr, ManagerImplementationFactoryInterfacePtr,
+                        LoggerInterfacePtr, ExecutorInterfacePtr)>(&ManagerFactory::make)>()),
+           py::arg("hostInterface").none(false),
+           py::arg("managerImplementationFactory").none(false), py::arg("logger").none(false),
+           py::arg("executor").none(false))
       .def("identifiers", &ManagerFactory::identifiers, py::call_guard<py::gil_scoped_release>{});
 
   py::class_<ManagerFactory::ManagerDetail>(managerFactory, "ManagerDetail")
@@ -46,11 +57,31 @@ void registerManagerFactory(const py::module& mod) {
                            &ManagerFactory::kDefaultManagerConfigEnvVarName)
       .def("createManager", &ManagerFactory::createManager, py::arg("identifier"),
            py::call_guard<py::gil_scoped_release>{})
+      .def_readonly_static("kDefaultSharedManagerIdleTimeout",
+                           &ManagerFactory::kDefaultSharedManagerIdleTimeout)
+      .def("sharedManager", &ManagerFactory::sharedManager, py::arg("identifier"),
+           py::arg("settings"), py::call_guard<py::gil_scoped_release>{})
+      .def("setSharedManagerIdleTimeout", &ManagerFactory::setSharedManagerIdleTimeout,
+           py::arg("idleTimeout"), py::call_guard<py::gil_scoped_release>{})
+      .def("evictIdleSharedManagers", &ManagerFactory::evictIdleSharedManagers,
+           py::call_guard<py::gil_scoped_release>{})
       .def_static("createManagerForInterface",
-                  RetainCommonPyArgs::forFn<&ManagerFactory::createManagerForInterface>(),
+                  RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
+                      const openassetio::Identifier&, const HostInterfacePtr&,
+                      const ManagerImplementationFactoryInterfacePtr&, const LoggerInterfacePtr&)>(
+                      &ManagerFactory::createManagerForInterface)>(),
                   py::arg("identifier"), py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
                   py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("createManagerForInterface",
+                  RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
+                      const openassetio::Identifier&, const HostInterfacePtr&,
+                      const ManagerImplementationFactoryInterfacePtr&, const LoggerInterfacePtr&,
+                      const ExecutorInterfacePtr&)>(&ManagerFactory::createManagerForInterface)>(),
+                  py::arg("identifier"), py::arg("hostInterface").none(false),
+                  py::arg("managerImplementationFactory").none(false),
+                  py::arg("logger").none(false), py::arg("executor").none(false),
+                  py::call_guard<py::gil_scoped_release>{})
       .def_static("defaultManagerForInterface",
                   RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
                       std::string_view, const HostInterfacePtr&,
@@ -59,11 +90,30 @@ void registerManagerFactory(const py::module& mod) {
                   py::arg("configPath"), py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
                   py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("defaultManagerForInterface",
+                  RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
+                      std::string_view, const HostInterfacePtr&,
+                      const ManagerImplementationFactoryInterfacePtr&, const LoggerInterfacePtr&,
+                      const ExecutorInterfacePtr&)>(
+                      &ManagerFactory::defaultManagerForInterface)>(),
+                  py::arg("configPath"), py::arg("hostInterface").none(false),
+                  py::arg("managerImplementationFactory").none(false),
+                  py::arg("logger").none(false), py::arg("executor").none(false),
+                  py::call_guard<py::gil_scoped_release>{})
       .def_static("defaultManagerForInterface",
                   RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
                       const HostInterfacePtr&, const ManagerImplementationFactoryInterfacePtr&,
                       const LoggerInterfacePtr&)>(&ManagerFactory::defaultManagerForInterface)>(),
                   py::arg("hostInterface").none(false),
                   py::arg("managerImplementationFactory").none(false),
-                  py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{});
+                  py::arg("logger").none(false), py::call_guard<py::gil_scoped_release>{})
+      .def_static("defaultManagerForInterface",
+                  RetainCommonPyArgs::forFn<static_cast<ManagerPtr (*)(
+                      const HostInterfacePtr&, const ManagerImplementationFactoryInterfacePtr&,
+                      const LoggerInterfacePtr&, const ExecutorInterfacePtr&)>(
+                      &ManagerFactory::defaultManagerForInterface)>(),
+                  py::arg("hostInterface").none(false),
+                  py::arg("managerImplementationFactory").none(false),
+                  py::arg("logger").none(false), py::arg("executor").none(false),
+                  py::call_guard<py::gil_scoped_release>{});
 }
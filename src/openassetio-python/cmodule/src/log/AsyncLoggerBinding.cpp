@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <openassetio/log/AsyncLogger.hpp>
+
+#include "../_openassetio.hpp"
+
+void registerAsyncLogger(const py::module& mod) {
+  using openassetio::log::AsyncLogger;
+  using openassetio::log::AsyncLoggerPtr;
+  using openassetio::log::LoggerInterface;
+
+  // We must ensure any Python facade implementing a "subclass" is not
+  // destroyed whilst the C++ instance is alive. The
+  // PyRetainingSharedPtr mechanism ensures the Python object lifetime
+  // is linked to the shared_ptr lifetime.
+  using openassetio::PyRetainingSharedPtr;
+  using PyRetainingLoggerInterfacePtr = PyRetainingSharedPtr<LoggerInterface>;
+
+  py::class_<AsyncLogger, LoggerInterface, AsyncLoggerPtr> asyncLogger(mod, "AsyncLogger",
+                                                                       py::is_final());
+
+  py::enum_<AsyncLogger::OverflowPolicy>{asyncLogger, "OverflowPolicy"}
+      .value("kDrop", AsyncLogger::OverflowPolicy::kDrop)
+      .value("kBlock", AsyncLogger::OverflowPolicy::kBlock)
+      .value("kSample", AsyncLogger::OverflowPolicy::kSample);
+
+  asyncLogger
+      .def(py::init([](PyRetainingLoggerInterfacePtr upstreamLogger, const std::size_t capacity,
+                       const AsyncLogger::OverflowPolicy overflowPolicy,
+                       const std::size_t sampleInterval) {
+             AsyncLoggerPtr logger = AsyncLogger::make(std::move(upstreamLogger), capacity,
+                                                       overflowPolicy, sampleInterval);
+             // Destruction joins the worker thread, which may itself be
+             // waiting on the GIL in order to call a Python upstream
+             // logger. So ensure the GIL is released whilst destroying.
+             return AsyncLoggerPtr{
+                 logger.get(), [logger]([[maybe_unused]] AsyncLogger* unused) mutable {
+                   if (PyGILState_Check() != 0) {
+                     const py::gil_scoped_release release{};
+                     logger.reset();
+                   } else {
+                     logger.reset();
+                   }
+                 }};
+           }),
+           py::arg("upstreamLogger").none(false),
+           py::arg("capacity") = AsyncLogger::kDefaultCapacity,
+           py::arg("overflowPolicy") = AsyncLogger::OverflowPolicy::kBlock,
+           py::arg("sampleInterval") = AsyncLogger::kDefaultSampleInterval)
+      .def_readonly_static("kDefaultCapacity", &AsyncLogger::kDefaultCapacity)
+      .def_readonly_static("kDefaultSampleInterval", &AsyncLogger::kDefaultSampleInterval)
+      .def("upstreamLogger", &AsyncLogger::upstreamLogger)
+      .def("capacity", &AsyncLogger::capacity)
+      .def("overflowPolicy", &AsyncLogger::overflowPolicy)
+      .def("droppedCount", &AsyncLogger::droppedCount)
+      .def("flush", &AsyncLogger::flush, py::call_guard<py::gil_scoped_release>{});
+}
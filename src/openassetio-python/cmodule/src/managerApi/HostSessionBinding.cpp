@@ -5,6 +5,7 @@
 #include <openassetio/managerApi/HostSession.hpp>
 
 // NOLINTBEGIN(misc-include-cleaner) - required for pybind11
+#include <openassetio/exec/ExecutorInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
 #include <openassetio/managerApi/Host.hpp>
 // NOLINTEND(misc-include-cleaner)
@@ -12,12 +13,22 @@
 #include "../_openassetio.hpp"
 
 void registerHostSession(const py::module& mod) {
+  using openassetio::exec::ExecutorInterfacePtr;
+  using openassetio::log::LoggerInterfacePtr;
+  using openassetio::managerApi::HostPtr;
   using openassetio::managerApi::HostSession;
   using openassetio::managerApi::HostSessionPtr;
 
   py::class_<HostSession, HostSessionPtr>(mod, "HostSession", py::is_final())
-      .def(py::init(RetainCommonPyArgs::forFn<&HostSession::make>()), py::arg("host").none(false),
-           py::arg("logger").none(false))
+      .def(py::init(RetainCommonPyArgs::forFn<static_cast<HostSessionPtr (*)(
+                        HostPtr, LoggerInterfacePtr)>(&HostSession::make)>()),
+           py::arg("host").none(false), py::arg("logger").none(false))
+      .def(py::init(RetainCommonPyArgs::forFn<
+                    static_cast<HostSessionPtr (*)(HostPtr, LoggerInterfacePtr,
+                                                   ExecutorInterfacePtr)>(&HostSession::make)>()),
+           py::arg("host").none(false), py::arg("logger").none(false),
+           py::arg("executor").none(false))
       .def("host", &HostSession::host)
-      .def("logger", &HostSession::logger);
+      .def("logger", &HostSession::logger)
+      .def("executor", &HostSession::executor);
 }
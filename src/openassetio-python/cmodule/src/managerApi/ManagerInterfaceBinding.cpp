@@ -1,7 +1,10 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
 #include <cstddef>
+#include <string>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include <pybind11/functional.h>
 #include <pybind11/stl.h>
@@ -11,6 +14,8 @@
 #include <openassetio/EntityReference.hpp>
 #include <openassetio/InfoDictionary.hpp>
 #include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/EntityReferencePager.hpp>
 #include <openassetio/managerApi/EntityReferencePagerInterface.hpp>
 #include <openassetio/managerApi/HostSession.hpp>
@@ -20,6 +25,7 @@
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
+#include "../PyOverrideCache.hpp"
 #include "../PyRetainingSharedPtr.hpp"
 #include "../_openassetio.hpp"
 #include "../overrideMacros.hpp"
@@ -38,92 +44,116 @@ struct PyManagerInterface final : ManagerInterface {
   using PyRetainingManagerStateBasePtr = PyRetainingSharedPtr<ManagerStateBase>;
 
   [[nodiscard]] Identifier identifier() const override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(Identifier, ManagerInterface, identifier, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(Identifier, ManagerInterface, overrideCache_,
+                                              kIdentifier, identifier, /* no args */);
   }
 
   [[nodiscard]] Str displayName() const override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(Str, ManagerInterface, displayName, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(Str, ManagerInterface, overrideCache_,
+                                              kDisplayName, displayName, /* no args */);
   }
 
   [[nodiscard]] InfoDictionary info() override {
-    OPENASSETIO_PYBIND11_OVERRIDE(InfoDictionary, ManagerInterface, info, /* no args */);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(InfoDictionary, ManagerInterface, overrideCache_, kInfo,
+                                         info, /* no args */);
   }
 
   [[nodiscard]] InfoDictionary settings(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(InfoDictionary, ManagerInterface, settings, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(InfoDictionary, ManagerInterface, overrideCache_,
+                                         kSettings, settings, hostSession);
   }
 
   void initialize(InfoDictionary managerSettings, const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, initialize, std::move(managerSettings),
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kInitialize,
+                                         initialize, std::move(managerSettings), hostSession);
   }
 
   void flushCaches(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, flushCaches, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kFlushCaches,
+                                         flushCaches, hostSession);
   }
 
   [[nodiscard]] trait::TraitsDatas managementPolicy(const trait::TraitSets& traitSets,
                                                     access::PolicyAccess policyAccess,
                                                     const ContextConstPtr& context,
                                                     const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(trait::TraitsDatas, ManagerInterface, managementPolicy,
-                                  traitSets, policyAccess, context, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(trait::TraitsDatas, ManagerInterface, overrideCache_,
+                                         kManagementPolicy, managementPolicy, traitSets,
+                                         policyAccess, context, hostSession);
   }
 
   ManagerStateBasePtr createState(const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface, createState,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
+                                         overrideCache_, kCreateState, createState, hostSession);
   }
 
   ManagerStateBasePtr createChildState(const ManagerStateBasePtr& parentState,
                                        const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
-                                  createChildState, parentState, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
+                                         overrideCache_, kCreateChildState, createChildState,
+                                         parentState, hostSession);
   }
 
   Str persistenceTokenForState(const ManagerStateBasePtr& parentState,
                                const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(Str, ManagerInterface, persistenceTokenForState, parentState,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(Str, ManagerInterface, overrideCache_,
+                                         kPersistenceTokenForState, persistenceTokenForState,
+                                         parentState, hostSession);
   }
 
   ManagerStateBasePtr stateFromPersistenceToken(const Str& token,
                                                 const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
-                                  stateFromPersistenceToken, token, hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(PyRetainingManagerStateBasePtr, ManagerInterface,
+                                         overrideCache_, kStateFromPersistenceToken,
+                                         stateFromPersistenceToken, token, hostSession);
   }
 
   [[nodiscard]] bool isEntityReferenceString(const Str& someString,
                                              const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(bool, ManagerInterface, isEntityReferenceString, someString,
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(bool, ManagerInterface, overrideCache_,
+                                         kIsEntityReferenceString, isEntityReferenceString,
+                                         someString, hostSession);
   }
 
   void entityExists(const EntityReferences& entityReferences, const ContextConstPtr& context,
                     const HostSessionPtr& hostSession,
                     const ExistsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityExists, entityReferences, context,
-                                  hostSession, successCallback, errorCallback);
+    if (overrideBatch<bool>(kEntityExistsBatch, "entityExistsBatch", entityReferences.size(),
+                            successCallback, errorCallback, entityReferences, context,
+                            hostSession)) {
+      return;
+    }
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kEntityExists,
+                                         entityExists, entityReferences, context, hostSession,
+                                         successCallback, errorCallback);
   }
 
   [[nodiscard]] bool hasCapability(Capability capability) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_PURE(bool, ManagerInterface, hasCapability, capability);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(bool, ManagerInterface, overrideCache_,
+                                              kHasCapability, hasCapability, capability);
   }
 
   [[nodiscard]] StrMap updateTerminology(StrMap terms,
                                          const HostSessionPtr& hostSession) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(StrMap, ManagerInterface, updateTerminology, std::move(terms),
-                                  hostSession);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(StrMap, ManagerInterface, overrideCache_,
+                                         kUpdateTerminology, updateTerminology, std::move(terms),
+                                         hostSession);
   }
 
   void resolve(const EntityReferences& entityReferences, const trait::TraitSet& traitSet,
                const access::ResolveAccess resolveAccess, const ContextConstPtr& context,
                const HostSessionPtr& hostSession, const ResolveSuccessCallback& successCallback,
                const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, resolve, entityReferences, traitSet,
-                                  resolveAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    if (overrideBatch<trait::TraitsDataPtr>(kResolveBatch, "resolveBatch",
+                                            entityReferences.size(), successCallback,
+                                            errorCallback, entityReferences, traitSet,
+                                            resolveAccess, context, hostSession)) {
+      return;
+    }
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kResolve,
+                                         resolve, entityReferences, traitSet, resolveAccess,
+                                         context, hostSession, successCallback, errorCallback);
   }
 
   void entityTraits(const EntityReferences& entityReferences,
@@ -131,9 +161,15 @@ struct PyManagerInterface final : ManagerInterface {
                     const ContextConstPtr& context, const HostSessionPtr& hostSession,
                     const EntityTraitsSuccessCallback& successCallback,
                     const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, entityTraits, entityReferences,
-                                  entityTraitsAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    if (overrideBatch<trait::TraitSet>(kEntityTraitsBatch, "entityTraitsBatch",
+                                       entityReferences.size(), successCallback, errorCallback,
+                                       entityReferences, entityTraitsAccess, context,
+                                       hostSession)) {
+      return;
+    }
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kEntityTraits,
+                                         entityTraits, entityReferences, entityTraitsAccess,
+                                         context, hostSession, successCallback, errorCallback);
   }
 
   void defaultEntityReference(const trait::TraitSets& traitSets,
@@ -141,9 +177,10 @@ struct PyManagerInterface final : ManagerInterface {
                               const ContextConstPtr& context, const HostSessionPtr& hostSession,
                               const DefaultEntityReferenceSuccessCallback& successCallback,
                               const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, defaultEntityReference, traitSets,
-                                  defaultEntityAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_,
+                                         kDefaultEntityReference, defaultEntityReference,
+                                         traitSets, defaultEntityAccess, context, hostSession,
+                                         successCallback, errorCallback);
   }
 
   void getWithRelationship(const EntityReferences& entityReferences,
@@ -153,8 +190,8 @@ struct PyManagerInterface final : ManagerInterface {
                            const ContextConstPtr& context, const HostSessionPtr& hostSession,
                            const RelationshipQuerySuccessCallback& successCallback,
                            const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
-        void, ManagerInterface, getWithRelationship,
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(
+        void, ManagerInterface, overrideCache_, kGetWithRelationship, getWithRelationship,
         (entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
          context, hostSession, successCallback, errorCallback),
         entityReferences, relationshipTraitsData, resultTraitSet, pageSize, relationsAccess,
@@ -168,8 +205,8 @@ struct PyManagerInterface final : ManagerInterface {
                             const ContextConstPtr& context, const HostSessionPtr& hostSession,
                             const RelationshipQuerySuccessCallback& successCallback,
                             const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_ARGS(
-        void, ManagerInterface, getWithRelationships,
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(
+        void, ManagerInterface, overrideCache_, kGetWithRelationships, getWithRelationships,
         (entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
          context, hostSession, successCallback, errorCallback),
         entityReference, relationshipTraitsDatas, resultTraitSet, pageSize, relationsAccess,
@@ -181,22 +218,142 @@ struct PyManagerInterface final : ManagerInterface {
                  const HostSessionPtr& hostSession,
                  const PreflightSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE(void, ManagerInterface, preflight, entityReferences, traitsHints,
-                                  publishingAccess, context, hostSession, successCallback,
-                                  errorCallback);
+    if (overrideBatch<EntityReference>(kPreflightBatch, "preflightBatch", entityReferences.size(),
+                                       successCallback, errorCallback, entityReferences,
+                                       traitsHints, publishingAccess, context, hostSession)) {
+      return;
+    }
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ManagerInterface, overrideCache_, kPreflight,
+                                         preflight, entityReferences, traitsHints,
+                                         publishingAccess, context, hostSession, successCallback,
+                                         errorCallback);
   }
 
   void register_(const EntityReferences& entityReferences, const trait::TraitsDatas& traitsDatas,
                  const access::PublishingAccess publishingAccess, const ContextConstPtr& context,
                  const HostSessionPtr& hostSession, const RegisterSuccessCallback& successCallback,
                  const BatchElementErrorCallback& errorCallback) override {
-    OPENASSETIO_PYBIND11_OVERRIDE_NAME(void, ManagerInterface, "register", register_,
-                                       entityReferences, traitsDatas, publishingAccess, context,
-                                       hostSession, successCallback, errorCallback);
+    if (overrideBatch<EntityReference>(kRegisterBatch, "registerBatch", entityReferences.size(),
+                                       successCallback, errorCallback, entityReferences,
+                                       traitsDatas, publishingAccess, context, hostSession)) {
+      return;
+    }
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(void, ManagerInterface, overrideCache_, kRegister,
+                                              "register", register_, entityReferences,
+                                              traitsDatas, publishingAccess, context,
+                                              hostSession, successCallback, errorCallback);
   }
 
   // Hoist protected members
   using ManagerInterface::createEntityReference;
+
+ private:
+  /// Slots of overridable methods in the override cache.
+  enum OverrideSlot : std::size_t {
+    kIdentifier,
+    kDisplayName,
+    kInfo,
+    kSettings,
+    kInitialize,
+    kFlushCaches,
+    kManagementPolicy,
+    kCreateState,
+    kCreateChildState,
+    kPersistenceTokenForState,
+    kStateFromPersistenceToken,
+    kIsEntityReferenceString,
+    kEntityExists,
+    kEntityExistsBatch,
+    kHasCapability,
+    kUpdateTerminology,
+    kResolve,
+    kResolveBatch,
+    kEntityTraits,
+    kEntityTraitsBatch,
+    kDefaultEntityReference,
+    kGetWithRelationship,
+    kGetWithRelationships,
+    kPreflight,
+    kPreflightBatch,
+    kRegister,
+    kRegisterBatch,
+    kNumOverrideSlots
+  };
+
+  /**
+   * Call the opt-in batch variant of a callback-based method, if the
+   * Python subclass implements one.
+   *
+   * A batch variant (e.g. `resolveBatch` for `resolve`) takes the same
+   * arguments as the callback-based method, minus the callbacks, and
+   * returns a sequence with one element per input, each either a
+   * result or a `BatchElementError`.
+   *
+   * The sequence is unpacked with the GIL acquired only once, and the
+   * elements are then delivered to the callbacks with the GIL released.
+   * This avoids crossing the language boundary for each element.
+   *
+   * @return Whether a batch variant was found and called.
+   */
+  template <class Result, class SuccessCallback, class... Args>
+  bool overrideBatch(const OverrideSlot slot, const char* name, const std::size_t batchSize,
+                     const SuccessCallback& successCallback,
+                     const BatchElementErrorCallback& errorCallback, const Args&... args) {
+    if (overrideCache_.isNotOverridden(slot)) {
+      return false;
+    }
+
+    std::vector<std::variant<Result, errors::BatchElementError>> results;
+
+    const bool hasOverride = decorateWithExceptionConverter([&] {
+      const py::gil_scoped_acquire gil{};
+      const py::function override = overrideCache_.get(this, slot, name);
+      if (!override) {
+        return false;
+      }
+
+      const auto activeOverride = overrideCache_.markActive(this, slot);
+      const auto pyResults = override(args...).template cast<py::sequence>();
+      if (pyResults.size() != batchSize) {
+        throw errors::InputValidationException{
+            std::string{name} + " returned " + std::to_string(pyResults.size()) +
+            " results, but " + std::to_string(batchSize) + " were expected"};
+      }
+
+      results.reserve(batchSize);
+      for (std::size_t idx = 0; idx < batchSize; ++idx) {
+        const py::object pyResult = pyResults[idx];
+        // Otherwise pybind would silently convert `None`, e.g. to a
+        // null TraitsDataPtr or to `false`.
+        if (pyResult.is_none()) {
+          throw errors::InputValidationException{std::string{name} + " returned None at index " +
+                                                 std::to_string(idx)};
+        }
+        if (py::isinstance<errors::BatchElementError>(pyResult)) {
+          results.emplace_back(pyResult.cast<errors::BatchElementError>());
+        } else {
+          results.emplace_back(pyResult.cast<Result>());
+        }
+      }
+      return true;
+    });
+
+    if (!hasOverride) {
+      return false;
+    }
+
+    for (std::size_t idx = 0; idx < results.size(); ++idx) {
+      if (auto* error = std::get_if<errors::BatchElementError>(&results[idx])) {
+        errorCallback(idx, std::move(*error));
+      } else {
+        successCallback(idx, std::move(std::get<Result>(results[idx])));
+      }
+    }
+    return true;
+  }
+
+  /// Cached Python override lookup, since some methods are hot paths.
+  mutable PyOverrideCache<ManagerInterface, kNumOverrideSlots> overrideCache_;
 };
 
 }  // namespace managerApi
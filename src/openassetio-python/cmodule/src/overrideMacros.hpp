@@ -3,6 +3,7 @@
 #pragma once
 #include <pybind11/pybind11.h>
 
+#include "./PyOverrideCache.hpp"
 #include "./errors/exceptionsConverter.hpp"
 
 /// @note Update errorsTest.cpp if adding more override macros below.
@@ -83,3 +84,76 @@
 #define OPENASSETIO_PYBIND11_OVERRIDE_PURE(ret_type, cname, fn, ...)                              \
   OPENASSETIO_PYBIND11_OVERRIDE_PURE_NAME(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), #fn, fn, \
                                           __VA_ARGS__)
+
+/**
+ * Equivalent of PYBIND11_OVERRIDE_IMPL, but using a PyOverrideCache to
+ * avoid looking up the Python override on every call, and to avoid
+ * acquiring the GIL at all if the method is known not to be
+ * overridden.
+ *
+ * The `cache` parameter is the trampoline's PyOverrideCache instance,
+ * and `slot` is the index of the method within that cache.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(ret_type, cname, cache, slot, name, ...)     \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                          \
+    if (!(cache).isNotOverridden(slot)) {                                                      \
+      const pybind11::gil_scoped_acquire gil{};                                                \
+      const pybind11::function override =                                                      \
+          (cache).get(static_cast<const cname*>(this), slot, name);                            \
+      if (override) {                                                                          \
+        const auto activeOverride = (cache).markActive(static_cast<const cname*>(this), slot); \
+        auto o = override(__VA_ARGS__);                                                        \
+        if (pybind11::detail::cast_is_temporary_value_reference<ret_type>::value) {            \
+          thread_local pybind11::detail::override_caster_t<ret_type> caster;                   \
+          return pybind11::detail::cast_ref<ret_type>(std::move(o), caster);                   \
+        }                                                                                      \
+        return pybind11::detail::cast_safe<ret_type>(std::move(o));                            \
+      }                                                                                        \
+    }                                                                                          \
+  } while (false)
+
+/**
+ * Cached equivalent of OPENASSETIO_PYBIND11_OVERRIDE_NAME.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(ret_type, cname, cache, slot, name, fn, ...) \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                          \
+    return decorateWithExceptionConverter([&]() -> decltype(cname::fn(__VA_ARGS__)) {          \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), \
+                                                cache, slot, name, __VA_ARGS__);               \
+      return cname::fn(__VA_ARGS__);                                                           \
+    });                                                                                        \
+  } while (false)
+
+/**
+ * Cached equivalent of OPENASSETIO_PYBIND11_OVERRIDE.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE(ret_type, cname, cache, slot, fn, ...)               \
+  OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), cache, \
+                                            slot, #fn, fn, __VA_ARGS__)
+
+/**
+ * Cached equivalent of OPENASSETIO_PYBIND11_OVERRIDE_ARGS.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(Ret, Class, cache, slot, Fn, CppArgs,   \
+                                                  ... /* PyArgs */)                       \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                     \
+    return decorateWithExceptionConverter([&]() -> decltype(Class::Fn CppArgs) {          \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(PYBIND11_TYPE(Ret), PYBIND11_TYPE(Class), \
+                                                cache, slot, #Fn, __VA_ARGS__);           \
+      return Class::Fn CppArgs;                                                           \
+    });                                                                                   \
+  } while (false)
+
+/**
+ * Cached equivalent of OPENASSETIO_PYBIND11_OVERRIDE_PURE.
+ */
+#define OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(ret_type, cname, cache, slot, fn, ...)       \
+  do { /* NOLINT(cppcoreguidelines-avoid-do-while) */                                          \
+    return decorateWithExceptionConverter([&]() -> decltype(cname::fn(__VA_ARGS__)) {          \
+      OPENASSETIO_PYBIND11_CACHED_OVERRIDE_IMPL(PYBIND11_TYPE(ret_type), PYBIND11_TYPE(cname), \
+                                                cache, slot, #fn, __VA_ARGS__);                \
+      const pybind11::gil_scoped_acquire gil{};                                                \
+      pybind11::pybind11_fail(                                                                 \
+          "Tried to call pure virtual function \"" PYBIND11_STRINGIFY(cname) "::" #fn "\"");   \
+    });                                                                                        \
+  } while (false)
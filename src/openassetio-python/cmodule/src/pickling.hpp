@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Utilities for pickling bound types.
+ */
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <pybind11/pybind11.h>
+
+#include <openassetio/export.h>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+/**
+ * Register pickle support for a class whose state is a binary
+ * encoding.
+ *
+ * The state is a `bytes` object. For pickle protocol 5 and above it is
+ * wrapped in a `pickle.PickleBuffer`, so that large states can be
+ * transferred out-of-band (i.e. without copying into the pickle
+ * stream) when a `buffer_callback` is supplied. Any contiguous buffer
+ * is accepted when unpickling.
+ *
+ * @param pyClass Class to register with.
+ * @param encode Callable taking a `const Class&` and returning the
+ * encoded state as a `Str`.
+ * @param decode Callable taking a `std::string_view` of the encoded
+ * state and returning a new instance (or holder of an instance).
+ */
+template <class Class, class... Options, class Encode, class Decode>
+void defBinaryPickle(pybind11::class_<Class, Options...>& pyClass, Encode encode,
+                     Decode decode) {
+  pyClass.def(pybind11::pickle(
+      [encode = std::move(encode)](const Class& self) {
+        const Str encoded = encode(self);
+        return pybind11::bytes{encoded.data(), encoded.size()};
+      },
+      [decode = std::move(decode)](const pybind11::buffer& state) {
+        const pybind11::buffer_info info = state.request();
+        return decode(std::string_view{static_cast<const char*>(info.ptr),
+                                       static_cast<std::size_t>(info.size * info.itemsize)});
+      }));
+
+  pyClass.def("__reduce_ex__", [](const pybind11::object& self, const int protocol) {
+    pybind11::object state = self.attr("__getstate__")();
+    // NOLINTNEXTLINE(*-magic-numbers)
+    if (protocol >= 5) {
+      state = pybind11::module_::import("pickle").attr("PickleBuffer")(state);
+    }
+    return pybind11::make_tuple(pybind11::module_::import("copyreg").attr("__newobj__"),
+                                pybind11::make_tuple(pybind11::type::of(self)), state);
+  });
+}
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
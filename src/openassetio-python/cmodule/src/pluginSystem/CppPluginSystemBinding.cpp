@@ -16,10 +16,10 @@
 void registerCppPluginSystem(const py::module_ &mod) {
   using openassetio::pluginSystem::CppPluginSystem;
 
-  // Only bother releasing the GIL for `scan`, since that's the only
-  // method that potentially calls out to virtual method(s). Tests will
-  // catch if this changes (e.g. if we add logger calls in the other
-  // methods).
+  // Only bother releasing the GIL for `scan` and `reload`, since
+  // they're the only methods that potentially call out to virtual
+  // method(s). Tests will catch if this changes (e.g. if we add logger
+  // calls in the other methods).
 
   py::class_<CppPluginSystem, CppPluginSystem::Ptr>(mod, "CppPluginSystem", py::is_final())
       .def(py::init(RetainCommonPyArgs::forFn<&CppPluginSystem::make>()),
@@ -27,6 +27,8 @@ void registerCppPluginSystem(const py::module_ &mod) {
       .def("reset", &CppPluginSystem::reset)
       .def("scan", &CppPluginSystem::scan, py::arg("paths"),
            py::call_guard<py::gil_scoped_release>{})
+      .def("reload", &CppPluginSystem::reload, py::arg("paths"),
+           py::call_guard<py::gil_scoped_release>{})
       .def("identifiers", &CppPluginSystem::identifiers)
       .def("plugin", &CppPluginSystem::plugin, py::arg("identifier"));
 }
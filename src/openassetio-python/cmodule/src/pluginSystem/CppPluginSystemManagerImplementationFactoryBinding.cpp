@@ -34,5 +34,7 @@ void registerCppPluginSystemManagerImplementationFactory(const py::module_& mod)
       .def("identifiers", &CppPluginSystemManagerImplementationFactory::identifiers,
            py::call_guard<py::gil_scoped_release>{})
       .def("instantiate", &CppPluginSystemManagerImplementationFactory::instantiate,
-           py::arg("identifier"), py::call_guard<py::gil_scoped_release>{});
+           py::arg("identifier"), py::call_guard<py::gil_scoped_release>{})
+      .def("reload", &CppPluginSystemManagerImplementationFactory::reload,
+           py::call_guard<py::gil_scoped_release>{});
 }
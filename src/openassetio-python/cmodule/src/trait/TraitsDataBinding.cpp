@@ -1,27 +1,62 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2013-2025 The Foundry Visionmongers Ltd
+#include <cstddef>
 #include <optional>
 #include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 
 #include <pybind11/operators.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/trait/TraitsData.hpp>
 #include <openassetio/trait/collection.hpp>
 #include <openassetio/trait/property.hpp>
 #include <openassetio/utils/ostream.hpp>
 
 #include "../_openassetio.hpp"
+#include "../pickling.hpp"
+#include "TraitsDataEncoding.hpp"
+
+namespace {
+namespace trait = openassetio::trait;
+
+/// Mapping of trait ID to property key to value.
+using TraitsDict =
+    std::unordered_map<trait::TraitId,
+                       std::unordered_map<trait::property::Key, trait::property::Value>>;
+
+/**
+ * Build a nested `{traitId: {propertyKey: value}}` Python dict from a
+ * TraitsData in a single pass.
+ */
+py::dict toPyDict(const trait::TraitsData& traitsData) {
+  py::dict pyTraits;
+  trait::property::Value value;
+  for (const trait::TraitId& traitId : traitsData.traitSet()) {
+    py::dict pyProperties;
+    for (const trait::property::Key& propertyKey : traitsData.traitPropertyKeys(traitId)) {
+      traitsData.getTraitProperty(&value, traitId, propertyKey);
+      pyProperties[py::str(propertyKey)] = py::cast(value);
+    }
+    pyTraits[py::str(traitId)] = std::move(pyProperties);
+  }
+  return pyTraits;
+}
+}  // namespace
 
 void registerTraitsData(const py::module& mod) {
   using openassetio::trait::TraitsData;
   using openassetio::trait::TraitsDataConstPtr;
   using openassetio::trait::TraitsDataPtr;
-  namespace trait = openassetio::trait;
   namespace property = openassetio::trait::property;
   using MaybeValue = std::optional<property::Value>;
 
-  py::class_<TraitsData, TraitsDataPtr>(mod, "TraitsData", py::is_final())
+  py::class_<TraitsData, TraitsDataPtr> traitsData{mod, "TraitsData", py::is_final()};
+
+  traitsData
       .def(py::init(static_cast<TraitsDataPtr (*)()>(&TraitsData::make)))
       .def(py::init(static_cast<TraitsDataPtr (*)(const trait::TraitSet&)>(&TraitsData::make)),
            py::arg("traitSet"))
@@ -44,6 +79,34 @@ void registerTraitsData(const py::module& mod) {
           },
           py::arg("traitId"), py::arg("propertyKey"))
       .def("traitPropertyKeys", &TraitsData::traitPropertyKeys, py::arg("traitId"))
+      .def("toDict", &toPyDict)
+      .def_static(
+          "fromDict",
+          [](const TraitsDict& traitsDict) {
+            TraitsDataPtr traitsData = TraitsData::make();
+            for (const auto& [traitId, properties] : traitsDict) {
+              traitsData->addTrait(traitId);
+              for (const auto& [propertyKey, value] : properties) {
+                traitsData->setTraitProperty(traitId, propertyKey, value);
+              }
+            }
+            return traitsData;
+          },
+          py::arg("traitsDict"))
+      .def_static(
+          "toDicts",
+          [](const trait::TraitsDatas& traitsDatas) {
+            py::list pyDicts{traitsDatas.size()};
+            for (std::size_t idx = 0; idx < traitsDatas.size(); ++idx) {
+              if (!traitsDatas[idx]) {
+                throw openassetio::errors::InputValidationException{
+                    "Traits data cannot be None"};
+              }
+              pyDicts[idx] = toPyDict(*traitsDatas[idx]);
+            }
+            return pyDicts;
+          },
+          py::arg("traitsDatas"))
       .def(py::self == py::self)  // NOLINT(misc-redundant-expression)
       .def("__str__",
            [](const TraitsData& self) {
@@ -56,4 +119,8 @@ void registerTraitsData(const py::module& mod) {
         stringStream << "TraitsData(" << self << ")";
         return stringStream.str();
       });
+
+  openassetio::defBinaryPickle(
+      traitsData, [](const TraitsData& self) { return trait::encodeTraitsData(self); },
+      [](const std::string_view encoded) { return trait::decodeTraitsData(encoded); });
 }
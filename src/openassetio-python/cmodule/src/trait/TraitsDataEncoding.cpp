@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#include "TraitsDataEncoding.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include <openassetio/errors/exceptions.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/trait/property.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+namespace {
+/// Version of the encoding, bumped on incompatible changes.
+constexpr std::uint8_t kFormatVersion = 1;
+
+/// Type tags for property values, in `property::Value` variant order.
+enum class ValueTag : std::uint8_t { kBool, kInt, kFloat, kStr };
+
+/// Append fixed-width values and length-prefixed strings.
+class Writer {
+ public:
+  explicit Writer(Str& out) : out_{out} {}
+
+  void u8(const std::uint8_t value) { out_.push_back(static_cast<char>(value)); }
+
+  void u32(const std::uint32_t value) { fixed(value); }
+
+  void u64(const std::uint64_t value) { fixed(value); }
+
+  void string(const std::string_view value) {
+    u32(static_cast<std::uint32_t>(value.size()));
+    out_.append(value);
+  }
+
+  void traitsData(const TraitsData& traitsData) {
+    const TraitSet traitSet = traitsData.traitSet();
+    u32(static_cast<std::uint32_t>(traitSet.size()));
+    property::Value value;
+    for (const TraitId& traitId : traitSet) {
+      string(traitId);
+      const property::KeySet keys = traitsData.traitPropertyKeys(traitId);
+      u32(static_cast<std::uint32_t>(keys.size()));
+      for (const property::Key& key : keys) {
+        string(key);
+        traitsData.getTraitProperty(&value, traitId, key);
+        u8(static_cast<std::uint8_t>(value.index()));
+        std::visit(
+            [this](const auto& concrete) {
+              using T = std::decay_t<decltype(concrete)>;
+              if constexpr (std::is_same_v<T, Bool>) {
+                u8(static_cast<std::uint8_t>(concrete));
+              } else if constexpr (std::is_same_v<T, Int>) {
+                u64(static_cast<std::uint64_t>(concrete));
+              } else if constexpr (std::is_same_v<T, Float>) {
+                std::uint64_t bits = 0;
+                std::memcpy(&bits, &concrete, sizeof(bits));
+                u64(bits);
+              } else {
+                string(concrete);
+              }
+            },
+            value);
+      }
+    }
+  }
+
+ private:
+  template <class T>
+  void fixed(const T value) {
+    for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+      out_.push_back(static_cast<char>((value >> (byte * 8U)) & 0xFFU));
+    }
+  }
+
+  Str& out_;
+};
+
+static_assert(sizeof(Float) == sizeof(std::uint64_t));
+
+/// Consume values written by Writer, validating bounds.
+class Reader {
+ public:
+  explicit Reader(const std::string_view in) : in_{in} {}
+
+  std::uint8_t u8() { return static_cast<std::uint8_t>(take(1)[0]); }
+
+  std::uint32_t u32() { return fixed<std::uint32_t>(); }
+
+  std::uint64_t u64() { return fixed<std::uint64_t>(); }
+
+  std::string_view string() { return take(u32()); }
+
+  TraitsDataPtr traitsData() {
+    TraitsDataPtr traitsData = TraitsData::make();
+    const std::uint32_t numTraits = u32();
+    for (std::uint32_t traitIdx = 0; traitIdx < numTraits; ++traitIdx) {
+      const TraitId traitId{string()};
+      traitsData->addTrait(traitId);
+      const std::uint32_t numProperties = u32();
+      for (std::uint32_t propertyIdx = 0; propertyIdx < numProperties; ++propertyIdx) {
+        const property::Key key{string()};
+        traitsData->setTraitProperty(traitId, key, value());
+      }
+    }
+    return traitsData;
+  }
+
+  void version() {
+    if (u8() != kFormatVersion) {
+      fail();
+    }
+  }
+
+  void expectEnd() const {
+    if (!in_.empty()) {
+      fail();
+    }
+  }
+
+ private:
+  property::Value value() {
+    switch (static_cast<ValueTag>(u8())) {
+      case ValueTag::kBool:
+        return u8() != 0;
+      case ValueTag::kInt:
+        return static_cast<Int>(u64());
+      case ValueTag::kFloat: {
+        const std::uint64_t bits = u64();
+        Float concrete = 0;
+        std::memcpy(&concrete, &bits, sizeof(concrete));
+        return concrete;
+      }
+      case ValueTag::kStr:
+        return Str{string()};
+    }
+    fail();
+  }
+
+  template <class T>
+  T fixed() {
+    const std::string_view bytes = take(sizeof(T));
+    T value = 0;
+    for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+      value |= static_cast<T>(static_cast<std::uint8_t>(bytes[byte])) << (byte * 8U);
+    }
+    return value;
+  }
+
+  std::string_view take(const std::size_t size) {
+    if (size > in_.size()) {
+      fail();
+    }
+    const std::string_view bytes = in_.substr(0, size);
+    in_.remove_prefix(size);
+    return bytes;
+  }
+
+  [[noreturn]] static void fail() {
+    throw errors::InputValidationException{"Malformed TraitsData encoding"};
+  }
+
+  std::string_view in_;
+};
+}  // namespace
+
+Str encodeTraitsData(const TraitsData& traitsData) {
+  Str encoded;
+  Writer writer{encoded};
+  writer.u8(kFormatVersion);
+  writer.traitsData(traitsData);
+  return encoded;
+}
+
+TraitsDataPtr decodeTraitsData(const std::string_view encoded) {
+  Reader reader{encoded};
+  reader.version();
+  TraitsDataPtr traitsData = reader.traitsData();
+  reader.expectEnd();
+  return traitsData;
+}
+
+Str encodeTraitsDatas(const TraitsDatas& traitsDatas) {
+  Str encoded;
+  Writer writer{encoded};
+  writer.u8(kFormatVersion);
+  writer.u64(traitsDatas.size());
+  for (const TraitsDataPtr& traitsData : traitsDatas) {
+    if (!traitsData) {
+      throw errors::InputValidationException{"Traits data cannot be None"};
+    }
+    writer.traitsData(*traitsData);
+  }
+  return encoded;
+}
+
+TraitsDatas decodeTraitsDatas(const std::string_view encoded) {
+  Reader reader{encoded};
+  reader.version();
+  const std::uint64_t size = reader.u64();
+  TraitsDatas traitsDatas;
+  // Don't trust the size for preallocation beyond what the encoding
+  // could possibly hold, i.e. at least 4 bytes per element.
+  traitsDatas.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(size, encoded.size() / 4)));
+  for (std::uint64_t idx = 0; idx < size; ++idx) {
+    traitsDatas.push_back(reader.traitsData());
+  }
+  reader.expectEnd();
+  return traitsDatas;
+}
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
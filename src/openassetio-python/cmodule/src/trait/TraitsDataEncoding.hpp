@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2025 The Foundry Visionmongers Ltd
+#pragma once
+/**
+ * Compact binary encoding of TraitsData, used as pickle state.
+ */
+#include <string_view>
+
+#include <openassetio/export.h>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
+#include <openassetio/typedefs.hpp>
+
+namespace openassetio {
+inline namespace OPENASSETIO_CORE_ABI_VERSION {
+namespace trait {
+/**
+ * Encode a TraitsData.
+ *
+ * The encoding is a format version byte followed by the number of
+ * traits, then each trait ID with its properties as key, type tag and
+ * value. Integers are fixed-width little-endian, and strings are
+ * length-prefixed, so the encoding is portable between processes and
+ * platforms.
+ */
+Str encodeTraitsData(const TraitsData& traitsData);
+
+/**
+ * Decode a TraitsData previously encoded by @ref encodeTraitsData.
+ *
+ * @throw errors::InputValidationException if the encoding is
+ * malformed.
+ */
+TraitsDataPtr decodeTraitsData(std::string_view encoded);
+
+/**
+ * Encode a batch of TraitsData as a single contiguous block.
+ *
+ * @throw errors::InputValidationException if any element is null.
+ */
+Str encodeTraitsDatas(const TraitsDatas& traitsDatas);
+
+/**
+ * Decode a batch of TraitsData previously encoded by
+ * @ref encodeTraitsDatas.
+ *
+ * @throw errors::InputValidationException if the encoding is
+ * malformed.
+ */
+TraitsDatas decodeTraitsDatas(std::string_view encoded);
+}  // namespace trait
+}  // namespace OPENASSETIO_CORE_ABI_VERSION
+}  // namespace openassetio
@@ -1,8 +1,16 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2023 The Foundry Visionmongers Ltd
+// Copyright 2023-2025 The Foundry Visionmongers Ltd
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <openassetio/InfoDictionary.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
 #include <openassetio/utils/path.hpp>
 #include <openassetio/utils/substitute.hpp>
 
@@ -11,17 +19,102 @@
 void registerUtils(py::module_ &mod) {
   namespace utils = openassetio::utils;
 
+  // Take batches of paths as owning strings, then view them. Views
+  // loaded directly by pybind would point into each element's Python
+  // str, which need not outlive the conversion, e.g. if the input
+  // sequence creates its elements on access.
+  const auto asStringViews = [](const std::vector<std::string>& strings) {
+    return std::vector<std::string_view>(strings.begin(), strings.end());
+  };
+
   py::enum_<utils::PathType>{mod, "PathType"}
       .value("kSystem", utils::PathType::kSystem)
       .value("kPOSIX", utils::PathType::kPOSIX)
       .value("kWindows", utils::PathType::kWindows);
 
+  py::class_<utils::PathBatchResult>(mod, "PathBatchResult")
+      .def(py::init())
+      .def("__len__", &utils::PathBatchResult::size)
+      .def("__getitem__",
+           [](const utils::PathBatchResult& self, py::ssize_t index) {
+             const auto size = static_cast<py::ssize_t>(self.size());
+             if (index < 0) {
+               index += size;
+             }
+             if (index < 0 || index >= size) {
+               throw py::index_error{};
+             }
+             return self[static_cast<std::size_t>(index)];
+           })
+      .def("bytes",
+           [](const utils::PathBatchResult& self) {
+             return py::bytes{self.bytes.data(), self.bytes.size()};
+           })
+      .def("offsets",
+           [](const utils::PathBatchResult& self) {
+             // Pack as unsigned 64-bit integers, rather than creating a
+             // Python int per element.
+             const std::vector<std::uint64_t> offsets(self.offsets.begin(), self.offsets.end());
+             const py::bytes packed{
+                 reinterpret_cast<const char*>(offsets.data()),  // NOLINT(*-reinterpret-cast)
+                 offsets.size() * sizeof(std::uint64_t)};
+             return py::memoryview{packed}.attr("cast")("Q");
+           })
+      .def("errors", [](const utils::PathBatchResult& self) {
+        py::dict errors;
+        for (const auto& [index, error] : self.elementErrors) {
+          errors[py::int_(index)] = error;
+        }
+        return errors;
+      });
+
   py::class_<utils::FileUrlPathConverter>(mod, "FileUrlPathConverter")
       .def(py::init())
-      .def("pathToUrl", &utils::FileUrlPathConverter::pathToUrl, py::arg("absolutePath"),
-           py::arg("pathType") = utils::PathType::kSystem)
-      .def("pathFromUrl", &utils::FileUrlPathConverter::pathFromUrl, py::arg("fileUrl"),
-           py::arg("pathType") = utils::PathType::kSystem);
+      .def("pathToUrl",
+           py::overload_cast<std::string_view, utils::PathType>(
+               &utils::FileUrlPathConverter::pathToUrl, py::const_),
+           py::arg("absolutePath"), py::arg("pathType") = utils::PathType::kSystem)
+      .def(
+          "pathToUrl",
+          [asStringViews](const utils::FileUrlPathConverter& self,
+                          const std::vector<std::string>& absolutePaths,
+                          utils::PathBatchResult& result, const utils::PathType pathType) {
+            self.pathToUrl(asStringViews(absolutePaths), result, pathType);
+          },
+          py::arg("absolutePaths"), py::arg("result"),
+          py::arg("pathType") = utils::PathType::kSystem)
+      .def("pathFromUrl",
+           py::overload_cast<std::string_view, utils::PathType>(
+               &utils::FileUrlPathConverter::pathFromUrl, py::const_),
+           py::arg("fileUrl"), py::arg("pathType") = utils::PathType::kSystem)
+      .def(
+          "pathFromUrl",
+          [asStringViews](const utils::FileUrlPathConverter& self,
+                          const std::vector<std::string>& fileUrls,
+                          utils::PathBatchResult& result, const utils::PathType pathType) {
+            self.pathFromUrl(asStringViews(fileUrls), result, pathType);
+          },
+          py::arg("fileUrls"), py::arg("result"), py::arg("pathType") = utils::PathType::kSystem);
 
   mod.def("substitute", &utils::substitute, py::arg("input"), py::arg("substitutions"));
+
+  using utils::CompiledTemplate;
+  using openassetio::InfoDictionary;
+  using openassetio::InfoDictionaryValue;
+
+  py::class_<CompiledTemplate>{mod, "CompiledTemplate", py::is_final()}
+      .def(py::init<std::string_view>(), py::arg("input"))
+      .def("input", &CompiledTemplate::input)
+      .def("placeholders", &CompiledTemplate::placeholders)
+      .def("substitute",
+           py::overload_cast<const InfoDictionary &>(&CompiledTemplate::substitute, py::const_),
+           py::arg("substitutions"), py::call_guard<py::gil_scoped_release>{})
+      .def("substitute",
+           py::overload_cast<const std::vector<InfoDictionary> &>(&CompiledTemplate::substitute,
+                                                                  py::const_),
+           py::arg("substitutionsBatch"), py::call_guard<py::gil_scoped_release>{})
+      .def("substitute",
+           py::overload_cast<const std::vector<InfoDictionaryValue> &>(
+               &CompiledTemplate::substitute, py::const_),
+           py::arg("values"), py::call_guard<py::gil_scoped_release>{});
 }
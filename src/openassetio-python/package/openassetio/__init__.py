@@ -79,6 +79,7 @@ if os.name == "nt":
 # pylint: disable=wrong-import-position,import-error,no-name-in-module
 from ._openassetio import (
     constants,
+    CancellationToken,
     Context,
     EntityReference,
     majorVersion,
@@ -0,0 +1,26 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+@namespace openassetio.exec
+Provides the classes used to run work concurrently, shared between
+hosts and managers.
+"""
+
+from . import _openassetio  # pylint: disable=no-name-in-module
+
+
+ExecutorInterface = _openassetio.exec.ExecutorInterface
+ThreadPool = _openassetio.exec.ThreadPool
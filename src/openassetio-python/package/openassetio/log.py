@@ -24,3 +24,4 @@ from . import _openassetio  # pylint: disable=no-name-in-module
 LoggerInterface = _openassetio.log.LoggerInterface
 ConsoleLogger = _openassetio.log.ConsoleLogger
 SeverityFilter = _openassetio.log.SeverityFilter
+AsyncLogger = _openassetio.log.AsyncLogger
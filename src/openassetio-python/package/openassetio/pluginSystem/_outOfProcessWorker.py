@@ -0,0 +1,609 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+@namespace openassetio.pluginSystem._outOfProcessWorker
+Worker process hosting a Python manager plugin on behalf of an
+out-of-process manager proxy in another (C++) process.
+
+@warning This is an internal module. The wire protocol is private to
+OpenAssetIO and may change between releases.
+
+The worker is launched as
+
+    python -m openassetio.pluginSystem._outOfProcessWorker <fd>
+
+where `<fd>` is an inherited file descriptor of one end of a connected
+Unix domain stream socket. Requests are serviced one at a time until the
+other end of the socket is closed.
+
+Messages are frames consisting of a `uint32` payload length followed by
+the payload. All integers are in native byte order, since both ends of
+the socket are on the same machine.
+
+A request payload is a `uint8` opcode (see @ref Op) followed by its
+arguments. The worker replies with zero or more log frames, followed by
+exactly one result or exception frame (see @ref Reply).
+
+Batch methods reply with a `uint32` element count, followed by each
+element as a `uint8` tag (see @ref Element) and either the value or a
+`uint8` error code and a string message.
+"""
+import socket
+import struct
+import sys
+import threading
+
+from .. import Context, EntityReference
+from ..hostApi import HostInterface
+from ..log import LoggerInterface
+from ..managerApi import Host, HostSession, ManagerInterface
+from ..trait import TraitsData
+from .. import access
+from .PythonPluginSystemManagerImplementationFactory import (
+    PythonPluginSystemManagerImplementationFactory,
+)
+
+
+# pylint: disable=too-few-public-methods
+
+
+class Op:
+    """
+    Request opcodes. Must match the C++ proxy.
+    """
+
+    kIdentifiers = 0
+    kInstantiate = 1
+    kIdentifier = 2
+    kDisplayName = 3
+    kInfo = 4
+    kSettings = 5
+    kInitialize = 6
+    kFlushCaches = 7
+    kHasCapability = 8
+    kUpdateTerminology = 9
+    kIsEntityReferenceString = 10
+    kManagementPolicy = 11
+    kEntityExists = 12
+    kEntityTraits = 13
+    kResolve = 14
+    kPreflight = 15
+    kRegister = 16
+
+
+class Reply:
+    """
+    Kinds of reply frame. Must match the C++ proxy.
+    """
+
+    kResult = 0
+    kLog = 1
+    kException = 2
+
+
+class Element:
+    """
+    Tags for elements of batch results. Must match the C++ proxy.
+    """
+
+    kValue = 0
+    kError = 1
+
+
+class ValueType:
+    """
+    Tags for dictionary and trait property values. Must match the C++
+    proxy.
+    """
+
+    kBool = 0
+    kInt = 1
+    kFloat = 2
+    kStr = 3
+
+
+class MalformedMessageError(Exception):
+    """
+    Raised when a message cannot be decoded.
+    """
+
+
+class Writer:
+    """
+    Encoder for message payloads.
+    """
+
+    def __init__(self):
+        self.__parts = []
+
+    def u8(self, value):
+        self.__parts.append(struct.pack("=B", value))
+
+    def u32(self, value):
+        self.__parts.append(struct.pack("=I", value))
+
+    def i64(self, value):
+        self.__parts.append(struct.pack("=q", value))
+
+    def f64(self, value):
+        self.__parts.append(struct.pack("=d", value))
+
+    def string(self, value):
+        data = value.encode("utf-8")
+        self.u32(len(data))
+        self.__parts.append(data)
+
+    def strings(self, values):
+        values = list(values)
+        self.u32(len(values))
+        for value in values:
+            self.string(value)
+
+    def value(self, value):
+        # Note: bool is a subclass of int, so must be checked first.
+        if isinstance(value, bool):
+            self.u8(ValueType.kBool)
+            self.u8(value)
+        elif isinstance(value, int):
+            self.u8(ValueType.kInt)
+            self.i64(value)
+        elif isinstance(value, float):
+            self.u8(ValueType.kFloat)
+            self.f64(value)
+        else:
+            self.u8(ValueType.kStr)
+            self.string(value)
+
+    def dictionary(self, values):
+        self.u32(len(values))
+        for key, value in values.items():
+            self.string(key)
+            self.value(value)
+
+    def strMap(self, values):
+        self.u32(len(values))
+        for key, value in values.items():
+            self.string(key)
+            self.string(value)
+
+    def traitsData(self, traitsData):
+        traitSet = traitsData.traitSet()
+        self.u32(len(traitSet))
+        for traitId in traitSet:
+            self.string(traitId)
+            keys = traitsData.traitPropertyKeys(traitId)
+            self.u32(len(keys))
+            for key in keys:
+                self.string(key)
+                self.value(traitsData.getTraitProperty(traitId, key))
+
+    def traitsDatas(self, traitsDatas):
+        self.u32(len(traitsDatas))
+        for traitsData in traitsDatas:
+            self.traitsData(traitsData)
+
+    def traitSets(self, traitSets):
+        self.u32(len(traitSets))
+        for traitSet in traitSets:
+            self.strings(traitSet)
+
+    def context(self, context):
+        self.traitsData(context.locale)
+
+    def payload(self):
+        return b"".join(self.__parts)
+
+
+class Reader:
+    """
+    Decoder for message payloads.
+    """
+
+    def __init__(self, payload):
+        self.__payload = payload
+        self.__offset = 0
+
+    def __unpack(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.__offset + size > len(self.__payload):
+            raise MalformedMessageError("Truncated message")
+        (value,) = struct.unpack_from(fmt, self.__payload, self.__offset)
+        self.__offset += size
+        return value
+
+    def u8(self):
+        return self.__unpack("=B")
+
+    def u32(self):
+        return self.__unpack("=I")
+
+    def i64(self):
+        return self.__unpack("=q")
+
+    def f64(self):
+        return self.__unpack("=d")
+
+    def string(self):
+        size = self.u32()
+        if self.__offset + size > len(self.__payload):
+            raise MalformedMessageError("Truncated message")
+        value = self.__payload[self.__offset : self.__offset + size].decode("utf-8")
+        self.__offset += size
+        return value
+
+    def strings(self):
+        return [self.string() for _ in range(self.u32())]
+
+    def value(self):
+        valueType = self.u8()
+        if valueType == ValueType.kBool:
+            return bool(self.u8())
+        if valueType == ValueType.kInt:
+            return self.i64()
+        if valueType == ValueType.kFloat:
+            return self.f64()
+        if valueType == ValueType.kStr:
+            return self.string()
+        raise MalformedMessageError(f"Unknown value type {valueType}")
+
+    def dictionary(self):
+        return {self.string(): self.value() for _ in range(self.u32())}
+
+    def strMap(self):
+        return {self.string(): self.string() for _ in range(self.u32())}
+
+    def traitsData(self):
+        traitsData = TraitsData()
+        for _ in range(self.u32()):
+            traitId = self.string()
+            traitsData.addTrait(traitId)
+            for _ in range(self.u32()):
+                key = self.string()
+                traitsData.setTraitProperty(traitId, key, self.value())
+        return traitsData
+
+    def traitsDatas(self):
+        return [self.traitsData() for _ in range(self.u32())]
+
+    def traitSets(self):
+        return [set(self.strings()) for _ in range(self.u32())]
+
+    def entityReferences(self):
+        return [EntityReference(ref) for ref in self.strings()]
+
+    def context(self):
+        return Context(self.traitsData())
+
+    def atEnd(self):
+        return self.__offset == len(self.__payload)
+
+
+def sendFrame(connection, payload):
+    """
+    Send a length-prefixed frame.
+    """
+    connection.sendall(struct.pack("=I", len(payload)) + payload)
+
+
+def receiveFrame(connection):
+    """
+    Receive a length-prefixed frame.
+
+    @return Frame payload, or `None` if the connection was closed before
+    a new frame was started.
+    """
+    header = _receiveExactly(connection, struct.calcsize("=I"))
+    if header is None:
+        return None
+    (size,) = struct.unpack("=I", header)
+    payload = _receiveExactly(connection, size)
+    if payload is None:
+        raise MalformedMessageError("Connection closed mid-frame")
+    return payload
+
+
+def _receiveExactly(connection, size):
+    chunks = []
+    remaining = size
+    while remaining:
+        chunk = connection.recv(remaining)
+        if not chunk:
+            if remaining == size:
+                return None
+            raise MalformedMessageError("Connection closed mid-frame")
+        chunks.append(chunk)
+        remaining -= len(chunk)
+    return b"".join(chunks)
+
+
+class _ForwardingLogger(LoggerInterface):
+    """
+    Logger that forwards messages to the proxy as log frames.
+
+    Managers may log from their own threads, so frames are sent under
+    a lock shared with the worker's replies, such that frames are never
+    interleaved.
+    """
+
+    def __init__(self, connection, sendLock):
+        LoggerInterface.__init__(self)
+        self.__connection = connection
+        self.__sendLock = sendLock
+
+    def log(self, severity, message):
+        writer = Writer()
+        writer.u8(Reply.kLog)
+        writer.u8(int(severity))
+        writer.string(message)
+        with self.__sendLock:
+            sendFrame(self.__connection, writer.payload())
+
+
+class _RemoteHostInterface(HostInterface):
+    """
+    Stand-in for the host's HostInterface, populated when the manager
+    is initialized.
+    """
+
+    def __init__(self):
+        HostInterface.__init__(self)
+        self.hostIdentifier = ""
+        self.hostDisplayName = ""
+        self.hostInfo = {}
+
+    def identifier(self):
+        return self.hostIdentifier
+
+    def displayName(self):
+        return self.hostDisplayName
+
+    def info(self):
+        return self.hostInfo
+
+
+class Worker:
+    """
+    Services requests from an out-of-process manager proxy over a
+    connected socket.
+    """
+
+    def __init__(self, connection, implementationFactory=None):
+        """
+        @param connection Connected stream socket.
+
+        @param implementationFactory
+        @fqref{hostApi.ManagerImplementationFactoryInterface}
+        "ManagerImplementationFactoryInterface" used to instantiate the
+        manager. Defaults to a
+        @ref openassetio.pluginSystem.PythonPluginSystemManagerImplementationFactory
+        "PythonPluginSystemManagerImplementationFactory".
+        """
+        self.__connection = connection
+        # Guards all sends on the connection.
+        self.__sendLock = threading.Lock()
+        self.__logger = _ForwardingLogger(connection, self.__sendLock)
+        self.__factory = implementationFactory or PythonPluginSystemManagerImplementationFactory(
+            self.__logger
+        )
+        self.__hostInterface = _RemoteHostInterface()
+        self.__hostSession = HostSession(Host(self.__hostInterface), self.__logger)
+        self.__interface = None
+        self.__handlers = {
+            Op.kIdentifiers: self.__identifiers,
+            Op.kInstantiate: self.__instantiate,
+            Op.kIdentifier: lambda _, writer: writer.string(self.__interface.identifier()),
+            Op.kDisplayName: lambda _, writer: writer.string(self.__interface.displayName()),
+            Op.kInfo: lambda _, writer: writer.dictionary(self.__interface.info()),
+            Op.kSettings: lambda _, writer: writer.dictionary(
+                self.__interface.settings(self.__hostSession)
+            ),
+            Op.kInitialize: self.__initialize,
+            Op.kFlushCaches: lambda *_: self.__interface.flushCaches(self.__hostSession),
+            Op.kHasCapability: self.__hasCapability,
+            Op.kUpdateTerminology: lambda reader, writer: writer.strMap(
+                self.__interface.updateTerminology(reader.strMap(), self.__hostSession)
+            ),
+            Op.kIsEntityReferenceString: lambda reader, writer: writer.u8(
+                self.__interface.isEntityReferenceString(reader.string(), self.__hostSession)
+            ),
+            Op.kManagementPolicy: self.__managementPolicy,
+            Op.kEntityExists: self.__entityExists,
+            Op.kEntityTraits: self.__entityTraits,
+            Op.kResolve: self.__resolve,
+            Op.kPreflight: self.__preflight,
+            Op.kRegister: self.__register,
+        }
+
+    def serve(self):
+        """
+        Service requests until the connection is closed.
+        """
+        while (request := receiveFrame(self.__connection)) is not None:
+            reply = self.handle(request)
+            with self.__sendLock:
+                sendFrame(self.__connection, reply)
+
+    def handle(self, request):
+        """
+        Handle a single request.
+
+        @param request Request payload.
+
+        @return Reply payload.
+        """
+        writer = Writer()
+        writer.u8(Reply.kResult)
+        try:
+            reader = Reader(request)
+            opcode = reader.u8()
+            handler = self.__handlers.get(opcode)
+            if handler is None:
+                raise MalformedMessageError(f"Unknown opcode {opcode}")
+            if self.__interface is None and opcode not in (Op.kIdentifiers, Op.kInstantiate):
+                raise MalformedMessageError("Manager has not been instantiated")
+            handler(reader, writer)
+            if not reader.atEnd():
+                raise MalformedMessageError("Unexpected trailing data")
+        except Exception as exc:  # pylint: disable=broad-except
+            writer = Writer()
+            writer.u8(Reply.kException)
+            writer.string(type(exc).__name__)
+            writer.string(str(exc))
+        return writer.payload()
+
+    def __identifiers(self, _reader, writer):
+        writer.strings(self.__factory.identifiers())
+
+    def __instantiate(self, reader, _writer):
+        self.__interface = self.__factory.instantiate(reader.string())
+
+    def __initialize(self, reader, _writer):
+        self.__hostInterface.hostIdentifier = reader.string()
+        self.__hostInterface.hostDisplayName = reader.string()
+        self.__hostInterface.hostInfo = reader.dictionary()
+        self.__interface.initialize(reader.dictionary(), self.__hostSession)
+
+    def __hasCapability(self, reader, writer):
+        capability = ManagerInterface.Capability(reader.u8())
+        writer.u8(self.__interface.hasCapability(capability))
+
+    def __managementPolicy(self, reader, writer):
+        traitSets = reader.traitSets()
+        policyAccess = access.PolicyAccess(reader.u8())
+        context = reader.context()
+        writer.traitsDatas(
+            self.__interface.managementPolicy(
+                traitSets, policyAccess, context, self.__hostSession
+            )
+        )
+
+    def __entityExists(self, reader, writer):
+        entityReferences = reader.entityReferences()
+        context = reader.context()
+        self.__batch(
+            writer,
+            len(entityReferences),
+            writer.u8,
+            lambda success, error: self.__interface.entityExists(
+                entityReferences, context, self.__hostSession, success, error
+            ),
+        )
+
+    def __entityTraits(self, reader, writer):
+        entityReferences = reader.entityReferences()
+        entityTraitsAccess = access.EntityTraitsAccess(reader.u8())
+        context = reader.context()
+        self.__batch(
+            writer,
+            len(entityReferences),
+            writer.strings,
+            lambda success, error: self.__interface.entityTraits(
+                entityReferences, entityTraitsAccess, context, self.__hostSession, success, error
+            ),
+        )
+
+    def __resolve(self, reader, writer):
+        entityReferences = reader.entityReferences()
+        traitSet = set(reader.strings())
+        resolveAccess = access.ResolveAccess(reader.u8())
+        context = reader.context()
+        self.__batch(
+            writer,
+            len(entityReferences),
+            writer.traitsData,
+            lambda success, error: self.__interface.resolve(
+                entityReferences,
+                traitSet,
+                resolveAccess,
+                context,
+                self.__hostSession,
+                success,
+                error,
+            ),
+        )
+
+    def __preflight(self, reader, writer):
+        self.__publish(reader, writer, self.__interface.preflight)
+
+    def __register(self, reader, writer):
+        self.__publish(reader, writer, self.__interface.register)
+
+    def __publish(self, reader, writer, method):
+        entityReferences = reader.entityReferences()
+        traitsDatas = reader.traitsDatas()
+        publishingAccess = access.PublishingAccess(reader.u8())
+        context = reader.context()
+        self.__batch(
+            writer,
+            len(entityReferences),
+            lambda ref: writer.string(ref.toString()),
+            lambda success, error: method(
+                entityReferences,
+                traitsDatas,
+                publishingAccess,
+                context,
+                self.__hostSession,
+                success,
+                error,
+            ),
+        )
+
+    @staticmethod
+    def __batch(writer, size, writeValue, call):
+        """
+        Call a callback-based batch method, collecting the results, then
+        write them in index order.
+        """
+        results = [None] * size
+
+        def success(idx, value):
+            results[idx] = (Element.kValue, value)
+
+        def error(idx, batchElementError):
+            results[idx] = (Element.kError, batchElementError)
+
+        call(success, error)
+
+        writer.u32(size)
+        for idx, result in enumerate(results):
+            if result is None:
+                raise MalformedMessageError(f"No result for element {idx}")
+            tag, value = result
+            writer.u8(tag)
+            if tag == Element.kValue:
+                writeValue(value)
+            else:
+                writer.u8(int(value.code))
+                writer.string(value.message)
+
+
+def main(argv):
+    """
+    Entry point, servicing requests on an inherited socket.
+
+    @param argv Command line arguments, where the first argument is the
+    file descriptor of the socket.
+    """
+    if len(argv) != 2:
+        sys.stderr.write(f"Usage: {argv[0]} <fd>\n")
+        return 2
+    with socket.socket(fileno=int(argv[1])) as connection:
+        Worker(connection).serve()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -25,4 +25,8 @@ PathType = _openassetio.utils.PathType
 
 FileUrlPathConverter = _openassetio.utils.FileUrlPathConverter
 
+PathBatchResult = _openassetio.utils.PathBatchResult
+
 substitute = _openassetio.utils.substitute
+
+CompiledTemplate = _openassetio.utils.CompiledTemplate
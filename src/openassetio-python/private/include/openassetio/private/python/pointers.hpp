@@ -1,5 +1,5 @@
 // SPDX-License-Identifier: Apache-2.0
-// Copyright 2022 The Foundry Visionmongers Ltd
+// Copyright 2022-2025 The Foundry Visionmongers Ltd
 #pragma once
 #include <memory>
 #include <utility>
@@ -14,6 +14,20 @@ namespace py = pybind11;
 namespace openassetio {
 inline namespace OPENASSETIO_CORE_ABI_VERSION {
 namespace python::pointers {
+/**
+ * Check whether the Python interpreter is shutting down.
+ *
+ * `_Py_IsFinalizing` was made public as `Py_IsFinalizing` in Python
+ * 3.13, and the private name removed from the headers.
+ */
+inline bool isFinalizing() {
+#if PY_VERSION_HEX >= 0x030D0000
+  return Py_IsFinalizing() != 0;
+#else
+  return _Py_IsFinalizing() != 0;
+#endif
+}
+
 /**
  * Get a shared_ptr-compatible smart pointer that controls the lifetime
  * of a Python object reference, but dereferences to a C++ object.
@@ -46,9 +60,9 @@ Ptr createPyRetainingPtr(const py::object& pyInstance,
   // Custom deleter for shared_ptr below.
   const auto deleter = [](py::object* pyObjectPtr) {
     // Note: Technically we have a race condition here with
-    // _Py_IsFinalizing if multiple threads are involved, but that is a
+    // isFinalizing if multiple threads are involved, but that is a
     // corner case of a corner case, and difficult to solve.
-    if (_Py_IsFinalizing()) {
+    if (isFinalizing()) {
       // If the Python interpreter is gone, clear the internal PyObject*
       // so pybind11 won't attempt to clean it up.
       pyObjectPtr->release();
@@ -56,6 +70,8 @@ Ptr createPyRetainingPtr(const py::object& pyInstance,
       delete pyObjectPtr;
     } else {
       // Acquire the GIL, in case deleter runs in a non-Python thread.
+      // In free-threaded builds there is no GIL, but this still
+      // attaches a thread state, which is required to decref.
       // Note: We may be inside the destructor of some parent object,
       // and yet it is possible that pybind11 will throw an exception
       // here trying to acquire the GIL (though only in catastrophic
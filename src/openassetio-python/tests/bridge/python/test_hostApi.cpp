@@ -1,15 +1,26 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2022-2025 The Foundry Visionmongers Ltd
+#include <cstddef>
 #include <memory>
+#include <thread>
+#include <variant>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 #include <catch2/catch.hpp>
 #include <catch2/trompeloeil.hpp>
 #include <trompeloeil.hpp>
 
+#include <openassetio/EntityReference.hpp>
+#include <openassetio/access.hpp>
+#include <openassetio/errors/BatchElementError.hpp>
+#include <openassetio/errors/exceptions.hpp>
 #include <openassetio/hostApi/ManagerImplementationFactoryInterface.hpp>
 #include <openassetio/log/LoggerInterface.hpp>
+#include <openassetio/managerApi/ManagerInterface.hpp>
 #include <openassetio/python/hostApi.hpp>
+#include <openassetio/trait/TraitsData.hpp>
+#include <openassetio/trait/collection.hpp>
 #include <openassetio/typedefs.hpp>
 
 namespace {
@@ -17,6 +28,18 @@ struct MockLogger : trompeloeil::mock_interface<openassetio::log::LoggerInterfac
   IMPLEMENT_MOCK2(log);
 };
 using trompeloeil::_;
+
+/**
+ * Query the Python `id()` of the test manager instance that services a
+ * call.
+ */
+openassetio::Int servicingInstanceId(const openassetio::managerApi::ManagerInterfacePtr& manager) {
+  const openassetio::trait::TraitsDatas policies = manager->managementPolicy(
+      {{}}, openassetio::access::PolicyAccess::kRead, nullptr, nullptr);
+  openassetio::trait::property::Value instanceId;
+  policies.at(0)->getTraitProperty(&instanceId, "instance", "id");
+  return std::get<openassetio::Int>(instanceId);
+}
 }  // namespace
 
 SCENARIO("Accessing the Python plugin system from C++") {
@@ -44,5 +67,186 @@ SCENARIO("Accessing the Python plugin system from C++") {
         }
       }
     }
+
+    AND_GIVEN("a pooled Python plugin system manager factory with two instances") {
+      const openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory =
+          openassetio::python::hostApi::createPythonPluginSystemManagerImplementationFactory(
+              logger, 2);
+
+      WHEN("the list of plugin identifiers is queried") {
+        const openassetio::Identifiers identifiers = factory->identifiers();
+
+        THEN("identifiers are those of the underlying plugin system") {
+          CHECK(identifiers == openassetio::Identifiers{
+                                   "org.openassetio.test.pluginSystem.resources.modulePlugin"});
+        }
+      }
+
+      AND_GIVEN("a manager instantiated from the factory") {
+        const openassetio::managerApi::ManagerInterfacePtr manager = factory->instantiate(
+            "org.openassetio.test.pluginSystem.resources.modulePlugin");
+
+        CHECK(manager->identifier() ==
+              "org.openassetio.test.pluginSystem.resources.modulePlugin");
+
+        WHEN("calls are made whilst another call is in progress") {
+          openassetio::Int outerInstanceId = 0;
+          openassetio::Int nestedInstanceId = 0;
+          openassetio::Int concurrentInstanceId = 0;
+
+          manager->resolve(
+              {openassetio::EntityReference{"ref"}}, {"instance"},
+              openassetio::access::ResolveAccess::kRead, nullptr, nullptr,
+              [&](std::size_t, const openassetio::trait::TraitsDataPtr& traitsData) {
+                openassetio::trait::property::Value instanceId;
+                traitsData->getTraitProperty(&instanceId, "instance", "id");
+                outerInstanceId = std::get<openassetio::Int>(instanceId);
+
+                nestedInstanceId = servicingInstanceId(manager);
+
+                // Callback is called from Python, holding the GIL.
+                const pybind11::gil_scoped_release releaseGil{};
+                std::thread{[&] { concurrentInstanceId = servicingInstanceId(manager); }}.join();
+              },
+              [](std::size_t, const openassetio::errors::BatchElementError&) { FAIL(); });
+
+          THEN("nested calls from the same thread use the same instance") {
+            CHECK(nestedInstanceId == outerInstanceId);
+          }
+
+          AND_THEN("concurrent calls from another thread use a different instance") {
+            CHECK(concurrentInstanceId != outerInstanceId);
+          }
+        }
+      }
+    }
+  }
+}
+
+#ifndef _WIN32
+SCENARIO("Accessing Python managers hosted in worker processes from C++") {
+  namespace errors = openassetio::errors;
+  using openassetio::access::ResolveAccess;
+  using openassetio::trait::TraitsDataPtr;
+
+  // Workers don't need the host's Python interpreter.
+  const pybind11::gil_scoped_release gil{};
+
+  const openassetio::log::LoggerInterfacePtr logger = std::make_shared<MockLogger>();
+  auto& mockLogger = dynamic_cast<MockLogger&>(*logger);
+  ALLOW_CALL(mockLogger, log(_, _));
+
+  GIVEN("an out-of-process Python manager factory with two workers") {
+    const openassetio::hostApi::ManagerImplementationFactoryInterfacePtr factory =
+        openassetio::python::hostApi::createOutOfProcessPythonManagerImplementationFactory(
+            logger, OPENASSETIO_TEST_PYTHON_EXECUTABLE, 2);
+
+    WHEN("the list of plugin identifiers is queried") {
+      const openassetio::Identifiers identifiers = factory->identifiers();
+
+      THEN("identifiers are those discovered by the worker") {
+        CHECK(identifiers == openassetio::Identifiers{
+                                 "org.openassetio.test.pluginSystem.resources.modulePlugin"});
+      }
+    }
+
+    AND_GIVEN("a manager instantiated from the factory") {
+      const openassetio::managerApi::ManagerInterfacePtr manager =
+          factory->instantiate("org.openassetio.test.pluginSystem.resources.modulePlugin");
+
+      CHECK(manager->identifier() == "org.openassetio.test.pluginSystem.resources.modulePlugin");
+
+      // Resolve a batch, returning the "entity.ref" trait of each
+      // result, or the error.
+      const auto resolve = [&manager](const std::vector<openassetio::Str>& refs) {
+        openassetio::EntityReferences entityReferences;
+        for (const openassetio::Str& ref : refs) {
+          entityReferences.emplace_back(ref);
+        }
+        std::vector<std::variant<std::monostate, openassetio::Str, errors::BatchElementError>>
+            results(refs.size());
+        manager->resolve(
+            entityReferences, {"entity", "instance"}, ResolveAccess::kRead, nullptr, nullptr,
+            [&](const std::size_t idx, const TraitsDataPtr& traitsData) {
+              openassetio::trait::property::Value ref;
+              traitsData->getTraitProperty(&ref, "entity", "ref");
+              results.at(idx) = std::get<openassetio::Str>(ref);
+            },
+            [&](const std::size_t idx, errors::BatchElementError error) {
+              results.at(idx) = std::move(error);
+            });
+        return results;
+      };
+
+      WHEN("a batch is resolved") {
+        const auto results =
+            resolve({"test://a", "test://error", "test://c", "test://d", "test://e"});
+
+        THEN("results and errors are decoded in order") {
+          REQUIRE(results.size() == 5);
+          CHECK(std::get<openassetio::Str>(results[0]) == "test://a");
+          const auto& error = std::get<errors::BatchElementError>(results[1]);
+          CHECK(error.code == errors::BatchElementError::ErrorCode::kEntityResolutionError);
+          CHECK(error.message == "Failed to resolve");
+          CHECK(std::get<openassetio::Str>(results[2]) == "test://c");
+          CHECK(std::get<openassetio::Str>(results[3]) == "test://d");
+          CHECK(std::get<openassetio::Str>(results[4]) == "test://e");
+        }
+      }
+
+      WHEN("the manager raises an OpenAssetIO exception") {
+        THEN("the corresponding C++ exception is thrown") {
+          CHECK_THROWS_MATCHES(resolve({"test://raise"}), errors::InputValidationException,
+                               Catch::Message("Invalid request"));
+        }
+      }
+
+      WHEN("the manager raises some other exception") {
+        THEN("an UnhandledException is thrown naming the Python exception") {
+          CHECK_THROWS_MATCHES(resolve({"test://raiseOther"}), errors::UnhandledException,
+                               Catch::Message("RuntimeError: Unexpected failure"));
+        }
+      }
+
+      WHEN("the manager logs a message") {
+        REQUIRE_CALL(mockLogger,
+                     log(openassetio::log::LoggerInterface::Severity::kInfo, "Resolving"));
+
+        const auto results = resolve({"test://log"});
+
+        THEN("message is forwarded to the host logger before the call returns") {
+          CHECK(std::get<openassetio::Str>(results[0]) == "test://log");
+        }
+      }
+
+      WHEN("a worker process dies during a call") {
+        CHECK_THROWS_MATCHES(resolve({"test://die"}), errors::OpenAssetIOException,
+                             Catch::Message("Out-of-process manager worker has terminated"));
+
+        THEN("the worker is replaced, and all workers remain usable") {
+          // Enough elements to lease both workers, several times over.
+          for (int attempt = 0; attempt < 4; ++attempt) {
+            const auto results = resolve({"test://a", "test://b"});
+            CHECK(std::get<openassetio::Str>(results[0]) == "test://a");
+            CHECK(std::get<openassetio::Str>(results[1]) == "test://b");
+          }
+        }
+      }
+    }
+  }
+}
+#else
+SCENARIO("Accessing Python managers hosted in worker processes from C++ on Windows") {
+  const openassetio::log::LoggerInterfacePtr logger = std::make_shared<MockLogger>();
+
+  WHEN("an out-of-process Python manager factory is created") {
+    THEN("a NotImplementedException is thrown") {
+      CHECK_THROWS_MATCHES(
+          openassetio::python::hostApi::createOutOfProcessPythonManagerImplementationFactory(
+              logger),
+          openassetio::errors::NotImplementedException,
+          Catch::Message("Out-of-process Python managers are not supported on this platform"));
+    }
   }
 }
+#endif
@@ -1,18 +1,99 @@
 """
-Provides a test PythonPluginSystemPlugin implemented within a single file
-module.
+Provides a test PythonPluginSystemManagerPlugin implemented within a
+single file module.
 """
+import os
 
-from openassetio.pluginSystem import PythonPluginSystemPlugin
+from openassetio import errors
+from openassetio.managerApi import ManagerInterface
+from openassetio.pluginSystem import PythonPluginSystemManagerPlugin
+from openassetio.trait import TraitsData
 
 
-class ModulePlugin(PythonPluginSystemPlugin):
+class ModuleManagerInterface(ManagerInterface):
+    """
+    Minimal manager that reports the identity of the instance servicing
+    each call, so that tests can check how calls are dispatched.
+
+    Some entity references trigger particular behaviour when resolved,
+    so that tests can check how it is propagated to the host:
+
+    - `test://error` - reports a BatchElementError.
+    - `test://raise` - raises an InputValidationException.
+    - `test://raiseOther` - raises a RuntimeError.
+    - `test://log` - logs a message, then succeeds.
+    - `test://die` - terminates the (worker) process.
+    """
+
+    # pylint: disable=missing-function-docstring,too-many-arguments
+    # pylint: disable=too-many-positional-arguments
+
+    def identifier(self):
+        return ModulePlugin.identifier()
+
+    def displayName(self):
+        return "Module Plugin"
+
+    def hasCapability(self, capability):
+        return capability in (
+            ManagerInterface.Capability.kManagementPolicyQueries,
+            ManagerInterface.Capability.kResolution,
+        )
+
+    def managementPolicy(self, traitSets, policyAccess, context, hostSession):
+        return [self.__instanceTraitsData() for _ in traitSets]
+
+    def resolve(
+        self,
+        entityReferences,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, entityReference in enumerate(entityReferences):
+            ref = entityReference.toString()
+            if ref == "test://error":
+                errorCallback(
+                    idx,
+                    errors.BatchElementError(
+                        errors.BatchElementError.ErrorCode.kEntityResolutionError,
+                        "Failed to resolve",
+                    ),
+                )
+                continue
+            if ref == "test://raise":
+                raise errors.InputValidationException("Invalid request")
+            if ref == "test://raiseOther":
+                raise RuntimeError("Unexpected failure")
+            if ref == "test://log":
+                hostSession.logger().info("Resolving")
+            if ref == "test://die":
+                os._exit(1)  # pylint: disable=protected-access
+
+            traitsData = self.__instanceTraitsData()
+            traitsData.setTraitProperty("entity", "ref", ref)
+            successCallback(idx, traitsData)
+
+    def __instanceTraitsData(self):
+        traitsData = TraitsData()
+        traitsData.setTraitProperty("instance", "id", id(self))
+        return traitsData
+
+
+class ModulePlugin(PythonPluginSystemManagerPlugin):
     # pylint: disable=missing-class-docstring
 
     @classmethod
     def identifier(cls):
         return "org.openassetio.test.pluginSystem.resources.modulePlugin"
 
+    @classmethod
+    def interface(cls):
+        return ModuleManagerInterface()
+
 
 # pylint: disable=invalid-name
 openassetioPlugin = ModulePlugin
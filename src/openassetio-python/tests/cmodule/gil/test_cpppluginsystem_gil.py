@@ -123,6 +123,14 @@ class Test_CppPluginSystem_gil:
         a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
         a_cpp_plugin_system.reset()
 
+    def test_reload(
+        self,
+        the_cpp_gil_check_plugin_path,
+        a_cpp_plugin_system,
+    ):
+        a_cpp_plugin_system.scan(the_cpp_gil_check_plugin_path)
+        a_cpp_plugin_system.reload(the_cpp_gil_check_plugin_path)
+
     def test_plugin(
         self,
         the_cpp_gil_check_plugin_identifier,
@@ -183,6 +191,10 @@ class Test_CppPluginSystemManagerImplementationFactory_gil:
         # Confidence check.
         assert isinstance(manager_interface, ManagerInterface)
 
+    def test_reload(self, a_cpp_plugin_impl_factory):
+        a_cpp_plugin_impl_factory.identifiers()
+        a_cpp_plugin_impl_factory.reload()
+
 
 @pytest.fixture
 def a_cpp_plugin_system(a_threaded_logger_interface):
@@ -1,5 +1,5 @@
 #
-#   Copyright 2023 The Foundry Visionmongers Ltd
+#   Copyright 2023-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -14,14 +14,15 @@
 #   limitations under the License.
 #
 """
-Testing that LoggerInterface methods release the GIL.
+Testing that LoggerInterface and AsyncLogger methods release the GIL.
 """
 # pylint: disable=redefined-outer-name,protected-access
 # pylint: disable=invalid-name,c-extension-no-member
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import pytest
 
 # pylint: disable=no-name-in-module
-from openassetio.log import LoggerInterface
+from openassetio.log import AsyncLogger, LoggerInterface
 
 
 class Test_LoggerInterface_gil:
@@ -77,3 +78,98 @@ class Test_LoggerInterface_gil:
 
     def test_isSeverityLogged(self, a_threaded_logger_interface):
         a_threaded_logger_interface.isSeverityLogged(LoggerInterface.Severity.kInfo)
+
+
+class Test_AsyncLogger_gil:
+    """
+    Check all methods release the GIL during C++ function body
+    execution.
+
+    Messages are delivered to the upstream logger on a background
+    thread, which must acquire the GIL to call into the Python mock.
+    So flushing whilst holding the GIL would deadlock.
+
+    See docstring for similar test under `gil/Test_ManagerInterface.py`
+    for details on how these tests are structured.
+    """
+
+    def test_all_methods_covered(self, find_unimplemented_test_cases):
+        """
+        Ensure this test class covers all methods.
+        """
+        unimplemented = find_unimplemented_test_cases(AsyncLogger, self)
+
+        if unimplemented:
+            print("\nSome test cases not implemented. Method templates can be found below:\n")
+            for method in unimplemented:
+                print(
+                    f"""
+    def test_{method}(self, an_async_logger):
+        an_async_logger.{method}()
+"""
+                )
+
+        assert unimplemented == []
+
+    def test_critical(self, an_async_logger, mock_logger):
+        an_async_logger.critical("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kCritical, "")
+
+    def test_debug(self, an_async_logger, mock_logger):
+        an_async_logger.debug("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kDebug, "")
+
+    def test_debugApi(self, an_async_logger, mock_logger):
+        an_async_logger.debugApi("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kDebugApi, "")
+
+    def test_error(self, an_async_logger, mock_logger):
+        an_async_logger.error("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kError, "")
+
+    def test_info(self, an_async_logger, mock_logger):
+        an_async_logger.info("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kInfo, "")
+
+    def test_log(self, an_async_logger, mock_logger):
+        an_async_logger.log(LoggerInterface.Severity.kInfo, "")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kInfo, "")
+
+    def test_progress(self, an_async_logger, mock_logger):
+        an_async_logger.progress("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kProgress, "")
+
+    def test_warning(self, an_async_logger, mock_logger):
+        an_async_logger.warning("")
+        an_async_logger.flush()
+        mock_logger.mock.log.assert_called_once_with(LoggerInterface.Severity.kWarning, "")
+
+    def test_isSeverityLogged(self, an_async_logger):
+        an_async_logger.isSeverityLogged(LoggerInterface.Severity.kInfo)
+
+    def test_flush(self, an_async_logger):
+        an_async_logger.flush()
+
+    def test_upstreamLogger(self, an_async_logger, a_threaded_logger_interface):
+        assert an_async_logger.upstreamLogger() is a_threaded_logger_interface
+
+    def test_capacity(self, an_async_logger):
+        assert an_async_logger.capacity() == AsyncLogger.kDefaultCapacity
+
+    def test_overflowPolicy(self, an_async_logger):
+        assert an_async_logger.overflowPolicy() == AsyncLogger.OverflowPolicy.kBlock
+
+    def test_droppedCount(self, an_async_logger):
+        assert an_async_logger.droppedCount() == 0
+
+
+@pytest.fixture
+def an_async_logger(a_threaded_logger_interface):
+    return AsyncLogger(a_threaded_logger_interface)
@@ -1,5 +1,5 @@
 #
-#   Copyright 2023 The Foundry Visionmongers Ltd
+#   Copyright 2023-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@ Testing that Manager methods release the GIL.
 # pylint: disable=redefined-outer-name,too-many-public-methods
 # pylint: disable=invalid-name,c-extension-no-member
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import asyncio
+
 import pytest
 
 # pylint: disable=no-name-in-module
@@ -264,6 +266,14 @@ class Test_Manager_gil:
         a_threaded_manager.register([], [], an_access, a_context, tag.kException)
         a_threaded_manager.register([], [], an_access, a_context, tag.kVariant)
 
+    def test_replaceImplementation(
+        self, mock_manager_interface, a_threaded_mock_manager_interface, a_threaded_manager
+    ):
+        mock_manager_interface.mock.identifier.return_value = ""
+        mock_manager_interface.mock.settings.return_value = {}
+        mock_manager_interface.mock.hasCapability.return_value = True
+        a_threaded_manager.replaceImplementation(a_threaded_mock_manager_interface)
+
     def test_resolve(self, a_threaded_manager, an_entity_reference, a_context):
         an_access = access.ResolveAccess.kRead
         tag = Manager.BatchElementErrorPolicyTag
@@ -281,6 +291,21 @@ class Test_Manager_gil:
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kException)
         a_threaded_manager.resolve([], set(), an_access, a_context, tag.kVariant)
 
+    def test_resolveAsync(self, a_threaded_manager, an_entity_reference, a_context):
+        an_access = access.ResolveAccess.kRead
+        tag = Manager.BatchElementErrorPolicyTag
+        ref = an_entity_reference
+
+        async def resolve_all():
+            await a_threaded_manager.resolveAsync(ref, set(), an_access, a_context)
+            await a_threaded_manager.resolveAsync(ref, set(), an_access, a_context, tag.kException)
+            await a_threaded_manager.resolveAsync(ref, set(), an_access, a_context, tag.kVariant)
+            await a_threaded_manager.resolveAsync([], set(), an_access, a_context)
+            await a_threaded_manager.resolveAsync([], set(), an_access, a_context, tag.kException)
+            await a_threaded_manager.resolveAsync([], set(), an_access, a_context, tag.kVariant)
+
+        asyncio.run(resolve_all())
+
     def test_settings(self, mock_manager_interface, a_threaded_manager):
         mock_manager_interface.mock.settings.return_value = {}
         a_threaded_manager.settings()
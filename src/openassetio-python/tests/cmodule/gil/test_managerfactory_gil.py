@@ -20,6 +20,7 @@ methods release the GIL.
 # pylint: disable=redefined-outer-name,protected-access
 # pylint: disable=invalid-name,c-extension-no-member
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
 from unittest import mock
 
 import pytest
@@ -234,6 +235,29 @@ class Test_ManagerFactory_gil:
 
         mock_manager_impl_factory.mock.instantiate.assert_called()
 
+    def test_sharedManager(
+        self, a_threaded_manager_factory, mock_manager_impl_factory, mock_manager_interface
+    ):
+        mock_manager_impl_factory.mock.instantiate.return_value = mock_manager_interface
+
+        a_threaded_manager_factory.sharedManager("", {})
+
+        mock_manager_impl_factory.mock.instantiate.assert_called()
+
+    def test_setSharedManagerIdleTimeout(self, a_threaded_manager_factory):
+        # No callbacks to observe, but ensure it doesn't deadlock.
+        a_threaded_manager_factory.setSharedManagerIdleTimeout(datetime.timedelta(0))
+
+    def test_evictIdleSharedManagers(
+        self, a_threaded_manager_factory, mock_manager_impl_factory, mock_manager_interface
+    ):
+        mock_manager_impl_factory.mock.instantiate.return_value = mock_manager_interface
+        a_threaded_manager_factory.setSharedManagerIdleTimeout(datetime.timedelta(0))
+        manager = a_threaded_manager_factory.sharedManager("", {})
+        del manager
+
+        assert a_threaded_manager_factory.evictIdleSharedManagers() == 1
+
     def test_identifiers(
         self,
         a_threaded_manager_factory,
@@ -19,6 +19,7 @@
 #include <openassetio/errors/exceptions.hpp>
 
 #include <errors/exceptionsConverter.hpp>
+#include <PyOverrideCache.hpp>
 #include <overrideMacros.hpp>
 
 namespace py = pybind11;
@@ -307,6 +308,10 @@ struct ExceptionThrower {
   virtual void throwFromOverridePure() = 0;
   virtual void throwFromOverrideName() {}
   virtual void throwFromOverrideArgs() {}
+  virtual void throwFromCachedOverride() {}
+  virtual void throwFromCachedOverridePure() = 0;
+  virtual void throwFromCachedOverrideName() {}
+  virtual void throwFromCachedOverrideArgs() {}
 };
 
 /**
@@ -330,6 +335,34 @@ struct PyExceptionThrower final : ExceptionThrower {
   void throwFromOverrideArgs() override {
     OPENASSETIO_PYBIND11_OVERRIDE_ARGS(void, ExceptionThrower, throwFromOverrideArgs, (), );
   }
+  void throwFromCachedOverride() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE(void, ExceptionThrower, overrideCache_,
+                                         kCachedOverride, throwFromCachedOverride, );
+  }
+  void throwFromCachedOverridePure() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_PURE(void, ExceptionThrower, overrideCache_,
+                                              kCachedOverridePure, throwFromCachedOverridePure, );
+  }
+  void throwFromCachedOverrideName() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_NAME(void, ExceptionThrower, overrideCache_,
+                                              kCachedOverrideName, "throwFromCachedOverrideName",
+                                              throwFromCachedOverrideName, );
+  }
+  void throwFromCachedOverrideArgs() override {
+    OPENASSETIO_PYBIND11_CACHED_OVERRIDE_ARGS(void, ExceptionThrower, overrideCache_,
+                                              kCachedOverrideArgs, throwFromCachedOverrideArgs,
+                                              (), );
+  }
+
+ private:
+  enum OverrideSlot : std::size_t {
+    kCachedOverride,
+    kCachedOverridePure,
+    kCachedOverrideName,
+    kCachedOverrideArgs,
+    kNumOverrideSlots
+  };
+  openassetio::PyOverrideCache<ExceptionThrower, kNumOverrideSlots> overrideCache_;
 };
 
 /**
@@ -400,6 +433,14 @@ extern void registerExceptionThrower(py::module_& mod) {
                executeFnAndCatch([&] { exceptionThrower.throwFromOverrideName(); },
                                  catchExceptionName) &&
                executeFnAndCatch([&] { exceptionThrower.throwFromOverridePure(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverride(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverrideArgs(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverrideName(); },
+                                 catchExceptionName) &&
+               executeFnAndCatch([&] { exceptionThrower.throwFromCachedOverridePure(); },
                                  catchExceptionName);
       },
       py::arg("exceptionThrower"), py::arg("catchExceptionName"),
@@ -444,5 +485,9 @@ extern void registerExceptionThrower(py::module_& mod) {
       .def("throwFromOverride", &ExceptionThrower::throwFromOverride)
       .def("throwFromOverridePure", &ExceptionThrower::throwFromOverridePure)
       .def("throwFromOverrideName", &ExceptionThrower::throwFromOverrideName)
-      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs);
+      .def("throwFromOverrideArgs", &ExceptionThrower::throwFromOverrideArgs)
+      .def("throwFromCachedOverride", &ExceptionThrower::throwFromCachedOverride)
+      .def("throwFromCachedOverridePure", &ExceptionThrower::throwFromCachedOverridePure)
+      .def("throwFromCachedOverrideName", &ExceptionThrower::throwFromCachedOverrideName)
+      .def("throwFromCachedOverrideArgs", &ExceptionThrower::throwFromCachedOverrideArgs);
 }
@@ -1,5 +1,5 @@
 #
-#   Copyright 2023-2024 The Foundry Visionmongers Ltd
+#   Copyright 2023-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -181,6 +181,18 @@ class PyExceptionThrower(_openassetio._testutils.ExceptionThrower):
     def throwFromOverrideArgs(self):
         self.callee()
 
+    def throwFromCachedOverride(self):
+        self.callee()
+
+    def throwFromCachedOverridePure(self):
+        self.callee()
+
+    def throwFromCachedOverrideName(self):
+        self.callee()
+
+    def throwFromCachedOverrideArgs(self):
+        self.callee()
+
 
 @pytest.fixture
 def exception_thrower():
@@ -0,0 +1,201 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Concurrency stress tests of the C++ bindings.
+
+These are most meaningful under a free-threaded (no-GIL) interpreter,
+where calls from multiple threads genuinely run in parallel. Under a
+GIL-enabled interpreter they still exercise thread switching across
+C++/Python boundaries.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name,protected-access
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import sys
+import sysconfig
+import threading
+
+import pytest
+
+from openassetio import _openassetio  # pylint: disable=no-name-in-module
+from openassetio import Context, EntityReference, access, errors
+from openassetio.hostApi import Manager
+from openassetio.managerApi import ManagerInterface
+from openassetio.trait import TraitsData
+
+
+kNumThreads = 8
+kNumIterations = 50
+
+
+@pytest.mark.skipif(
+    not sysconfig.get_config_var("Py_GIL_DISABLED"), reason="Requires free-threaded interpreter"
+)
+class Test_import_freethreaded:
+    def test_when_imported_then_gil_is_not_reenabled(self):
+        assert not sys._is_gil_enabled()
+
+
+class Test_ManagerInterface_concurrent_first_use:
+    def test_when_resolve_first_called_concurrently_then_all_calls_dispatched_to_python(
+        self, a_host_session
+    ):
+        # Fresh instances each iteration, so that every iteration races
+        # on first-use lookup of Python overrides.
+        for _ in range(kNumIterations):
+            manager = Manager(ResolvingManagerInterface(), a_host_session)
+            results = []
+
+            def resolve(manager=manager, results=results):
+                ref = EntityReference("test:///a")
+                results.append(
+                    manager.resolve(ref, {"aTrait"}, access.ResolveAccess.kRead, Context())
+                )
+
+            runConcurrently(resolve)
+
+            assert len(results) == kNumThreads
+            for result in results:
+                assert result.getTraitProperty("aTrait", "ref") == "test:///a"
+
+
+class Test_exceptionsConverter_concurrent:
+    def test_when_exceptions_thrown_concurrently_then_each_thread_gets_its_own(self):
+        def throwAndCatch():
+            for idx in range(kNumIterations):
+                thrower = ExceptionThrower()
+                thrower.exception = errors.BatchElementException(
+                    idx,
+                    errors.BatchElementError(
+                        errors.BatchElementError.ErrorCode.kInvalidEntityReference,
+                        threading.current_thread().name,
+                    ),
+                    "Explosion!",
+                )
+
+                assert _openassetio._testutils.isPythonExceptionCatchableAs(
+                    thrower, "BatchElementException"
+                )
+
+                with pytest.raises(errors.BatchElementException) as err:
+                    _openassetio._testutils.throwPythonExceptionCatchAsCppExceptionAndRethrow(
+                        thrower, "BatchElementException"
+                    )
+
+                assert err.value.index == idx
+                assert err.value.error.message == threading.current_thread().name
+
+        runConcurrently(throwAndCatch)
+
+
+class Test_PyRetainingSharedPtr_concurrent:
+    def test_when_containers_created_and_dropped_concurrently_then_implementation_retained(self):
+        def createAndDrop():
+            for _ in range(kNumIterations):
+                container = _openassetio._testutils.PyRetainingSimpleCppContainer(
+                    SimpleCppType()
+                )
+                assert container.heldObject().value() == 2
+                del container
+
+        runConcurrently(createAndDrop)
+
+
+def runConcurrently(target):
+    """
+    Run the given callable in several threads, released together, and
+    re-raise the first exception encountered in any of them.
+    """
+    barrier = threading.Barrier(kNumThreads)
+    exceptions = []
+
+    def run():
+        barrier.wait()
+        try:
+            target()
+        except BaseException as exc:  # pylint: disable=broad-exception-caught
+            exceptions.append(exc)
+
+    threads = [threading.Thread(target=run) for _ in range(kNumThreads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    if exceptions:
+        raise exceptions[0]
+
+
+class ResolvingManagerInterface(ManagerInterface):
+    def identifier(self):
+        return "org.openassetio.test.freethreading"
+
+    def displayName(self):
+        return "Free-threading test manager"
+
+    def hasCapability(self, capability):
+        return capability == ManagerInterface.Capability.kResolution
+
+    def resolve(
+        self,
+        entityReferences,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, ref in enumerate(entityReferences):
+            data = TraitsData()
+            for traitId in traitSet:
+                data.setTraitProperty(traitId, "ref", ref.toString())
+            successCallback(idx, data)
+
+
+class ExceptionThrower(_openassetio._testutils.ExceptionThrower):
+    def __init__(self):
+        _openassetio._testutils.ExceptionThrower.__init__(self)
+        self.exception = None
+
+    def throwFromOverride(self):
+        raise self.exception
+
+    def throwFromOverridePure(self):
+        raise self.exception
+
+    def throwFromOverrideName(self):
+        raise self.exception
+
+    def throwFromOverrideArgs(self):
+        raise self.exception
+
+    def throwFromCachedOverride(self):
+        raise self.exception
+
+    def throwFromCachedOverridePure(self):
+        raise self.exception
+
+    def throwFromCachedOverrideName(self):
+        raise self.exception
+
+    def throwFromCachedOverrideArgs(self):
+        raise self.exception
+
+
+class SimpleCppType(_openassetio._testutils.SimpleBaseCppType):
+    def value(self):
+        return 2
@@ -1,5 +1,5 @@
 #
-#   Copyright 2024 The Foundry Visionmongers Ltd
+#   Copyright 2024-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -32,6 +32,7 @@ expected_pyi_files = (
     "access.pyi",
     "constants.pyi",
     "errors.pyi",
+    "exec.pyi",
     "hostApi.pyi",
     "log.pyi",
     "managerApi.pyi",
@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2024 The Foundry Visionmongers Ltd
+#   Copyright 2013-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -16,7 +16,10 @@
 """
 Tests that cover the openassetio.hostApi.Manager wrapper class.
 """
+import asyncio
+import datetime
 import itertools
+import pickle
 from typing import Callable, Any
 
 # pylint: disable=invalid-name,redefined-outer-name,unused-argument
@@ -29,6 +32,7 @@ import re
 import pytest
 
 from openassetio import (
+    CancellationToken,
     Context,
     EntityReference,
     managerApi,
@@ -83,6 +87,7 @@ class BatchFirstMethodTest:
         "invalidPreflightHint",
         "invalidTraitSet",
         "authError",
+        "timeout",
     ]
 
     def assert_callback_overload_wraps_the_corresponding_method_of_the_held_interface(
@@ -747,6 +752,21 @@ class Test_Manager_initialize:
             " than call the manager's implementation.",
         )
 
+    def test_when_entity_ref_prefix_given_and_debugApi_not_logged_then_no_log_printed(
+        self, manager, mock_manager_interface, mock_logger
+    ):
+        mock_manager_interface.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "someprefix:"
+        }
+        mock_logger.mock.isSeverityLogged.side_effect = (
+            lambda severity: severity != mock_logger.Severity.kDebugApi
+        )
+
+        manager.initialize({})
+
+        mock_logger.mock.isSeverityLogged.assert_called_with(mock_logger.Severity.kDebugApi)
+        mock_logger.mock.log.assert_not_called()
+
     def test_when_entity_ref_prefix_type_invalid_then_debug_log_printed(
         self, manager, mock_manager_interface, mock_logger
     ):
@@ -875,6 +895,74 @@ class Test_Manager_flushCaches:
         method.assert_called_once_with(a_host_session)
 
 
+class Test_Manager_replaceImplementation:
+    def test_when_identifier_differs_then_raises_InputValidationException(
+        self, manager, mock_manager_interface, create_mock_manager_interface
+    ):
+        mock_manager_interface.mock.identifier.return_value = "org.openassetio.test.manager"
+        replacement = create_mock_manager_interface()
+        replacement.mock.identifier.return_value = "org.openassetio.test.other"
+
+        with pytest.raises(
+            InputValidationException,
+            match="Cannot replace implementation of manager 'org.openassetio.test.manager'"
+            " with 'org.openassetio.test.other'",
+        ):
+            manager.replaceImplementation(replacement)
+
+        replacement.mock.initialize.assert_not_called()
+
+    def test_replacement_initialized_with_current_settings(
+        self, manager, mock_manager_interface, create_mock_manager_interface, a_host_session
+    ):
+        settings = {"some": "setting"}
+        mock_manager_interface.mock.identifier.return_value = "org.openassetio.test.manager"
+        mock_manager_interface.mock.settings.return_value = settings
+        replacement = create_mock_manager_interface()
+        replacement.mock.identifier.return_value = "org.openassetio.test.manager"
+        replacement.mock.hasCapability.return_value = True
+
+        manager.replaceImplementation(replacement)
+
+        replacement.mock.initialize.assert_called_once_with(settings, a_host_session)
+
+    def test_when_replacement_lacks_capabilities_then_raises_and_current_retained(
+        self, manager, mock_manager_interface, create_mock_manager_interface, a_host_session
+    ):
+        mock_manager_interface.mock.identifier.return_value = "org.openassetio.test.manager"
+        mock_manager_interface.mock.settings.return_value = {}
+        replacement = create_mock_manager_interface()
+        replacement.mock.identifier.return_value = "org.openassetio.test.manager"
+        replacement.mock.hasCapability.return_value = False
+
+        with pytest.raises(ConfigurationException):
+            manager.replaceImplementation(replacement)
+
+        manager.flushCaches()
+        mock_manager_interface.mock.flushCaches.assert_called_once_with(a_host_session)
+        replacement.mock.flushCaches.assert_not_called()
+
+    def test_subsequent_calls_use_replacement(
+        self, manager, mock_manager_interface, create_mock_manager_interface, a_host_session
+    ):
+        mock_manager_interface.mock.identifier.return_value = "org.openassetio.test.manager"
+        mock_manager_interface.mock.settings.return_value = {}
+        replacement = create_mock_manager_interface()
+        replacement.mock.identifier.return_value = "org.openassetio.test.manager"
+        replacement.mock.hasCapability.return_value = True
+        replacement.mock.info.return_value = {
+            constants.kInfoKey_EntityReferencesMatchPrefix: "someprefix:"
+        }
+
+        manager.replaceImplementation(replacement)
+        manager.flushCaches()
+
+        replacement.mock.flushCaches.assert_called_once_with(a_host_session)
+        mock_manager_interface.mock.flushCaches.assert_not_called()
+        assert manager.isEntityReferenceString("someprefix:something") is True
+        replacement.mock.isEntityReferenceString.assert_not_called()
+
+
 class Test_Manager_isEntityReferenceString:
     @pytest.mark.parametrize("expected", (True, False))
     def test_wraps_the_corresponding_method_of_the_held_interface(
@@ -1098,6 +1186,89 @@ class Test_Manager_entityExists(BatchFirstMethodTest):
         )
 
 
+class Test_Manager_entityExists_batch_result:
+    @pytest.fixture
+    def call_callbacks(self, mock_manager_interface):
+        def call_callbacks(*args):
+            args[3](1, False)
+            args[3](0, True)
+
+        mock_manager_interface.mock.entityExists.side_effect = call_callbacks
+
+    @pytest.fixture
+    def batch_result(self, manager, call_callbacks, two_refs, a_context):
+        return manager.entityExistsAsArray(two_refs, a_context)
+
+    @pytest.mark.parametrize(
+        "error_policy_tag", [(), (Manager.BatchElementErrorPolicyTag.kException,)]
+    )
+    def test_when_not_opted_in_then_returns_list(
+        self, manager, call_callbacks, two_refs, a_context, error_policy_tag
+    ):
+        actual = manager.entityExists(two_refs, a_context, *error_policy_tag)
+
+        assert type(actual) is list
+        assert actual == [True, False]
+
+    def test_when_exception_policy_then_returns_bool_array(
+        self, manager, call_callbacks, two_refs, a_context
+    ):
+        actual = manager.entityExistsAsArray(
+            two_refs, a_context, Manager.BatchElementErrorPolicyTag.kException
+        )
+
+        assert isinstance(actual, Manager.BoolArray)
+        assert actual == [True, False]
+
+    def test_is_a_read_only_sequence_of_bools(self, batch_result):
+        assert len(batch_result) == 2
+        assert batch_result[0] is True
+        assert batch_result[1] is False
+        assert list(batch_result) == [True, False]
+
+        with pytest.raises(IndexError):
+            _ = batch_result[2]
+
+        with pytest.raises(TypeError):
+            batch_result[0] = False
+
+    def test_when_indexed_with_negative_index_then_counts_from_end(self, batch_result):
+        assert batch_result[-1] is False
+        assert batch_result[-2] is True
+
+        with pytest.raises(IndexError):
+            _ = batch_result[-3]
+
+    def test_when_sliced_then_returns_list(self, batch_result):
+        assert batch_result[:] == [True, False]
+        assert isinstance(batch_result[:], list)
+        assert batch_result[1:] == [False]
+        assert batch_result[::-1] == [False, True]
+        assert batch_result[5:] == []
+
+    def test_compares_equal_to_equivalent_sequences(self, batch_result):
+        assert batch_result == [True, False]
+        assert batch_result == (True, False)
+        assert batch_result != [True, True]
+        assert batch_result != [True]
+        assert batch_result != "ab"
+
+    def test_exposes_read_only_bool_buffer(self, batch_result):
+        view = memoryview(batch_result)
+
+        assert view.format == "?"
+        assert view.itemsize == 1
+        assert view.readonly
+        assert view.tolist() == [True, False]
+
+    @pytest.mark.parametrize("protocol", range(pickle.HIGHEST_PROTOCOL + 1))
+    def test_when_round_tripped_through_pickle_then_equal(self, batch_result, protocol):
+        actual = pickle.loads(pickle.dumps(batch_result, protocol=protocol))
+
+        assert isinstance(actual, Manager.BoolArray)
+        assert actual == [True, False]
+
+
 class Test_Manager_defaultEntityReference(BatchFirstMethodTest):
     @pytest.fixture(autouse=True)
     def constructor(
@@ -2487,6 +2658,406 @@ class Test_Manager_resolve(BatchFirstMethodTest):
         )
 
 
+class Test_Manager_resolve_batch_result:
+    @pytest.mark.parametrize(
+        "error_policy_tag", [(), (Manager.BatchElementErrorPolicyTag.kException,)]
+    )
+    def test_when_not_opted_in_then_returns_list(
+        self,
+        manager,
+        mock_manager_interface,
+        two_refs,
+        an_entity_trait_set,
+        a_context,
+        error_policy_tag,
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(*args):
+            args[5](1, traits_datas[1])
+            args[5](0, traits_datas[0])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        actual = manager.resolve(
+            two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context, *error_policy_tag
+        )
+
+        assert type(actual) is list
+        assert actual == traits_datas
+
+    def test_when_exception_policy_then_returns_traitsdata_sequence(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(*args):
+            args[5](0, traits_datas[0])
+            args[5](1, traits_datas[1])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        actual = manager.resolveAsSequence(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kException,
+        )
+
+        assert isinstance(actual, Manager.TraitsDataSequence)
+        assert actual == traits_datas
+
+    def test_is_a_read_only_sequence_of_traitsdata(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(*args):
+            args[5](1, traits_datas[1])
+            args[5](0, traits_datas[0])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        batch_result = manager.resolveAsSequence(
+            two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        )
+
+        assert isinstance(batch_result, Manager.TraitsDataSequence)
+        assert len(batch_result) == 2
+        assert batch_result[0] is traits_datas[0]
+        assert batch_result[1] is traits_datas[1]
+        assert list(batch_result) == traits_datas
+        assert batch_result == traits_datas
+        assert batch_result != traits_datas[:1]
+
+        with pytest.raises(IndexError):
+            _ = batch_result[2]
+
+        with pytest.raises(TypeError):
+            batch_result[0] = traits_datas[1]
+
+    def test_supports_negative_indices_and_slices(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(*args):
+            args[5](0, traits_datas[0])
+            args[5](1, traits_datas[1])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        batch_result = manager.resolveAsSequence(
+            two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        )
+
+        assert batch_result[-1] is traits_datas[1]
+        assert batch_result[-2] is traits_datas[0]
+
+        with pytest.raises(IndexError):
+            _ = batch_result[-3]
+
+        sliced = batch_result[::-1]
+
+        assert isinstance(sliced, list)
+        assert sliced[0] is traits_datas[1]
+        assert sliced[1] is traits_datas[0]
+        assert batch_result[1:] == traits_datas[1:]
+
+    def test_when_pickled_with_protocol_5_then_batch_transferred_as_single_buffer(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+        traits_datas[1].setTraitProperty("b", "c", 1.5)
+
+        def call_callbacks(*args):
+            args[5](0, traits_datas[0])
+            args[5](1, traits_datas[1])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        batch_result = manager.resolveAsSequence(
+            two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        )
+        buffers = []
+
+        pickled = pickle.dumps(batch_result, protocol=5, buffer_callback=buffers.append)
+        actual = pickle.loads(pickled, buffers=buffers)
+
+        assert len(buffers) == 1
+        assert isinstance(actual, Manager.TraitsDataSequence)
+        assert actual == traits_datas
+
+
+class Test_Manager_resolve_expiry:
+    def test_when_context_already_expired_then_interface_not_called_and_all_timeout(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        a_context.setTimeout(datetime.timedelta(0))
+        success_cb = mock.Mock()
+        error_cb = mock.Mock()
+
+        manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            success_cb,
+            error_cb,
+        )
+
+        mock_manager_interface.mock.resolve.assert_not_called()
+        success_cb.assert_not_called()
+        assert [c.args[0] for c in error_cb.call_args_list] == [0, 1]
+        for call in error_cb.call_args_list:
+            assert call.args[1].code == BatchElementError.ErrorCode.kTimeout
+
+    def test_when_cancelled_during_call_then_unreported_elements_timeout(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        a_context.cancellationToken = CancellationToken()
+        a_traitsdata = TraitsData()
+
+        def resolve_one_then_cancel(*args):
+            args[5](1, a_traitsdata)
+            a_context.cancellationToken.cancel()
+
+        mock_manager_interface.mock.resolve.side_effect = resolve_one_then_cancel
+        success_cb = mock.Mock()
+        error_cb = mock.Mock()
+
+        manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            success_cb,
+            error_cb,
+        )
+
+        success_cb.assert_called_once_with(1, a_traitsdata)
+        error_cb.assert_called_once()
+        assert error_cb.call_args.args[0] == 0
+        assert error_cb.call_args.args[1].code == BatchElementError.ErrorCode.kTimeout
+
+    def test_when_host_cancels_from_callback_then_later_results_not_forwarded(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        a_context.cancellationToken = CancellationToken()
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        # Manager ignores cancellation, reporting every element.
+        def call_callbacks(*args):
+            args[5](0, traits_datas[0])
+            args[5](1, traits_datas[1])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+        success_cb = mock.Mock(side_effect=lambda *_: a_context.cancellationToken.cancel())
+        error_cb = mock.Mock()
+
+        manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            success_cb,
+            error_cb,
+        )
+
+        success_cb.assert_called_once_with(0, traits_datas[0])
+        error_cb.assert_called_once()
+        assert error_cb.call_args.args[0] == 1
+        assert error_cb.call_args.args[1].code == BatchElementError.ErrorCode.kTimeout
+
+    def test_when_not_expired_then_no_timeout_reported(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        a_context.setTimeout(datetime.timedelta(hours=1))
+        a_context.cancellationToken = CancellationToken()
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(*args):
+            args[5](0, traits_datas[0])
+            args[5](1, traits_datas[1])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        actual = manager.resolve(
+            two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+        )
+
+        assert list(actual) == traits_datas
+
+    def test_when_deadline_passed_then_convenience_overload_raises_timeout(
+        self, manager, mock_manager_interface, a_ref, an_entity_trait_set, a_context
+    ):
+        a_context.setTimeout(datetime.timedelta(0))
+
+        with pytest.raises(BatchElementException) as exc:
+            manager.resolve(a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+
+        assert exc.value.error.code == BatchElementError.ErrorCode.kTimeout
+        assert exc.value.index == 0
+
+    def test_when_deadline_passed_then_variant_overload_returns_timeout(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        a_context.setTimeout(datetime.timedelta(0))
+
+        actual = manager.resolve(
+            two_refs,
+            an_entity_trait_set,
+            access.ResolveAccess.kRead,
+            a_context,
+            Manager.BatchElementErrorPolicyTag.kVariant,
+        )
+
+        assert [result.code for result in actual] == [BatchElementError.ErrorCode.kTimeout] * 2
+
+
+class Test_Manager_resolveAsync:
+    def test_when_awaited_then_result_of_held_interface_returned(
+        self, manager, mock_manager_interface, a_ref, an_entity_trait_set, a_context, a_traitsdata
+    ):
+        def call_callbacks(refs, *args):
+            assert refs == [a_ref]
+            args[4](0, a_traitsdata)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        result = asyncio.run(
+            manager.resolveAsync(
+                a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+            )
+        )
+
+        assert result is a_traitsdata
+
+    def test_when_batch_awaited_then_results_returned_in_order(
+        self, manager, mock_manager_interface, two_refs, an_entity_trait_set, a_context
+    ):
+        traits_datas = [TraitsData({"a"}), TraitsData({"b"})]
+
+        def call_callbacks(_refs, *args):
+            args[4](1, traits_datas[1])
+            args[4](0, traits_datas[0])
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        result = asyncio.run(
+            manager.resolveAsync(
+                two_refs, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+            )
+        )
+
+        assert result == traits_datas
+
+    def test_when_element_errors_then_exception_raised_from_await(
+        self,
+        manager,
+        mock_manager_interface,
+        a_ref,
+        an_entity_trait_set,
+        a_context,
+        a_batch_element_error,
+    ):
+        def call_callbacks(*args):
+            args[6](0, a_batch_element_error)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        with pytest.raises(BatchElementException) as err:
+            asyncio.run(
+                manager.resolveAsync(
+                    a_ref,
+                    an_entity_trait_set,
+                    access.ResolveAccess.kRead,
+                    a_context,
+                    Manager.BatchElementErrorPolicyTag.kException,
+                )
+            )
+
+        assert err.value.index == 0
+        assert err.value.error == a_batch_element_error
+
+    def test_when_variant_policy_then_errors_returned(
+        self,
+        manager,
+        mock_manager_interface,
+        two_refs,
+        an_entity_trait_set,
+        a_context,
+        a_traitsdata,
+        a_batch_element_error,
+    ):
+        def call_callbacks(*args):
+            args[5](0, a_traitsdata)
+            args[6](1, a_batch_element_error)
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        result = asyncio.run(
+            manager.resolveAsync(
+                two_refs,
+                an_entity_trait_set,
+                access.ResolveAccess.kRead,
+                a_context,
+                Manager.BatchElementErrorPolicyTag.kVariant,
+            )
+        )
+
+        assert result == [a_traitsdata, a_batch_element_error]
+
+    def test_when_interface_raises_then_exception_raised_from_await(
+        self, manager, mock_manager_interface, a_ref, an_entity_trait_set, a_context
+    ):
+        expected = InputValidationException("Explosion!")
+        mock_manager_interface.mock.resolve.side_effect = expected
+
+        with pytest.raises(InputValidationException) as err:
+            asyncio.run(
+                manager.resolveAsync(
+                    a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context
+                )
+            )
+
+        assert err.value is expected
+
+    def test_when_many_awaited_concurrently_then_all_complete(
+        self, manager, mock_manager_interface, an_entity_trait_set, a_context
+    ):
+        def call_callbacks(refs, *args):
+            args[4](0, TraitsData({refs[0].toString()}))
+
+        mock_manager_interface.mock.resolve.side_effect = call_callbacks
+
+        ref_strs = [f"asset://{idx}" for idx in range(100)]
+
+        async def resolve_all():
+            return await asyncio.gather(
+                *(
+                    manager.resolveAsync(
+                        manager.createEntityReference(ref_str),
+                        an_entity_trait_set,
+                        access.ResolveAccess.kRead,
+                        a_context,
+                    )
+                    for ref_str in ref_strs
+                )
+            )
+
+        results = asyncio.run(resolve_all())
+
+        assert [result.traitSet() for result in results] == [{ref_str} for ref_str in ref_strs]
+
+    def test_when_no_running_event_loop_then_RuntimeError_raised(
+        self, manager, a_ref, an_entity_trait_set, a_context
+    ):
+        with pytest.raises(RuntimeError):
+            manager.resolveAsync(a_ref, an_entity_trait_set, access.ResolveAccess.kRead, a_context)
+
+
 class Test_Manager_entityTraits(BatchFirstMethodTest):
     @pytest.fixture(autouse=True)
     def constructor(
@@ -3266,6 +3837,17 @@ class Test_Manager_createChildContext:
         original_locale.setTraitProperty("a", "v", 2)
         assert context_b.locale != context_a.locale
 
+    def test_when_called_with_parent_then_deadline_copied_and_token_shared(self, manager):
+        context_a = Context()
+        context_a.setTimeout(datetime.timedelta(hours=1))
+        context_a.cancellationToken = CancellationToken()
+
+        context_b = manager.createChildContext(context_a)
+
+        assert context_b.remainingTime() <= context_a.remainingTime()
+        assert context_b.remainingTime() > datetime.timedelta(minutes=59)
+        assert context_b.cancellationToken is context_a.cancellationToken
+
     def test_when_called_with_parent_with_no_managerState_then_createChildState_is_not_called(
         self, manager, mock_manager_interface
     ):
@@ -1,5 +1,5 @@
 #
-#   Copyright 2022 The Foundry Visionmongers Ltd
+#   Copyright 2022-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@ Tests that cover the openassetio.hostApi.ManagerFactory class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
 import os
 import pathlib
 from unittest import mock
@@ -26,6 +27,7 @@ from unittest import mock
 import pytest
 
 from openassetio import _openassetio, errors  # pylint: disable=no-name-in-module
+from openassetio.exec import ThreadPool
 from openassetio.hostApi import ManagerFactory, Manager, ManagerImplementationFactoryInterface
 from openassetio.log import LoggerInterface
 
@@ -424,6 +426,95 @@ class Test_ManagerFactory_defaultManagerForInterface:
                 mock_logger,
             )
 
+    def test_when_config_file_modified_then_modifications_used(
+        self,
+        tmp_path,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        config_path = tmp_path / "manager.toml"
+        config_path.write_text('[manager]\nidentifier = "first"\n[manager.settings]\na = 1\n')
+
+        ManagerFactory.defaultManagerForInterface(
+            str(config_path), mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with("first")
+        assert mock_manager_interface.mock.initialize.call_args[0][0] == {"a": 1}
+
+        mock_manager_implementation_factory.mock.instantiate.reset_mock()
+        mock_manager_interface.mock.initialize.reset_mock()
+        # Ensure the change is detectable regardless of the filesystem's
+        # timestamp resolution.
+        stat = config_path.stat()
+        config_path.write_text('[manager]\nidentifier = "second"\n[manager.settings]\na = 2\n')
+        os.utime(config_path, ns=(stat.st_atime_ns, stat.st_mtime_ns + 1_000_000_000))
+
+        ManagerFactory.defaultManagerForInterface(
+            str(config_path), mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with("second")
+        assert mock_manager_interface.mock.initialize.call_args[0][0] == {"a": 2}
+
+    @pytest.mark.parametrize("use_env_var_for_config_file", [True, False])
+    def test_when_executor_provided_then_host_session_has_executor(
+        self,
+        use_env_var_for_config_file,
+        valid_manager_config,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        executor = ThreadPool(1)
+        executors = []
+
+        def record_executor(_settings, hostSession):
+            executors.append(hostSession.executor())
+
+        mock_manager_interface.mock.initialize.side_effect = record_executor
+
+        if use_env_var_for_config_file:
+            ManagerFactory.defaultManagerForInterface(
+                mock_host_interface, mock_manager_implementation_factory, mock_logger, executor
+            )
+        else:
+            ManagerFactory.defaultManagerForInterface(
+                valid_manager_config,
+                mock_host_interface,
+                mock_manager_implementation_factory,
+                mock_logger,
+                executor,
+            )
+
+        assert executors[0] is executor
+
+    @pytest.mark.parametrize("use_env_var_for_config_file", [True, False])
+    def test_when_executor_is_None_then_raises_TypeError(
+        self,
+        use_env_var_for_config_file,
+        valid_manager_config,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+    ):
+        with pytest.raises(TypeError):
+            if use_env_var_for_config_file:
+                ManagerFactory.defaultManagerForInterface(
+                    mock_host_interface, mock_manager_implementation_factory, mock_logger, None
+                )
+            else:
+                ManagerFactory.defaultManagerForInterface(
+                    valid_manager_config,
+                    mock_host_interface,
+                    mock_manager_implementation_factory,
+                    mock_logger,
+                    None,
+                )
+
 
 class Test_ManagerFactory_createManager:
     def test_returns_a_manager(self, a_manager_factory):
@@ -449,6 +540,177 @@ class Test_ManagerFactory_createManager:
         )
         assert_expected_manager(manager)
 
+    def test_when_no_executor_then_host_session_has_default_pool(
+        self, a_manager_factory, mock_manager_interface
+    ):
+        manager = a_manager_factory.createManager("a.manager")
+
+        executors = []
+
+        def record_executor(hostSession):
+            executors.append(hostSession.executor())
+            return {}
+
+        mock_manager_interface.mock.settings.side_effect = record_executor
+        manager.settings()
+
+        assert executors[0] is ThreadPool.defaultPool()
+
+    def test_when_executor_provided_then_host_session_has_executor(
+        self,
+        mock_host_interface,
+        mock_manager_implementation_factory,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        executor = ThreadPool(1)
+        manager_factory = ManagerFactory(
+            mock_host_interface, mock_manager_implementation_factory, mock_logger, executor
+        )
+        manager = manager_factory.createManager("a.manager")
+
+        executors = []
+
+        def record_executor(hostSession):
+            executors.append(hostSession.executor())
+            return {}
+
+        mock_manager_interface.mock.settings.side_effect = record_executor
+        manager.settings()
+
+        assert executors[0] is executor
+
+    def test_when_executor_is_None_then_raises_TypeError(
+        self, mock_host_interface, mock_manager_implementation_factory, mock_logger
+    ):
+        with pytest.raises(TypeError):
+            ManagerFactory(
+                mock_host_interface, mock_manager_implementation_factory, mock_logger, None
+            )
+
+
+class Test_ManagerFactory_kDefaultSharedManagerIdleTimeout:
+    def test_has_expected_value(self):
+        assert ManagerFactory.kDefaultSharedManagerIdleTimeout == datetime.timedelta(minutes=5)
+
+
+class Test_ManagerFactory_sharedManager:
+    def test_returns_an_initialized_manager(
+        self, a_manager_factory, mock_manager_implementation_factory, mock_manager_interface
+    ):
+        expected_identifier = "a.manager"
+        expected_settings = {"some": "settings"}
+
+        manager = a_manager_factory.sharedManager(expected_identifier, expected_settings)
+
+        assert isinstance(manager, Manager)
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once_with(
+            expected_identifier
+        )
+        mock_manager_interface.mock.initialize.assert_called_once()
+        assert mock_manager_interface.mock.initialize.call_args[0][0] == expected_settings
+
+    def test_when_called_with_equal_settings_then_manager_is_reused(
+        self, a_manager_factory, mock_manager_implementation_factory, mock_manager_interface
+    ):
+        manager_a = a_manager_factory.sharedManager("a.manager", {"a": 1, "b": "2"})
+        manager_b = a_manager_factory.sharedManager("a.manager", {"b": "2", "a": 1})
+
+        assert manager_a is manager_b
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once()
+        mock_manager_interface.mock.initialize.assert_called_once()
+
+    @pytest.mark.parametrize(
+        "identifier_b,settings_b",
+        [
+            ("another.manager", {"a": 1}),
+            ("a.manager", {"a": 2}),
+            ("a.manager", {"a": 1.0}),
+            ("a.manager", {"a": True}),
+            ("a.manager", {"a": "1"}),
+            ("a.manager", {"a": 1, "b": 1}),
+            ("a.manager", {}),
+        ],
+    )
+    def test_when_called_with_different_identifier_or_settings_then_new_manager_created(
+        self,
+        a_manager_factory,
+        mock_manager_implementation_factory,
+        create_mock_manager_interface,
+        identifier_b,
+        settings_b,
+    ):
+        mock_manager_implementation_factory.mock.instantiate.side_effect = (
+            lambda _: create_mock_manager_interface()
+        )
+
+        manager_a = a_manager_factory.sharedManager("a.manager", {"a": 1})
+        manager_b = a_manager_factory.sharedManager(identifier_b, settings_b)
+
+        assert manager_a is not manager_b
+        assert mock_manager_implementation_factory.mock.instantiate.call_count == 2
+
+    def test_when_initialize_fails_then_exception_propagated_and_next_call_retries(
+        self, a_manager_factory, mock_manager_implementation_factory, mock_manager_interface
+    ):
+        mock_manager_interface.mock.initialize.side_effect = errors.ConfigurationException(
+            "Bad settings"
+        )
+
+        with pytest.raises(errors.ConfigurationException, match="Bad settings"):
+            a_manager_factory.sharedManager("a.manager", {})
+
+        mock_manager_interface.mock.initialize.side_effect = None
+
+        manager = a_manager_factory.sharedManager("a.manager", {})
+
+        assert isinstance(manager, Manager)
+        assert mock_manager_implementation_factory.mock.instantiate.call_count == 2
+
+
+class Test_ManagerFactory_evictIdleSharedManagers:
+    def test_when_default_timeout_then_recently_released_manager_not_evicted(
+        self, a_manager_factory, mock_manager_implementation_factory
+    ):
+        manager = a_manager_factory.sharedManager("a.manager", {})
+        del manager
+
+        assert a_manager_factory.evictIdleSharedManagers() == 0
+
+        a_manager_factory.sharedManager("a.manager", {})
+        mock_manager_implementation_factory.mock.instantiate.assert_called_once()
+
+    def test_when_manager_referenced_then_not_evicted(self, a_manager_factory):
+        a_manager_factory.setSharedManagerIdleTimeout(datetime.timedelta(0))
+        manager = a_manager_factory.sharedManager("a.manager", {})
+
+        assert a_manager_factory.evictIdleSharedManagers() == 0
+        assert a_manager_factory.sharedManager("a.manager", {}) is manager
+
+    def test_when_manager_idle_beyond_timeout_then_evicted(
+        self, a_manager_factory, mock_manager_implementation_factory
+    ):
+        a_manager_factory.setSharedManagerIdleTimeout(datetime.timedelta(0))
+        manager = a_manager_factory.sharedManager("a.manager", {})
+        del manager
+
+        assert a_manager_factory.evictIdleSharedManagers() == 1
+
+        a_manager_factory.sharedManager("a.manager", {})
+        assert mock_manager_implementation_factory.mock.instantiate.call_count == 2
+
+    def test_when_manager_idle_beyond_timeout_then_evicted_by_next_request(
+        self, a_manager_factory, mock_manager_implementation_factory
+    ):
+        a_manager_factory.setSharedManagerIdleTimeout(datetime.timedelta(0))
+        manager = a_manager_factory.sharedManager("a.manager", {})
+        del manager
+
+        another_manager = a_manager_factory.sharedManager("another.manager", {})
+
+        assert a_manager_factory.evictIdleSharedManagers() == 0
+        assert another_manager is not None
+
 
 class Test_ManagerFactory_createManagerForInterface:
     def test_returns_a_manager(
@@ -487,6 +749,67 @@ class Test_ManagerFactory_createManagerForInterface:
         )
         assert_expected_manager(manager)
 
+    def test_when_no_executor_then_host_session_has_default_pool(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        manager = ManagerFactory.createManagerForInterface(
+            "a.manager", mock_host_interface, mock_manager_implementation_factory, mock_logger
+        )
+
+        executors = []
+
+        def record_executor(hostSession):
+            executors.append(hostSession.executor())
+            return {}
+
+        mock_manager_interface.mock.settings.side_effect = record_executor
+        manager.settings()
+
+        assert executors[0] is ThreadPool.defaultPool()
+
+    def test_when_executor_provided_then_host_session_has_executor(
+        self,
+        mock_manager_implementation_factory,
+        mock_host_interface,
+        mock_logger,
+        mock_manager_interface,
+    ):
+        executor = ThreadPool(1)
+        manager = ManagerFactory.createManagerForInterface(
+            "a.manager",
+            mock_host_interface,
+            mock_manager_implementation_factory,
+            mock_logger,
+            executor,
+        )
+
+        executors = []
+
+        def record_executor(hostSession):
+            executors.append(hostSession.executor())
+            return {}
+
+        mock_manager_interface.mock.settings.side_effect = record_executor
+        manager.settings()
+
+        assert executors[0] is executor
+
+    def test_when_executor_is_None_then_raises_TypeError(
+        self, mock_manager_implementation_factory, mock_host_interface, mock_logger
+    ):
+        with pytest.raises(TypeError):
+            ManagerFactory.createManagerForInterface(
+                "a.manager",
+                mock_host_interface,
+                mock_manager_implementation_factory,
+                mock_logger,
+                None,
+            )
+
 
 @pytest.fixture
 def assert_expected_manager(mock_host_interface, mock_manager_interface):
@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2021 The Foundry Visionmongers Ltd
+#   Copyright 2013-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@ Tests that cover the openassetio.managerApi.HostSession class.
 
 import pytest
 
+from openassetio.exec import ThreadPool
 from openassetio.managerApi import HostSession
 
 
@@ -58,6 +59,12 @@ class Test_HostSession_init:
 
         assert str(err.value).startswith("__init__(): incompatible constructor arguments")
 
+    def test_when_executor_is_None_then_raises_TypeError(self, a_host, mock_logger):
+        with pytest.raises(TypeError) as err:
+            HostSession(a_host, mock_logger, None)
+
+        assert str(err.value).startswith("__init__(): incompatible constructor arguments")
+
 
 class Test_HostSession_host:
     def test_returns_expected_host_instance(self, a_host_session, a_host):
@@ -71,3 +78,14 @@ class Test_HostSession_logger:
         actual_logger = a_host_session.logger()
 
         assert actual_logger is mock_logger
+
+
+class Test_HostSession_executor:
+    def test_when_executor_not_provided_then_returns_default_pool(self, a_host_session):
+        assert a_host_session.executor() is ThreadPool.defaultPool()
+
+    def test_when_executor_provided_then_returns_expected_executor(self, a_host, mock_logger):
+        executor = ThreadPool(1)
+        host_session = HostSession(a_host, mock_logger, executor)
+
+        assert host_session.executor() is executor
@@ -0,0 +1,205 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the opt-in batch variants of callback-based ManagerInterface
+methods (e.g. `resolveBatch`), which are used in preference to the
+callback-based methods when called via C++ (e.g. a `Manager`).
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+# pylint: disable=unused-argument,too-many-arguments
+
+import pytest
+
+from openassetio import Context, EntityReference, access, errors
+from openassetio.errors import BatchElementError
+from openassetio.hostApi import Manager
+from openassetio.managerApi import ManagerInterface
+from openassetio.trait import TraitsData
+
+
+class Test_ManagerInterface_resolveBatch:
+    def test_when_batch_variant_implemented_then_results_delivered_to_callbacks(
+        self, a_host_session, a_context, two_refs
+    ):
+        a_traitsdata = TraitsData({"aTrait"})
+        an_error = BatchElementError(
+            BatchElementError.ErrorCode.kEntityResolutionError, "unresolvable"
+        )
+
+        class BatchManagerInterface(ManagerInterface):
+            def resolveBatch(self, entityRefs, traitSet, resolveAccess, context, hostSession):
+                assert entityRefs == two_refs
+                assert traitSet == {"aTrait"}
+                assert resolveAccess == access.ResolveAccess.kRead
+                return [a_traitsdata, an_error]
+
+            def resolve(self, *_args):
+                pytest.fail("Callback-based method should not be called")
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+        successes = []
+        errs = []
+
+        manager.resolve(
+            two_refs,
+            {"aTrait"},
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, data: successes.append((idx, data)),
+            lambda idx, err: errs.append((idx, err)),
+        )
+
+        assert successes == [(0, a_traitsdata)]
+        assert errs == [(1, an_error)]
+
+    def test_when_batch_variant_returns_wrong_number_of_results_then_raises(
+        self, a_host_session, a_context, two_refs
+    ):
+        class BatchManagerInterface(ManagerInterface):
+            def resolveBatch(self, *_args):
+                return [TraitsData()]
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+
+        with pytest.raises(
+            errors.InputValidationException,
+            match="resolveBatch returned 1 results, but 2 were expected",
+        ):
+            manager.resolve(two_refs, set(), access.ResolveAccess.kRead, a_context, print, print)
+
+    def test_when_batch_variant_returns_None_element_then_raises(
+        self, a_host_session, a_context, two_refs
+    ):
+        class BatchManagerInterface(ManagerInterface):
+            def resolveBatch(self, *_args):
+                return [TraitsData(), None]
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+
+        with pytest.raises(
+            errors.InputValidationException, match="resolveBatch returned None at index 1"
+        ):
+            manager.resolve(
+                two_refs,
+                set(),
+                access.ResolveAccess.kRead,
+                a_context,
+                lambda idx, _: None,
+                lambda idx, err: pytest.fail("No errors expected"),
+            )
+
+    def test_when_batch_variant_not_implemented_then_callback_method_used(
+        self, a_host_session, a_context, two_refs
+    ):
+        class CallbackManagerInterface(ManagerInterface):
+            def resolve(
+                self, entityRefs, traitSet, resolveAccess, context, hostSession, success, error
+            ):
+                for idx, _ in enumerate(entityRefs):
+                    success(idx, TraitsData())
+
+        manager = Manager(CallbackManagerInterface(), a_host_session)
+        successes = []
+
+        manager.resolve(
+            two_refs,
+            set(),
+            access.ResolveAccess.kRead,
+            a_context,
+            lambda idx, _: successes.append(idx),
+            lambda idx, err: pytest.fail("No errors expected"),
+        )
+
+        assert successes == [0, 1]
+
+
+class Test_ManagerInterface_entityExistsBatch:
+    def test_when_batch_variant_implemented_then_results_delivered_to_callbacks(
+        self, a_host_session, a_context, two_refs
+    ):
+        an_error = BatchElementError(BatchElementError.ErrorCode.kEntityAccessError, "denied")
+
+        class BatchManagerInterface(ManagerInterface):
+            def entityExistsBatch(self, entityRefs, context, hostSession):
+                return [an_error, True]
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+        successes = []
+        errs = []
+
+        manager.entityExists(
+            two_refs,
+            a_context,
+            lambda idx, exists: successes.append((idx, exists)),
+            lambda idx, err: errs.append((idx, err)),
+        )
+
+        assert successes == [(1, True)]
+        assert errs == [(0, an_error)]
+
+    def test_when_batch_variant_returns_None_element_then_raises(
+        self, a_host_session, a_context, two_refs
+    ):
+        class BatchManagerInterface(ManagerInterface):
+            def entityExistsBatch(self, *_args):
+                return [None, True]
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+
+        with pytest.raises(
+            errors.InputValidationException, match="entityExistsBatch returned None at index 0"
+        ):
+            manager.entityExists(two_refs, a_context, print, print)
+
+
+class Test_ManagerInterface_preflightBatch:
+    def test_when_batch_variant_implemented_then_results_delivered_to_callbacks(
+        self, a_host_session, a_context, two_refs
+    ):
+        class BatchManagerInterface(ManagerInterface):
+            def preflightBatch(
+                self, entityRefs, traitsHints, publishingAccess, context, hostSession
+            ):
+                return [EntityReference(ref.toString() + "#preflighted") for ref in entityRefs]
+
+        manager = Manager(BatchManagerInterface(), a_host_session)
+        successes = []
+
+        manager.preflight(
+            two_refs,
+            [TraitsData(), TraitsData()],
+            access.PublishingAccess.kWrite,
+            a_context,
+            lambda idx, ref: successes.append((idx, ref)),
+            lambda idx, err: pytest.fail("No errors expected"),
+        )
+
+        assert successes == [
+            (0, EntityReference("first#preflighted")),
+            (1, EntityReference("second#preflighted")),
+        ]
+
+
+@pytest.fixture
+def a_context():
+    return Context()
+
+
+@pytest.fixture
+def two_refs():
+    return [EntityReference("first"), EntityReference("second")]
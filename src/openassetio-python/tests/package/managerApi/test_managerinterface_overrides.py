@@ -0,0 +1,93 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the resolution of Python overrides when ManagerInterface
+methods are called via C++ (e.g. a `Manager`), which is cached per
+instance.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+# pylint: disable=unused-argument
+
+from openassetio.hostApi import Manager
+from openassetio.managerApi import ManagerInterface
+
+
+class Test_ManagerInterface_overrides:
+    def test_when_method_not_overridden_then_base_implementation_used_on_every_call(
+        self, a_host_session
+    ):
+        manager = Manager(ManagerInterface(), a_host_session)
+
+        assert manager.info() == {}
+        assert manager.info() == {}
+
+    def test_when_method_overridden_then_override_called_on_every_call(self, a_host_session):
+        calls = []
+
+        class CountingManagerInterface(ManagerInterface):
+            def isEntityReferenceString(self, someString, hostSession):
+                calls.append(someString)
+                return someString.startswith("ref://")
+
+        manager = Manager(CountingManagerInterface(), a_host_session)
+
+        assert manager.isEntityReferenceString("ref://a") is True
+        assert manager.isEntityReferenceString("other") is False
+        assert manager.isEntityReferenceString("ref://b") is True
+        assert calls == ["ref://a", "other", "ref://b"]
+
+    def test_when_override_delegates_to_base_then_base_implementation_called(
+        self, a_host_session
+    ):
+        class DelegatingManagerInterface(ManagerInterface):
+            def info(self):
+                info = super().info()
+                info["delegated"] = True
+                return info
+
+        manager = Manager(DelegatingManagerInterface(), a_host_session)
+
+        assert manager.info() == {"delegated": True}
+        assert manager.info() == {"delegated": True}
+
+    def test_when_instances_of_different_types_then_overrides_resolved_per_instance(
+        self, a_host_session
+    ):
+        class OverridingManagerInterface(ManagerInterface):
+            def info(self):
+                return {"overridden": True}
+
+        overriding_manager = Manager(OverridingManagerInterface(), a_host_session)
+        base_manager = Manager(ManagerInterface(), a_host_session)
+
+        assert base_manager.info() == {}
+        assert overriding_manager.info() == {"overridden": True}
+        assert base_manager.info() == {}
+
+    def test_when_method_overridden_by_instance_attribute_then_attribute_called(
+        self, a_host_session
+    ):
+        class PlainManagerInterface(ManagerInterface):
+            pass
+
+        interface = PlainManagerInterface()
+        interface.info = lambda: {"fromAttribute": True}
+        manager = Manager(interface, a_host_session)
+
+        assert manager.info() == {"fromAttribute": True}
+        assert manager.info() == {"fromAttribute": True}
@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2022 The Foundry Visionmongers Ltd
+#   Copyright 2013-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -287,6 +287,53 @@ class Test_CppPluginSystem_reset:
         assert plugin.identifier() == plugin_a_identifier
 
 
+class Test_CppPluginSystem_reload:
+    def test_when_paths_unchanged_then_plugins_retained(
+        self, a_plugin_system, a_cpp_plugin_path, plugin_a_identifier
+    ):
+        a_plugin_system.scan(a_cpp_plugin_path)
+        path, plugin = a_plugin_system.plugin(plugin_a_identifier)
+
+        a_plugin_system.reload(a_cpp_plugin_path)
+
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+        reloaded_path, reloaded_plugin = a_plugin_system.plugin(plugin_a_identifier)
+        assert reloaded_path == path
+        assert reloaded_plugin.identifier() == plugin.identifier()
+        assert reloaded_plugin is plugin
+
+    def test_when_paths_changed_then_plugins_replaced(
+        self,
+        a_plugin_system,
+        the_cpp_plugins_root_path,
+        plugin_b_identifier,
+        plugin_a_identifier,
+    ):
+        a_plugin_system.scan(os.path.join(the_cpp_plugins_root_path, "pathA"))
+        # Confidence check.
+        assert a_plugin_system.identifiers() == [plugin_a_identifier]
+
+        a_plugin_system.reload(os.path.join(the_cpp_plugins_root_path, "pathB"))
+
+        assert a_plugin_system.identifiers() == [plugin_b_identifier]
+
+    def test_when_plugin_retired_then_existing_instance_still_accessible(
+        self,
+        a_plugin_system,
+        the_cpp_plugins_root_path,
+        plugin_a_identifier,
+    ):
+        # Essentially testing that a retired library is not unloaded
+        # whilst a plugin instance from it is still in use.
+
+        a_plugin_system.scan(os.path.join(the_cpp_plugins_root_path, "pathA"))
+        _path, plugin = a_plugin_system.plugin(plugin_a_identifier)
+
+        a_plugin_system.reload(os.path.join(the_cpp_plugins_root_path, "pathB"))
+
+        assert plugin.identifier() == plugin_a_identifier
+
+
 class Test_CppPluginSystem_destruction:
     def test_when_plugin_system_destructs_then_plugin_still_accessible(
         self, a_cpp_plugin_path, plugin_a_identifier, mock_logger
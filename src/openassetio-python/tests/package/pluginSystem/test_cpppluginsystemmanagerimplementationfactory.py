@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2024 The Foundry Visionmongers Ltd
+#   Copyright 2013-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -28,7 +28,7 @@ import re
 import pytest
 
 from openassetio import errors
-from openassetio.hostApi import ManagerFactory
+from openassetio.hostApi import Manager, ManagerFactory
 from openassetio.pluginSystem import CppPluginSystemManagerImplementationFactory
 
 
@@ -169,6 +169,41 @@ class Test_CppPluginSystemManagerImplementationFactory_instantiate:
             manager_interface.info()
 
 
+class Test_CppPluginSystemManagerImplementationFactory_reload:
+    def test_when_plugin_retired_then_context_manager_state_still_usable(
+        self, a_cpp_manager_plugin_path, plugin_a_identifier, a_host_session, mock_logger, tmp_path
+    ):
+        # Essentially testing that a retired library is not unloaded
+        # whilst an object created by its plugin, in this case the
+        # manager state held by a Context, is still in use.
+
+        (lib_name,) = (
+            name for name in os.listdir(a_cpp_manager_plugin_path) if name.endswith(lib_ext)
+        )
+        lib_link_path = tmp_path / lib_name
+        try:
+            os.symlink(os.path.join(a_cpp_manager_plugin_path, lib_name), lib_link_path)
+        except OSError:
+            pytest.skip("Symlinks are not supported on this platform")
+
+        factory = CppPluginSystemManagerImplementationFactory(str(tmp_path), mock_logger)
+        manager = Manager(factory.instantiate(plugin_a_identifier), a_host_session)
+        context = manager.createContext()
+        # Confidence check.
+        assert context.managerState is not None
+
+        del manager
+        os.unlink(lib_link_path)
+        factory.reload()
+
+        # Confidence check that the plugin has been retired.
+        assert factory.identifiers() == []
+        # Ensure the state's type information and destructor, provided
+        # by the retired library, are still available.
+        assert context.managerState is not None
+        del context
+
+
 class Test_ManagerFactory_CppPluginSystemManagerImplementationFactory:
     def test(
         self,
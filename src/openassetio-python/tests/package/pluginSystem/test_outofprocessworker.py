@@ -0,0 +1,333 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests for the worker side of out-of-process Python managers.
+
+The C++ proxy is emulated by encoding requests using the worker
+module's own Writer/Reader.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import socket
+import threading
+
+import pytest
+
+from openassetio import errors
+from openassetio.hostApi import ManagerImplementationFactoryInterface
+from openassetio.log import ConsoleLogger, LoggerInterface
+from openassetio.managerApi import ManagerInterface
+from openassetio.pluginSystem._outOfProcessWorker import (
+    Element,
+    Op,
+    Reader,
+    Reply,
+    Worker,
+    Writer,
+    receiveFrame,
+    sendFrame,
+)
+from openassetio.trait import TraitsData
+
+
+class Test_Worker_handle:
+    def test_when_instantiated_then_identifier_is_forwarded(self, worker):
+        assert call(worker, request(Op.kIdentifier)).string() == "org.openassetio.test.oop"
+
+    def test_when_not_instantiated_then_exception_reply_returned(self, uninstantiated_worker):
+        name, message = exceptionReply(uninstantiated_worker.handle(request(Op.kIdentifier)))
+        assert name == "MalformedMessageError"
+        assert message == "Manager has not been instantiated"
+
+    def test_when_opcode_unknown_then_exception_reply_returned(self, worker):
+        name, message = exceptionReply(worker.handle(bytes([255])))
+        assert name == "MalformedMessageError"
+        assert message == "Unknown opcode 255"
+
+    def test_when_trailing_data_then_exception_reply_returned(self, worker):
+        name, _ = exceptionReply(worker.handle(request(Op.kIdentifier) + b"\0"))
+        assert name == "MalformedMessageError"
+
+    def test_when_factory_identifiers_requested_then_identifiers_returned(
+        self, uninstantiated_worker
+    ):
+        reply = call(uninstantiated_worker, request(Op.kIdentifiers))
+        assert reply.strings() == ["org.openassetio.test.oop"]
+
+    def test_when_capability_queried_then_result_forwarded(self, worker):
+        reply = call(
+            worker, request(Op.kHasCapability, int(ManagerInterface.Capability.kResolution))
+        )
+        assert reply.u8() == 1
+        reply = call(
+            worker, request(Op.kHasCapability, int(ManagerInterface.Capability.kPublishing))
+        )
+        assert reply.u8() == 0
+
+    def test_when_initialized_then_host_details_available_to_manager(self, worker, manager):
+        writer = Writer()
+        writer.u8(Op.kInitialize)
+        writer.string("org.openassetio.test.host")
+        writer.string("Test Host")
+        writer.dictionary({"a": 1})
+        writer.dictionary({"b": True, "c": 1.5, "d": "e"})
+
+        call(worker, writer.payload())
+
+        assert manager.initializedSettings == {"b": True, "c": 1.5, "d": "e"}
+        assert manager.hostIdentifier == "org.openassetio.test.host"
+
+    def test_when_manager_raises_then_exception_reply_returned(self, worker):
+        name, message = exceptionReply(worker.handle(request(Op.kFlushCaches)))
+        assert name == "InputValidationException"
+        assert message == "Can't flush"
+
+    def test_when_resolving_then_values_and_errors_returned_in_order(self, worker):
+        writer = Writer()
+        writer.u8(Op.kResolve)
+        writer.strings(["oop://good", "oop://bad", "oop://good"])
+        writer.strings(["aTrait"])
+        writer.u8(0)
+        writer.traitsData(TraitsData())
+
+        reply = call(worker, writer.payload())
+
+        assert reply.u32() == 3
+        assert reply.u8() == Element.kValue
+        assert reply.traitsData().getTraitProperty("aTrait", "ref") == "oop://good"
+        assert reply.u8() == Element.kError
+        assert reply.u8() == int(errors.BatchElementError.ErrorCode.kEntityResolutionError)
+        assert reply.string() == "oop://bad"
+        assert reply.u8() == Element.kValue
+        assert reply.traitsData().getTraitProperty("aTrait", "ref") == "oop://good"
+        assert reply.atEnd()
+
+
+class Test_Worker_serve:
+    def test_when_manager_logs_then_log_frame_precedes_result(self, manager):
+        hostEnd, workerEnd = socket.socketpair()
+        worker = Worker(workerEnd, implementationFactory=FakeFactory(ConsoleLogger(), manager))
+        thread = threading.Thread(target=worker.serve)
+        thread.start()
+        try:
+            sendFrame(hostEnd, request(Op.kInstantiate, "org.openassetio.test.oop"))
+            assert Reader(receiveFrame(hostEnd)).u8() == Reply.kResult
+
+            sendFrame(hostEnd, request(Op.kSettings))
+
+            logFrame = Reader(receiveFrame(hostEnd))
+            assert logFrame.u8() == Reply.kLog
+            assert logFrame.u8() == int(LoggerInterface.Severity.kInfo)
+            assert logFrame.string() == "Getting settings"
+            result = Reader(receiveFrame(hostEnd))
+            assert result.u8() == Reply.kResult
+            assert result.dictionary() == {}
+        finally:
+            hostEnd.close()
+            thread.join()
+            workerEnd.close()
+
+    def test_when_manager_logs_from_other_threads_then_frames_not_interleaved(self):
+        numRequests = 20
+        manager = ThreadedLoggingManager(numThreads=4, numMessages=10)
+        hostEnd, workerEnd = socket.socketpair()
+        # Fail rather than hang if the stream is corrupted.
+        hostEnd.settimeout(30)
+        worker = Worker(workerEnd, implementationFactory=FakeFactory(ConsoleLogger(), manager))
+        thread = threading.Thread(target=worker.serve)
+        thread.start()
+        try:
+            sendFrame(hostEnd, request(Op.kInstantiate, "org.openassetio.test.oop"))
+            assert Reader(receiveFrame(hostEnd)).u8() == Reply.kResult
+            # Starts the logging threads.
+            sendFrame(hostEnd, request(Op.kSettings))
+            for _ in range(numRequests):
+                sendFrame(hostEnd, request(Op.kIdentifier))
+
+            numResults = 0
+            numLogs = 0
+            while numResults < numRequests + 1 or numLogs < manager.expectedNumLogs:
+                frame = Reader(receiveFrame(hostEnd))
+                tag = frame.u8()
+                if tag == Reply.kLog:
+                    assert frame.u8() == int(LoggerInterface.Severity.kInfo)
+                    assert frame.string() == ThreadedLoggingManager.message
+                    numLogs += 1
+                else:
+                    assert tag == Reply.kResult
+                    if numResults > 0:
+                        assert frame.string() == "org.openassetio.test.oop"
+                    numResults += 1
+        finally:
+            hostEnd.close()
+            manager.join()
+            thread.join()
+            workerEnd.close()
+
+    def test_when_connection_closed_then_serve_returns(self, manager):
+        hostEnd, workerEnd = socket.socketpair()
+        worker = Worker(workerEnd, implementationFactory=FakeFactory(ConsoleLogger(), manager))
+        hostEnd.close()
+        worker.serve()
+        workerEnd.close()
+
+
+def request(opcode, *args):
+    writer = Writer()
+    writer.u8(opcode)
+    for arg in args:
+        if isinstance(arg, str):
+            writer.string(arg)
+        else:
+            writer.u8(arg)
+    return writer.payload()
+
+
+def call(worker, payload):
+    reader = Reader(worker.handle(payload))
+    tag = reader.u8()
+    if tag == Reply.kException:
+        pytest.fail(f"{reader.string()}: {reader.string()}")
+    assert tag == Reply.kResult
+    return reader
+
+
+def exceptionReply(payload):
+    reader = Reader(payload)
+    assert reader.u8() == Reply.kException
+    return reader.string(), reader.string()
+
+
+class FakeManager(ManagerInterface):
+    def __init__(self):
+        ManagerInterface.__init__(self)
+        self.initializedSettings = None
+        self.hostIdentifier = None
+
+    def identifier(self):
+        return "org.openassetio.test.oop"
+
+    def displayName(self):
+        return "Out-of-process test manager"
+
+    def hasCapability(self, capability):
+        return capability == ManagerInterface.Capability.kResolution
+
+    def settings(self, hostSession):
+        hostSession.logger().info("Getting settings")
+        return {}
+
+    def initialize(self, managerSettings, hostSession):
+        self.initializedSettings = managerSettings
+        self.hostIdentifier = hostSession.host().identifier()
+
+    def flushCaches(self, hostSession):
+        raise errors.InputValidationException("Can't flush")
+
+    def resolve(
+        self,
+        entityReferences,
+        traitSet,
+        resolveAccess,
+        context,
+        hostSession,
+        successCallback,
+        errorCallback,
+    ):
+        for idx, ref in enumerate(entityReferences):
+            if ref.toString() == "oop://bad":
+                errorCallback(
+                    idx,
+                    errors.BatchElementError(
+                        errors.BatchElementError.ErrorCode.kEntityResolutionError, ref.toString()
+                    ),
+                )
+                continue
+            data = TraitsData()
+            for traitId in traitSet:
+                data.setTraitProperty(traitId, "ref", ref.toString())
+            successCallback(idx, data)
+
+
+class ThreadedLoggingManager(FakeManager):
+    """
+    Manager that logs large messages from background threads, started
+    when settings are queried.
+    """
+
+    # Large enough that a frame is sent in several pieces.
+    message = "x" * 1_000_000
+
+    def __init__(self, numThreads, numMessages):
+        FakeManager.__init__(self)
+        self.__numThreads = numThreads
+        self.__numMessages = numMessages
+        self.__threads = []
+        self.expectedNumLogs = numThreads * numMessages
+
+    def settings(self, hostSession):
+        logger = hostSession.logger()
+
+        def logMessages():
+            for _ in range(self.__numMessages):
+                logger.info(self.message)
+
+        self.__threads = [threading.Thread(target=logMessages) for _ in range(self.__numThreads)]
+        for thread in self.__threads:
+            thread.start()
+        return {}
+
+    def join(self):
+        for thread in self.__threads:
+            thread.join()
+
+
+class FakeFactory(ManagerImplementationFactoryInterface):
+    def __init__(self, logger, manager):
+        ManagerImplementationFactoryInterface.__init__(self, logger)
+        self.__manager = manager
+
+    def identifiers(self):
+        return [self.__manager.identifier()]
+
+    def instantiate(self, identifier):
+        assert identifier == self.__manager.identifier()
+        return self.__manager
+
+
+@pytest.fixture
+def manager():
+    return FakeManager()
+
+
+@pytest.fixture
+def connection():
+    hostEnd, workerEnd = socket.socketpair()
+    yield workerEnd
+    hostEnd.close()
+    workerEnd.close()
+
+
+@pytest.fixture
+def uninstantiated_worker(connection, manager):
+    return Worker(connection, implementationFactory=FakeFactory(ConsoleLogger(), manager))
+
+
+@pytest.fixture
+def worker(uninstantiated_worker):
+    call(uninstantiated_worker, request(Op.kInstantiate, "org.openassetio.test.oop"))
+    return uninstantiated_worker
@@ -1,5 +1,5 @@
 #
-#   Copyright 2022-2024 The Foundry Visionmongers Ltd
+#   Copyright 2022-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@ Tests for the BatchElementError type.
 # pylint: disable=too-few-public-methods
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import pickle
 import re
 
 import pytest
@@ -37,6 +38,7 @@ class Test_BatchElementError_ErrorCode:
         assert int(BatchElementError.ErrorCode.kInvalidPreflightHint) == 133
         assert int(BatchElementError.ErrorCode.kInvalidTraitSet) == 134
         assert int(BatchElementError.ErrorCode.kAuthError) == 135
+        assert int(BatchElementError.ErrorCode.kTimeout) == 136
 
 
 class Test_BatchElementError_inheritance:
@@ -121,6 +123,7 @@ class Test_BatchElementException:
             BatchElementError.ErrorCode.kInvalidPreflightHint,
             BatchElementError.ErrorCode.kInvalidTraitSet,
             BatchElementError.ErrorCode.kAuthError,
+            BatchElementError.ErrorCode.kTimeout,
         ],
     )
     def test_when_thrown_then_correct_data_set(self, exception_code):
@@ -145,3 +148,14 @@ class Test_BatchElementException:
             0, BatchElementError(BatchElementError.ErrorCode.kInvalidEntityReference, ""), ""
         )
         assert isinstance(exception, OpenAssetIOException)
+
+
+class Test_BatchElementError_pickle:
+    @pytest.mark.parametrize("protocol", range(pickle.HIGHEST_PROTOCOL + 1))
+    def test_when_round_tripped_then_equal(self, protocol):
+        error = BatchElementError(BatchElementError.ErrorCode.kEntityAccessError, "a 🦆 message")
+
+        actual = pickle.loads(pickle.dumps(error, protocol=protocol))
+
+        assert actual == error
+        assert actual.code == BatchElementError.ErrorCode.kEntityAccessError
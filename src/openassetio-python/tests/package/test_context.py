@@ -1,5 +1,5 @@
 #
-#   Copyright 2022 The Foundry Visionmongers Ltd
+#   Copyright 2022-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -19,9 +19,12 @@ Tests that cover the openassetio.Context class.
 
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
+import datetime
+import pickle
+
 import pytest
 
-from openassetio import Context, managerApi
+from openassetio import CancellationToken, Context, managerApi
 from openassetio.trait import TraitsData
 
 
@@ -30,6 +33,9 @@ class Test_Context_init:
         context = Context()
         assert isinstance(context.locale, TraitsData)
         assert context.managerState is None
+        assert context.cancellationToken is None
+        assert context.remainingTime() is None
+        assert context.isExpired() is False
         # Ensure we're not re-using the same instance.
         assert Context().locale is not context.locale
 
@@ -101,6 +107,110 @@ class Test_Context_managerState:
         assert actual_data is expected_data
 
 
+class Test_Context_setTimeout:
+    def test_when_set_then_remaining_time_is_at_most_timeout(self, a_context):
+        timeout = datetime.timedelta(seconds=60)
+
+        a_context.setTimeout(timeout)
+
+        remaining = a_context.remainingTime()
+        assert datetime.timedelta(0) < remaining <= timeout
+        assert a_context.isExpired() is False
+
+    def test_when_maximum_timeout_then_does_not_overflow(self, a_context):
+        a_context.setTimeout(datetime.timedelta.max)
+
+        assert a_context.remainingTime() > datetime.timedelta(0)
+        assert a_context.isExpired() is False
+
+    def test_when_negative_timeout_then_is_expired(self, a_context):
+        a_context.setTimeout(datetime.timedelta.min)
+
+        assert a_context.remainingTime() == datetime.timedelta(0)
+        assert a_context.isExpired() is True
+
+    def test_when_deadline_passed_then_is_expired(self, a_context):
+        a_context.setTimeout(datetime.timedelta(0))
+
+        assert a_context.remainingTime() == datetime.timedelta(0)
+        assert a_context.isExpired() is True
+
+    def test_when_set_to_None_then_deadline_is_cleared(self, a_context):
+        a_context.setTimeout(datetime.timedelta(0))
+
+        a_context.setTimeout(None)
+
+        assert a_context.remainingTime() is None
+        assert a_context.isExpired() is False
+
+
+class Test_Context_cancellationToken:
+    def test_when_set_then_holds_reference_to_token(self, a_context):
+        token = CancellationToken()
+
+        a_context.cancellationToken = token
+
+        assert a_context.cancellationToken is token
+
+    def test_when_token_cancelled_then_is_expired(self, a_context):
+        a_context.cancellationToken = CancellationToken()
+        assert a_context.isExpired() is False
+
+        a_context.cancellationToken.cancel()
+
+        assert a_context.isExpired() is True
+
+
+class Test_CancellationToken:
+    def test_when_constructed_then_is_not_cancelled(self):
+        assert CancellationToken().isCancelled() is False
+
+    def test_when_cancelled_then_is_cancelled(self):
+        token = CancellationToken()
+
+        token.cancel()
+        token.cancel()
+
+        assert token.isCancelled() is True
+
+    def test_cannot_be_subclassed(self):
+        with pytest.raises(TypeError):
+
+            class _(CancellationToken):  # pylint: disable=unused-variable
+                pass
+
+
+class Test_Context_pickle:
+    @pytest.mark.parametrize("protocol", range(pickle.HIGHEST_PROTOCOL + 1))
+    def test_when_round_tripped_then_locale_is_preserved(self, a_context, protocol):
+        a_context.locale.setTraitProperty("a_trait", "a_property", "a value")
+
+        actual = pickle.loads(pickle.dumps(a_context, protocol=protocol))
+
+        assert isinstance(actual, Context)
+        assert actual.locale == a_context.locale
+        assert actual.locale is not a_context.locale
+        assert actual.managerState is None
+
+    def test_when_context_has_manager_state_then_raises(self, a_context):
+        a_context.managerState = managerApi.ManagerStateBase()
+
+        with pytest.raises(TypeError, match="persistenceTokenForState"):
+            pickle.dumps(a_context)
+
+    def test_when_context_has_deadline_then_raises(self, a_context):
+        a_context.setTimeout(datetime.timedelta(seconds=1))
+
+        with pytest.raises(TypeError, match="deadline"):
+            pickle.dumps(a_context)
+
+    def test_when_context_has_cancellation_token_then_raises(self, a_context):
+        a_context.cancellationToken = CancellationToken()
+
+        with pytest.raises(TypeError, match="cancellationToken"):
+            pickle.dumps(a_context)
+
+
 @pytest.fixture
 def a_context():
     return Context()
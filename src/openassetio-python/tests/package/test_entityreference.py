@@ -1,5 +1,5 @@
 #
-#   Copyright 2024 The Foundry Visionmongers Ltd
+#   Copyright 2024-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@ Tests for the EntityReference type.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+import pickle
+
 import pytest
 
 from openassetio import EntityReference
@@ -79,3 +81,11 @@ class Test_EntityReference_string_equivalence:
     def test_when_used_with_format_then_result_contains_toString_value(self):
         a_ref = EntityReference("Some 🍟 with that?")
         assert f"{a_ref}" == a_ref.toString()
+
+
+class Test_EntityReference_pickle:
+    @pytest.mark.parametrize("protocol", range(pickle.HIGHEST_PROTOCOL + 1))
+    def test_when_round_tripped_then_equal(self, protocol):
+        a_ref = EntityReference("Some 🍟 with that?")
+
+        assert pickle.loads(pickle.dumps(a_ref, protocol=protocol)) == a_ref
@@ -0,0 +1,123 @@
+#
+#   Copyright 2025 The Foundry Visionmongers Ltd
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#
+"""
+Tests that cover the openassetio.exec namespace.
+"""
+
+# pylint: disable=invalid-name,redefined-outer-name
+# pylint: disable=missing-class-docstring,missing-function-docstring
+import threading
+
+import pytest
+
+from openassetio.exec import ExecutorInterface, ThreadPool
+from openassetio.log import LoggerInterface
+
+
+class Test_ThreadPool_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(ThreadPool):
+                pass
+
+    def test_is_ExecutorInterface(self):
+        assert issubclass(ThreadPool, ExecutorInterface)
+
+
+class Test_ThreadPool_init:
+    def test_when_numThreads_given_then_concurrency_is_numThreads(self):
+        assert ThreadPool(3).concurrency() == 3
+
+    def test_when_numThreads_not_given_then_concurrency_is_nonzero(self):
+        assert ThreadPool().concurrency() >= 1
+
+
+class Test_ThreadPool_defaultPool:
+    def test_returns_same_instance(self):
+        assert ThreadPool.defaultPool() is ThreadPool.defaultPool()
+
+
+class Test_ThreadPool_submit:
+    def test_when_pool_destroyed_then_all_tasks_have_run(self):
+        pool = ThreadPool(4)
+        results = []
+        lock = threading.Lock()
+
+        def task(value):
+            with lock:
+                results.append(value)
+
+        for idx in range(100):
+            pool.submit(lambda idx=idx: task(idx))
+
+        del pool
+
+        assert sorted(results) == list(range(100))
+
+    def test_when_task_raises_then_subsequent_tasks_still_run(self):
+        pool = ThreadPool(1)
+        done = threading.Event()
+
+        def failing_task():
+            raise RuntimeError("Task failed")
+
+        pool.submit(failing_task)
+        pool.submit(done.set)
+
+        assert done.wait(timeout=10)
+
+    def test_when_task_raises_then_exception_logged(self, mock_logger):
+        pool = ThreadPool(1, mock_logger)
+
+        def failing_task():
+            raise RuntimeError("Task failed")
+
+        pool.submit(failing_task)
+        del pool
+
+        mock_logger.mock.log.assert_called_once()
+        severity, message = mock_logger.mock.log.call_args.args
+        assert severity == LoggerInterface.Severity.kError
+        assert message.startswith("Uncaught exception in ThreadPool task: ")
+        assert "Task failed" in message
+
+    def test_when_task_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError):
+            ThreadPool(1).submit(None)
+
+
+class Test_ThreadPool_parallelFor:
+    def test_calls_body_for_each_index(self):
+        pool = ThreadPool(4)
+        visits = [0] * 1000
+
+        def body(idx):
+            visits[idx] += 1
+
+        pool.parallelFor(len(visits), body)
+
+        assert visits == [1] * len(visits)
+
+    def test_when_body_raises_then_exception_propagates(self):
+        pool = ThreadPool(4)
+
+        def body(idx):
+            if idx == 50:
+                raise ValueError("Body failed")
+
+        with pytest.raises(ValueError, match="Body failed"):
+            pool.parallelFor(100, body)
@@ -1,5 +1,5 @@
 #
-#   Copyright 2013-2023 The Foundry Visionmongers Ltd
+#   Copyright 2013-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -49,6 +49,9 @@ class Test_package_imports:
     def test_importing_constants_succeeds(self):
         from openassetio import constants
 
+    def test_importing_CancellationToken_succeeds(self):
+        from openassetio import CancellationToken
+
     def test_importing_Context_succeeds(self):
         from openassetio import Context
 
@@ -62,6 +65,14 @@ class Test_package_imports:
         from openassetio import utils
 
 
+class Test_exec_imports:
+    def test_importing_ExecutorInterface_succeeds(self):
+        from openassetio.exec import ExecutorInterface
+
+    def test_importing_ThreadPool_succeeds(self):
+        from openassetio.exec import ThreadPool
+
+
 class Test_hostApi_imports:
     def test_importing_HostInterface_succeeds(self):
         from openassetio.hostApi import HostInterface
@@ -20,8 +20,11 @@ Tests that cover the openassetio.log module.
 # pylint: disable=invalid-name,redefined-outer-name
 # pylint: disable=missing-class-docstring,missing-function-docstring
 
+from unittest import mock
+
 import pytest
 
+from openassetio import errors
 import openassetio.log as lg
 
 
@@ -324,3 +327,67 @@ class Test_SeverityFilter_upstreamLogger:
     def test_returns_the_constructor_supplied_logger(self, mock_logger):
         a_filter = lg.SeverityFilter(mock_logger)
         assert a_filter.upstreamLogger() is mock_logger
+
+
+class Test_AsyncLogger_inheritance:
+    def test_class_is_final(self):
+        with pytest.raises(TypeError):
+
+            class _(lg.AsyncLogger):
+                pass
+
+
+class Test_AsyncLogger_init:
+    def test_when_logger_is_None_then_raises_TypeError(self):
+        with pytest.raises(TypeError) as err:
+            lg.AsyncLogger(None)
+
+        assert str(err.value).startswith("__init__(): incompatible constructor arguments")
+
+    def test_when_defaults_then_has_default_configuration(self, mock_logger):
+        a_logger = lg.AsyncLogger(mock_logger)
+
+        assert a_logger.capacity() == lg.AsyncLogger.kDefaultCapacity
+        assert a_logger.overflowPolicy() == lg.AsyncLogger.OverflowPolicy.kBlock
+        assert a_logger.droppedCount() == 0
+
+    def test_when_capacity_zero_then_raises_InputValidationException(self, mock_logger):
+        with pytest.raises(errors.InputValidationException):
+            lg.AsyncLogger(mock_logger, 0)
+
+
+class Test_AsyncLogger_upstreamLogger:
+    def test_returns_the_constructor_supplied_logger(self, mock_logger):
+        a_logger = lg.AsyncLogger(mock_logger)
+        assert a_logger.upstreamLogger() is mock_logger
+
+
+class Test_AsyncLogger_isSeverityLogged:
+    @pytest.mark.parametrize("is_severity_logged", (True, False))
+    def test_delegates_to_upstream_logger(self, mock_logger, is_severity_logged):
+        mock_logger.mock.isSeverityLogged.return_value = is_severity_logged
+        a_logger = lg.AsyncLogger(mock_logger)
+
+        assert a_logger.isSeverityLogged(lg.LoggerInterface.Severity.kInfo) == is_severity_logged
+
+
+class Test_AsyncLogger_log:
+    def test_when_flushed_then_messages_relayed_in_order(self, mock_logger):
+        a_logger = lg.AsyncLogger(mock_logger)
+
+        a_logger.log(lg.LoggerInterface.Severity.kInfo, "one")
+        a_logger.log(lg.LoggerInterface.Severity.kError, "two")
+        a_logger.flush()
+
+        assert mock_logger.mock.log.call_args_list == [
+            mock.call(lg.LoggerInterface.Severity.kInfo, "one"),
+            mock.call(lg.LoggerInterface.Severity.kError, "two"),
+        ]
+
+    def test_when_destroyed_then_pending_messages_relayed(self, mock_logger):
+        a_logger = lg.AsyncLogger(mock_logger)
+
+        a_logger.log(lg.LoggerInterface.Severity.kInfo, "one")
+        del a_logger
+
+        mock_logger.mock.log.assert_called_once_with(lg.LoggerInterface.Severity.kInfo, "one")
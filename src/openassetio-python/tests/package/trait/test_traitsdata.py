@@ -1,5 +1,5 @@
 # SPDX-License-Identifier: Apache-2.0
-# Copyright 2024 The Foundry Visionmongers Ltd
+# Copyright 2024-2025 The Foundry Visionmongers Ltd
 
 """
 Tests for the traits data container
@@ -8,8 +8,11 @@ Tests for the traits data container
 # pylint: disable=invalid-name,missing-class-docstring
 # pylint: disable=redefined-outer-name
 # pylint: disable=missing-function-docstring
+import pickle
+
 import pytest
 
+from openassetio.errors import InputValidationException
 from openassetio.trait import TraitsData
 
 
@@ -183,6 +186,105 @@ class Test_TraitsData_equality:
         assert data_a != data_b
 
 
+class Test_TraitsData_toDict:
+    def test_when_empty_then_returns_empty_dict(self):
+        assert TraitsData().toDict() == {}
+
+    def test_when_has_traits_then_returns_nested_dict_of_properties(self, a_traitsdata):
+        a_traitsdata.setTraitProperty("first_trait", "a_bool", True)
+        a_traitsdata.setTraitProperty("first_trait", "an_int", 1)
+        a_traitsdata.setTraitProperty("first_trait", "a_float", 1.5)
+        a_traitsdata.setTraitProperty("first_trait", "a_str", "🦆")
+
+        actual = a_traitsdata.toDict()
+
+        assert actual == {
+            "first_trait": {"a_bool": True, "an_int": 1, "a_float": 1.5, "a_str": "🦆"},
+            "second_trait": {},
+        }
+        assert isinstance(actual["first_trait"]["a_bool"], bool)
+        assert isinstance(actual["first_trait"]["an_int"], int)
+        assert not isinstance(actual["first_trait"]["an_int"], bool)
+
+
+class Test_TraitsData_fromDict:
+    def test_when_dict_empty_then_returns_empty_traitsdata(self):
+        assert TraitsData.fromDict({}) == TraitsData()
+
+    def test_when_dict_has_traits_then_equivalent_traitsdata_returned(self, a_traitsdata):
+        a_traitsdata.setTraitProperty("first_trait", "a_bool", False)
+        a_traitsdata.setTraitProperty("first_trait", "an_int", 2)
+        a_traitsdata.setTraitProperty("first_trait", "a_float", 2.5)
+        a_traitsdata.setTraitProperty("first_trait", "a_str", "a value")
+
+        actual = TraitsData.fromDict(
+            {
+                "first_trait": {"a_bool": False, "an_int": 2, "a_float": 2.5, "a_str": "a value"},
+                "second_trait": {},
+            }
+        )
+
+        assert actual == a_traitsdata
+
+    def test_round_trips_with_toDict(self, a_traitsdata):
+        a_traitsdata.setTraitProperty("second_trait", "a_property", 3)
+
+        assert TraitsData.fromDict(a_traitsdata.toDict()) == a_traitsdata
+
+    def test_when_value_is_None_then_raises(self):
+        with pytest.raises(TypeError):
+            TraitsData.fromDict({"a_trait": {"a_property": None}})
+
+
+class Test_TraitsData_toDicts:
+    def test_when_list_empty_then_returns_empty_list(self):
+        assert TraitsData.toDicts([]) == []
+
+    def test_returns_dict_per_traitsdata_in_order(self, a_traitsdata):
+        another_traitsdata = TraitsData()
+        another_traitsdata.setTraitProperty("third_trait", "a_property", "a value")
+
+        actual = TraitsData.toDicts([a_traitsdata, another_traitsdata])
+
+        assert actual == [
+            {"first_trait": {}, "second_trait": {}},
+            {"third_trait": {"a_property": "a value"}},
+        ]
+
+    def test_when_element_is_None_then_raises(self, a_traitsdata):
+        with pytest.raises(InputValidationException, match="Traits data cannot be None"):
+            TraitsData.toDicts([a_traitsdata, None])
+
+
+class Test_TraitsData_pickle:
+    @pytest.mark.parametrize("protocol", range(pickle.HIGHEST_PROTOCOL + 1))
+    def test_when_round_tripped_then_equal(self, a_traitsdata, protocol):
+        a_traitsdata.setTraitProperty("first_trait", "a_bool", True)
+        a_traitsdata.setTraitProperty("first_trait", "an_int", -(2**62))
+        a_traitsdata.setTraitProperty("first_trait", "a_float", -1.5)
+        a_traitsdata.setTraitProperty("second_trait", "a_str", "🦆")
+
+        actual = pickle.loads(pickle.dumps(a_traitsdata, protocol=protocol))
+
+        assert actual == a_traitsdata
+        assert actual is not a_traitsdata
+
+    def test_when_protocol_5_then_state_can_be_transferred_out_of_band(self, a_traitsdata):
+        a_traitsdata.setTraitProperty("first_trait", "a_str", "a value")
+        buffers = []
+
+        pickled = pickle.dumps(a_traitsdata, protocol=5, buffer_callback=buffers.append)
+
+        assert len(buffers) == 1
+        assert pickle.loads(pickled, buffers=buffers) == a_traitsdata
+
+    def test_when_state_malformed_then_raises(self):
+        a_traitsdata = TraitsData.__new__(TraitsData)
+
+        with pytest.raises(InputValidationException, match="Malformed TraitsData encoding"):
+            a_traitsdata.__setstate__(b"\x01\x01")
+
+
 @pytest.fixture
 def a_traitsdata():
     return TraitsData({"first_trait", "second_trait"})
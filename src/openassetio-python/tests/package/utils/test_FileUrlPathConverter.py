@@ -1,5 +1,5 @@
 #
-#   Copyright 2023 The Foundry Visionmongers Ltd
+#   Copyright 2023-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -27,7 +27,7 @@ from pathlib import Path
 import pytest
 
 from openassetio import utils
-from openassetio.errors import InputValidationException
+from openassetio.errors import BatchElementError, InputValidationException
 from openassetio.utils import PathType
 
 
@@ -166,6 +166,109 @@ class Test_pathFromUrl:
             raise RuntimeError("Unhandled URL mapping")
 
 
+class Test_batch:
+    @pytest.mark.parametrize("path_type", [PathType.kPOSIX, PathType.kWindows])
+    def test_pathToUrl_matches_single_element_conversion(
+        self, path_type, file_path_to_url_json, url_path_converter
+    ):
+        paths = [case["file_path"] for case in file_path_to_url_json] + ["", "/a\0b"]
+        result = utils.PathBatchResult()
+
+        url_path_converter.pathToUrl(paths, result, path_type)
+
+        self.assert_matches_single_element_conversion(
+            paths, result, lambda path: url_path_converter.pathToUrl(path, path_type)
+        )
+
+    @pytest.mark.parametrize("path_type", [PathType.kPOSIX, PathType.kWindows])
+    def test_pathFromUrl_matches_single_element_conversion(
+        self, path_type, url_to_file_path_json, url_path_converter
+    ):
+        urls = [case["URL"] for case in url_to_file_path_json] + ["http://a", "file://^"]
+        result = utils.PathBatchResult()
+
+        url_path_converter.pathFromUrl(urls, result, path_type)
+
+        self.assert_matches_single_element_conversion(
+            urls, result, lambda url: url_path_converter.pathFromUrl(url, path_type)
+        )
+
+    def test_when_result_reused_then_previous_contents_replaced(self, url_path_converter):
+        result = utils.PathBatchResult()
+        url_path_converter.pathToUrl(["/a", "relative", "/b"], result, PathType.kPOSIX)
+
+        url_path_converter.pathFromUrl(["file:///c"], result, PathType.kPOSIX)
+
+        assert len(result) == 1
+        assert result[0] == "/c"
+        assert result.errors() == {}
+
+    def test_packed_buffers_contain_all_elements(self, url_path_converter):
+        result = utils.PathBatchResult()
+
+        url_path_converter.pathToUrl(["/a", "relative", "/b c"], result, PathType.kPOSIX)
+
+        assert result.bytes() == b"file:///afile:///b%20c"
+        assert result.offsets().tolist() == [0, 9, 9, 22]
+        assert result.errors() == {
+            1: BatchElementError(
+                BatchElementError.ErrorCode.kUnknown, "Path is relative ('relative')"
+            )
+        }
+
+    def test_when_index_out_of_range_then_IndexError_raised(self, url_path_converter):
+        result = utils.PathBatchResult()
+        url_path_converter.pathToUrl(["/a"], result, PathType.kPOSIX)
+
+        with pytest.raises(IndexError):
+            _ = result[1]
+
+    def test_when_indexed_with_negative_index_then_counts_from_end(self, url_path_converter):
+        result = utils.PathBatchResult()
+        url_path_converter.pathToUrl(["/a", "/b"], result, PathType.kPOSIX)
+
+        assert result[-1] == "file:///b"
+        assert result[-2] == "file:///a"
+
+        with pytest.raises(IndexError):
+            _ = result[-3]
+
+    def test_when_input_creates_elements_on_access_then_converted(self, url_path_converter):
+        class GeneratedPaths:
+            def __len__(self):
+                return 2
+
+            def __getitem__(self, idx):
+                if idx >= 2:
+                    raise IndexError
+                # Construct a new str each time, so that only the
+                # converter holds a reference to it.
+                return "".join(["/path", str(idx)])
+
+        result = utils.PathBatchResult()
+
+        url_path_converter.pathToUrl(GeneratedPaths(), result, PathType.kPOSIX)
+
+        assert list(result) == ["file:///path0", "file:///path1"]
+
+    @staticmethod
+    def assert_matches_single_element_conversion(inputs, result, convert):
+        assert len(result) == len(inputs)
+        errors = result.errors()
+
+        for idx, value in enumerate(inputs):
+            try:
+                expected = convert(value)
+            except InputValidationException as exc:
+                assert result[idx] == ""
+                assert errors[idx] == BatchElementError(
+                    BatchElementError.ErrorCode.kUnknown, str(exc)
+                )
+            else:
+                assert result[idx] == expected
+                assert idx not in errors
+
+
 def exc_to_regex(exc):
     return re.escape(str(exc))
 
@@ -1,5 +1,5 @@
 #
-#   Copyright 2023 The Foundry Visionmongers Ltd
+#   Copyright 2023-2025 The Foundry Visionmongers Ltd
 #
 #   Licensed under the Apache License, Version 2.0 (the "License");
 #   you may not use this file except in compliance with the License.
@@ -71,3 +71,93 @@ class Test_substitute:
         assert utils.substitute("hello {name:04d}", {"name": 1}) == "hello 0001"
         assert utils.substitute("hello {name:04d}", {"name": 123}) == "hello 0123"
         assert utils.substitute("hello {name:04d}", {"name": 12345}) == "hello 12345"
+
+
+class Test_CompiledTemplate_init:
+    def test_when_malformed_input_then_raises_InputValidationException(self):
+        expected_error = re.escape(
+            "substitute(): failed to process the input string 'hello {name': missing '}' in"
+            " format string"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledTemplate("hello {name")
+
+    @pytest.mark.parametrize("input_str", ["hello {}", "hello {0}", "hello {name:{width}}"])
+    def test_when_unnamed_or_nested_placeholder_then_raises_InputValidationException(
+        self, input_str
+    ):
+        expected_error = re.escape(
+            f"substitute(): failed to process the input string '{input_str}': automatic,"
+            " numeric and nested placeholders are not supported"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledTemplate(input_str)
+
+
+class Test_CompiledTemplate_input:
+    def test_returns_input_string(self):
+        assert utils.CompiledTemplate("hello {name}").input() == "hello {name}"
+
+
+class Test_CompiledTemplate_placeholders:
+    def test_returns_unique_names_in_order_of_first_appearance(self):
+        template = utils.CompiledTemplate("{b}/{a}/{b:03d}/{{c}}")
+
+        assert template.placeholders() == ["b", "a"]
+
+
+class Test_CompiledTemplate_substitute:
+    def test_when_substitutions_available_then_returns_same_as_substitute(self):
+        input_str = "{{{name}}}/{version:03d}/{name}.{ext} {flag} {scale}"
+        substitutions = {
+            "name": "world",
+            "version": 7,
+            "ext": "exr",
+            "flag": True,
+            "scale": 1.5,
+            "extra": "ignored",
+        }
+
+        assert utils.CompiledTemplate(input_str).substitute(substitutions) == utils.substitute(
+            input_str, substitutions
+        )
+
+    def test_when_missing_substitution_variable_then_raises_InputValidationException(self):
+        expected_error = re.escape(
+            "substitute(): failed to process the input string 'hello {name}': argument not found"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledTemplate("hello {name}").substitute({})
+
+    def test_when_positional_values_then_substitutes_in_slot_order(self):
+        template = utils.CompiledTemplate("{b}/{a}/{b:03d}")
+
+        assert template.substitute([1, "x"]) == "1/x/001"
+
+    def test_when_wrong_number_of_positional_values_then_raises_InputValidationException(self):
+        expected_error = re.escape(
+            "substitute(): failed to process the input string '{b}/{a}': expected 2 positional"
+            " values, got 1"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledTemplate("{b}/{a}").substitute([1])
+
+    def test_when_batch_of_substitutions_then_returns_list_in_same_order(self):
+        template = utils.CompiledTemplate("{name}.{frame:04d}.exr")
+
+        assert template.substitute(
+            [{"name": "a", "frame": 1}, {"name": "b", "frame": 2}, {"name": "c", "frame": 3}]
+        ) == ["a.0001.exr", "b.0002.exr", "c.0003.exr"]
+
+    def test_when_batch_element_fails_then_raises_InputValidationException_with_index(self):
+        expected_error = re.escape(
+            "substitute(): failed to process the input string '{name}': argument not found"
+            " (substitutions at index 1)"
+        )
+
+        with pytest.raises(errors.InputValidationException, match=expected_error):
+            utils.CompiledTemplate("{name}").substitute([{"name": "a"}, {}])